@@ -412,6 +412,15 @@ namespace AZ
         return nullptr;
     }
 
+    int32_t TaskExecutor::GetCurrentWorkerIndex()
+    {
+        if (Internal::TaskWorker* worker = GetTaskWorker(); worker)
+        {
+            return static_cast<int32_t>(worker - m_workers);
+        }
+        return -1;
+    }
+
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
     {
 
@@ -136,6 +136,13 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        // Returns the number of worker threads owned by this executor
+        uint32_t GetThreadCount() const { return m_threadCount; }
+
+        // Returns the index of the worker thread that is calling this, in the range [0, GetThreadCount()), or -1 when
+        // called from a thread that isn't owned by this executor
+        int32_t GetCurrentWorkerIndex();
+
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
     private:
@@ -142,14 +142,17 @@ namespace AZ
             m_compiledTaskGraph->m_tasks[i].Init();
         }
 
-        eventTracker.WriteEventInfo(m_compiledTaskGraph, Internal::CTGEvent::Submitted, "SubmitOnExecutor");
-        executor.Submit(*m_compiledTaskGraph, waitEvent);
-
+        // Mark a retained graph as in flight before handing it to the executor, as the last task can finish
+        // (and clear the flag again) before Submit returns
         if (m_retained)
         {
             m_submitted = true;
         }
-        else
+
+        eventTracker.WriteEventInfo(m_compiledTaskGraph, Internal::CTGEvent::Submitted, "SubmitOnExecutor");
+        executor.Submit(*m_compiledTaskGraph, waitEvent);
+
+        if (!m_retained)
         {
             m_compiledTaskGraph = nullptr;
             Reset();
@@ -140,6 +140,7 @@ namespace AzPhysics
         virtual bool QueryScene(SceneHandle sceneHandle, const SceneQueryRequest* request, SceneQueryHits& result) = 0;
 
         //! Make many blocking queries into the scene.
+        //! Requests may be split across task worker threads, so the filter callbacks of the requests must be thread safe.
         //! @param sceneHandle A handle to the scene to make the scene query with.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
@@ -150,6 +151,7 @@ namespace AzPhysics
         //! @param requestId A user defined value to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when the request is complete.
+        //!     The callback is invoked on a task worker thread, not on the thread that made the request.
         //! @return Returns If the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsync(SceneHandle sceneHandle, SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequest* request, SceneQuery::AsyncCallback callback) = 0;
@@ -159,6 +161,7 @@ namespace AzPhysics
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when all the request are complete.
+        //!     The callback is invoked on a task worker thread, not on the thread that made the request.
         //! @return Returns If the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsyncBatch(SceneHandle sceneHandle, SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequests& requests, SceneQuery::AsyncBatchCallback callback) = 0;
@@ -358,6 +361,7 @@ namespace AzPhysics
         virtual bool QueryScene(const SceneQueryRequest* request, SceneQueryHits& result) = 0;
 
         //! Make many blocking queries into the scene.
+        //! Requests may be split across task worker threads, so the filter callbacks of the requests must be thread safe.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(const SceneQueryRequests& requests) = 0;
@@ -366,6 +370,7 @@ namespace AzPhysics
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when the request is complete.
+        //!     The callback is invoked on a task worker thread, not on the thread that made the request.
         //! @return Returns if the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsync(SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequest* request, SceneQuery::AsyncCallback callback) = 0;
@@ -374,6 +379,7 @@ namespace AzPhysics
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when all the request are complete.
+        //!     The callback is invoked on a task worker thread, not on the thread that made the request.
         //! @return Returns If the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsyncBatch(SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequests& requests, SceneQuery::AsyncBatchCallback callback) = 0;
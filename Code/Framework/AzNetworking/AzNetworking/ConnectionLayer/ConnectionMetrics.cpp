@@ -16,6 +16,11 @@ namespace AzNetworking
 {
     AZ_CVAR(float, net_rttIncreaseOnPacketLoss, 1.2f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scalar amount to increase round trip time estimates by on packet loss");
     AZ_CVAR(AZ::TimeMs, net_maxPacketTrackTimeMs, AZ::TimeMs{2000}, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum time to track any particular packetid before giving up");
+    AZ_CVAR(float, net_congestionInitialSendRate, 64.0f * 1024.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Initial estimate of the sustainable send rate for a connection in bytes per second");
+    AZ_CVAR(float, net_congestionMinSendRate, 8.0f * 1024.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Lower bound on the sustainable send rate estimate for a connection in bytes per second");
+    AZ_CVAR(float, net_congestionMaxSendRate, 1024.0f * 1024.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Upper bound on the sustainable send rate estimate for a connection in bytes per second");
+    AZ_CVAR(float, net_congestionAdditiveIncrease, 256.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Bytes per second added to the send rate estimate for each acknowledged packet");
+    AZ_CVAR(float, net_congestionBackoffScalar, 0.7f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scalar applied to the send rate estimate when packet loss is detected, at most once per round trip");
 
     void DatarateMetrics::LogPacket(uint32_t byteCount, AZ::TimeMs currentTimeMs)
     {
@@ -112,4 +117,29 @@ namespace AzNetworking
             }
         }
     }
+
+    ConnectionCongestionControl::ConnectionCongestionControl()
+        : m_sendRateBytesPerSecond(net_congestionInitialSendRate)
+    {
+        ;
+    }
+
+    void ConnectionCongestionControl::LogPacketAcked()
+    {
+        m_sendRateBytesPerSecond = AZStd::min<float>(m_sendRateBytesPerSecond + net_congestionAdditiveIncrease, net_congestionMaxSendRate);
+    }
+
+    void ConnectionCongestionControl::LogPacketLost(AZ::TimeMs currentTimeMs, float roundTripTimeSeconds)
+    {
+        // Losses within a round trip of the last backoff were most likely caused by the same congestion event
+        if ((m_backoffCount > 0) && (currentTimeMs - m_lastBackoffTimeMs < AZ::SecondsToTimeMs(roundTripTimeSeconds)))
+        {
+            return;
+        }
+
+        m_sendRateBytesPerSecond = AZStd::max<float>(m_sendRateBytesPerSecond * net_congestionBackoffScalar, net_congestionMinSendRate);
+        m_lastBackoffTimeMs = currentTimeMs;
+        ++m_backoffCount;
+        AZLOG(NET_Congestion, "Packet loss detected, reducing send rate estimate to %f bytes per second", m_sendRateBytesPerSecond);
+    }
 }
@@ -116,6 +116,41 @@ namespace AzNetworking
         ConnectionPacketEntry m_entries[MaxTrackableEntries];
     };
 
+    //! @class ConnectionCongestionControl
+    //! @brief additive increase, multiplicative decrease estimate of the send rate a connection can sustain.
+    //!
+    //! Every acknowledged packet grows the estimate by a fixed number of bytes per second, while packet loss scales it
+    //! down by a constant factor, at most once per round trip so that a single burst of loss is only penalized once.
+    //! Higher layers may use the estimate to budget how much data they send each tick.
+    class ConnectionCongestionControl
+    {
+    public:
+
+        ConnectionCongestionControl();
+
+        //! Invoked whenever traffic is acknowledged from the connection this instance is responsible for.
+        void LogPacketAcked();
+
+        //! Invoked whenever traffic sent through the connection this instance is responsible for is lost.
+        //! @param currentTimeMs        current process time in milliseconds
+        //! @param roundTripTimeSeconds current round trip time estimate for the connection in seconds
+        void LogPacketLost(AZ::TimeMs currentTimeMs, float roundTripTimeSeconds);
+
+        //! Retrieve the current estimate of the sustainable send rate for this connection.
+        //! @return estimated sustainable send rate in bytes per second
+        float GetSendRateBytesPerSecond() const;
+
+        //! Retrieve the number of times the send rate estimate has been reduced due to loss.
+        //! @return the number of times the send rate estimate has been reduced due to loss
+        uint32_t GetBackoffCount() const;
+
+    private:
+
+        float m_sendRateBytesPerSecond = 0.0f;
+        AZ::TimeMs m_lastBackoffTimeMs = AZ::Time::ZeroTimeMs;
+        uint32_t m_backoffCount = 0;
+    };
+
     //! @struct ConnectionMetrics
     //! @brief used to track general performance metrics for a given connection with respect to time.
     struct ConnectionMetrics
@@ -139,6 +174,7 @@ namespace AzNetworking
         DatarateMetrics      m_sendDatarate;
         DatarateMetrics      m_recvDatarate;
         ConnectionComputeRtt m_connectionRtt;
+        ConnectionCongestionControl m_congestionControl;
     };
 }
 
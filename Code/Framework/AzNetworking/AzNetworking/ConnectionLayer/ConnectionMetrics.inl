@@ -36,6 +36,16 @@ namespace AzNetworking
         return m_roundTripTime;
     }
 
+    inline float ConnectionCongestionControl::GetSendRateBytesPerSecond() const
+    {
+        return m_sendRateBytesPerSecond;
+    }
+
+    inline uint32_t ConnectionCongestionControl::GetBackoffCount() const
+    {
+        return m_backoffCount;
+    }
+
     inline void ConnectionMetrics::Reset()
     {
         *this = ConnectionMetrics();
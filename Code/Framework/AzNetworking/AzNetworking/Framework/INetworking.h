@@ -91,6 +91,20 @@ namespace AzNetworking
         //! @return the total time spent updating our UdpReaderThread
         virtual AZ::TimeMs GetUdpReaderThreadUpdateTime() const = 0;
 
+        //! Returns the number of UdpReaderThreads servicing Udp sockets.
+        //! @return the number of UdpReaderThreads servicing Udp sockets
+        virtual uint32_t GetUdpReaderThreadCount() const = 0;
+
+        //! Returns the number of packets the given UdpReaderThread handed off for processing during the last system tick.
+        //! @param readerIndex index of the UdpReaderThread to query, must be less than GetUdpReaderThreadCount()
+        //! @return the number of packets the given UdpReaderThread handed off for processing during the last system tick
+        virtual uint32_t GetUdpReaderThreadQueueDepth(uint32_t readerIndex) const = 0;
+
+        //! Returns the largest number of packets the given UdpReaderThread has handed off for processing in a single system tick.
+        //! @param readerIndex index of the UdpReaderThread to query, must be less than GetUdpReaderThreadCount()
+        //! @return the largest number of packets the given UdpReaderThread has handed off for processing in a single system tick
+        virtual uint32_t GetUdpReaderThreadMaxQueueDepth(uint32_t readerIndex) const = 0;
+
         //! Forcibly swaps reader thread buffers and updates all Network Interfaces
         //! CAUTION: For use when SystemTickBus is suspended or similar
         virtual void ForceUpdate() = 0;
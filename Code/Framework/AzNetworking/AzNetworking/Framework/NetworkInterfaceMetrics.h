@@ -46,5 +46,9 @@ namespace AzNetworking
         uint64_t m_recvBytesUncompressed = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
+        //! Returns the total number of heap allocations made for packet buffers and the reliable and fragment queues holding them on this network interface.
+        uint64_t m_packetBufferAllocations = 0;
+        //! Returns the total number of packet buffers acquired from this network interface's packet buffer pool.
+        uint64_t m_packetBufferAcquires = 0;
     };
 }
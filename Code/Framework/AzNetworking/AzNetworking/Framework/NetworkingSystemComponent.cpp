@@ -18,6 +18,7 @@
 namespace AzNetworking
 {
     AZ_CVAR(bool, net_validateSerializedTypes, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Validate that all serialized types are correct");
+    AZ_CVAR(uint32_t, net_UdpReaderThreadCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of threads used to read Udp sockets, must be set prior to networking initialization");
 
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -46,7 +47,7 @@ namespace AzNetworking
 
         m_listenThread = AZStd::make_unique<TcpListenThread>();
         m_heartbeatThread = AZStd::make_unique<UdpHeartbeatThread>();
-        m_readerThread = AZStd::make_unique<UdpReaderThread>();
+        m_readerThreadPool = AZStd::make_unique<UdpReaderThreadPool>(net_UdpReaderThreadCount);
     }
 
     NetworkingSystemComponent::~NetworkingSystemComponent()
@@ -56,7 +57,7 @@ namespace AzNetworking
 
         m_compressorFactories.clear();
 
-        m_readerThread = nullptr;
+        m_readerThreadPool = nullptr;
         m_heartbeatThread = nullptr;
         m_listenThread = nullptr;
 
@@ -77,7 +78,7 @@ namespace AzNetworking
 
     void NetworkingSystemComponent::OnSystemTick()
     {
-        m_readerThread->SwapBuffers();
+        m_readerThreadPool->SwapBuffers();
         for (auto& networkInterface : m_networkInterfaces)
         {
             networkInterface.second->Update();
@@ -95,7 +96,7 @@ namespace AzNetworking
             result = AZStd::make_unique<TcpNetworkInterface>(name, listener, trustZone, *m_listenThread);
             break;
         case ProtocolType::Udp:
-            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, *m_readerThread, *m_heartbeatThread);
+            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, *m_readerThreadPool, *m_heartbeatThread);
             break;
         }
         INetworkInterface* returnResult = result.get();
@@ -163,12 +164,27 @@ namespace AzNetworking
 
     uint32_t NetworkingSystemComponent::GetUdpReaderThreadSocketCount() const
     {
-        return m_readerThread->GetSocketCount();
+        return m_readerThreadPool->GetSocketCount();
     }
 
     AZ::TimeMs NetworkingSystemComponent::GetUdpReaderThreadUpdateTime() const
     {
-        return m_readerThread->GetUpdateTimeMs();
+        return m_readerThreadPool->GetUpdateTimeMs();
+    }
+
+    uint32_t NetworkingSystemComponent::GetUdpReaderThreadCount() const
+    {
+        return m_readerThreadPool->GetReaderThreadCount();
+    }
+
+    uint32_t NetworkingSystemComponent::GetUdpReaderThreadQueueDepth(uint32_t readerIndex) const
+    {
+        return m_readerThreadPool->GetReaderThread(readerIndex).GetQueueDepth();
+    }
+
+    uint32_t NetworkingSystemComponent::GetUdpReaderThreadMaxQueueDepth(uint32_t readerIndex) const
+    {
+        return m_readerThreadPool->GetReaderThread(readerIndex).GetMaxQueueDepth();
     }
 
     void NetworkingSystemComponent::ForceUpdate()
@@ -182,6 +198,11 @@ namespace AzNetworking
         AZLOG_INFO("Total time spent updating TcpListenThread: %lld", aznumeric_cast<AZ::s64>(GetTcpListenThreadUpdateTime()));
         AZLOG_INFO("Total sockets monitored by UdpReaderThread: %u", GetUdpReaderThreadSocketCount());
         AZLOG_INFO("Total time spent updating UdpReaderThread: %lld", aznumeric_cast<AZ::s64>(GetUdpReaderThreadUpdateTime()));
+        for (uint32_t readerIndex = 0; readerIndex < GetUdpReaderThreadCount(); ++readerIndex)
+        {
+            AZLOG_INFO("UdpReaderThread %u queue depth: %u (max %u)", readerIndex,
+                GetUdpReaderThreadQueueDepth(readerIndex), GetUdpReaderThreadMaxQueueDepth(readerIndex));
+        }
 
         for (auto& networkInterface : m_networkInterfaces)
         {
@@ -205,6 +226,10 @@ namespace AzNetworking
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
             AZLOG_INFO(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
+            AZLOG_INFO(" - Total packet buffer allocations: %llu", aznumeric_cast<AZ::u64>(metrics.m_packetBufferAllocations));
+            AZLOG_INFO(" - Total packet buffers acquired from pool: %llu", aznumeric_cast<AZ::u64>(metrics.m_packetBufferAcquires));
+            const uint64_t totalPackets = metrics.m_sendPackets + metrics.m_recvPackets;
+            AZLOG_INFO(" - Packet buffer allocations per packet: %.4f", (totalPackets > 0) ? aznumeric_cast<double>(metrics.m_packetBufferAllocations) / aznumeric_cast<double>(totalPackets) : 0.0);
         }
     }
 }
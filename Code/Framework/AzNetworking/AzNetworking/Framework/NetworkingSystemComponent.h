@@ -14,7 +14,7 @@
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
 #include <AzNetworking/UdpTransport/UdpHeartbeatThread.h>
-#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpReaderThreadPool.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/IConsole.h>
@@ -64,6 +64,9 @@ namespace AzNetworking
         AZ::TimeMs GetTcpListenThreadUpdateTime() const override;
         uint32_t GetUdpReaderThreadSocketCount() const override;
         AZ::TimeMs GetUdpReaderThreadUpdateTime() const override;
+        uint32_t GetUdpReaderThreadCount() const override;
+        uint32_t GetUdpReaderThreadQueueDepth(uint32_t readerIndex) const override;
+        uint32_t GetUdpReaderThreadMaxQueueDepth(uint32_t readerIndex) const override;
         void ForceUpdate() override;
         //! @}
 
@@ -78,7 +81,7 @@ namespace AzNetworking
 
         NetworkInterfaces m_networkInterfaces;
         AZStd::unique_ptr<TcpListenThread> m_listenThread;
-        AZStd::unique_ptr<UdpReaderThread> m_readerThread;
+        AZStd::unique_ptr<UdpReaderThreadPool> m_readerThreadPool;
         AZStd::unique_ptr<UdpHeartbeatThread> m_heartbeatThread;
 
         using CompressionFactories = AZStd::unordered_map<AZ::Crc32, AZStd::unique_ptr<ICompressorFactory>>;
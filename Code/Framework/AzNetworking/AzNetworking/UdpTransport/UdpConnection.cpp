@@ -48,6 +48,8 @@ namespace AzNetworking
     UdpConnection::UdpConnection(ConnectionId connectionId, const IpAddress& remoteAddress, UdpNetworkInterface& networkInterface, ConnectionRole connectionRole)
         : IConnection(connectionId, remoteAddress)
         , m_networkInterface(networkInterface)
+        , m_reliableQueue(networkInterface.GetPacketBufferPool())
+        , m_fragmentQueue(networkInterface.GetPacketBufferPool())
         , m_lastSentPacketMs(AZ::GetElapsedTimeMs())
         , m_connectionRole(connectionRole)
     {
@@ -157,6 +159,7 @@ namespace AzNetworking
     void UdpConnection::ProcessAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
     {
         GetMetrics().LogPacketAcked();
+        GetMetrics().m_congestionControl.LogPacketAcked();
         m_reliableQueue.OnPacketAcked(m_networkInterface, *this, packetId);
 
         // Compute Rtt adjustments
@@ -166,8 +169,7 @@ namespace AzNetworking
         }
     }
 
-    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
-        uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
+    void UdpConnection::ProcessSent(PacketId packetId, uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
     {
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
@@ -197,6 +199,7 @@ namespace AzNetworking
 
         case PacketAckState::Nacked:
             GetMetrics().LogPacketLost();
+            GetMetrics().m_congestionControl.LogPacketLost(AZ::GetElapsedTimeMs(), GetMetrics().m_connectionRtt.GetRoundTripTimeSeconds());
             if (reliability == ReliabilityType::Reliable)
             {
                 m_reliableQueue.OnPacketLost(m_networkInterface, *this, packetId);
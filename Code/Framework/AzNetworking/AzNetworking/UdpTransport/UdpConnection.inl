@@ -40,8 +40,8 @@ namespace AzNetworking
         return m_timeoutId;
     }
 
-    inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
+    inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const UdpPacketBufferView& payload)
     {
-        return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packet);
+        return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packetType, payload);
     }
 }
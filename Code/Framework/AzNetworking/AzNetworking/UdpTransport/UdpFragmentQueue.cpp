@@ -8,6 +8,7 @@
 
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
 #include <AzNetworking/UdpTransport/UdpConnection.h>
+#include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
@@ -18,6 +19,13 @@ namespace AzNetworking
 {
     AZ_CVAR(AZ::TimeMs, net_UdpFragmentTimeoutMs, AZ::TimeMs{ 5000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Milliseconds to retain chunks of incomplete unreliable fragmented packets before timing them out");
 
+    UdpFragmentQueue::UdpFragmentQueue(UdpPacketBufferPool& packetBufferPool)
+        : m_packetBufferPool(packetBufferPool)
+        , m_packetFragments(UdpPacketQueueAllocator(packetBufferPool))
+    {
+        ;
+    }
+
     void UdpFragmentQueue::Update()
     {
         m_timeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item)
@@ -45,16 +53,16 @@ namespace AzNetworking
 
     PacketDispatchResult UdpFragmentQueue::ProcessReceivedChunk(UdpConnection* connection, IConnectionListener& connectionListener, UdpPacketHeader& header, ISerializer& serializer)
     {
-        AZStd::unique_ptr<CorePackets::FragmentedPacket> packet = AZStd::make_unique<CorePackets::FragmentedPacket>();
+        CorePackets::FragmentedPacket packet;
 
-        if (!serializer.Serialize(*packet, "Packet"))
+        if (!serializer.Serialize(packet, "Packet"))
         {
             AZLOG(NET_FragmentQueue, "Fragment failed serialization");
             return PacketDispatchResult::Failure;
         }
 
         const bool isReliable = header.GetIsReliable();
-        const SequenceId fragmentSequence = packet->GetFragmentSequence();
+        const SequenceId fragmentSequence = packet.GetFragmentSequence();
 
         if (SequenceMoreRecent(fragmentSequence, m_latestReceivedFragmentSequence))
         {
@@ -79,12 +87,12 @@ namespace AzNetworking
             return PacketDispatchResult::Success;
         }
 
-        const uint32_t chunkCount = packet->GetChunkCount();
-        const uint32_t chunkIndex = packet->GetChunkIndex();
+        const uint32_t chunkCount = packet.GetChunkCount();
+        const uint32_t chunkIndex = packet.GetChunkIndex();
 
         // If this is the first time we've heard about this sequence, resize the vector appropriately
-        const bool isNewPacketFragment = m_packetFragments.find(fragmentSequence) == m_packetFragments.end();
-        PacketFragments& packetFragments = m_packetFragments[fragmentSequence];
+        const auto [fragmentsIter, isNewPacketFragment] = m_packetFragments.try_emplace(fragmentSequence, UdpPacketQueueAllocator(m_packetBufferPool));
+        PacketFragments& packetFragments = fragmentsIter->second;
 
         if (isNewPacketFragment)
         {
@@ -98,12 +106,14 @@ namespace AzNetworking
             return PacketDispatchResult::Failure;
         }
 
-        packetFragments[chunkIndex] = AZStd::move(packet);
+        // Hold the chunk in a pooled buffer rather than keeping the deserialized packet alive on the heap
+        const ChunkBuffer& chunkBuffer = packet.GetChunkBuffer();
+        packetFragments[chunkIndex] = m_packetBufferPool.Acquire(chunkBuffer.GetBuffer(), static_cast<uint32_t>(chunkBuffer.GetSize()));
 
         uint32_t totalPacketSize = 0;
         for (uint32_t index = 0; index < packetFragments.size(); ++index)
         {
-            if (packetFragments[index] == nullptr)
+            if (!packetFragments[index].IsValid())
             {
                 if (!isReliable)
                 {
@@ -114,7 +124,7 @@ namespace AzNetworking
                 return PacketDispatchResult::Success;
             }
 
-            totalPacketSize += static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
+            totalPacketSize += packetFragments[index].GetSize();
         }
 
         // We now mark this sequence as delivered, so if by some chance all the individual chunks get redelivered again we don't double deliver the reconstructed packet
@@ -131,8 +141,8 @@ namespace AzNetworking
         uint8_t* bufferPointer = buffer.GetBuffer();
         for (uint32_t index = 0; index < packetFragments.size(); ++index)
         {
-            const uint32_t chunkSize = static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
-            memcpy(bufferPointer, packetFragments[index]->GetChunkBuffer().GetBuffer(), chunkSize);
+            const uint32_t chunkSize = packetFragments[index].GetSize();
+            memcpy(bufferPointer, packetFragments[index].GetBuffer(), chunkSize);
             bufferPointer += chunkSize;
         }
 
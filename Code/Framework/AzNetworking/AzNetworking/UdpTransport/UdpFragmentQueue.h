@@ -14,6 +14,7 @@
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
 #include <AzNetworking/DataStructures/RingBufferBitset.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzNetworking/UdpTransport/UdpPacketBufferPool.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzCore/std/containers/unordered_map.h>
 
@@ -29,6 +30,9 @@ namespace AzNetworking
     {
 
     public:
+        //! Constructor.
+        //! @param packetBufferPool the pool received chunks are held in, the queue's own allocations are counted against it
+        explicit UdpFragmentQueue(UdpPacketBufferPool& packetBufferPool);
         virtual ~UdpFragmentQueue() = default;
 
         //! Updates the UdpFragmentQueue timeout queue.
@@ -53,8 +57,11 @@ namespace AzNetworking
         TimeoutQueue m_timeoutQueue;
         SequenceGenerator m_sequenceGenerator;
 
-        using PacketFragments = AZStd::vector<AZStd::unique_ptr<CorePackets::FragmentedPacket>>;
-        AZStd::unordered_map<SequenceId, PacketFragments> m_packetFragments;
+        using PacketFragments = AZStd::vector<UdpPacketBufferView, UdpPacketQueueAllocator>; //< Chunk payloads held in pooled buffers until the packet is complete
+        using PacketFragmentsMap = AZStd::unordered_map<SequenceId, PacketFragments, AZStd::hash<SequenceId>, AZStd::equal_to<SequenceId>, UdpPacketQueueAllocator>;
+
+        UdpPacketBufferPool& m_packetBufferPool;
+        PacketFragmentsMap m_packetFragments;
 
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
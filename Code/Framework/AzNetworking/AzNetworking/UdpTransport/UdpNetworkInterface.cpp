@@ -38,6 +38,8 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(uint32_t, net_UdpPacketBufferPoolSize, 256, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of packet buffers each Udp network interface preallocates for reliable resends and fragment reassembly");
+    AZ_CVAR(uint32_t, net_UdpReusePortSocketCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of sockets a listening Udp network interface binds to its port, values above one use SO_REUSEPORT so the kernel distributes clients across reader threads");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -56,12 +58,13 @@ namespace AzNetworking
         outReliability = ((timeoutId & 0x8000000000000000) > 0) ? ReliabilityType::Reliable : ReliabilityType::Unreliable;
     }
 
-    UdpNetworkInterface::UdpNetworkInterface(const AZ::Name& name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThread& readerThread, UdpHeartbeatThread& heartbeatThread)
+    UdpNetworkInterface::UdpNetworkInterface(const AZ::Name& name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThreadPool& readerThreadPool, UdpHeartbeatThread& heartbeatThread)
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
+        , m_packetBufferPool(net_UdpPacketBufferPoolSize)
         , m_socket(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket())
-        , m_readerThread(readerThread)
+        , m_readerThreadPool(readerThreadPool)
         , m_heartbeatThread(heartbeatThread)
         , m_timeoutMs(net_UdpDefaultTimeoutMs)
     {
@@ -73,7 +76,8 @@ namespace AzNetworking
     UdpNetworkInterface::~UdpNetworkInterface()
     {
         m_heartbeatThread.UnregisterNetworkInterface(this);
-        m_readerThread.UnregisterSocket(m_socket.get());
+        CloseReusePortSockets();
+        m_readerThreadPool.UnregisterSocket(m_socket.get());
     }
 
     AZ::Name UdpNetworkInterface::GetName() const
@@ -116,9 +120,19 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
+
+        // An ephemeral port can't be shared, since each additional socket would bind a port of its own
+#if AZ_TRAIT_USE_SOCKET_REUSE_PORT
+        const uint32_t reusePortSocketCount = (m_port != 0) ? static_cast<uint32_t>(net_UdpReusePortSocketCount) : 1;
+#else
+        const uint32_t reusePortSocketCount = 1;
+#endif
+        m_socket->SetReusePort(reusePortSocketCount > 1);
+
         if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
-            m_readerThread.RegisterSocket(m_socket.get());
+            m_readerThreadPool.RegisterSocket(m_socket.get());
+            OpenReusePortSockets(reusePortSocketCount - 1);
             return true;
         }
         else
@@ -140,7 +154,7 @@ namespace AzNetworking
         {
             if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone))
             {
-                m_readerThread.RegisterSocket(m_socket.get());
+                m_readerThreadPool.RegisterSocket(m_socket.get());
             }
             else
             {
@@ -181,23 +195,68 @@ namespace AzNetworking
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
+        const UdpReaderThread::ReceivedPackets* packets = m_readerThreadPool.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
         {
             // Socket is not yet registered with the reader thread and is likely still pending, try again later
             return;
         }
 
-        for (uint32_t i = 0; i < packets->size(); ++i)
+        ProcessReceivedPackets(*packets, startTimeMs);
+        uint32_t recvPackets = m_socket->GetRecvPackets();
+        uint32_t recvBytes = m_socket->GetRecvBytes();
+        for (AZStd::unique_ptr<UdpSocket>& reusePortSocket : m_reusePortSockets)
+        {
+            // Clients are hashed to a fixed socket by the kernel, so packets from a connection are never reordered across sockets
+            if (const UdpReaderThread::ReceivedPackets* reusePortPackets = m_readerThreadPool.GetReceivedPackets(reusePortSocket.get()))
+            {
+                ProcessReceivedPackets(*reusePortPackets, startTimeMs);
+            }
+            recvPackets += reusePortSocket->GetRecvPackets();
+            recvBytes += reusePortSocket->GetRecvBytes();
+        }
+        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+
+        // Time out any stale client connections
+        m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
+
+        // Time out any packets that haven't been acked within our timeout window
+        m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
+
+        // Delete any connections we've disconnected
+        for (RemovedConnection& removedConnection : m_removedConnections)
+        {
+            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
+            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
+        }
+        m_removedConnections.clear();
+
+        // Update metrics
+        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
+        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
+        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
+        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_recvTimeMs += receiveTimeMs;
+        GetMetrics().m_recvPackets = recvPackets;
+        GetMetrics().m_recvBytes = recvBytes;
+        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
+        GetMetrics().m_packetBufferAllocations = m_packetBufferPool.GetAllocationCount();
+        GetMetrics().m_packetBufferAcquires = m_packetBufferPool.GetAcquireCount();
+        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    void UdpNetworkInterface::ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs)
+    {
+        for (uint32_t i = 0; i < packets.size(); ++i)
         {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
             const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
             // Don't exceed our timeslice, even if unprocessed data remains
             if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
             {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
+                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets.size() - i), aznumeric_cast<int32_t>(packets.size()));
+                GetMetrics().m_discardedPackets += packets.size() - i;
                 break;
             }
 
@@ -330,32 +389,6 @@ namespace AzNetworking
                 }
             }
         }
-        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
-
-        // Time out any stale client connections
-        m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
-
-        // Time out any packets that haven't been acked within our timeout window
-        m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
-
-        // Delete any connections we've disconnected
-        for (RemovedConnection& removedConnection : m_removedConnections)
-        {
-            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
-            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
-        }
-        m_removedConnections.clear();
-
-        // Update metrics
-        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
-        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
-        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
-        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
-        GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
-        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
-        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
@@ -396,7 +429,8 @@ namespace AzNetworking
         }
 
         m_port = 0;
-        m_readerThread.UnregisterSocket(m_socket.get());
+        CloseReusePortSockets();
+        m_readerThreadPool.UnregisterSocket(m_socket.get());
         m_allowIncomingConnections = false;
         m_socket->Close();
         return true;
@@ -472,12 +506,56 @@ namespace AzNetworking
 
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
-        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
+        // Reliable payloads are retained by the reliable queue, so serialize them straight into a pooled buffer rather than copying them in after
+        if (reliableSequence != InvalidSequenceId)
+        {
+            UdpPacketBufferView pooledPayload = m_packetBufferPool.Acquire();
+
+            NetworkInputSerializer networkSerializer(pooledPayload.GetWritableBuffer(), pooledPayload.GetCapacity());
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            if (serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            {
+                pooledPayload.SetSize(serializer.GetSize());
+                return SendPayload(connection, packet.GetPacketType(), pooledPayload.GetBuffer(), pooledPayload.GetSize(), pooledPayload, reliableSequence);
+            }
+
+            // The payload doesn't fit in a single pooled buffer, it gets serialized again below and will be fragmented on send
+        }
+
+        // Serialize the payload on its own so that the reliable queue can retain the serialized bytes rather than a clone of the packet
+        UdpPacketEncodingBuffer payloadBuffer;
+        {
+            payloadBuffer.Resize(payloadBuffer.GetCapacity());
+
+            NetworkInputSerializer networkSerializer(payloadBuffer.GetBuffer(), static_cast<uint32_t>(payloadBuffer.GetCapacity()));
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            {
+                AZLOG_ERROR("Packet type %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(packet.GetPacketType()));
+                return InvalidPacketId;
+            }
+
+            payloadBuffer.Resize(serializer.GetSize());
+        }
+
+        return SendPayload(connection, packet.GetPacketType(), payloadBuffer.GetBuffer(), static_cast<uint32_t>(payloadBuffer.GetSize()), UdpPacketBufferView(), reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, PacketType packetType, const UdpPacketBufferView& payload, SequenceId reliableSequence)
+    {
+        return SendPayload(connection, packetType, payload.GetBuffer(), payload.GetSize(), payload, reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::SendPayload(UdpConnection& connection, PacketType packetType, const uint8_t* payloadData, uint32_t payloadSize, const UdpPacketBufferView& pooledPayload, SequenceId reliableSequence)
+    {
+        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packetType), connection.GetRemoteAddress().GetString().c_str());
 
         // The ordering inside this function is incredibly important and fragile
         const IpAddress& address = connection.GetRemoteAddress();
         // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two
-        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        const bool shouldCompress = packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
         if (address.GetAddress(ByteOrder::Host) == 0)
         {
@@ -489,29 +567,35 @@ namespace AzNetworking
         // Check if we need to fragment this packet first
         // We don't ack aggregate packets that get fragmented, so we want to get this chunk out of the way before
         // we start throwing PacketId's and SequenceId's into our other tracking data structures below
-        UdpPacketHeader header(connection.GetPacketTracker(), packet.GetPacketType(), reliableSequence);
+        UdpPacketHeader header(connection.GetPacketTracker(), packetType, reliableSequence);
         const PacketId localPacketId = header.GetPacketId();
 
-        // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
-        // not set up
-        if (reliabilityType == ReliabilityType::Reliable)
+        // Reliable packets hand the reliable queue a reference to the pooled payload, copying it into the pool only on first send
+        auto prepareReliablePayload = [&]()
         {
-            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packet))
+            const UdpPacketBufferView reliablePayload = pooledPayload.IsValid() ? pooledPayload : m_packetBufferPool.Acquire(payloadData, payloadSize);
+            if (!reliablePayload.IsValid() || !connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packetType, reliablePayload))
             {
                 connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
             }
-        }
+        };
 
         // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
         // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
         // Other large packets are simply queued before they are fragmented
-        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType()))
+        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType))
         {
+            // If it's a reliable packet, make sure our reliable queue knows about it now so it gets resent once the connection is set up
+            if (reliabilityType == ReliabilityType::Reliable)
+            {
+                prepareReliablePayload();
+            }
+
             // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             AZLOG(
                 NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
-                (int)packet.GetPacketType());
+                (int)packetType);
             return localPacketId;
         }
 
@@ -534,18 +618,20 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            // The payload was serialized up front, so it is simply appended after the header
+            const uint32_t headerSize = serializer.GetSize();
+            if (!buffer.Resize(headerSize + payloadSize))
             {
                 AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
             }
-
-            buffer.Resize(serializer.GetSize());
+            memcpy(buffer.GetBuffer() + headerSize, payloadData, payloadSize);
         }
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
 
         // If the packet doesn't fit within our MTU (minus potential SSL encryption overhead), break it up
+        // The aggregate packet is never transmitted or acked, so only its fragments are registered with the reliable queue
         if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
         {
             // Each fragmented packet we send adds an extra fragmented packet header, need to deduct that from our chunk size, otherwise we infinitely loop
@@ -573,6 +659,11 @@ namespace AzNetworking
             return localPacketId;
         }
 
+        if (reliabilityType == ReliabilityType::Reliable)
+        {
+            prepareReliablePayload();
+        }
+
         UdpPacketEncodingBuffer writeBuffer;
         if (m_compressor && shouldCompress)
         {
@@ -620,13 +711,13 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(header.GetSequenceWindow())
         );
 
-        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
+        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packetType));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType);
         if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
+            connection.ProcessSent(localPacketId, packetSize + UdpPacketHeaderSize, reliabilityType);
             GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
@@ -638,6 +729,34 @@ namespace AzNetworking
         return InvalidPacketId;
     }
 
+    void UdpNetworkInterface::OpenReusePortSockets(uint32_t socketCount)
+    {
+        for (uint32_t socketIndex = 0; socketIndex < socketCount; ++socketIndex)
+        {
+            // Additional sockets only ever receive, all sends and any encryption context remain on m_socket
+            AZStd::unique_ptr<UdpSocket> reusePortSocket = AZStd::make_unique<UdpSocket>();
+            reusePortSocket->SetReusePort(true);
+            if (!reusePortSocket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                AZLOG_WARN("Failed to open additional port reuse socket on port %u, continuing with %u sockets",
+                    aznumeric_cast<uint32_t>(m_port), aznumeric_cast<uint32_t>(m_reusePortSockets.size() + 1));
+                return;
+            }
+            m_readerThreadPool.RegisterSocket(reusePortSocket.get());
+            m_reusePortSockets.emplace_back(AZStd::move(reusePortSocket));
+        }
+    }
+
+    void UdpNetworkInterface::CloseReusePortSockets()
+    {
+        for (AZStd::unique_ptr<UdpSocket>& reusePortSocket : m_reusePortSockets)
+        {
+            m_readerThreadPool.UnregisterSocket(reusePortSocket.get());
+            reusePortSocket->Close();
+        }
+        m_reusePortSockets.clear();
+    }
+
     void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket)
     {
         if (!m_allowIncomingConnections)
@@ -799,4 +918,9 @@ namespace AzNetworking
     {
         return m_lastSystemTickUpdate.load();
     }
+
+    UdpPacketBufferPool& UdpNetworkInterface::GetPacketBufferPool()
+    {
+        return m_packetBufferPool;
+    }
 }
@@ -11,7 +11,8 @@
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/UdpTransport/UdpConnectionSet.h>
 #include <AzNetworking/UdpTransport/UdpHeartbeatThread.h>
-#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpPacketBufferPool.h>
+#include <AzNetworking/UdpTransport/UdpReaderThreadPool.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
@@ -94,8 +95,8 @@ namespace AzNetworking
         //! @param name               the name of this network interface instance.
         //! @param connectionListener reference to the connection listener responsible for handling all connection events
         //! @param trustZone          the trust level assigned to this network interface, server to server or client to server
-        //! @param readerThread       pointer to the reader thread to be bound to this network interface
-        UdpNetworkInterface(const AZ::Name& name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThread& readerThread, UdpHeartbeatThread& heartbeatThread);
+        //! @param readerThreadPool   reference to the reader thread pool servicing this network interface's sockets
+        UdpNetworkInterface(const AZ::Name& name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThreadPool& readerThreadPool, UdpHeartbeatThread& heartbeatThread);
         ~UdpNetworkInterface() override;
 
         //! INetworkInterface interface.
@@ -122,6 +123,10 @@ namespace AzNetworking
 
         AZStd::atomic<AZ::TimeMs> GetLastSystemTickUpdate() const;
 
+        //! Returns the pool of packet buffers used by this network interface for retaining packet data.
+        //! @return reference to the packet buffer pool owned by this network interface
+        UdpPacketBufferPool& GetPacketBufferPool();
+
     private:
 
         //! Registers a packet with a timeout queue on the provided connection.
@@ -145,10 +150,40 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Sends an already serialized packet payload to the remote connection, used to resend reliable packets.
+        //! @param connection         the UdpConnection instance to send the packet on
+        //! @param packetType         the type of the serialized packet
+        //! @param payload            view of the serialized packet payload, retained by the reliable queue if the packet is reliable
+        //! @param reliableSequence   the reliable sequence number to use for this packet, providing InvalidSequenceId will cause the packet to be sent unreliably
+        //! @return packet id for the transmitted packet
+        PacketId SendPacket(UdpConnection& connection, PacketType packetType, const UdpPacketBufferView& payload, SequenceId reliableSequence);
+
+        //! Internal helper that frames, fragments, compresses and transmits a serialized packet payload.
+        //! @param connection         the UdpConnection instance to send the packet on
+        //! @param packetType         the type of the serialized packet
+        //! @param payloadData        pointer to the serialized packet payload
+        //! @param payloadSize        size of the serialized packet payload in bytes
+        //! @param pooledPayload      pooled view of the payload if one already exists, an invalid view if the payload is not pooled
+        //! @param reliableSequence   the reliable sequence number to use for this packet, providing InvalidSequenceId will cause the packet to be sent unreliably
+        //! @return packet id for the transmitted packet
+        PacketId SendPayload(UdpConnection& connection, PacketType packetType, const uint8_t* payloadData, uint32_t payloadSize, const UdpPacketBufferView& pooledPayload, SequenceId reliableSequence);
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
 
+        //! Internal helper that decodes and dispatches a set of packets received on one of our sockets.
+        //! @param packets     the packets received by the reader thread
+        //! @param startTimeMs the time this update started processing received packets
+        void ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs);
+
+        //! Internal helper that opens additional port reuse sockets on m_port, spreading received traffic across reader threads.
+        //! @param socketCount the number of additional sockets to open
+        void OpenReusePortSockets(uint32_t socketCount);
+
+        //! Internal helper that unregisters and closes all additional port reuse sockets.
+        void CloseReusePortSockets();
+
         //! Internal helper to cleanly remove a connection from the network interface.
         //! @param connection pointer to the connection to disconnect
         //! @param reason     reason for the disconnect
@@ -179,12 +214,14 @@ namespace AzNetworking
         bool m_allowIncomingConnections = false;
         AZ::TimeMs m_timeoutMs = AZ::Time::ZeroTimeMs;
         IConnectionListener& m_connectionListener;
+        UdpPacketBufferPool m_packetBufferPool; // Must outlive m_connectionSet, connections hold views into the pool
         UdpConnectionSet m_connectionSet;
         TimeoutQueue m_connectionTimeoutQueue;
         TimeoutQueue m_packetTimeoutQueue;
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
-        UdpReaderThread& m_readerThread;
+        AZStd::vector<AZStd::unique_ptr<UdpSocket>> m_reusePortSockets; // Additional listen sockets sharing m_port, only used for receiving
+        UdpReaderThreadPool& m_readerThreadPool;
         UdpHeartbeatThread& m_heartbeatThread;
         AZStd::atomic<AZ::TimeMs> m_lastSystemTickUpdate;
 
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpPacketBufferPool.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    UdpPacketBufferPool::UdpPacketBufferPool(uint32_t slabBufferCount)
+        : m_slabBufferCount(AZStd::max<uint32_t>(slabBufferCount, 1))
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        AllocateSlab();
+    }
+
+    UdpPacketBufferPool::~UdpPacketBufferPool()
+    {
+        AZ_Assert(m_freeBuffers.size() == m_slabs.size() * m_slabBufferCount, "UdpPacketBufferPool destroyed while packet buffers are still referenced");
+    }
+
+    UdpPacketBufferView UdpPacketBufferPool::Acquire(const uint8_t* data, uint32_t dataSize)
+    {
+        if (dataSize > UdpPacketEncodingBuffer::GetCapacity())
+        {
+            AZLOG_ERROR("Requested packet buffer of %u bytes exceeds the maximum packet size", dataSize);
+            return UdpPacketBufferView();
+        }
+
+        m_acquireCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+        UdpPooledPacketBuffer* pooledBuffer = nullptr;
+        if (dataSize > MaxUdpTransmissionUnit)
+        {
+            // Oversized payloads bypass the free list entirely
+            pooledBuffer = new UdpPooledPacketBuffer();
+            pooledBuffer->m_oversizedBuffer = AZStd::make_unique<UdpPacketEncodingBuffer>();
+            pooledBuffer->m_data = pooledBuffer->m_oversizedBuffer->GetBuffer();
+            pooledBuffer->m_capacity = aznumeric_cast<uint32_t>(UdpPacketEncodingBuffer::GetCapacity());
+            pooledBuffer->m_pool = this;
+            m_allocationCount.fetch_add(2, AZStd::memory_order_relaxed);
+        }
+        else
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_freeBuffers.empty())
+            {
+                AllocateSlab();
+            }
+            pooledBuffer = m_freeBuffers.back();
+            m_freeBuffers.pop_back();
+        }
+
+        memcpy(pooledBuffer->m_data, data, dataSize);
+        pooledBuffer->m_size = dataSize;
+        return UdpPacketBufferView(pooledBuffer);
+    }
+
+    UdpPacketBufferView UdpPacketBufferPool::Acquire()
+    {
+        m_acquireCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_freeBuffers.empty())
+        {
+            AllocateSlab();
+        }
+        UdpPooledPacketBuffer* pooledBuffer = m_freeBuffers.back();
+        m_freeBuffers.pop_back();
+        return UdpPacketBufferView(pooledBuffer);
+    }
+
+    void UdpPacketBufferPool::AllocateSlab()
+    {
+        AZStd::unique_ptr<UdpPooledPacketBuffer[]> slab = AZStd::make_unique<UdpPooledPacketBuffer[]>(m_slabBufferCount);
+        // Reserve up front so that returning buffers to the free list never reallocates
+        m_freeBuffers.reserve((m_slabs.size() + 1) * m_slabBufferCount);
+        for (uint32_t index = 0; index < m_slabBufferCount; ++index)
+        {
+            UdpPooledPacketBuffer& pooledBuffer = slab[index];
+            pooledBuffer.m_data = pooledBuffer.m_buffer;
+            pooledBuffer.m_capacity = MaxUdpTransmissionUnit;
+            pooledBuffer.m_pool = this;
+            m_freeBuffers.push_back(&pooledBuffer);
+        }
+        m_slabs.emplace_back(AZStd::move(slab));
+        m_allocationCount.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    void UdpPacketBufferPool::Release(UdpPooledPacketBuffer* pooledBuffer)
+    {
+        if (pooledBuffer->m_oversizedBuffer != nullptr)
+        {
+            delete pooledBuffer;
+            return;
+        }
+
+        pooledBuffer->m_size = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_freeBuffers.push_back(pooledBuffer);
+    }
+}
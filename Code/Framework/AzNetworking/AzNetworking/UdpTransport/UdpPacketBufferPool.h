@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    class UdpPacketBufferPool;
+
+    //! @struct UdpPooledPacketBuffer
+    //! @brief A single reference counted buffer owned by a UdpPacketBufferPool.
+    struct UdpPooledPacketBuffer
+    {
+        AZStd::atomic<uint32_t> m_refCount = 0;
+        uint32_t m_size = 0;
+        uint32_t m_capacity = 0;
+        uint8_t* m_data = nullptr;
+        UdpPacketBufferPool* m_pool = nullptr;
+        AZStd::unique_ptr<UdpPacketEncodingBuffer> m_oversizedBuffer; //< Only used by buffers that exceed MaxUdpTransmissionUnit
+        uint8_t m_buffer[MaxUdpTransmissionUnit];
+    };
+
+    //! @class UdpPacketBufferView
+    //! @brief Ref-counted view of a buffer acquired from a UdpPacketBufferPool.
+    //!
+    //! Copying a view shares the underlying buffer rather than copying the bytes. The buffer is returned to its owning
+    //! pool once the last view referencing it is released, so holders like the reliable resend queue and the fragment
+    //! reassembly queue can keep packet data alive without allocating.
+    class UdpPacketBufferView
+    {
+    public:
+
+        UdpPacketBufferView() = default;
+        UdpPacketBufferView(const UdpPacketBufferView& rhs);
+        UdpPacketBufferView(UdpPacketBufferView&& rhs);
+        ~UdpPacketBufferView();
+
+        UdpPacketBufferView& operator=(const UdpPacketBufferView& rhs);
+        UdpPacketBufferView& operator=(UdpPacketBufferView&& rhs);
+
+        //! Returns whether or not this view references a buffer.
+        //! @return boolean true if this view references a buffer, false otherwise
+        bool IsValid() const;
+
+        //! Const raw buffer access.
+        //! @return const pointer to the referenced buffer, nullptr if the view is invalid
+        const uint8_t* GetBuffer() const;
+
+        //! Returns the number of bytes stored in the referenced buffer.
+        //! @return the number of bytes stored in the referenced buffer
+        uint32_t GetSize() const;
+
+        //! Returns the number of views currently referencing the same buffer.
+        //! @return the number of views currently referencing the same buffer
+        uint32_t GetRefCount() const;
+
+        //! Returns the number of bytes that can be written into the referenced buffer.
+        //! @return the number of bytes that can be written into the referenced buffer
+        uint32_t GetCapacity() const;
+
+        //! Non-const raw buffer access, only valid while this is the only view referencing the buffer.
+        //! @return pointer to the referenced buffer, nullptr if the view is invalid
+        uint8_t* GetWritableBuffer();
+
+        //! Sets the number of bytes stored in the referenced buffer, only valid while this is the only view referencing the buffer.
+        //! @param size the number of bytes written to the buffer, must not exceed GetCapacity()
+        void SetSize(uint32_t size);
+
+        //! Releases the reference held by this view, returning the buffer to its pool if this was the last reference.
+        void Reset();
+
+    private:
+
+        explicit UdpPacketBufferView(UdpPooledPacketBuffer* pooledBuffer);
+
+        UdpPooledPacketBuffer* m_pooledBuffer = nullptr;
+
+        friend class UdpPacketBufferPool;
+    };
+
+    //! @class UdpPacketBufferPool
+    //! @brief Preallocated pool of MTU sized packet buffers handed out as ref-counted views.
+    //!
+    //! Buffers are allocated in slabs and recycled through a free list, so once the pool has warmed up acquiring and
+    //! releasing buffers never touches the heap. Buffers larger than MaxUdpTransmissionUnit are rare (they only occur for
+    //! unfragmented payloads queued during the encryption handshake) and fall back to a dedicated heap allocation.
+    class UdpPacketBufferPool
+    {
+    public:
+
+        //! Constructor.
+        //! @param slabBufferCount number of buffers to preallocate, and to allocate each time the pool runs dry
+        UdpPacketBufferPool(uint32_t slabBufferCount);
+        ~UdpPacketBufferPool();
+
+        //! Acquires a buffer from the pool and copies the provided data into it.
+        //! @param data     pointer to the data to copy into the acquired buffer
+        //! @param dataSize the number of bytes to copy
+        //! @return view referencing the acquired buffer, invalid on failure
+        UdpPacketBufferView Acquire(const uint8_t* data, uint32_t dataSize);
+
+        //! Acquires an empty MaxUdpTransmissionUnit sized buffer from the pool, to be written through the returned view.
+        //! @return view referencing the acquired buffer
+        UdpPacketBufferView Acquire();
+
+        //! Returns the number of buffers currently available in the free list.
+        //! @return the number of buffers currently available in the free list
+        uint32_t GetFreeBufferCount() const;
+
+        //! Returns the total number of buffers this pool has preallocated.
+        //! @return the total number of buffers this pool has preallocated
+        uint32_t GetPooledBufferCount() const;
+
+        //! Returns the total number of heap allocations performed by this pool, including the allocations made by containers
+        //! using a UdpPacketQueueAllocator bound to this pool.
+        //! @return the total number of heap allocations performed by this pool
+        uint64_t GetAllocationCount() const;
+
+        //! Returns the total number of buffers acquired from this pool.
+        //! @return the total number of buffers acquired from this pool
+        uint64_t GetAcquireCount() const;
+
+    private:
+
+        //! Allocates a new slab of buffers and pushes them onto the free list, must be called with m_mutex held.
+        void AllocateSlab();
+
+        //! Returns a buffer to the pool once the last view referencing it has been released.
+        //! @param pooledBuffer the buffer to return
+        void Release(UdpPooledPacketBuffer* pooledBuffer);
+
+        AZ_DISABLE_COPY_MOVE(UdpPacketBufferPool);
+
+        const uint32_t m_slabBufferCount;
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<AZStd::unique_ptr<UdpPooledPacketBuffer[]>> m_slabs;
+        AZStd::vector<UdpPooledPacketBuffer*> m_freeBuffers;
+        AZStd::atomic<uint64_t> m_allocationCount = 0;
+        AZStd::atomic<uint64_t> m_acquireCount = 0;
+
+        friend class UdpPacketBufferView;
+        friend class UdpPacketQueueAllocator;
+    };
+
+    //! @class UdpPacketQueueAllocator
+    //! @brief AZStd allocator for the containers that hold on to pooled packet buffers.
+    //!
+    //! Allocations are forwarded to the system allocator and added to the allocation count of the bound pool, so the node
+    //! and bucket allocations of the reliable and fragment queues are reported along with the packet buffer allocations.
+    class UdpPacketQueueAllocator
+    {
+    public:
+
+        using value_type = void;
+        using pointer = void*;
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using align_type = AZStd::size_t;
+        using propagate_on_container_copy_assignment = AZStd::true_type;
+        using propagate_on_container_move_assignment = AZStd::true_type;
+
+        UdpPacketQueueAllocator() = default;
+        explicit UdpPacketQueueAllocator(UdpPacketBufferPool& pool);
+
+        pointer allocate(size_type byteSize, size_type alignment);
+        void deallocate(pointer ptr, size_type byteSize, size_type alignment);
+        pointer reallocate(pointer ptr, size_type newSize, align_type alignment = 1);
+
+        size_type max_size() const;
+        size_type get_allocated_size() const;
+
+    private:
+
+        UdpPacketBufferPool* m_pool = nullptr;
+    };
+
+    //! All queue allocators share the system allocator, so memory allocated by one can be freed by any other.
+    bool operator==(const UdpPacketQueueAllocator& lhs, const UdpPacketQueueAllocator& rhs);
+    bool operator!=(const UdpPacketQueueAllocator& lhs, const UdpPacketQueueAllocator& rhs);
+}
+
+#include <AzNetworking/UdpTransport/UdpPacketBufferPool.inl>
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline UdpPacketBufferView::UdpPacketBufferView(UdpPooledPacketBuffer* pooledBuffer)
+        : m_pooledBuffer(pooledBuffer)
+    {
+        m_pooledBuffer->m_refCount.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    inline UdpPacketBufferView::UdpPacketBufferView(const UdpPacketBufferView& rhs)
+        : m_pooledBuffer(rhs.m_pooledBuffer)
+    {
+        if (m_pooledBuffer != nullptr)
+        {
+            m_pooledBuffer->m_refCount.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+    }
+
+    inline UdpPacketBufferView::UdpPacketBufferView(UdpPacketBufferView&& rhs)
+        : m_pooledBuffer(rhs.m_pooledBuffer)
+    {
+        rhs.m_pooledBuffer = nullptr;
+    }
+
+    inline UdpPacketBufferView::~UdpPacketBufferView()
+    {
+        Reset();
+    }
+
+    inline UdpPacketBufferView& UdpPacketBufferView::operator=(const UdpPacketBufferView& rhs)
+    {
+        if (m_pooledBuffer != rhs.m_pooledBuffer)
+        {
+            Reset();
+            m_pooledBuffer = rhs.m_pooledBuffer;
+            if (m_pooledBuffer != nullptr)
+            {
+                m_pooledBuffer->m_refCount.fetch_add(1, AZStd::memory_order_relaxed);
+            }
+        }
+        return *this;
+    }
+
+    inline UdpPacketBufferView& UdpPacketBufferView::operator=(UdpPacketBufferView&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Reset();
+            m_pooledBuffer = rhs.m_pooledBuffer;
+            rhs.m_pooledBuffer = nullptr;
+        }
+        return *this;
+    }
+
+    inline bool UdpPacketBufferView::IsValid() const
+    {
+        return m_pooledBuffer != nullptr;
+    }
+
+    inline const uint8_t* UdpPacketBufferView::GetBuffer() const
+    {
+        return (m_pooledBuffer != nullptr) ? m_pooledBuffer->m_data : nullptr;
+    }
+
+    inline uint32_t UdpPacketBufferView::GetSize() const
+    {
+        return (m_pooledBuffer != nullptr) ? m_pooledBuffer->m_size : 0;
+    }
+
+    inline uint32_t UdpPacketBufferView::GetRefCount() const
+    {
+        return (m_pooledBuffer != nullptr) ? m_pooledBuffer->m_refCount.load(AZStd::memory_order_relaxed) : 0;
+    }
+
+    inline uint32_t UdpPacketBufferView::GetCapacity() const
+    {
+        return (m_pooledBuffer != nullptr) ? m_pooledBuffer->m_capacity : 0;
+    }
+
+    inline uint8_t* UdpPacketBufferView::GetWritableBuffer()
+    {
+        AZ_Assert(GetRefCount() <= 1, "Writing to a packet buffer that is shared with other views");
+        return (m_pooledBuffer != nullptr) ? m_pooledBuffer->m_data : nullptr;
+    }
+
+    inline void UdpPacketBufferView::SetSize(uint32_t size)
+    {
+        AZ_Assert(GetRefCount() == 1, "Resizing a packet buffer that is shared with other views or invalid");
+        AZ_Assert(size <= m_pooledBuffer->m_capacity, "Packet buffer size %u exceeds its capacity %u", size, m_pooledBuffer->m_capacity);
+        m_pooledBuffer->m_size = size;
+    }
+
+    inline void UdpPacketBufferView::Reset()
+    {
+        if (m_pooledBuffer != nullptr)
+        {
+            if (m_pooledBuffer->m_refCount.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+            {
+                m_pooledBuffer->m_pool->Release(m_pooledBuffer);
+            }
+            m_pooledBuffer = nullptr;
+        }
+    }
+
+    inline uint32_t UdpPacketBufferPool::GetFreeBufferCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_freeBuffers.size());
+    }
+
+    inline uint32_t UdpPacketBufferPool::GetPooledBufferCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_slabs.size()) * m_slabBufferCount;
+    }
+
+    inline uint64_t UdpPacketBufferPool::GetAllocationCount() const
+    {
+        return m_allocationCount.load(AZStd::memory_order_relaxed);
+    }
+
+    inline uint64_t UdpPacketBufferPool::GetAcquireCount() const
+    {
+        return m_acquireCount.load(AZStd::memory_order_relaxed);
+    }
+
+    inline UdpPacketQueueAllocator::UdpPacketQueueAllocator(UdpPacketBufferPool& pool)
+        : m_pool(&pool)
+    {
+        ;
+    }
+
+    inline UdpPacketQueueAllocator::pointer UdpPacketQueueAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        if (m_pool != nullptr)
+        {
+            m_pool->m_allocationCount.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+        return AZStd::allocator().allocate(byteSize, alignment);
+    }
+
+    inline void UdpPacketQueueAllocator::deallocate(pointer ptr, size_type byteSize, size_type alignment)
+    {
+        AZStd::allocator().deallocate(ptr, byteSize, alignment);
+    }
+
+    inline UdpPacketQueueAllocator::pointer UdpPacketQueueAllocator::reallocate(pointer ptr, size_type newSize, align_type alignment)
+    {
+        if (m_pool != nullptr)
+        {
+            m_pool->m_allocationCount.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+        return AZStd::allocator().reallocate(ptr, newSize, alignment);
+    }
+
+    inline UdpPacketQueueAllocator::size_type UdpPacketQueueAllocator::max_size() const
+    {
+        return AZStd::allocator().max_size();
+    }
+
+    inline UdpPacketQueueAllocator::size_type UdpPacketQueueAllocator::get_allocated_size() const
+    {
+        return 0;
+    }
+
+    inline bool operator==(const UdpPacketQueueAllocator&, const UdpPacketQueueAllocator&)
+    {
+        return true;
+    }
+
+    inline bool operator!=(const UdpPacketQueueAllocator&, const UdpPacketQueueAllocator&)
+    {
+        return false;
+    }
+}
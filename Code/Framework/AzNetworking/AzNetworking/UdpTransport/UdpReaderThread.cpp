@@ -9,25 +9,49 @@
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+#   include <sys/epoll.h>
+#endif
+
 namespace AzNetworking
 {
     static constexpr AZ::TimeMs ReaderThreadUpdateRateMs{ 10 };
 
     AZ_CVAR(AZ::TimeMs, net_UdpMaxReadTimeMs, ReaderThreadUpdateRateMs, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The amount of time to allow the reader thread to read data off registered sockets");
 
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+    static constexpr int32_t MaxEpollEvents = 64;
+#endif
+
     UdpReaderThread::UdpReaderThread()
         : TimedThread("UdpReaderThread", ReaderThreadUpdateRateMs)
     {
-        ;
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        m_epollFd = SocketFd(epoll_create1(EPOLL_CLOEXEC));
+        if (m_epollFd == InvalidSocketFd)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("Failed to create UdpReaderThread epoll instance, falling back to polling (%d:%s)", error, GetNetworkErrorDesc(error));
+        }
+#endif
     }
 
     UdpReaderThread::~UdpReaderThread()
     {
         Stop();
         Join();
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        if (m_epollFd != InvalidSocketFd)
+        {
+            close(int32_t(m_epollFd));
+            m_epollFd = InvalidSocketFd;
+        }
+#endif
     }
 
     bool UdpReaderThread::RegisterSocket(UdpSocket* socket)
@@ -50,6 +74,18 @@ namespace AzNetworking
         // We need to null out the socket immediately in both the front and back
         // buffers so that the reader thread doesn't try and use a deleted socket
         AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        if ((m_epollFd != InvalidSocketFd) && socket->IsOpen())
+        {
+            // Failure is expected for sockets still pending addition, those were never added to the epoll set
+            epoll_ctl(int32_t(m_epollFd), EPOLL_CTL_DEL, int32_t(socket->GetSocketFd()), nullptr);
+        }
+#endif
+
+        // Sockets that were never swapped in only need to be dropped from the pending list
+        m_pendingAdds.erase(AZStd::remove(m_pendingAdds.begin(), m_pendingAdds.end(), socket), m_pendingAdds.end());
+
         {
             const int32_t frontIndex = 1 - m_backIndex;
             ReaderBuffer& front = m_readerBuffers[frontIndex];
@@ -106,12 +142,30 @@ namespace AzNetworking
             {
                 front.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
                 back.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+                if (m_epollFd != InvalidSocketFd)
+                {
+                    epoll_event event = {};
+                    event.events = EPOLLIN;
+                    event.data.fd = int32_t(socket->GetSocketFd());
+                    if (epoll_ctl(int32_t(m_epollFd), EPOLL_CTL_ADD, event.data.fd, &event) != 0)
+                    {
+                        const int32_t error = GetLastNetworkError();
+                        AZLOG_ERROR("Failed to add socket to UdpReaderThread epoll set (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                }
+#endif
             }
             m_pendingAdds.clear();
-            AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
-            AZStd::remove_if(back.m_entries.begin(), back.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
+            front.m_entries.erase(AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; }), front.m_entries.end());
+            back.m_entries.erase(AZStd::remove_if(back.m_entries.begin(), back.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; }), back.m_entries.end());
             m_backIndex = 1 - m_backIndex;
             m_readerBuffers[m_backIndex].m_receiveBuffer.Resize(0);
+
+            m_queueDepth = m_backPacketCount;
+            m_maxQueueDepth = AZStd::max(m_maxQueueDepth, m_queueDepth);
+            m_backPacketCount = 0;
         }
     }
 
@@ -127,6 +181,16 @@ namespace AzNetworking
         return m_updateTimeMs;
     }
 
+    uint32_t UdpReaderThread::GetQueueDepth() const
+    {
+        return m_queueDepth;
+    }
+
+    uint32_t UdpReaderThread::GetMaxQueueDepth() const
+    {
+        return m_maxQueueDepth;
+    }
+
     bool UdpReaderThread::SocketExists(UdpSocket* socket) const
     {
         const int32_t frontIndex = 1 - m_backIndex;
@@ -153,57 +217,118 @@ namespace AzNetworking
 
     void UdpReaderThread::OnUpdate(AZ::TimeMs updateRateMs)
     {
-        AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
-        ReaderBuffer& back = m_readerBuffers[m_backIndex];
-        ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer = back.m_receiveBuffer;
-        for (auto& socketEntry : back.m_entries)
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        if (m_epollFd != InvalidSocketFd)
         {
-            UdpSocket* socket = socketEntry.m_socket;
-            if (socket == nullptr)
-            {
-                continue;
-            }
-
-            ReceivedPackets& receivedPackets = socketEntry.m_receivedPackets;
-            for (;;)
+            // Block on readiness for the whole update interval so datagrams are drained as they arrive rather than piling up
+            // in the kernel while this thread sleeps, the lock is only held while reading so SwapBuffers is never stalled
+            epoll_event events[MaxEpollEvents];
+            AZ::TimeMs elapsedTimeMs = AZ::Time::ZeroTimeMs;
+            while (elapsedTimeMs < updateRateMs)
             {
-                AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
-                if (elapsedTimeMs > updateRateMs)
+                const int32_t eventCount = epoll_wait(int32_t(m_epollFd), events, MaxEpollEvents, aznumeric_cast<int32_t>(updateRateMs - elapsedTimeMs));
+                if (eventCount < 0)
                 {
-                    AZLOG_INFO("ReceivePackets bled %d ms", aznumeric_cast<int32_t>(elapsedTimeMs - updateRateMs));
-                    break;
+                    const int32_t error = GetLastNetworkError();
+                    if (error != EINTR)
+                    {
+                        AZLOG_ERROR("UdpReaderThread epoll_wait failed (%d:%s)", error, GetNetworkErrorDesc(error));
+                        break;
+                    }
                 }
 
-                IpAddress address;
-                const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                bool drained = true;
+                const AZ::TimeMs readStartTimeMs = AZ::GetElapsedTimeMs();
                 {
-                    AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
-                        aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
-                    break;
+                    AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
+                    ReaderBuffer& back = m_readerBuffers[m_backIndex];
+                    for (int32_t eventIndex = 0; (eventIndex < eventCount) && drained; ++eventIndex)
+                    {
+                        const SocketFd readyFd = SocketFd(events[eventIndex].data.fd);
+                        for (auto& socketEntry : back.m_entries)
+                        {
+                            if ((socketEntry.m_socket != nullptr) && (socketEntry.m_socket->GetSocketFd() == readyFd))
+                            {
+                                drained = ReadSocket(socketEntry, back, readStartTimeMs, updateRateMs);
+                                break;
+                            }
+                        }
+                    }
                 }
+                m_updateTimeMs += AZ::GetElapsedTimeMs() - readStartTimeMs;
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
-
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
-                {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
-                }
-                else
+                if (!drained)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // Out of buffer space, sockets remain readable so waiting again would spin until the next swap
                     break;
                 }
+                elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
             }
+            return;
+        }
+#endif
+
+        AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
+        ReaderBuffer& back = m_readerBuffers[m_backIndex];
+        for (auto& socketEntry : back.m_entries)
+        {
+            if (socketEntry.m_socket == nullptr)
+            {
+                continue;
+            }
+            ReadSocket(socketEntry, back, startTimeMs, updateRateMs);
         }
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    bool UdpReaderThread::ReadSocket(SocketEntry& socketEntry, ReaderBuffer& back, AZ::TimeMs startTimeMs, AZ::TimeMs updateRateMs)
+    {
+        UdpSocket* socket = socketEntry.m_socket;
+        ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer = back.m_receiveBuffer;
+        ReceivedPackets& receivedPackets = socketEntry.m_receivedPackets;
+        for (;;)
+        {
+            AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+            if (elapsedTimeMs > updateRateMs)
+            {
+                AZLOG_INFO("ReceivePackets bled %d ms", aznumeric_cast<int32_t>(elapsedTimeMs - updateRateMs));
+                return false;
+            }
+
+            IpAddress address;
+            const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
+            if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+            {
+                AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
+                    aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
+                return false;
+            }
+
+            if (receivedPackets.full())
+            {
+                return false;
+            }
+
+            uint8_t* dstData = receiveBuffer.GetBufferEnd();
+            receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+
+            const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
+            if (receivedBytes > 0)
+            {
+                receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
+                receiveBuffer.Resize(bufferHead + receivedBytes);
+                ++m_backPacketCount;
+            }
+            else
+            {
+                receiveBuffer.Resize(bufferHead);
+                return true;
+            }
+        }
+    }
+
     UdpReaderThread::ReceivedPacket::ReceivedPacket(const IpAddress& address, const uint8_t* buffer, int32_t receivedBytes)
         : m_address(address)
         , m_buffer(buffer)
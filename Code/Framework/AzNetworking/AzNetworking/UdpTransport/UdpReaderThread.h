@@ -12,6 +12,7 @@
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Utilities/TimedThread.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzCore/std/containers/unordered_map.h>
 
 namespace AzNetworking
@@ -21,6 +22,9 @@ namespace AzNetworking
 
     //! @class UdpSocketReader
     //! @brief reads lots of data off a UDP socket for deferred processing.
+    //!
+    //! On platforms supporting epoll, the reader blocks on socket readiness for its entire update interval and only
+    //! reads from sockets with pending datagrams, otherwise every registered socket is polled once per update.
     class UdpReaderThread
         : public TimedThread
     {
@@ -67,11 +71,30 @@ namespace AzNetworking
         //! @return the total elapsed time spent updating the background thread in milliseconds
         AZ::TimeMs GetUpdateTimeMs() const;
 
+        //! Returns the number of packets handed off for processing by the most recent call to SwapBuffers.
+        //! @return the number of packets handed off for processing by the most recent call to SwapBuffers
+        uint32_t GetQueueDepth() const;
+
+        //! Returns the largest number of packets handed off for processing by a single call to SwapBuffers.
+        //! @return the largest number of packets handed off for processing by a single call to SwapBuffers
+        uint32_t GetMaxQueueDepth() const;
+
     private:
 
+        struct SocketEntry;
+        struct ReaderBuffer;
+
         //! Helper to determine if a given socket is monitored by this reader thread instance
         bool SocketExists(UdpSocket* socket) const;
 
+        //! Reads pending datagrams off a single socket into the back buffer.
+        //! @param socketEntry   the socket entry to read datagrams for
+        //! @param back          the back buffer to read into
+        //! @param startTimeMs   the time this update started reading
+        //! @param updateRateMs  the maximum time this update may spend reading
+        //! @return boolean false if the read budget or receive buffer were exhausted, true if the socket was drained
+        bool ReadSocket(SocketEntry& socketEntry, ReaderBuffer& back, AZ::TimeMs startTimeMs, AZ::TimeMs updateRateMs);
+
         void OnStart() override;
         void OnStop() override;
         void OnUpdate(AZ::TimeMs updateRateMs) override;
@@ -95,5 +118,12 @@ namespace AzNetworking
         AZStd::array<ReaderBuffer, 2> m_readerBuffers;
         AZStd::vector<UdpSocket*> m_pendingAdds;
         AZ::TimeMs m_updateTimeMs = AZ::Time::ZeroTimeMs;
+        uint32_t m_backPacketCount = 0; // Packets read into the back buffer, guarded by m_mutex
+        uint32_t m_queueDepth = 0;
+        uint32_t m_maxQueueDepth = 0;
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        SocketFd m_epollFd = InvalidSocketFd;
+#endif
     };
 }
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReaderThreadPool.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    UdpReaderThreadPool::UdpReaderThreadPool(uint32_t readerThreadCount)
+    {
+        // Reader threads are only started once a socket is registered, so idle readers cost nothing beyond their buffers
+        readerThreadCount = AZStd::max(readerThreadCount, 1u);
+        m_readerThreads.reserve(readerThreadCount);
+        for (uint32_t readerIndex = 0; readerIndex < readerThreadCount; ++readerIndex)
+        {
+            m_readerThreads.emplace_back(AZStd::make_unique<UdpReaderThread>());
+        }
+        m_assignedSocketCounts.resize(readerThreadCount, 0);
+    }
+
+    bool UdpReaderThreadPool::RegisterSocket(UdpSocket* socket, uint32_t readerIndex)
+    {
+        if (m_socketAffinity.find(socket) != m_socketAffinity.end())
+        {
+            AZLOG_ERROR("Attempting to add a duplicate socket to the UdpReaderThreadPool");
+            return false;
+        }
+
+        if (readerIndex == AnyReaderThread)
+        {
+            readerIndex = 0;
+            for (uint32_t index = 1; index < GetReaderThreadCount(); ++index)
+            {
+                if (m_assignedSocketCounts[index] < m_assignedSocketCounts[readerIndex])
+                {
+                    readerIndex = index;
+                }
+            }
+        }
+        readerIndex %= GetReaderThreadCount();
+
+        if (!m_readerThreads[readerIndex]->RegisterSocket(socket))
+        {
+            return false;
+        }
+
+        m_socketAffinity.emplace(socket, readerIndex);
+        ++m_assignedSocketCounts[readerIndex];
+        return true;
+    }
+
+    void UdpReaderThreadPool::UnregisterSocket(UdpSocket* socket)
+    {
+        auto iterator = m_socketAffinity.find(socket);
+        if (iterator == m_socketAffinity.end())
+        {
+            return;
+        }
+
+        m_readerThreads[iterator->second]->UnregisterSocket(socket);
+        --m_assignedSocketCounts[iterator->second];
+        m_socketAffinity.erase(iterator);
+    }
+
+    const UdpReaderThread::ReceivedPackets* UdpReaderThreadPool::GetReceivedPackets(UdpSocket* socket) const
+    {
+        auto iterator = m_socketAffinity.find(socket);
+        if (iterator == m_socketAffinity.end())
+        {
+            return nullptr;
+        }
+        return m_readerThreads[iterator->second]->GetReceivedPackets(socket);
+    }
+
+    uint32_t UdpReaderThreadPool::GetReaderIndex(UdpSocket* socket) const
+    {
+        auto iterator = m_socketAffinity.find(socket);
+        return (iterator != m_socketAffinity.end()) ? iterator->second : AnyReaderThread;
+    }
+
+    void UdpReaderThreadPool::SwapBuffers()
+    {
+        for (AZStd::unique_ptr<UdpReaderThread>& readerThread : m_readerThreads)
+        {
+            readerThread->SwapBuffers();
+        }
+    }
+
+    uint32_t UdpReaderThreadPool::GetReaderThreadCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_readerThreads.size());
+    }
+
+    const UdpReaderThread& UdpReaderThreadPool::GetReaderThread(uint32_t readerIndex) const
+    {
+        AZ_Assert(readerIndex < GetReaderThreadCount(), "Reader thread index %u out of range", readerIndex);
+        return *m_readerThreads[readerIndex];
+    }
+
+    uint32_t UdpReaderThreadPool::GetSocketCount() const
+    {
+        uint32_t socketCount = 0;
+        for (const AZStd::unique_ptr<UdpReaderThread>& readerThread : m_readerThreads)
+        {
+            socketCount += readerThread->GetSocketCount();
+        }
+        return socketCount;
+    }
+
+    AZ::TimeMs UdpReaderThreadPool::GetUpdateTimeMs() const
+    {
+        AZ::TimeMs updateTimeMs = AZ::Time::ZeroTimeMs;
+        for (const AZStd::unique_ptr<UdpReaderThread>& readerThread : m_readerThreads)
+        {
+            updateTimeMs += readerThread->GetUpdateTimeMs();
+        }
+        return updateTimeMs;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    // Forwards
+    class UdpSocket;
+
+    //! @class UdpReaderThreadPool
+    //! @brief distributes registered UDP sockets across a fixed set of reader threads.
+    //!
+    //! Each socket is bound to a single reader for its lifetime, so its received packets are always read and handed off
+    //! by the same thread. Sockets are assigned to the reader servicing the fewest sockets unless an explicit reader is requested.
+    //! All methods must be invoked from the thread that owns the network interfaces.
+    class UdpReaderThreadPool
+    {
+    public:
+
+        static constexpr uint32_t AnyReaderThread = 0xFFFFFFFF;
+
+        //! Constructor.
+        //! @param readerThreadCount the number of reader threads to create, clamped to at least one
+        UdpReaderThreadPool(uint32_t readerThreadCount);
+        ~UdpReaderThreadPool() = default;
+
+        //! Adds the provided socket to a reader thread for processing.
+        //! @param socket      pointer to the UdpSocket to read incoming data from
+        //! @param readerIndex index of the reader thread to bind the socket to, AnyReaderThread selects the least loaded reader
+        //! @return boolean true on success, false for failure
+        bool RegisterSocket(UdpSocket* socket, uint32_t readerIndex = AnyReaderThread);
+
+        //! Removes the provided socket from its reader thread.
+        //! @param socket pointer to the UdpSocket to stop reading from
+        void UnregisterSocket(UdpSocket* socket);
+
+        //! Returns the set of all packets consumed off the socket by its reader thread prior to the last SwapBuffers call.
+        //! @param socket pointer to the UdpSocket to retrieve received packets for
+        //! @return all packets consumed off the socket, or nullptr if the socket is not yet monitored
+        const UdpReaderThread::ReceivedPackets* GetReceivedPackets(UdpSocket* socket) const;
+
+        //! Returns the index of the reader thread the provided socket is bound to.
+        //! @param socket pointer to the UdpSocket to look up
+        //! @return the index of the reader thread the socket is bound to, or AnyReaderThread if the socket is not registered
+        uint32_t GetReaderIndex(UdpSocket* socket) const;
+
+        //! Should be called immediately before any registered sockets have processed their received packets.
+        void SwapBuffers();
+
+        //! Returns the number of reader threads owned by this pool.
+        //! @return the number of reader threads owned by this pool
+        uint32_t GetReaderThreadCount() const;
+
+        //! Returns the reader thread at the provided index.
+        //! @param readerIndex index of the reader thread to return
+        //! @return the reader thread at the provided index
+        const UdpReaderThread& GetReaderThread(uint32_t readerIndex) const;
+
+        //! Returns the number of active sockets bound to all reader threads.
+        //! @return the number of active sockets bound to all reader threads
+        uint32_t GetSocketCount() const;
+
+        //! Gets the total elapsed time spent updating all reader threads in milliseconds
+        //! @return the total elapsed time spent updating all reader threads in milliseconds
+        AZ::TimeMs GetUpdateTimeMs() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpReaderThreadPool);
+
+        AZStd::vector<AZStd::unique_ptr<UdpReaderThread>> m_readerThreads;
+        AZStd::vector<uint32_t> m_assignedSocketCounts;
+        AZStd::unordered_map<UdpSocket*, uint32_t> m_socketAffinity;
+    };
+}
@@ -11,6 +11,7 @@
 #include <AzNetworking/PacketLayer/IPacket.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
+#include <AzNetworking/UdpTransport/UdpPacketBufferPool.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
 #include <AzCore/std/containers/unordered_map.h>
 
@@ -24,7 +25,8 @@ namespace AzNetworking
     struct PendingPacket
     {
         SequenceId m_reliableSequenceId;
-        AZStd::unique_ptr<IPacket> m_packet;
+        PacketType m_packetType;
+        UdpPacketBufferView m_payload; //< Serialized packet payload, shared with any in-flight resends
     };
 
     //! @class UdpReliableQueue
@@ -33,7 +35,9 @@ namespace AzNetworking
     {
     public:
 
-        UdpReliableQueue() = default;
+        //! Constructor.
+        //! @param packetBufferPool the pool the retained payloads are acquired from, the queue's own allocations are counted against it
+        explicit UdpReliableQueue(UdpPacketBufferPool& packetBufferPool);
         ~UdpReliableQueue();
 
         //! Returns the next sequence id for this generator instance.
@@ -47,9 +51,10 @@ namespace AzNetworking
         //! Called when we're going to transmit a packet that we want to be reliable.
         //! @param packetId           packet id of the packet we're sending
         //! @param reliableSequenceId the reliable sequence identifier of the packet we're sending
-        //! @param packet             reference to the packet being transmitted
+        //! @param packetType         the type of the packet being transmitted
+        //! @param payload            view of the serialized payload of the packet being transmitted
         //! @return boolean true on success, false on failure
-        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const UdpPacketBufferView& payload);
 
         //! Called when a reliable packet has been received.
         //! @param header the header for the received reliable packet
@@ -73,7 +78,7 @@ namespace AzNetworking
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
 
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
-        using PendingPacketMap = AZStd::unordered_map<PacketId, PendingPacket>;
+        using PendingPacketMap = AZStd::unordered_map<PacketId, PendingPacket, AZStd::hash<PacketId>, AZStd::equal_to<PacketId>, UdpPacketQueueAllocator>;
 
         SequenceGenerator  m_reliableSequenceGenerator;
         SequenceId         m_lastReceivedReliableSequenceId = InvalidSequenceId;
@@ -68,6 +68,12 @@ namespace AzNetworking
             }
         }
 
+        if (m_reusePort && !SetSocketReusePort(m_socketFd))
+        {
+            Close();
+            return false;
+        }
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -72,6 +72,15 @@ namespace AzNetworking
         //! Closes an open socket.
         virtual void Close();
 
+        //! Sets whether the socket should be opened with port reuse enabled, allowing several sockets to bind the same port.
+        //! Must be set prior to calling Open, the kernel load balances incoming datagrams across all sockets sharing the port.
+        //! @param reusePort if true, the next call to Open will enable port reuse before binding
+        void SetReusePort(bool reusePort);
+
+        //! Returns true if the socket will be opened with port reuse enabled.
+        //! @return boolean true if the socket will be opened with port reuse enabled
+        bool GetReusePort() const;
+
         //! Returns true if the UDP socket is currently in an open state.
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
@@ -131,6 +140,7 @@ namespace AzNetworking
     private:
 
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_reusePort = false;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
@@ -15,6 +15,16 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline void UdpSocket::SetReusePort(bool reusePort)
+    {
+        m_reusePort = reusePort;
+    }
+
+    inline bool UdpSocket::GetReusePort() const
+    {
+        return m_reusePort;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
@@ -90,6 +90,25 @@ namespace AzNetworking
         return true;
     }
 
+    bool SetSocketReusePort([[maybe_unused]] SocketFd socketFd)
+    {
+#if AZ_TRAIT_USE_SOCKET_REUSE_PORT
+        int flag = 1;
+
+        if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_REUSEPORT, (const char *)&flag, sizeof(int)) != SocketOpResultSuccess)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("Failed to enable port reuse for socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return false;
+        }
+
+        return true;
+#else
+        AZLOG_WARN("Port reuse is not supported on this platform");
+        return false;
+#endif
+    }
+
     void CloseSocket(SocketFd socketFd)
     {
         if (int32_t(socketFd) <= 0)
@@ -82,6 +82,12 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize);
 
+    //! Allows multiple sockets to bind the same port, the kernel then distributes incoming datagrams between them.
+    //! Must be invoked prior to binding the socket, and is a no-op returning false on platforms without SO_REUSEPORT support.
+    //! @param socketFd identifier of the socket to enable port reuse for
+    //! @return boolean true on success
+    bool SetSocketReusePort(SocketFd socketFd);
+
     //! Closes the provided socket.
     //! @param socketFd identifier of socket to close
     void CloseSocket(SocketFd socketFd);
@@ -108,6 +108,9 @@ set(FILES
     UdpTransport/UdpHeartbeatThread.h
     UdpTransport/UdpNetworkInterface.cpp
     UdpTransport/UdpNetworkInterface.h
+    UdpTransport/UdpPacketBufferPool.cpp
+    UdpTransport/UdpPacketBufferPool.h
+    UdpTransport/UdpPacketBufferPool.inl
     UdpTransport/UdpPacketHeader.cpp
     UdpTransport/UdpPacketHeader.h
     UdpTransport/UdpPacketHeader.inl
@@ -119,6 +122,8 @@ set(FILES
     UdpTransport/UdpPacketTracker.inl
     UdpTransport/UdpReaderThread.cpp
     UdpTransport/UdpReaderThread.h
+    UdpTransport/UdpReaderThreadPool.cpp
+    UdpTransport/UdpReaderThreadPool.h
     UdpTransport/UdpReliableQueue.cpp
     UdpTransport/UdpReliableQueue.h
     UdpTransport/UdpSocket.cpp
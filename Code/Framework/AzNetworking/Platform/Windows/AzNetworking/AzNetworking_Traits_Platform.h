@@ -12,6 +12,8 @@
 #define AZ_TRAIT_OS_USE_MACH 0
 #define AZ_TRAIT_USE_SOCKET_SERVER_EPOLL 0
 #define AZ_TRAIT_USE_SOCKET_SERVER_SELECT 1
+#define AZ_TRAIT_USE_UDP_READER_EPOLL 0
+#define AZ_TRAIT_USE_SOCKET_REUSE_PORT 0
 #define AZ_TRAIT_USE_OPENSSL 1
 #define AZ_TRAIT_NEEDS_HTONLL 0
 
@@ -11,4 +11,56 @@
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    using ConnectionMetricsTests = LeakDetectionFixture;
+
+    TEST_F(ConnectionMetricsTests, CongestionControlIncreasesOnAck)
+    {
+        ConnectionCongestionControl congestionControl;
+        const float initialSendRate = congestionControl.GetSendRateBytesPerSecond();
+        EXPECT_GT(initialSendRate, 0.0f);
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            congestionControl.LogPacketAcked();
+        }
+        EXPECT_GT(congestionControl.GetSendRateBytesPerSecond(), initialSendRate);
+        EXPECT_EQ(congestionControl.GetBackoffCount(), 0);
+    }
+
+    TEST_F(ConnectionMetricsTests, CongestionControlBacksOffOncePerRoundTrip)
+    {
+        ConnectionCongestionControl congestionControl;
+        const float initialSendRate = congestionControl.GetSendRateBytesPerSecond();
+        constexpr float RoundTripTimeSeconds = 0.1f;
+
+        congestionControl.LogPacketLost(AZ::TimeMs{ 1000 }, RoundTripTimeSeconds);
+        const float reducedSendRate = congestionControl.GetSendRateBytesPerSecond();
+        EXPECT_LT(reducedSendRate, initialSendRate);
+        EXPECT_EQ(congestionControl.GetBackoffCount(), 1);
+
+        // Further losses within the same round trip belong to the same congestion event
+        congestionControl.LogPacketLost(AZ::TimeMs{ 1050 }, RoundTripTimeSeconds);
+        EXPECT_EQ(congestionControl.GetSendRateBytesPerSecond(), reducedSendRate);
+        EXPECT_EQ(congestionControl.GetBackoffCount(), 1);
+
+        congestionControl.LogPacketLost(AZ::TimeMs{ 1100 }, RoundTripTimeSeconds);
+        EXPECT_LT(congestionControl.GetSendRateBytesPerSecond(), reducedSendRate);
+        EXPECT_EQ(congestionControl.GetBackoffCount(), 2);
+    }
+
+    TEST_F(ConnectionMetricsTests, CongestionControlRespectsMinimumRate)
+    {
+        ConnectionCongestionControl congestionControl;
+        for (int64_t i = 0; i < 100; ++i)
+        {
+            congestionControl.LogPacketLost(AZ::TimeMs{ i * 1000 }, 0.1f);
+        }
+
+        const float minimumSendRate = congestionControl.GetSendRateBytesPerSecond();
+        EXPECT_GT(minimumSendRate, 0.0f);
+        congestionControl.LogPacketLost(AZ::TimeMs{ 200 * 1000 }, 0.1f);
+        EXPECT_EQ(congestionControl.GetSendRateBytesPerSecond(), minimumSendRate);
+    }
 }
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpPacketBufferPool.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    using UdpPacketBufferPoolTests = LeakDetectionFixture;
+
+    TEST_F(UdpPacketBufferPoolTests, AcquireCopiesData)
+    {
+        UdpPacketBufferPool pool(4);
+        const uint8_t data[] = { 1, 2, 3, 4, 5 };
+
+        UdpPacketBufferView view = pool.Acquire(data, sizeof(data));
+        ASSERT_TRUE(view.IsValid());
+        EXPECT_EQ(view.GetSize(), sizeof(data));
+        EXPECT_EQ(memcmp(view.GetBuffer(), data, sizeof(data)), 0);
+        EXPECT_EQ(view.GetRefCount(), 1);
+        EXPECT_EQ(pool.GetFreeBufferCount(), 3);
+    }
+
+    TEST_F(UdpPacketBufferPoolTests, ViewsShareBuffer)
+    {
+        UdpPacketBufferPool pool(4);
+        const uint8_t data[] = { 1, 2, 3 };
+
+        UdpPacketBufferView view = pool.Acquire(data, sizeof(data));
+        {
+            UdpPacketBufferView copy = view;
+            EXPECT_EQ(copy.GetBuffer(), view.GetBuffer());
+            EXPECT_EQ(view.GetRefCount(), 2);
+            EXPECT_EQ(pool.GetFreeBufferCount(), 3);
+        }
+        EXPECT_EQ(view.GetRefCount(), 1);
+
+        UdpPacketBufferView moved = AZStd::move(view);
+        EXPECT_FALSE(view.IsValid());
+        EXPECT_EQ(moved.GetRefCount(), 1);
+
+        moved.Reset();
+        EXPECT_FALSE(moved.IsValid());
+        EXPECT_EQ(pool.GetFreeBufferCount(), 4);
+    }
+
+    TEST_F(UdpPacketBufferPoolTests, RecycledBuffersDoNotAllocate)
+    {
+        UdpPacketBufferPool pool(2);
+        const uint64_t initialAllocations = pool.GetAllocationCount();
+        const uint8_t data[MaxUdpTransmissionUnit] = {};
+
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            UdpPacketBufferView first = pool.Acquire(data, sizeof(data));
+            UdpPacketBufferView second = pool.Acquire(data, sizeof(data));
+            EXPECT_TRUE(first.IsValid());
+            EXPECT_TRUE(second.IsValid());
+        }
+
+        EXPECT_EQ(pool.GetAllocationCount(), initialAllocations);
+        EXPECT_EQ(pool.GetAcquireCount(), 2000);
+    }
+
+    TEST_F(UdpPacketBufferPoolTests, PoolGrowsWhenExhausted)
+    {
+        UdpPacketBufferPool pool(2);
+        const uint64_t initialAllocations = pool.GetAllocationCount();
+        const uint8_t data[] = { 7 };
+
+        UdpPacketBufferView views[3] = { pool.Acquire(data, 1), pool.Acquire(data, 1), pool.Acquire(data, 1) };
+        EXPECT_GT(pool.GetAllocationCount(), initialAllocations);
+        EXPECT_EQ(pool.GetPooledBufferCount(), 4);
+
+        for (UdpPacketBufferView& view : views)
+        {
+            view.Reset();
+        }
+        EXPECT_EQ(pool.GetFreeBufferCount(), 4);
+    }
+
+    TEST_F(UdpPacketBufferPoolTests, OversizedBuffersBypassPool)
+    {
+        UdpPacketBufferPool pool(2);
+        AZStd::vector<uint8_t> data(MaxUdpTransmissionUnit * 2, 0xAB);
+
+        UdpPacketBufferView view = pool.Acquire(data.data(), aznumeric_cast<uint32_t>(data.size()));
+        ASSERT_TRUE(view.IsValid());
+        EXPECT_EQ(view.GetSize(), data.size());
+        EXPECT_EQ(memcmp(view.GetBuffer(), data.data(), data.size()), 0);
+        EXPECT_EQ(pool.GetFreeBufferCount(), 2);
+    }
+
+    TEST_F(UdpPacketBufferPoolTests, AcquireWritableBuffer)
+    {
+        UdpPacketBufferPool pool(2);
+        const uint8_t data[] = { 9, 8, 7 };
+
+        UdpPacketBufferView view = pool.Acquire();
+        ASSERT_TRUE(view.IsValid());
+        EXPECT_EQ(view.GetSize(), 0);
+        EXPECT_EQ(view.GetCapacity(), MaxUdpTransmissionUnit);
+
+        memcpy(view.GetWritableBuffer(), data, sizeof(data));
+        view.SetSize(sizeof(data));
+        EXPECT_EQ(view.GetSize(), sizeof(data));
+        EXPECT_EQ(memcmp(view.GetBuffer(), data, sizeof(data)), 0);
+        EXPECT_EQ(pool.GetFreeBufferCount(), 1);
+        EXPECT_EQ(pool.GetAcquireCount(), 1);
+
+        view.Reset();
+        EXPECT_EQ(pool.GetFreeBufferCount(), 2);
+    }
+
+    TEST_F(UdpPacketBufferPoolTests, QueueAllocationsAreCounted)
+    {
+        UdpPacketBufferPool pool(2);
+        const uint64_t initialAllocations = pool.GetAllocationCount();
+
+        {
+            AZStd::unordered_map<uint32_t, uint32_t, AZStd::hash<uint32_t>, AZStd::equal_to<uint32_t>, UdpPacketQueueAllocator> map(
+                (UdpPacketQueueAllocator(pool)));
+            for (uint32_t i = 0; i < 8; ++i)
+            {
+                map[i] = i;
+            }
+
+            // Every inserted node is a heap allocation, plus any bucket allocations made while growing
+            EXPECT_GE(pool.GetAllocationCount(), initialAllocations + 8);
+        }
+
+        const uint64_t mapAllocations = pool.GetAllocationCount();
+        {
+            AZStd::vector<uint32_t, UdpPacketQueueAllocator> vector((UdpPacketQueueAllocator(pool)));
+            vector.reserve(16);
+        }
+        EXPECT_EQ(pool.GetAllocationCount(), mapAllocations + 1);
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReaderThreadPool.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzCore/Socket/AzSocket.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    using UdpReaderThreadPoolTests = LeakDetectionFixture;
+
+    // Returns the port an open socket is bound to, so tests can bind to port 0 and let the OS pick a free one
+    static uint16_t GetBoundPort(const UdpSocket& socket)
+    {
+        AZ::AzSock::AzSocketAddress address;
+        if (AZ::AzSock::GetSockName(static_cast<AZSOCKET>(static_cast<int32_t>(socket.GetSocketFd())), address) != 0)
+        {
+            return 0;
+        }
+        return address.GetAddrPort();
+    }
+
+    TEST_F(UdpReaderThreadPoolTests, ClampsToOneReader)
+    {
+        UdpReaderThreadPool pool(0);
+        EXPECT_EQ(pool.GetReaderThreadCount(), 1);
+    }
+
+    TEST_F(UdpReaderThreadPoolTests, BalancesSocketsAcrossReaders)
+    {
+        UdpReaderThreadPool pool(2);
+        UdpSocket sockets[4];
+        for (UdpSocket& socket : sockets)
+        {
+            ASSERT_TRUE(socket.Open(0, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+            EXPECT_TRUE(pool.RegisterSocket(&socket));
+        }
+
+        EXPECT_EQ(pool.GetReaderIndex(&sockets[0]), 0);
+        EXPECT_EQ(pool.GetReaderIndex(&sockets[1]), 1);
+        EXPECT_EQ(pool.GetReaderIndex(&sockets[2]), 0);
+        EXPECT_EQ(pool.GetReaderIndex(&sockets[3]), 1);
+
+        pool.SwapBuffers();
+        EXPECT_EQ(pool.GetSocketCount(), 4);
+        EXPECT_EQ(pool.GetReaderThread(0).GetSocketCount(), 2);
+        EXPECT_EQ(pool.GetReaderThread(1).GetSocketCount(), 2);
+
+        // Freed capacity is reused by the next registration
+        pool.UnregisterSocket(&sockets[1]);
+        EXPECT_EQ(pool.GetReaderIndex(&sockets[1]), UdpReaderThreadPool::AnyReaderThread);
+        EXPECT_EQ(pool.GetReceivedPackets(&sockets[1]), nullptr);
+        EXPECT_TRUE(pool.RegisterSocket(&sockets[1]));
+        EXPECT_EQ(pool.GetReaderIndex(&sockets[1]), 1);
+
+        for (UdpSocket& socket : sockets)
+        {
+            pool.UnregisterSocket(&socket);
+        }
+    }
+
+    TEST_F(UdpReaderThreadPoolTests, HonoursExplicitAffinity)
+    {
+        UdpReaderThreadPool pool(3);
+        UdpSocket socket;
+        ASSERT_TRUE(socket.Open(0, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        EXPECT_TRUE(pool.RegisterSocket(&socket, 2));
+        EXPECT_EQ(pool.GetReaderIndex(&socket), 2);
+        EXPECT_FALSE(pool.RegisterSocket(&socket, 0));
+
+        pool.SwapBuffers();
+        EXPECT_NE(pool.GetReceivedPackets(&socket), nullptr);
+        pool.UnregisterSocket(&socket);
+    }
+
+    TEST_F(UdpReaderThreadPoolTests, ReadsDatagramsAndTracksQueueDepth)
+    {
+        UdpReaderThreadPool pool(1);
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(0, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        const uint16_t receiverPort = GetBoundPort(receiver);
+        ASSERT_NE(receiverPort, 0);
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(pool.RegisterSocket(&receiver));
+        pool.SwapBuffers();
+
+        constexpr uint32_t PacketCount = 8;
+        const uint8_t payload[] = { 1, 2, 3, 4 };
+        DtlsEndpoint dtlsEndpoint;
+        for (uint32_t i = 0; i < PacketCount; ++i)
+        {
+            sender.Send(IpAddress(127, 0, 0, 1, receiverPort), payload, sizeof(payload), false, dtlsEndpoint, ConnectionQuality());
+        }
+
+        // Wait for the reader to pick everything up, the swap hands the received packets to this thread
+        uint32_t receivedCount = 0;
+        for (uint32_t attempt = 0; (attempt < 100) && (receivedCount < PacketCount); ++attempt)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+            pool.SwapBuffers();
+            const UdpReaderThread::ReceivedPackets* packets = pool.GetReceivedPackets(&receiver);
+            ASSERT_NE(packets, nullptr);
+            EXPECT_EQ(pool.GetReaderThread(0).GetQueueDepth(), packets->size());
+            for (const UdpReaderThread::ReceivedPacket& packet : *packets)
+            {
+                EXPECT_EQ(packet.m_receivedBytes, sizeof(payload));
+                EXPECT_EQ(memcmp(packet.m_buffer, payload, sizeof(payload)), 0);
+            }
+            receivedCount += aznumeric_cast<uint32_t>(packets->size());
+        }
+
+        EXPECT_EQ(receivedCount, PacketCount);
+        EXPECT_GE(pool.GetReaderThread(0).GetMaxQueueDepth(), 1);
+        EXPECT_LE(pool.GetReaderThread(0).GetMaxQueueDepth(), PacketCount);
+        pool.UnregisterSocket(&receiver);
+    }
+
+#if AZ_TRAIT_USE_SOCKET_REUSE_PORT
+    TEST_F(UdpReaderThreadPoolTests, ReusePortSocketsShareAPort)
+    {
+        UdpSocket first;
+        UdpSocket second;
+        first.SetReusePort(true);
+        second.SetReusePort(true);
+        ASSERT_TRUE(first.Open(0, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        const uint16_t sharedPort = GetBoundPort(first);
+        ASSERT_NE(sharedPort, 0);
+        EXPECT_TRUE(second.Open(sharedPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        // Without port reuse the bind must still be exclusive
+        UdpSocket exclusive;
+        EXPECT_FALSE(exclusive.Open(sharedPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+    }
+#endif
+}
@@ -320,4 +320,54 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, CongestionControlBacksOffUnderLoss)
+    {
+        TestUdpServer testServer;
+        TestUdpClient cleanClient;
+        TestUdpClient lossyClient;
+
+        constexpr AZ::TimeMs ConnectTimeMs = AZ::TimeMs{ 5000 };
+        AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (AZ::GetElapsedTimeMs() - startTimeMs < ConnectTimeMs)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+            if ((cleanClient.m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1)
+             && (lossyClient.m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1))
+            {
+                break;
+            }
+        }
+
+        IConnection* cleanConnection = nullptr;
+        IConnection* lossyConnection = nullptr;
+        cleanClient.m_clientNetworkInterface->GetConnectionSet().VisitConnections([&cleanConnection](IConnection& connection) { cleanConnection = &connection; });
+        lossyClient.m_clientNetworkInterface->GetConnectionSet().VisitConnections([&lossyConnection](IConnection& connection) { lossyConnection = &connection; });
+        ASSERT_NE(cleanConnection, nullptr);
+        ASSERT_NE(lossyConnection, nullptr);
+
+        const float initialSendRate = lossyConnection->GetMetrics().m_congestionControl.GetSendRateBytesPerSecond();
+        lossyConnection->GetConnectionQuality().m_lossPercentage = 30;
+
+        // Both clients send a steady stream of heartbeats, the server's replies carry acks back for whatever arrived
+        constexpr AZ::TimeMs SendTimeMs = AZ::TimeMs{ 2000 };
+        startTimeMs = AZ::GetElapsedTimeMs();
+        while (AZ::GetElapsedTimeMs() - startTimeMs < SendTimeMs)
+        {
+            for (uint32_t i = 0; i < 8; ++i)
+            {
+                cleanConnection->SendUnreliablePacket(CorePackets::HeartbeatPacket(false));
+                lossyConnection->SendUnreliablePacket(CorePackets::HeartbeatPacket(false));
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+            m_networkingSystemComponent->OnSystemTick();
+        }
+
+        const ConnectionCongestionControl& cleanCongestion = cleanConnection->GetMetrics().m_congestionControl;
+        const ConnectionCongestionControl& lossyCongestion = lossyConnection->GetMetrics().m_congestionControl;
+        EXPECT_GT(lossyCongestion.GetBackoffCount(), 0);
+        EXPECT_GE(cleanCongestion.GetSendRateBytesPerSecond(), initialSendRate);
+        EXPECT_LT(lossyCongestion.GetSendRateBytesPerSecond(), cleanCongestion.GetSendRateBytesPerSecond());
+    }
 }
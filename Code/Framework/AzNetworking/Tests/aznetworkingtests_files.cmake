@@ -22,6 +22,8 @@ set(FILES
     Serialization/TrackChangedSerializerTests.cpp
     Serialization/TypeValidatingSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpPacketBufferPoolTests.cpp
+    UdpTransport/UdpReaderThreadPoolTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
@@ -31,6 +31,7 @@ namespace AZ
             using RPI::MaterialFunctor::Process;
             void Process(RPI::MaterialFunctorAPI::RuntimeContext& context) override;
             void Process(RPI::MaterialFunctorAPI::EditorContext& context) override;
+            bool SupportsParallelProcessing() const override { return true; }
             float GetProcessedValue(float originalEmissiveIntensity, uint32_t lightUnitIndex) const;
 
             bool UpdateShaderParameterConnections(const RPI::MaterialShaderParameterLayout* layout) override;
@@ -59,6 +59,24 @@ namespace AZ
             "Batch size for the first stage of the mesh instancing bucket sort. "
             "Can be modified to find optimal load balancing for the multi-threaded tasks.");
 
+        AZ_CVAR(
+            bool,
+            r_meshInstancingFrameCoherent,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "Keep the mesh instancing buckets of each view between frames and only apply the visibility changes, "
+            "instead of rebuilding and re-sorting them every frame. Only the changed ranges of the instance buffers are uploaded.");
+
+        AZ_CVAR(
+            float,
+            r_meshInstancingFrameCoherentResortThreshold,
+            0.25f,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "With r_meshInstancingFrameCoherent, the fraction of instances in a bucket that must be added or removed in a frame "
+            "for the bucket to be fully re-sorted by depth.");
+
         AZ_CVAR(
             bool,
             r_meshInstancingDebugForceUniqueObjectsForProfiling,
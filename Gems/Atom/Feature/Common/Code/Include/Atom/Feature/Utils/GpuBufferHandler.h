@@ -41,6 +41,10 @@ namespace AZ
             template <typename T>
             bool UpdateBuffer(const AZStd::vector<T>& data);
             bool UpdateBuffer(const AZStd::unordered_map<int, const void*>& data, uint32_t elementCount);
+            // Only uploads the elements in [firstElement, firstElement + updateCount), unless the buffer needs to grow,
+            // in which case all elementCount elements are uploaded. The other elements must be unchanged since the last update.
+            template <typename T>
+            bool UpdateBufferRange(const T* data, uint32_t elementCount, uint32_t firstElement, uint32_t updateCount);
 
             void UpdateSrg(RPI::ShaderResourceGroup* srg) const;
 
@@ -53,6 +57,7 @@ namespace AZ
         private:
 
             bool UpdateBuffer(uint32_t elementCount, const void* data);
+            bool UpdateBufferRange(uint32_t elementCount, const void* data, uint32_t firstElement, uint32_t updateCount);
 
             Data::Instance<RPI::Buffer> m_buffer;
             RHI::ShaderInputBufferIndex m_bufferIndex;
@@ -73,5 +78,12 @@ namespace AZ
             AZ_Assert(sizeof(T) == m_elementSize, "Size of templated type doesn't match the size this GpuBuffer was initialized with.");
             return UpdateBuffer(aznumeric_cast<uint32_t>(data.size()), data.data());
         }
+
+        template <typename T>
+        bool GpuBufferHandler::UpdateBufferRange(const T* data, uint32_t elementCount, uint32_t firstElement, uint32_t updateCount)
+        {
+            AZ_Assert(sizeof(T) == m_elementSize, "Size of templated type doesn't match the size this GpuBuffer was initialized with.");
+            return UpdateBufferRange(elementCount, data, firstElement, updateCount);
+        }
     } // namespace Render
 } // namespace AZ
@@ -13,6 +13,7 @@
 
 #include <Atom/Feature/CoreLights/CoreLightsConstants.h>
 #include <Atom/Feature/Mesh/MeshCommon.h>
+#include <CoreLights/ClusteredLightFeatureProcessor.h>
 #include <CoreLights/LightCommon.h>
 #include <Mesh/MeshFeatureProcessor.h>
 
@@ -62,6 +63,7 @@ namespace AZ
 
         void CapsuleLightFeatureProcessor::Deactivate()
         {
+            ClusteredLightFeatureProcessor::ClearLights(GetParentScene(), ClusteredLightSource::Capsule);
             m_lightData.Clear();
             m_lightBufferHandler.Release();
         }
@@ -118,6 +120,11 @@ namespace AZ
                 m_deviceBufferNeedsUpdate = false;
             }
 
+            if (ClusteredLightFeatureProcessor* clusteredLightFeatureProcessor = ClusteredLightFeatureProcessor::GetEnabled(GetParentScene()))
+            {
+                clusteredLightFeatureProcessor->SetLights(ClusteredLightSource::Capsule, AZStd::span(m_lightData.GetDataVector<1>()));
+            }
+
             if (r_enablePerMeshShaderOptionFlags)
             {
                 MeshCommon::MarkMeshesWithFlag(GetParentScene(), AZStd::span(m_lightData.GetDataVector<1>()), m_lightMeshFlag.GetIndex());
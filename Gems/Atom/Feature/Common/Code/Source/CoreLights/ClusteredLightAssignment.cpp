@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/ClusteredLightAssignment.h>
+
+#include <Atom/RPI.Public/Base.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace AZ::Render
+{
+    void ClusteredLightList::SetSourceLights(ClusteredLightSource source, AZStd::span<const AZ::Sphere> bounds)
+    {
+        const uint32_t sourceIndex = static_cast<uint32_t>(source);
+        AZ_Assert(sourceIndex < SourceCount, "Invalid clustered light source %u", sourceIndex);
+
+        const uint32_t offset = m_sourceOffsets[sourceIndex];
+        const uint32_t previousCount = m_sourceCounts[sourceIndex];
+        const uint32_t count = aznumeric_cast<uint32_t>(bounds.size());
+        const uint32_t nextVersion = m_version + 1;
+        bool changed = false;
+
+        if (count != previousCount)
+        {
+            if (count > previousCount)
+            {
+                m_bounds.insert(m_bounds.begin() + offset + previousCount, count - previousCount, AZ::Sphere::CreateUnitSphere());
+                m_changeVersions.insert(m_changeVersions.begin() + offset + previousCount, count - previousCount, nextVersion);
+            }
+            else
+            {
+                m_bounds.erase(m_bounds.begin() + offset + count, m_bounds.begin() + offset + previousCount);
+                m_changeVersions.erase(m_changeVersions.begin() + offset + count, m_changeVersions.begin() + offset + previousCount);
+            }
+
+            m_sourceCounts[sourceIndex] = count;
+            uint32_t sourceOffset = 0;
+            for (uint32_t index = 0; index < SourceCount; ++index)
+            {
+                m_sourceOffsets[index] = sourceOffset;
+                sourceOffset += m_sourceCounts[index];
+            }
+
+            ++m_layoutVersion;
+            changed = true;
+        }
+
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            if (!(m_bounds[offset + index] == bounds[index]))
+            {
+                m_bounds[offset + index] = bounds[index];
+                m_changeVersions[offset + index] = nextVersion;
+                changed = true;
+            }
+        }
+
+        if (changed)
+        {
+            m_version = nextVersion;
+        }
+    }
+
+    void ClusteredLightList::Clear()
+    {
+        m_bounds.clear();
+        m_changeVersions.clear();
+        m_sourceOffsets = {};
+        m_sourceCounts = {};
+        ++m_version;
+        ++m_layoutVersion;
+    }
+
+    uint32_t ClusteredLightList::GetLightCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_bounds.size());
+    }
+
+    const AZStd::vector<AZ::Sphere>& ClusteredLightList::GetBounds() const
+    {
+        return m_bounds;
+    }
+
+    const AZStd::vector<uint32_t>& ClusteredLightList::GetChangeVersions() const
+    {
+        return m_changeVersions;
+    }
+
+    ClusteredLightList::LightReference ClusteredLightList::GetLight(uint32_t compactedIndex) const
+    {
+        for (uint32_t index = 0; index < SourceCount; ++index)
+        {
+            if (compactedIndex < m_sourceOffsets[index] + m_sourceCounts[index])
+            {
+                return { static_cast<ClusteredLightSource>(index), compactedIndex - m_sourceOffsets[index] };
+            }
+        }
+
+        AZ_Assert(false, "Compacted light index %u is out of range of the %zu lights", compactedIndex, m_bounds.size());
+        return {};
+    }
+
+    uint32_t ClusteredLightList::GetSourceOffset(ClusteredLightSource source) const
+    {
+        return m_sourceOffsets[static_cast<uint32_t>(source)];
+    }
+
+    uint32_t ClusteredLightList::GetVersion() const
+    {
+        return m_version;
+    }
+
+    uint32_t ClusteredLightList::GetLayoutVersion() const
+    {
+        return m_layoutVersion;
+    }
+
+    bool ClusterGridDescriptor::operator==(const ClusterGridDescriptor& rhs) const
+    {
+        return m_worldToView == rhs.m_worldToView &&
+            m_tanHalfFovX == rhs.m_tanHalfFovX &&
+            m_tanHalfFovY == rhs.m_tanHalfFovY &&
+            m_nearDepth == rhs.m_nearDepth &&
+            m_farDepth == rhs.m_farDepth &&
+            m_tileCountX == rhs.m_tileCountX &&
+            m_tileCountY == rhs.m_tileCountY &&
+            m_sliceCount == rhs.m_sliceCount;
+    }
+
+    bool ClusterGridDescriptor::operator!=(const ClusterGridDescriptor& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    bool ClusteredLightAssignment::ClusterRange::IsEmpty() const
+    {
+        return m_beginX >= m_endX || m_beginY >= m_endY || m_beginSlice >= m_endSlice;
+    }
+
+    void ClusteredLightAssignment::Update(const ClusteredLightList& lightList, const ClusterGridDescriptor& grid, bool parallel)
+    {
+        AZ_PROFILE_SCOPE(RPI, "ClusteredLightAssignment: Update");
+
+        if (grid.m_tileCountX == 0 || grid.m_tileCountY == 0 || grid.m_sliceCount == 0 || grid.m_nearDepth <= 0.0f ||
+            grid.m_farDepth <= grid.m_nearDepth)
+        {
+            AZ_Error("ClusteredLightAssignment", false, "Invalid cluster grid");
+            return;
+        }
+
+        const bool gridChanged = !m_hasGrid || grid != m_grid;
+        const bool layoutChanged = lightList.GetLayoutVersion() != m_lightListLayoutVersion;
+        const uint32_t lightCount = lightList.GetLightCount();
+
+        if (gridChanged)
+        {
+            m_grid = grid;
+            m_hasGrid = true;
+            m_sliceScale = aznumeric_cast<float>(grid.m_sliceCount) / logf(grid.m_farDepth / grid.m_nearDepth);
+            m_clusterOffsets.resize(GetClusterCount() + 1);
+            m_clusterCursors.resize(GetClusterCount());
+        }
+
+        m_dirtyLights.clear();
+        if (gridChanged || layoutChanged)
+        {
+            m_lightClusterRanges.resize(lightCount);
+            m_dirtyLights.resize(lightCount);
+            for (uint32_t lightIndex = 0; lightIndex < lightCount; ++lightIndex)
+            {
+                m_dirtyLights[lightIndex] = lightIndex;
+            }
+        }
+        else if (lightList.GetVersion() != m_lightListVersion)
+        {
+            const AZStd::vector<uint32_t>& changeVersions = lightList.GetChangeVersions();
+            for (uint32_t lightIndex = 0; lightIndex < lightCount; ++lightIndex)
+            {
+                if (changeVersions[lightIndex] > m_lightListVersion)
+                {
+                    m_dirtyLights.push_back(lightIndex);
+                }
+            }
+        }
+
+        m_lightListLayoutVersion = lightList.GetLayoutVersion();
+        m_lightListVersion = lightList.GetVersion();
+        m_rebinnedLightCount = aznumeric_cast<uint32_t>(m_dirtyLights.size());
+
+        if (m_dirtyLights.empty() && !gridChanged && !layoutChanged)
+        {
+            // Nothing moved, so the cluster light lists from the previous update are still valid
+            return;
+        }
+
+        CalculateClusterRanges(lightList);
+
+        // Fill the compacted cluster light lists with two passes, first counting the lights of each cluster, then writing them
+        // after a prefix sum. Each slice is only touched by its own task, so slices can be processed in parallel.
+        AZStd::fill(m_clusterOffsets.begin(), m_clusterOffsets.end(), 0);
+        const uint32_t sliceCount = m_grid.m_sliceCount;
+        if (parallel)
+        {
+            static const AZ::TaskDescriptor countClusterLightsTaskDescriptor{ "AZ::Render::ClusteredLightAssignment - count cluster lights", "Graphics" };
+            AZ::TaskGraphEvent countEvent{ "CountClusterLights Wait" };
+            AZ::TaskGraph countTaskGraph{ "CountClusterLights" };
+            for (uint32_t slice = 0; slice < sliceCount; ++slice)
+            {
+                countTaskGraph.AddTask(countClusterLightsTaskDescriptor, [this, slice]() { CountClusterLights(slice, slice + 1); });
+            }
+            countTaskGraph.Submit(&countEvent);
+            countEvent.Wait();
+        }
+        else
+        {
+            CountClusterLights(0, sliceCount);
+        }
+
+        // m_clusterOffsets[i + 1] holds the light count of cluster i, so an inclusive prefix sum gives the offsets
+        for (size_t clusterIndex = 1; clusterIndex < m_clusterOffsets.size(); ++clusterIndex)
+        {
+            m_clusterOffsets[clusterIndex] += m_clusterOffsets[clusterIndex - 1];
+        }
+        AZStd::copy(m_clusterOffsets.begin(), m_clusterOffsets.end() - 1, m_clusterCursors.begin());
+        m_clusterLightIndices.resize_no_construct(m_clusterOffsets.back());
+
+        if (parallel)
+        {
+            static const AZ::TaskDescriptor fillClusterLightsTaskDescriptor{ "AZ::Render::ClusteredLightAssignment - fill cluster lights", "Graphics" };
+            AZ::TaskGraphEvent fillEvent{ "FillClusterLights Wait" };
+            AZ::TaskGraph fillTaskGraph{ "FillClusterLights" };
+            for (uint32_t slice = 0; slice < sliceCount; ++slice)
+            {
+                fillTaskGraph.AddTask(fillClusterLightsTaskDescriptor, [this, slice]() { FillClusterLights(slice, slice + 1); });
+            }
+            fillTaskGraph.Submit(&fillEvent);
+            fillEvent.Wait();
+        }
+        else
+        {
+            FillClusterLights(0, sliceCount);
+        }
+    }
+
+    void ClusteredLightAssignment::CalculateClusterRanges(const ClusteredLightList& lightList)
+    {
+        AZ_PROFILE_SCOPE(RPI, "ClusteredLightAssignment: CalculateClusterRanges");
+
+        // Gather the dirty lights into structure of arrays form, padded to a multiple of four with lights that are never visible
+        const uint32_t dirtyCount = aznumeric_cast<uint32_t>(m_dirtyLights.size());
+        const uint32_t paddedCount = (dirtyCount + 3) & ~3u;
+        m_scratchX.resize_no_construct(paddedCount);
+        m_scratchY.resize_no_construct(paddedCount);
+        m_scratchZ.resize_no_construct(paddedCount);
+        m_scratchRadius.resize_no_construct(paddedCount);
+
+        const AZStd::vector<AZ::Sphere>& bounds = lightList.GetBounds();
+        for (uint32_t dirtyIndex = 0; dirtyIndex < paddedCount; ++dirtyIndex)
+        {
+            if (dirtyIndex < dirtyCount)
+            {
+                const AZ::Sphere& sphere = bounds[m_dirtyLights[dirtyIndex]];
+                m_scratchX[dirtyIndex] = sphere.GetCenter().GetX();
+                m_scratchY[dirtyIndex] = sphere.GetCenter().GetY();
+                m_scratchZ[dirtyIndex] = sphere.GetCenter().GetZ();
+                m_scratchRadius[dirtyIndex] = sphere.GetRadius();
+            }
+            else
+            {
+                m_scratchX[dirtyIndex] = 0.0f;
+                m_scratchY[dirtyIndex] = 0.0f;
+                m_scratchZ[dirtyIndex] = 0.0f;
+                m_scratchRadius[dirtyIndex] = -1.0f;
+            }
+        }
+
+        using Simd::Vec4;
+        const AZ::Matrix3x4& worldToView = m_grid.m_worldToView;
+        Vec4::FloatType rows[3][4];
+        for (int32_t row = 0; row < 3; ++row)
+        {
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                rows[row][column] = Vec4::Splat(worldToView.GetElement(row, column));
+            }
+        }
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType nearDepth = Vec4::Splat(m_grid.m_nearDepth);
+        const Vec4::FloatType tanHalfFovX = Vec4::Splat(m_grid.m_tanHalfFovX);
+        const Vec4::FloatType tanHalfFovY = Vec4::Splat(m_grid.m_tanHalfFovY);
+        const Vec4::FloatType tileScaleX = Vec4::Splat(aznumeric_cast<float>(m_grid.m_tileCountX) / (2.0f * m_grid.m_tanHalfFovX));
+        const Vec4::FloatType tileScaleY = Vec4::Splat(aznumeric_cast<float>(m_grid.m_tileCountY) / (2.0f * m_grid.m_tanHalfFovY));
+        const float tileCountX = aznumeric_cast<float>(m_grid.m_tileCountX);
+        const float tileCountY = aznumeric_cast<float>(m_grid.m_tileCountY);
+
+        for (uint32_t dirtyIndex = 0; dirtyIndex < paddedCount; dirtyIndex += 4)
+        {
+            const Vec4::FloatType x = Vec4::LoadUnaligned(&m_scratchX[dirtyIndex]);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(&m_scratchY[dirtyIndex]);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(&m_scratchZ[dirtyIndex]);
+            const Vec4::FloatType radius = Vec4::LoadUnaligned(&m_scratchRadius[dirtyIndex]);
+
+            const Vec4::FloatType viewX = Vec4::Madd(rows[0][0], x, Vec4::Madd(rows[0][1], y, Vec4::Madd(rows[0][2], z, rows[0][3])));
+            const Vec4::FloatType viewY = Vec4::Madd(rows[1][0], x, Vec4::Madd(rows[1][1], y, Vec4::Madd(rows[1][2], z, rows[1][3])));
+            const Vec4::FloatType viewZ = Vec4::Madd(rows[2][0], x, Vec4::Madd(rows[2][1], y, Vec4::Madd(rows[2][2], z, rows[2][3])));
+
+            // Bound the sphere with a view space box, then find the range of tangents covered by the part of the box in front
+            // of the near plane. The smallest x / depth is at the nearest depth when x is negative and at the farthest otherwise.
+            const Vec4::FloatType depth = Vec4::Sub(zero, viewZ);
+            const Vec4::FloatType minDepth = Vec4::Sub(depth, radius);
+            const Vec4::FloatType maxDepth = Vec4::Add(depth, radius);
+            const Vec4::FloatType invNearestDepth = Vec4::Reciprocal(Vec4::Max(minDepth, nearDepth));
+            const Vec4::FloatType invFarthestDepth = Vec4::Reciprocal(Vec4::Max(maxDepth, nearDepth));
+
+            const Vec4::FloatType lowX = Vec4::Sub(viewX, radius);
+            const Vec4::FloatType highX = Vec4::Add(viewX, radius);
+            const Vec4::FloatType lowY = Vec4::Sub(viewY, radius);
+            const Vec4::FloatType highY = Vec4::Add(viewY, radius);
+            const Vec4::FloatType minTanX = Vec4::Select(Vec4::Mul(lowX, invNearestDepth), Vec4::Mul(lowX, invFarthestDepth), Vec4::CmpLt(lowX, zero));
+            const Vec4::FloatType maxTanX = Vec4::Select(Vec4::Mul(highX, invNearestDepth), Vec4::Mul(highX, invFarthestDepth), Vec4::CmpGt(highX, zero));
+            const Vec4::FloatType minTanY = Vec4::Select(Vec4::Mul(lowY, invNearestDepth), Vec4::Mul(lowY, invFarthestDepth), Vec4::CmpLt(lowY, zero));
+            const Vec4::FloatType maxTanY = Vec4::Select(Vec4::Mul(highY, invNearestDepth), Vec4::Mul(highY, invFarthestDepth), Vec4::CmpGt(highY, zero));
+
+            // Convert to fractional tile coordinates, with tile rows counted from the top of the view
+            alignas(16) float minTileX[4];
+            alignas(16) float maxTileX[4];
+            alignas(16) float minTileY[4];
+            alignas(16) float maxTileY[4];
+            alignas(16) float minDepths[4];
+            alignas(16) float maxDepths[4];
+            Vec4::StoreAligned(minTileX, Vec4::Mul(Vec4::Add(minTanX, tanHalfFovX), tileScaleX));
+            Vec4::StoreAligned(maxTileX, Vec4::Mul(Vec4::Add(maxTanX, tanHalfFovX), tileScaleX));
+            Vec4::StoreAligned(minTileY, Vec4::Mul(Vec4::Sub(tanHalfFovY, maxTanY), tileScaleY));
+            Vec4::StoreAligned(maxTileY, Vec4::Mul(Vec4::Sub(tanHalfFovY, minTanY), tileScaleY));
+            Vec4::StoreAligned(minDepths, minDepth);
+            Vec4::StoreAligned(maxDepths, maxDepth);
+
+            const uint32_t laneCount = AZStd::min(4u, dirtyCount - dirtyIndex);
+            for (uint32_t lane = 0; lane < laneCount; ++lane)
+            {
+                ClusterRange& range = m_lightClusterRanges[m_dirtyLights[dirtyIndex + lane]];
+                range = {};
+
+                if (maxDepths[lane] <= m_grid.m_nearDepth || maxTileX[lane] < 0.0f || minTileX[lane] >= tileCountX ||
+                    maxTileY[lane] < 0.0f || minTileY[lane] >= tileCountY)
+                {
+                    // Behind the near plane or outside of the sides of the view
+                    continue;
+                }
+
+                range.m_beginX = aznumeric_cast<uint16_t>(AZStd::max(minTileX[lane], 0.0f));
+                range.m_endX = aznumeric_cast<uint16_t>(AZStd::min(maxTileX[lane], tileCountX - 1.0f)) + 1;
+                range.m_beginY = aznumeric_cast<uint16_t>(AZStd::max(minTileY[lane], 0.0f));
+                range.m_endY = aznumeric_cast<uint16_t>(AZStd::min(maxTileY[lane], tileCountY - 1.0f)) + 1;
+                range.m_beginSlice = aznumeric_cast<uint16_t>(GetSliceIndex(minDepths[lane]));
+                range.m_endSlice = aznumeric_cast<uint16_t>(GetSliceIndex(maxDepths[lane]) + 1);
+            }
+        }
+    }
+
+    uint32_t ClusteredLightAssignment::GetSliceIndex(float depth) const
+    {
+        if (depth <= m_grid.m_nearDepth)
+        {
+            return 0;
+        }
+
+        const float slice = logf(depth / m_grid.m_nearDepth) * m_sliceScale;
+        return AZStd::min(aznumeric_cast<uint32_t>(slice), m_grid.m_sliceCount - 1);
+    }
+
+    void ClusteredLightAssignment::CountClusterLights(uint32_t beginSlice, uint32_t endSlice)
+    {
+        for (const ClusterRange& range : m_lightClusterRanges)
+        {
+            const uint32_t rangeBeginSlice = AZStd::max<uint32_t>(range.m_beginSlice, beginSlice);
+            const uint32_t rangeEndSlice = AZStd::min<uint32_t>(range.m_endSlice, endSlice);
+            for (uint32_t slice = rangeBeginSlice; slice < rangeEndSlice; ++slice)
+            {
+                for (uint32_t tileY = range.m_beginY; tileY < range.m_endY; ++tileY)
+                {
+                    const uint32_t rowIndex = GetClusterIndex(0, tileY, slice);
+                    for (uint32_t tileX = range.m_beginX; tileX < range.m_endX; ++tileX)
+                    {
+                        ++m_clusterOffsets[rowIndex + tileX + 1];
+                    }
+                }
+            }
+        }
+    }
+
+    void ClusteredLightAssignment::FillClusterLights(uint32_t beginSlice, uint32_t endSlice)
+    {
+        const uint32_t lightCount = aznumeric_cast<uint32_t>(m_lightClusterRanges.size());
+        for (uint32_t lightIndex = 0; lightIndex < lightCount; ++lightIndex)
+        {
+            const ClusterRange& range = m_lightClusterRanges[lightIndex];
+            const uint32_t rangeBeginSlice = AZStd::max<uint32_t>(range.m_beginSlice, beginSlice);
+            const uint32_t rangeEndSlice = AZStd::min<uint32_t>(range.m_endSlice, endSlice);
+            for (uint32_t slice = rangeBeginSlice; slice < rangeEndSlice; ++slice)
+            {
+                for (uint32_t tileY = range.m_beginY; tileY < range.m_endY; ++tileY)
+                {
+                    const uint32_t rowIndex = GetClusterIndex(0, tileY, slice);
+                    for (uint32_t tileX = range.m_beginX; tileX < range.m_endX; ++tileX)
+                    {
+                        m_clusterLightIndices[m_clusterCursors[rowIndex + tileX]++] = lightIndex;
+                    }
+                }
+            }
+        }
+    }
+
+    void ClusteredLightAssignment::Invalidate()
+    {
+        m_hasGrid = false;
+        m_lightListLayoutVersion = 0;
+        m_lightListVersion = 0;
+    }
+
+    const ClusterGridDescriptor& ClusteredLightAssignment::GetGrid() const
+    {
+        return m_grid;
+    }
+
+    uint32_t ClusteredLightAssignment::GetClusterCount() const
+    {
+        return m_grid.m_tileCountX * m_grid.m_tileCountY * m_grid.m_sliceCount;
+    }
+
+    uint32_t ClusteredLightAssignment::GetClusterIndex(uint32_t tileX, uint32_t tileY, uint32_t slice) const
+    {
+        return (slice * m_grid.m_tileCountY + tileY) * m_grid.m_tileCountX + tileX;
+    }
+
+    AZStd::span<const uint32_t> ClusteredLightAssignment::GetClusterLights(uint32_t clusterIndex) const
+    {
+        if (clusterIndex + 1 >= m_clusterOffsets.size())
+        {
+            return {};
+        }
+
+        const uint32_t begin = m_clusterOffsets[clusterIndex];
+        return AZStd::span<const uint32_t>(m_clusterLightIndices.data() + begin, m_clusterOffsets[clusterIndex + 1] - begin);
+    }
+
+    const ClusteredLightAssignment::ClusterRange& ClusteredLightAssignment::GetLightClusterRange(uint32_t compactedIndex) const
+    {
+        return m_lightClusterRanges[compactedIndex];
+    }
+
+    uint32_t ClusteredLightAssignment::GetAssignedLightIndexCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_clusterLightIndices.size());
+    }
+
+    uint32_t ClusteredLightAssignment::GetRebinnedLightCount() const
+    {
+        return m_rebinnedLightCount;
+    }
+} // namespace AZ::Render
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::Render
+{
+    //! The light feature processors that publish their lights to the shared clustered light list.
+    enum class ClusteredLightSource : uint32_t
+    {
+        Point,
+        SimpleSpot,
+        Disk,
+        Capsule,
+        Polygon,
+        Count
+    };
+
+    //! ClusteredLightList holds the bounding spheres of the lights of every light feature processor in one compacted list,
+    //! so lights of all types are assigned to clusters in a single pass. The lights of each source are stored contiguously
+    //! in the order of the source's light buffer, so a compacted light index maps back to a source and a light buffer index.
+    //! Each light records the version of the list in which its bounds last changed, which lets cluster assignments only
+    //! re-bin the lights that moved.
+    class ClusteredLightList
+    {
+    public:
+        struct LightReference
+        {
+            ClusteredLightSource m_source = ClusteredLightSource::Count;
+            uint32_t m_lightIndex = 0;
+        };
+
+        //! Replaces the lights of a source. Lights whose bounds are unchanged keep their change version.
+        //! If the number of lights changes, the compacted indices of the lights of later sources change as well.
+        void SetSourceLights(ClusteredLightSource source, AZStd::span<const AZ::Sphere> bounds);
+
+        //! Removes every light of every source.
+        void Clear();
+
+        uint32_t GetLightCount() const;
+        const AZStd::vector<AZ::Sphere>& GetBounds() const;
+        //! Returns, for each light, the version in which its bounds last changed.
+        const AZStd::vector<uint32_t>& GetChangeVersions() const;
+        //! Returns the source and light buffer index of a compacted light index.
+        LightReference GetLight(uint32_t compactedIndex) const;
+        //! Returns the first compacted light index of a source.
+        uint32_t GetSourceOffset(ClusteredLightSource source) const;
+
+        //! Incremented whenever any light changes.
+        uint32_t GetVersion() const;
+        //! Incremented whenever the compacted light indices change, which invalidates any previous assignment.
+        uint32_t GetLayoutVersion() const;
+
+    private:
+        static constexpr uint32_t SourceCount = static_cast<uint32_t>(ClusteredLightSource::Count);
+
+        AZStd::vector<AZ::Sphere> m_bounds;
+        AZStd::vector<uint32_t> m_changeVersions;
+        AZStd::array<uint32_t, SourceCount> m_sourceOffsets = {};
+        AZStd::array<uint32_t, SourceCount> m_sourceCounts = {};
+        uint32_t m_version = 1;
+        uint32_t m_layoutVersion = 1;
+    };
+
+    //! Describes the cluster (froxel) grid of a perspective view. View space looks down -Z, as with the matrices of RPI::View.
+    //! Tiles are evenly spaced across the view, starting from the top left, and depth slices are spaced exponentially between
+    //! the near and far depths. The last depth slice extends to infinity.
+    struct ClusterGridDescriptor
+    {
+        AZ::Matrix3x4 m_worldToView = AZ::Matrix3x4::CreateIdentity();
+        float m_tanHalfFovX = 1.0f;
+        float m_tanHalfFovY = 1.0f;
+        float m_nearDepth = 0.1f;
+        float m_farDepth = 1000.0f;
+        uint32_t m_tileCountX = 16;
+        uint32_t m_tileCountY = 8;
+        uint32_t m_sliceCount = 24;
+
+        bool operator==(const ClusterGridDescriptor& rhs) const;
+        bool operator!=(const ClusterGridDescriptor& rhs) const;
+    };
+
+    //! ClusteredLightAssignment assigns the lights of a ClusteredLightList to the clusters of one view on the CPU, as a
+    //! GPU independent alternative and reference to the light culling passes. Each light's sphere is transformed to view
+    //! space and bounded in tile and slice coordinates four lights at a time with SIMD, then the light is added to every
+    //! cluster in that range. The per-cluster light lists are stored compacted, one after another, in ascending compacted
+    //! light index order. The assignment is conservative: a light may be assigned to a cluster its sphere doesn't touch,
+    //! but never misses a cluster its sphere does touch.
+    //! While the grid is unchanged, only the lights that changed since the previous update are re-bounded.
+    class ClusteredLightAssignment
+    {
+    public:
+        //! The range of clusters touched by a light, with exclusive ends. Empty if the light is outside of the view.
+        struct ClusterRange
+        {
+            uint16_t m_beginX = 0;
+            uint16_t m_endX = 0;
+            uint16_t m_beginY = 0;
+            uint16_t m_endY = 0;
+            uint16_t m_beginSlice = 0;
+            uint16_t m_endSlice = 0;
+
+            bool IsEmpty() const;
+        };
+
+        //! Assigns the lights to the clusters of the grid.
+        //! @param parallel when true, the clusters are filled by slice on the task graph
+        void Update(const ClusteredLightList& lightList, const ClusterGridDescriptor& grid, bool parallel);
+
+        //! Discards the cached light bounds, so the next update re-bins every light.
+        void Invalidate();
+
+        const ClusterGridDescriptor& GetGrid() const;
+        uint32_t GetClusterCount() const;
+        uint32_t GetClusterIndex(uint32_t tileX, uint32_t tileY, uint32_t slice) const;
+
+        //! Returns the compacted light indices assigned to a cluster, in ascending order.
+        AZStd::span<const uint32_t> GetClusterLights(uint32_t clusterIndex) const;
+
+        //! Returns the clusters touched by a light at the last update.
+        const ClusterRange& GetLightClusterRange(uint32_t compactedIndex) const;
+
+        //! Returns the total number of light indices stored for all clusters.
+        uint32_t GetAssignedLightIndexCount() const;
+
+        //! Returns the number of lights that were re-bounded in the last update.
+        uint32_t GetRebinnedLightCount() const;
+
+    private:
+        void CalculateClusterRanges(const ClusteredLightList& lightList);
+        void CountClusterLights(uint32_t beginSlice, uint32_t endSlice);
+        void FillClusterLights(uint32_t beginSlice, uint32_t endSlice);
+        uint32_t GetSliceIndex(float depth) const;
+
+        ClusterGridDescriptor m_grid;
+        bool m_hasGrid = false;
+        uint32_t m_lightListLayoutVersion = 0;
+        uint32_t m_lightListVersion = 0;
+
+        AZStd::vector<ClusterRange> m_lightClusterRanges;
+        AZStd::vector<uint32_t> m_dirtyLights;
+
+        // Compacted per-cluster light lists: the lights of cluster i are m_clusterLightIndices[m_clusterOffsets[i], m_clusterOffsets[i + 1])
+        AZStd::vector<uint32_t> m_clusterOffsets;
+        AZStd::vector<uint32_t> m_clusterLightIndices;
+        // The next index to write to for each cluster while filling the light lists
+        AZStd::vector<uint32_t> m_clusterCursors;
+
+        // Scratch storage for transforming the dirty lights to view space four at a time
+        AZStd::vector<float> m_scratchX;
+        AZStd::vector<float> m_scratchY;
+        AZStd::vector<float> m_scratchZ;
+        AZStd::vector<float> m_scratchRadius;
+
+        float m_sliceScale = 0.0f;
+        uint32_t m_rebinnedLightCount = 0;
+    };
+} // namespace AZ::Render
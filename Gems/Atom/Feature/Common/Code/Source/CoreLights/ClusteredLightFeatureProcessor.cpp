@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/ClusteredLightFeatureProcessor.h>
+
+#include <Atom/RHI/RHIUtils.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/Console/IConsole.h>
+
+AZ_CVAR(bool, r_cpuLightClustering, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Assigns the point, spot, disk, capsule and polygon lights to the clusters of each camera view on the CPU");
+AZ_CVAR(uint32_t, r_cpuLightClusteringTileCountX, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of cluster columns across each view for CPU light clustering");
+AZ_CVAR(uint32_t, r_cpuLightClusteringTileCountY, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of cluster rows across each view for CPU light clustering");
+AZ_CVAR(uint32_t, r_cpuLightClusteringSliceCount, 24, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of exponentially spaced depth slices for CPU light clustering");
+AZ_CVAR(float, r_cpuLightClusteringFarDepth, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Depth of the start of the last slice for CPU light clustering. Lights beyond it are all assigned to the last slice");
+AZ_CVAR(uint32_t, r_cpuLightClusteringParallelMinLights, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Minimum number of lights for the clusters of a view to be filled in parallel");
+
+namespace AZ::Render
+{
+    namespace
+    {
+        AZ::Sphere GetBoundingSphere(const AZ::Capsule& capsule)
+        {
+            return AZ::Sphere(capsule.GetCenter(), 0.5f * capsule.GetCylinderHeight() + capsule.GetRadius());
+        }
+
+        AZ::Sphere GetBoundingSphere(const MeshCommon::BoundsVariant& bounds)
+        {
+            if (AZStd::holds_alternative<Sphere>(bounds))
+            {
+                return AZStd::get<Sphere>(bounds);
+            }
+            else if (AZStd::holds_alternative<Hemisphere>(bounds))
+            {
+                const Hemisphere& hemisphere = AZStd::get<Hemisphere>(bounds);
+                return AZ::Sphere(hemisphere.GetCenter(), hemisphere.GetRadius());
+            }
+            else if (AZStd::holds_alternative<Frustum>(bounds))
+            {
+                Frustum::CornerVertexArray corners;
+                if (AZStd::get<Frustum>(bounds).GetCorners(corners))
+                {
+                    AZ::Aabb aabb = AZ::Aabb::CreateNull();
+                    for (const AZ::Vector3& corner : corners)
+                    {
+                        aabb.AddPoint(corner);
+                    }
+                    return AZ::Sphere::CreateFromAabb(aabb);
+                }
+            }
+            else if (AZStd::holds_alternative<Aabb>(bounds))
+            {
+                return AZ::Sphere::CreateFromAabb(AZStd::get<Aabb>(bounds));
+            }
+            else if (AZStd::holds_alternative<Capsule>(bounds))
+            {
+                return GetBoundingSphere(AZStd::get<Capsule>(bounds));
+            }
+
+            // Lights without bounds don't affect anything
+            return AZ::Sphere(AZ::Vector3::CreateZero(), 0.0f);
+        }
+    } // namespace
+
+    void ClusteredLightFeatureProcessor::Reflect(ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+        {
+            serializeContext
+                ->Class<ClusteredLightFeatureProcessor, FeatureProcessor>()
+                ->Version(0);
+        }
+    }
+
+    ClusteredLightFeatureProcessor* ClusteredLightFeatureProcessor::GetEnabled(RPI::Scene* scene)
+    {
+        return r_cpuLightClustering ? scene->GetFeatureProcessor<ClusteredLightFeatureProcessor>() : nullptr;
+    }
+
+    void ClusteredLightFeatureProcessor::ClearLights(RPI::Scene* scene, ClusteredLightSource source)
+    {
+        if (auto* clusteredLightFeatureProcessor = scene->GetFeatureProcessor<ClusteredLightFeatureProcessor>())
+        {
+            clusteredLightFeatureProcessor->SetLights(source, AZStd::span<const AZ::Sphere>());
+        }
+    }
+
+    void ClusteredLightFeatureProcessor::Activate()
+    {
+    }
+
+    void ClusteredLightFeatureProcessor::Deactivate()
+    {
+        m_lightList.Clear();
+        m_viewClusters = {};
+        m_stagedLights = {};
+    }
+
+    void ClusteredLightFeatureProcessor::SetLights(ClusteredLightSource source, AZStd::span<const AZ::Sphere> bounds)
+    {
+        StagedLights& stagedLights = GetStagedLights(source);
+        stagedLights.m_bounds.assign(bounds.begin(), bounds.end());
+        stagedLights.m_isDirty = true;
+    }
+
+    void ClusteredLightFeatureProcessor::SetLights(ClusteredLightSource source, AZStd::span<const AZ::Capsule> bounds)
+    {
+        StagedLights& stagedLights = GetStagedLights(source);
+        stagedLights.m_bounds.clear();
+        for (const AZ::Capsule& capsule : bounds)
+        {
+            stagedLights.m_bounds.push_back(GetBoundingSphere(capsule));
+        }
+        stagedLights.m_isDirty = true;
+    }
+
+    void ClusteredLightFeatureProcessor::SetLights(ClusteredLightSource source, AZStd::span<const MeshCommon::BoundsVariant> bounds)
+    {
+        StagedLights& stagedLights = GetStagedLights(source);
+        stagedLights.m_bounds.clear();
+        for (const MeshCommon::BoundsVariant& lightBounds : bounds)
+        {
+            stagedLights.m_bounds.push_back(GetBoundingSphere(lightBounds));
+        }
+        stagedLights.m_isDirty = true;
+    }
+
+    ClusteredLightFeatureProcessor::StagedLights& ClusteredLightFeatureProcessor::GetStagedLights(ClusteredLightSource source)
+    {
+        const size_t sourceIndex = static_cast<size_t>(source);
+        AZ_Assert(sourceIndex < m_stagedLights.size(), "Invalid clustered light source %zu", sourceIndex);
+        return m_stagedLights[sourceIndex];
+    }
+
+    void ClusteredLightFeatureProcessor::ApplyStagedLights()
+    {
+        for (size_t sourceIndex = 0; sourceIndex < m_stagedLights.size(); ++sourceIndex)
+        {
+            StagedLights& stagedLights = m_stagedLights[sourceIndex];
+            if (stagedLights.m_isDirty)
+            {
+                m_lightList.SetSourceLights(static_cast<ClusteredLightSource>(sourceIndex), stagedLights.m_bounds);
+                stagedLights.m_isDirty = false;
+            }
+        }
+    }
+
+    void ClusteredLightFeatureProcessor::Render(const RenderPacket& packet)
+    {
+        // The light feature processors publish their lights from Simulate, which runs in parallel across feature processors,
+        // so they are only merged into the shared light list here.
+        ApplyStagedLights();
+
+        if (!r_cpuLightClustering)
+        {
+            m_viewClusters.clear();
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(RPI, "ClusteredLightFeatureProcessor: Render");
+
+        const bool parallel = m_lightList.GetLightCount() >= r_cpuLightClusteringParallelMinLights;
+
+        // Keep the assignments of views that are still rendered, so only the lights that moved are re-binned
+        AZStd::vector<ViewClusters> previousViewClusters = AZStd::move(m_viewClusters);
+        m_viewClusters.clear();
+        for (const RPI::ViewPtr& view : packet.m_views)
+        {
+            ClusterGridDescriptor grid;
+            if (!RHI::CheckBitsAll(view->GetUsageFlags(), RPI::View::UsageFlags::UsageCamera) || !BuildClusterGrid(*view, grid))
+            {
+                continue;
+            }
+
+            ViewClusters viewClusters;
+            viewClusters.m_view = view.get();
+            for (ViewClusters& previous : previousViewClusters)
+            {
+                if (previous.m_view == view.get())
+                {
+                    viewClusters.m_assignment = AZStd::move(previous.m_assignment);
+                    break;
+                }
+            }
+
+            if (!viewClusters.m_assignment)
+            {
+                viewClusters.m_assignment = AZStd::make_unique<ClusteredLightAssignment>();
+            }
+
+            viewClusters.m_assignment->Update(m_lightList, grid, parallel);
+            m_viewClusters.push_back(AZStd::move(viewClusters));
+        }
+    }
+
+    bool ClusteredLightFeatureProcessor::BuildClusterGrid(const RPI::View& view, ClusterGridDescriptor& grid)
+    {
+        const AZ::Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+        if (viewToClip.GetElement(3, 3) != 0.0f)
+        {
+            // Orthographic views aren't clustered
+            return false;
+        }
+
+        // Perspective projections map depth with m22 = f / (n - f), m23 = n * f / (n - f), or with n and f swapped for reverse
+        // depth. Either way, m23 / m22 and m23 / (m22 + 1) are the near and far distances in some order.
+        const float m22 = viewToClip.GetElement(2, 2);
+        const float m23 = viewToClip.GetElement(2, 3);
+        if (m22 == 0.0f || m22 == -1.0f)
+        {
+            return false;
+        }
+        const float depthA = m23 / m22;
+        const float depthB = m23 / (m22 + 1.0f);
+        const float nearDepth = AZStd::min(depthA, depthB);
+        if (!(nearDepth > 0.0f))
+        {
+            return false;
+        }
+
+        grid.m_worldToView = view.GetWorldToViewMatrixAsMatrix3x4();
+        grid.m_tanHalfFovX = 1.0f / viewToClip.GetElement(0, 0);
+        grid.m_tanHalfFovY = 1.0f / viewToClip.GetElement(1, 1);
+        grid.m_nearDepth = nearDepth;
+        grid.m_farDepth = AZStd::max<float>(r_cpuLightClusteringFarDepth, nearDepth * 2.0f);
+        grid.m_tileCountX = AZStd::max<uint32_t>(r_cpuLightClusteringTileCountX, 1);
+        grid.m_tileCountY = AZStd::max<uint32_t>(r_cpuLightClusteringTileCountY, 1);
+        grid.m_sliceCount = AZStd::max<uint32_t>(r_cpuLightClusteringSliceCount, 1);
+        return true;
+    }
+
+    const ClusteredLightList& ClusteredLightFeatureProcessor::GetLightList() const
+    {
+        return m_lightList;
+    }
+
+    const ClusteredLightAssignment* ClusteredLightFeatureProcessor::GetViewClusters(const RPI::View* view) const
+    {
+        for (const ViewClusters& viewClusters : m_viewClusters)
+        {
+            if (viewClusters.m_view == view)
+            {
+                return viewClusters.m_assignment.get();
+            }
+        }
+        return nullptr;
+    }
+} // namespace AZ::Render
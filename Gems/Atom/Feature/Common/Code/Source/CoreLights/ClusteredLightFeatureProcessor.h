@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/Mesh/MeshCommon.h>
+#include <Atom/RPI.Public/FeatureProcessor.h>
+#include <CoreLights/ClusteredLightAssignment.h>
+
+namespace AZ::Render
+{
+    //! Assigns the lights of the point, spot, disk, capsule and polygon light feature processors to the clusters of each
+    //! camera view on the CPU, when r_cpuLightClustering is enabled. The light feature processors publish the bounds of
+    //! their lights during Simulate, which are merged into one shared compacted light list and binned per view during Render.
+    //! The results are not used for GPU shading, which relies on the light culling passes. They serve CPU side consumers
+    //! and give a GPU independent reference for light assignment.
+    class ClusteredLightFeatureProcessor final
+        : public RPI::FeatureProcessor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ClusteredLightFeatureProcessor, AZ::SystemAllocator)
+        AZ_RTTI(AZ::Render::ClusteredLightFeatureProcessor, "{61DFC9FC-31ED-4306-8448-845F21A73C90}", AZ::RPI::FeatureProcessor);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Returns the clustered light feature processor of the scene if CPU light clustering is enabled, otherwise nullptr.
+        static ClusteredLightFeatureProcessor* GetEnabled(RPI::Scene* scene);
+
+        //! Removes the lights of a source from the clustered light feature processor of the scene, if there is one.
+        static void ClearLights(RPI::Scene* scene, ClusteredLightSource source);
+
+        ClusteredLightFeatureProcessor() = default;
+        virtual ~ClusteredLightFeatureProcessor() = default;
+
+        // FeatureProcessor overrides ...
+        void Activate() override;
+        void Deactivate() override;
+        void Render(const RenderPacket& packet) override;
+
+        //! Replaces the lights of a source, in the order of the source's light buffer. The lights are staged per source, so
+        //! different sources can call this at the same time from Simulate. They are applied to the light list in Render.
+        void SetLights(ClusteredLightSource source, AZStd::span<const AZ::Sphere> bounds);
+        void SetLights(ClusteredLightSource source, AZStd::span<const AZ::Capsule> bounds);
+        void SetLights(ClusteredLightSource source, AZStd::span<const MeshCommon::BoundsVariant> bounds);
+
+        const ClusteredLightList& GetLightList() const;
+
+        //! Returns the cluster assignment of a view from the last Render, or nullptr if the view wasn't clustered.
+        const ClusteredLightAssignment* GetViewClusters(const RPI::View* view) const;
+
+    private:
+        ClusteredLightFeatureProcessor(const ClusteredLightFeatureProcessor&) = delete;
+
+        struct ViewClusters
+        {
+            const RPI::View* m_view = nullptr;
+            AZStd::unique_ptr<ClusteredLightAssignment> m_assignment;
+        };
+
+        //! The lights of a source published since the last Render. Only the feature processor of that source writes to it.
+        struct StagedLights
+        {
+            AZStd::vector<AZ::Sphere> m_bounds;
+            bool m_isDirty = false;
+        };
+
+        //! Builds the cluster grid of a perspective view, returning false for other projections.
+        static bool BuildClusterGrid(const RPI::View& view, ClusterGridDescriptor& grid);
+
+        StagedLights& GetStagedLights(ClusteredLightSource source);
+
+        //! Applies the staged lights of every source to the light list. Called from Render, after all sources finished Simulate.
+        void ApplyStagedLights();
+
+        ClusteredLightList m_lightList;
+        AZStd::vector<ViewClusters> m_viewClusters;
+        AZStd::array<StagedLights, static_cast<size_t>(ClusteredLightSource::Count)> m_stagedLights;
+    };
+} // namespace AZ::Render
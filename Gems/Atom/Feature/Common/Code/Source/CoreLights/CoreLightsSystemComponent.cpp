@@ -24,6 +24,7 @@
 #include <CoreLights/SimplePointLightFeatureProcessor.h>
 #include <CoreLights/SimpleSpotLightFeatureProcessor.h>
 #include <CoreLights/CapsuleLightFeatureProcessor.h>
+#include <CoreLights/ClusteredLightFeatureProcessor.h>
 #include <CoreLights/DepthExponentiationPass.h>
 #include <CoreLights/DirectionalLightFeatureProcessor.h>
 #include <CoreLights/DiskLightFeatureProcessor.h>
@@ -73,6 +74,7 @@ namespace AZ
             CapsuleLightFeatureProcessor::Reflect(context);
             QuadLightFeatureProcessor::Reflect(context);
             PolygonLightFeatureProcessor::Reflect(context);
+            ClusteredLightFeatureProcessor::Reflect(context);
 
             EsmShadowmapsPassData::Reflect(context);
 
@@ -126,6 +128,7 @@ namespace AZ
             AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessorWithInterface<CapsuleLightFeatureProcessor, CapsuleLightFeatureProcessorInterface>();
             AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessorWithInterface<QuadLightFeatureProcessor, QuadLightFeatureProcessorInterface>();
             AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessorWithInterface<PolygonLightFeatureProcessor, PolygonLightFeatureProcessorInterface>();
+            AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessor<ClusteredLightFeatureProcessor>();
 
             auto* passSystem = RPI::PassSystemInterface::Get();
             AZ_Assert(passSystem, "Cannot get the pass system.");
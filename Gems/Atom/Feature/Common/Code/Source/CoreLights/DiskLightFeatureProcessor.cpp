@@ -7,6 +7,7 @@
  */
 
 #include <CoreLights/DiskLightFeatureProcessor.h>
+#include <CoreLights/ClusteredLightFeatureProcessor.h>
 #include <CoreLights/SpotLightUtils.h>
 #include <Mesh/MeshFeatureProcessor.h>
 
@@ -66,6 +67,7 @@ namespace AZ
 
         void DiskLightFeatureProcessor::Deactivate()
         {
+            ClusteredLightFeatureProcessor::ClearLights(GetParentScene(), ClusteredLightSource::Disk);
             m_lightData.Clear();
             m_lightBufferHandler.Release();
         }
@@ -143,6 +145,11 @@ namespace AZ
                 m_deviceBufferNeedsUpdate = false;
             }
 
+            if (ClusteredLightFeatureProcessor* clusteredLightFeatureProcessor = ClusteredLightFeatureProcessor::GetEnabled(GetParentScene()))
+            {
+                clusteredLightFeatureProcessor->SetLights(ClusteredLightSource::Disk, AZStd::span(m_lightData.GetDataVector<1>()));
+            }
+
             if (r_enablePerMeshShaderOptionFlags)
             {
                 // Helper lambdas
@@ -7,6 +7,7 @@
  */
 
 #include <CoreLights/PointLightFeatureProcessor.h>
+#include <CoreLights/ClusteredLightFeatureProcessor.h>
 #include <CoreLights/LightCommon.h>
 #include <Mesh/MeshFeatureProcessor.h>
 
@@ -71,6 +72,7 @@ namespace AZ
 
         void PointLightFeatureProcessor::Deactivate()
         {
+            ClusteredLightFeatureProcessor::ClearLights(GetParentScene(), ClusteredLightSource::Point);
             m_lightData.Clear();
             m_lightBufferHandler.Release();
         }
@@ -152,6 +154,11 @@ namespace AZ
                 m_deviceBufferNeedsUpdate = false;
             }
 
+            if (ClusteredLightFeatureProcessor* clusteredLightFeatureProcessor = ClusteredLightFeatureProcessor::GetEnabled(GetParentScene()))
+            {
+                clusteredLightFeatureProcessor->SetLights(ClusteredLightSource::Point, AZStd::span(m_lightData.GetDataVector<1>()));
+            }
+
             if (r_enablePerMeshShaderOptionFlags)
             {
                 auto hasShadow = [&](const AZ::Sphere& sphere) -> bool
@@ -7,6 +7,7 @@
  */
 
 #include <CoreLights/PolygonLightFeatureProcessor.h>
+#include <CoreLights/ClusteredLightFeatureProcessor.h>
 #include <CoreLights/LtcCommon.h>
 #include <Mesh/MeshFeatureProcessor.h>
 
@@ -72,6 +73,7 @@ namespace AZ::Render
 
     void PolygonLightFeatureProcessor::Deactivate()
     {
+        ClusteredLightFeatureProcessor::ClearLights(GetParentScene(), ClusteredLightSource::Polygon);
         m_lightData.Clear();
         m_lightBufferHandler.Release();
         m_lightPolygonPointBufferHandler.Release();
@@ -155,6 +157,11 @@ namespace AZ::Render
             m_deviceBufferNeedsUpdate = false;
         }
 
+        if (ClusteredLightFeatureProcessor* clusteredLightFeatureProcessor = ClusteredLightFeatureProcessor::GetEnabled(GetParentScene()))
+        {
+            clusteredLightFeatureProcessor->SetLights(ClusteredLightSource::Polygon, AZStd::span(m_lightData.GetDataVector<2>()));
+        }
+
         if (r_enablePerMeshShaderOptionFlags)
         {
             MeshCommon::MarkMeshesWithFlag(GetParentScene(), AZStd::span(m_lightData.GetDataVector<2>()), m_lightMeshFlag.GetIndex());
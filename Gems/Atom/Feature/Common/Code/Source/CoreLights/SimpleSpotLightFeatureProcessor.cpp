@@ -7,6 +7,7 @@
  */
 
 #include <CoreLights/SimpleSpotLightFeatureProcessor.h>
+#include <CoreLights/ClusteredLightFeatureProcessor.h>
 #include <CoreLights/SpotLightUtils.h>
 #include <Mesh/MeshFeatureProcessor.h>
 #include <Atom/Feature/CoreLights/CoreLightsConstants.h>
@@ -66,7 +67,9 @@ namespace AZ
         void SimpleSpotLightFeatureProcessor::Deactivate()
         {
             DisableSceneNotification();
+            ClusteredLightFeatureProcessor::ClearLights(GetParentScene(), ClusteredLightSource::SimpleSpot);
             m_lightData.Clear();
+            m_clusteredLightBounds = {};
             m_lightBufferHandler.Release();
             for (auto& handler : m_visibleSpotLightsBufferHandlers)
             {
@@ -178,6 +181,16 @@ namespace AZ
                 m_deviceBufferNeedsUpdate = false;
             }
 
+            if (ClusteredLightFeatureProcessor* clusteredLightFeatureProcessor = ClusteredLightFeatureProcessor::GetEnabled(GetParentScene()))
+            {
+                m_clusteredLightBounds.clear();
+                for (const ExtraData& extraData : m_lightData.GetDataVector<1>())
+                {
+                    m_clusteredLightBounds.push_back(extraData.m_boundsVariant);
+                }
+                clusteredLightFeatureProcessor->SetLights(ClusteredLightSource::SimpleSpot, AZStd::span(m_clusteredLightBounds));
+            }
+
             if (r_enablePerMeshShaderOptionFlags)
             {
                 const uint32_t lightAndShadow = m_lightMeshFlag.GetIndex() | m_shadowMeshFlag.GetIndex();
@@ -118,6 +118,8 @@ namespace AZ
             };
 
             MultiIndexedDataVector<SimpleSpotLightData, ExtraData> m_lightData;
+            // Bounds of each light in light buffer order, gathered for the clustered light feature processor
+            AZStd::vector<MeshCommon::BoundsVariant> m_clusteredLightBounds;
             GpuBufferHandler m_lightBufferHandler;
             RHI::Handle<uint32_t> m_lightMeshFlag;
             RHI::Handle<uint32_t> m_shadowMeshFlag;
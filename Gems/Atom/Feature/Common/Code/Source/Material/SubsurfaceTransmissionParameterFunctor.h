@@ -29,6 +29,7 @@ namespace AZ
 
             using RPI::MaterialFunctor::Process;
             void Process(RPI::MaterialFunctorAPI::RuntimeContext& context) override;
+            bool SupportsParallelProcessing() const override { return true; }
             bool UpdateShaderParameterConnections(const RPI::MaterialShaderParameterLayout* layout) override;
 
         private:
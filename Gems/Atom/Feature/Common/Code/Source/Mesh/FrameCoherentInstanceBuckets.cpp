@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/FrameCoherentInstanceBuckets.h>
+#include <Mesh/MeshInstanceGroupList.h>
+
+#include <algorithm>
+
+namespace AZ::Render
+{
+    bool FrameCoherentInstanceBuckets::BeginFrame(const void* view, uint32_t layoutVersion, uint32_t objectCapacity, uint32_t bucketCount)
+    {
+        if (view != m_view || layoutVersion != m_layoutVersion || bucketCount != m_buckets.size())
+        {
+            Invalidate();
+            m_view = view;
+            m_layoutVersion = layoutVersion;
+            m_buckets.resize(bucketCount);
+        }
+
+        if (m_objects.size() < objectCapacity)
+        {
+            // New objects have never been visible, so growing doesn't affect the tracked visibility
+            m_objects.resize(objectCapacity);
+        }
+
+        // Visibility recorded in a full rebuild frame is still tracked, so the next frame can be incremental
+        m_fullRebuild = m_frame == 0 || m_trackingDisabled;
+        ++m_frame;
+        m_duplicateVisibleObject = false;
+        m_changedInstanceCount = 0;
+        m_resortedBucketCount = 0;
+        return m_fullRebuild;
+    }
+
+    bool FrameCoherentInstanceBuckets::MarkVisible(ObjectId objectId, const void* instanceList, float depth)
+    {
+        const uint32_t objectIndex = objectId.GetIndex();
+        if (objectIndex >= m_objects.size())
+        {
+            AZ_Assert(false, "Object id %u is out of range of the %zu objects tracked for this view", objectIndex, m_objects.size());
+            m_duplicateVisibleObject = true;
+            return true;
+        }
+
+        ObjectVisibility& object = m_objects[objectIndex];
+        const uint32_t previousVisibleFrame = object.m_visibleFrame.exchange(m_frame);
+        if (previousVisibleFrame == m_frame)
+        {
+            // The object is visible with more than one instance list, such as with overlapping lod ranges. Only one
+            // instance list is tracked per object, so the frame must be rebuilt from scratch.
+            m_duplicateVisibleObject = true;
+            return true;
+        }
+
+        object.m_depth = depth;
+        if (!m_fullRebuild && previousVisibleFrame + 1 == m_frame && object.m_instanceList == instanceList)
+        {
+            // The instances from the previous frame are still in their buckets
+            return false;
+        }
+
+        object.m_instanceList = instanceList;
+        object.m_insertedFrame = m_frame;
+        return true;
+    }
+
+    bool FrameCoherentInstanceBuckets::IsFullRebuildRequired() const
+    {
+        return !m_fullRebuild && m_duplicateVisibleObject;
+    }
+
+    void FrameCoherentInstanceBuckets::BeginFullRebuild()
+    {
+        m_fullRebuild = true;
+        m_trackingDisabled = true;
+    }
+
+    void FrameCoherentInstanceBuckets::UpdateBucket(uint32_t bucketIndex, AZStd::span<SortInstanceData> insertedInstances, float resortThreshold)
+    {
+        Bucket& bucket = m_buckets[bucketIndex];
+        if (m_fullRebuild)
+        {
+            bucket.m_instances.assign(insertedInstances.begin(), insertedInstances.end());
+            std::sort(bucket.m_instances.begin(), bucket.m_instances.end());
+            m_changedInstanceCount += aznumeric_cast<uint32_t>(insertedInstances.size());
+            ++m_resortedBucketCount;
+            return;
+        }
+
+        std::sort(insertedInstances.begin(), insertedInstances.end());
+
+        AZStd::vector<SortInstanceData>& merged = bucket.m_scratch;
+        merged.clear();
+        merged.reserve(bucket.m_instances.size() + insertedInstances.size());
+
+        uint32_t removedCount = 0;
+        auto insertedIter = insertedInstances.begin();
+        for (SortInstanceData& instance : bucket.m_instances)
+        {
+            const ObjectVisibility& object = m_objects[instance.m_objectId.GetIndex()];
+            if (object.m_visibleFrame.load(AZStd::memory_order_relaxed) != m_frame || object.m_insertedFrame == m_frame)
+            {
+                // Either the object is no longer visible, or its current instances were inserted again this frame
+                ++removedCount;
+                continue;
+            }
+
+            // Sort transparent objects in reverse by making their depths negative.
+            instance.m_depth = instance.m_instanceGroupHandle->m_isTransparent ? -object.m_depth : object.m_depth;
+
+            // Both lists are ordered by instance group, so the merged list stays grouped even though the refreshed depths
+            // of the retained instances may no longer be in order
+            while (insertedIter != insertedInstances.end() && *insertedIter < instance)
+            {
+                merged.push_back(*insertedIter++);
+            }
+            merged.push_back(instance);
+        }
+        merged.insert(merged.end(), insertedIter, insertedInstances.end());
+        bucket.m_instances.swap(merged);
+
+        const uint32_t changedCount = removedCount + aznumeric_cast<uint32_t>(insertedInstances.size());
+        m_changedInstanceCount += changedCount;
+        if (changedCount > 0 && aznumeric_cast<float>(changedCount) > resortThreshold * aznumeric_cast<float>(bucket.m_instances.size()))
+        {
+            std::sort(bucket.m_instances.begin(), bucket.m_instances.end());
+            ++m_resortedBucketCount;
+        }
+        else
+        {
+            SortTransparentGroups(bucket.m_instances);
+        }
+    }
+
+    void FrameCoherentInstanceBuckets::SortTransparentGroups(AZStd::vector<SortInstanceData>& instances) const
+    {
+        auto groupBegin = instances.begin();
+        while (groupBegin != instances.end())
+        {
+            const InstanceGroupHandle instanceGroupHandle = groupBegin->m_instanceGroupHandle;
+            auto groupEnd = groupBegin + 1;
+            while (groupEnd != instances.end() && groupEnd->m_instanceGroupHandle == instanceGroupHandle)
+            {
+                ++groupEnd;
+            }
+
+            if (instanceGroupHandle->m_isTransparent)
+            {
+                std::sort(groupBegin, groupEnd);
+            }
+            groupBegin = groupEnd;
+        }
+    }
+
+    const AZStd::vector<FrameCoherentInstanceBuckets::SortInstanceData>& FrameCoherentInstanceBuckets::GetBucketInstances(
+        uint32_t bucketIndex) const
+    {
+        return m_buckets[bucketIndex].m_instances;
+    }
+
+    void FrameCoherentInstanceBuckets::Invalidate()
+    {
+        m_objects.clear();
+        m_buckets.clear();
+        m_view = nullptr;
+        m_frame = 0;
+        m_fullRebuild = true;
+        m_trackingDisabled = false;
+    }
+
+    uint32_t FrameCoherentInstanceBuckets::GetChangedInstanceCount() const
+    {
+        return m_changedInstanceCount;
+    }
+
+    uint32_t FrameCoherentInstanceBuckets::GetResortedBucketCount() const
+    {
+        return m_resortedBucketCount;
+    }
+} // namespace AZ::Render
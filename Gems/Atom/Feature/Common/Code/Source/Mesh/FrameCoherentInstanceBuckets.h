@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/TransformService/TransformServiceFeatureProcessorInterface.h>
+#include <Atom/Utils/StableDynamicArray.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZ::Render
+{
+    struct MeshInstanceGroupData;
+
+    //! FrameCoherentInstanceBuckets keeps the sorted instance buckets of a single view alive between frames.
+    //! Instead of scattering and sorting every visible instance each frame, the caller reports each visible object with
+    //! MarkVisible, and only inserts the instances of objects that were not visible with the same instance list in the
+    //! previous frame. UpdateBucket then drops the instances of objects that are no longer visible, refreshes the depth of
+    //! the instances that remain visible, and merges the inserted instances into the previous frame's order. A bucket is
+    //! only fully re-sorted when the fraction of its instances that changed exceeds the resort threshold, so the order
+    //! within an instance group may drift slightly out of depth order while the camera moves. Transparent instance groups
+    //! are always re-sorted since their instances must be drawn back to front.
+    class FrameCoherentInstanceBuckets
+    {
+    public:
+        using InstanceGroupHandle = StableDynamicArrayWeakHandle<MeshInstanceGroupData>;
+        using ObjectId = TransformServiceFeatureProcessorInterface::ObjectId;
+
+        // SortInstanceData represents the data needed to do the sorting (sort by instance group, then by depth)
+        // as well as the data being sorted (ObjectId)
+        struct SortInstanceData
+        {
+            InstanceGroupHandle m_instanceGroupHandle;
+            float m_depth = 0.0f;
+            ObjectId m_objectId;
+
+            bool operator<(const SortInstanceData& rhs) const
+            {
+                return AZStd::tie(m_instanceGroupHandle, m_depth) < AZStd::tie(rhs.m_instanceGroupHandle, rhs.m_depth);
+            }
+        };
+
+        //! Starts a new frame for the view.
+        //! @param view identifies the view these buckets belong to; a different view invalidates the buckets
+        //! @param layoutVersion the version of the instance group layout; a different version invalidates the buckets,
+        //!        since instance group handles and object ids may have been released and reused
+        //! @param objectCapacity one more than the largest object id index that may be visible this frame
+        //! @param bucketCount the number of instance group buckets
+        //! @return true if every visible instance must be inserted this frame
+        bool BeginFrame(const void* view, uint32_t layoutVersion, uint32_t objectCapacity, uint32_t bucketCount);
+
+        //! Records that an object is visible this frame. Safe to call concurrently for different objects.
+        //! @param objectId the object that is visible
+        //! @param instanceList identifies the list of instances the object is visible with, such as the instances of a lod
+        //! @param depth the depth of the object from the view
+        //! @return true if the instances of the object must be inserted into their buckets this frame
+        bool MarkVisible(ObjectId objectId, const void* instanceList, float depth);
+
+        //! Returns true if visibility could not be tracked incrementally this frame, because an object was reported
+        //! visible more than once. The caller must then insert every visible instance, as in a full rebuild.
+        //! Tracking stays disabled until the buckets are invalidated.
+        bool IsFullRebuildRequired() const;
+
+        //! Switches the current frame to a full rebuild, after IsFullRebuildRequired returned true.
+        void BeginFullRebuild();
+
+        //! Updates a bucket from the instances inserted this frame and the instances that remain visible since the
+        //! previous frame. Safe to call concurrently for different buckets.
+        //! @param bucketIndex the bucket to update
+        //! @param insertedInstances the instances inserted into the bucket this frame; reordered by the call
+        //! @param resortThreshold the fraction of the bucket that must change for the bucket to be fully re-sorted
+        void UpdateBucket(uint32_t bucketIndex, AZStd::span<SortInstanceData> insertedInstances, float resortThreshold);
+
+        //! Returns the instances in a bucket, grouped by instance group.
+        const AZStd::vector<SortInstanceData>& GetBucketInstances(uint32_t bucketIndex) const;
+
+        //! Discards all buckets and tracked visibility, so the next frame is a full rebuild.
+        void Invalidate();
+
+        //! Returns the number of instances that were inserted or removed this frame.
+        uint32_t GetChangedInstanceCount() const;
+
+        //! Returns the number of buckets that were fully re-sorted this frame.
+        uint32_t GetResortedBucketCount() const;
+
+    private:
+        struct ObjectVisibility
+        {
+            AZStd::atomic<uint32_t> m_visibleFrame{ 0 };
+            uint32_t m_insertedFrame = 0;
+            const void* m_instanceList = nullptr;
+            float m_depth = 0.0f;
+
+            ObjectVisibility() = default;
+
+            ObjectVisibility(const ObjectVisibility& rhs)
+                : m_visibleFrame(rhs.m_visibleFrame.load())
+                , m_insertedFrame(rhs.m_insertedFrame)
+                , m_instanceList(rhs.m_instanceList)
+                , m_depth(rhs.m_depth)
+            {
+            }
+
+            void operator=(const ObjectVisibility& rhs)
+            {
+                m_visibleFrame = rhs.m_visibleFrame.load();
+                m_insertedFrame = rhs.m_insertedFrame;
+                m_instanceList = rhs.m_instanceList;
+                m_depth = rhs.m_depth;
+            }
+        };
+
+        struct Bucket
+        {
+            AZStd::vector<SortInstanceData> m_instances;
+            AZStd::vector<SortInstanceData> m_scratch;
+        };
+
+        void SortTransparentGroups(AZStd::vector<SortInstanceData>& instances) const;
+
+        AZStd::vector<ObjectVisibility> m_objects;
+        AZStd::vector<Bucket> m_buckets;
+        const void* m_view = nullptr;
+        uint32_t m_layoutVersion = 0;
+        // Frame 0 is reserved to mean never visible
+        uint32_t m_frame = 0;
+        bool m_fullRebuild = true;
+        bool m_trackingDisabled = false;
+        AZStd::atomic_bool m_duplicateVisibleObject{ false };
+        AZStd::atomic<uint32_t> m_changedInstanceCount{ 0 };
+        AZStd::atomic<uint32_t> m_resortedBucketCount{ 0 };
+    };
+} // namespace AZ::Render
@@ -180,6 +180,17 @@ namespace AZ
                     AZStd::string::format(
                         "r_meshInstancingBucketSortScatterBatchSize %zu", meshInstancingBucketSortScatterBatchSize)
                         .c_str());
+
+                bool meshInstancingFrameCoherent = false;
+                console->GetCvarValue("r_meshInstancingFrameCoherent", meshInstancingFrameCoherent);
+                console->PerformCommand(
+                    AZStd::string::format("r_meshInstancingFrameCoherent %s", meshInstancingFrameCoherent ? "true" : "false").c_str());
+
+                float meshInstancingFrameCoherentResortThreshold = r_meshInstancingFrameCoherentResortThreshold;
+                console->GetCvarValue("r_meshInstancingFrameCoherentResortThreshold", meshInstancingFrameCoherentResortThreshold);
+                console->PerformCommand(
+                    AZStd::string::format("r_meshInstancingFrameCoherentResortThreshold %f", meshInstancingFrameCoherentResortThreshold)
+                        .c_str());
             }
         }
 
@@ -475,6 +486,13 @@ namespace AZ
             {
                 AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: OnEndCulling");
 
+                if (m_useFrameCoherentBuckets != r_meshInstancingFrameCoherent)
+                {
+                    // Buckets kept from before the mode changed no longer match the instance buffers
+                    m_perViewFrameCoherentBuckets.clear();
+                    m_useFrameCoherentBuckets = r_meshInstancingFrameCoherent;
+                }
+
                 // If necessary, allocate memory up front for the work that needs to be done this frame
                 ResizePerViewInstanceVectors(packet.m_views.size());
 
@@ -486,13 +504,46 @@ namespace AZ
                     AZ::TaskGraph addVisibleObjectsToBucketsTG{ "AddVisibleObjectsToBuckets" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
-                        AddVisibleObjectsToBuckets(addVisibleObjectsToBucketsTG, viewIndex, packet.m_views[viewIndex]);
+                        AddVisibleObjectsToBuckets(
+                            addVisibleObjectsToBucketsTG,
+                            viewIndex,
+                            packet.m_views[viewIndex],
+                            BeginFrameCoherentBuckets(viewIndex, packet.m_views[viewIndex]));
                     }
 
                     addVisibleObjectsToBucketsTG.Submit(&addVisibleObjectsToBucketsTGEvent);
                     addVisibleObjectsToBucketsTGEvent.Wait();
                 }
 
+                if (m_useFrameCoherentBuckets)
+                {
+                    // Views where the visibility changes couldn't be tracked are scattered again with every visible object
+                    AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: Rebuild Frame Coherent Buckets");
+                    AZ::TaskGraphEvent rebuildBucketsTGEvent{ "RebuildFrameCoherentBuckets Wait" };
+                    AZ::TaskGraph rebuildBucketsTG{ "RebuildFrameCoherentBuckets" };
+                    bool rebuildNeeded = false;
+                    for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
+                    {
+                        FrameCoherentInstanceBuckets& frameCoherentBuckets = *m_perViewFrameCoherentBuckets[viewIndex];
+                        if (frameCoherentBuckets.IsFullRebuildRequired())
+                        {
+                            frameCoherentBuckets.BeginFullRebuild();
+                            for (InstanceGroupBucket& instanceGroupBucket : m_perViewInstanceGroupBuckets[viewIndex])
+                            {
+                                instanceGroupBucket.m_currentElementIndex = 0;
+                            }
+                            AddVisibleObjectsToBuckets(rebuildBucketsTG, viewIndex, packet.m_views[viewIndex], nullptr);
+                            rebuildNeeded = true;
+                        }
+                    }
+
+                    if (rebuildNeeded)
+                    {
+                        rebuildBucketsTG.Submit(&rebuildBucketsTGEvent);
+                        rebuildBucketsTGEvent.Wait();
+                    }
+                }
+
                 {
                     // Now that the buckets have been filled, create a task for each bucket to sort each individual bucket in parallel
                     AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: Sort Buckets");
@@ -547,6 +598,14 @@ namespace AZ
                 m_perViewInstanceGroupBuckets.resize(viewCount, AZStd::vector<InstanceGroupBucket>());
             }
 
+            if (m_useFrameCoherentBuckets)
+            {
+                while (m_perViewFrameCoherentBuckets.size() < viewCount)
+                {
+                    m_perViewFrameCoherentBuckets.push_back(AZStd::make_unique<FrameCoherentInstanceBuckets>());
+                }
+            }
+
             // Initialize the buffer handler if it hasn't been created yet
             if (m_perViewInstanceDataBufferHandlers.size() <= viewCount)
             {
@@ -611,6 +670,15 @@ namespace AZ
                 perBucketInstanceCounts[iteratorRange.m_begin.GetPageIndex()] = maxPossibleInstanceCountForGroup;
             }
 
+            // Frame coherent buckets each write to a fixed range of the instance buffer that fits all of their instances
+            m_bucketInstanceDataOffsets.resize(perBucketInstanceCounts.size());
+            m_instanceDataCapacity = 0;
+            for (size_t bucketIndex = 0; bucketIndex < perBucketInstanceCounts.size(); ++bucketIndex)
+            {
+                m_bucketInstanceDataOffsets[bucketIndex] = m_instanceDataCapacity;
+                m_instanceDataCapacity += perBucketInstanceCounts[bucketIndex];
+            }
+
             // Resize the per-bucket data vectors for every view to allow for all possible objects to be visible
             for (size_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
             {
@@ -649,8 +717,27 @@ namespace AZ
         }
 
 
+        FrameCoherentInstanceBuckets* MeshFeatureProcessor::BeginFrameCoherentBuckets(size_t viewIndex, const RPI::ViewPtr& view)
+        {
+            if (!m_useFrameCoherentBuckets)
+            {
+                return nullptr;
+            }
+
+            FrameCoherentInstanceBuckets& frameCoherentBuckets = *m_perViewFrameCoherentBuckets[viewIndex];
+            frameCoherentBuckets.BeginFrame(
+                view.get(),
+                m_meshInstanceManager.GetLayoutVersion(),
+                m_transformService->GetObjectIdCapacity(),
+                aznumeric_cast<uint32_t>(m_perViewInstanceGroupBuckets[viewIndex].size()));
+            return &frameCoherentBuckets;
+        }
+
         void MeshFeatureProcessor::AddVisibleObjectsToBuckets(
-            TaskGraph& addVisibleObjectsToBucketsTG, size_t viewIndex, const RPI::ViewPtr& view)
+            TaskGraph& addVisibleObjectsToBucketsTG,
+            size_t viewIndex,
+            const RPI::ViewPtr& view,
+            FrameCoherentInstanceBuckets* frameCoherentBuckets)
         {
             AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: AddVisibleObjectsToBuckets");
             size_t visibleObjectCount = view->GetVisibleObjectList().size();
@@ -658,7 +745,11 @@ namespace AZ
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
             if (visibleObjectCount > 0)
             {
-                perViewInstanceData.clear();
+                // Frame coherent buckets compare against the previous contents of the instance data to find what changed
+                if (!m_useFrameCoherentBuckets)
+                {
+                    perViewInstanceData.clear();
+                }
 
                 static const AZ::TaskDescriptor addVisibleObjectsToBucketsTaskDescriptor{
                     "AZ::Render::MeshFeatureProcessor::OnEndCulling - AddVisibleObjectsToBuckets", "Graphics"
@@ -676,7 +767,7 @@ namespace AZ
                     addVisibleObjectsToBucketsTG.AddTask(
                         addVisibleObjectsToBucketsTaskDescriptor,
                         // Don't capture the shared_ptr because that causes incorrect ref counting when copying/moving the lambda
-                        [this, viewPtr = view.get(), viewIndex, batchStart, currentBatchCount]()
+                        [this, viewPtr = view.get(), viewIndex, batchStart, currentBatchCount, frameCoherentBuckets]()
                         {
                             RPI::VisibleObjectListView visibilityList = viewPtr->GetVisibleObjectList();
                             AZStd::vector<InstanceGroupBucket>& currentViewInstanceGroupBuckets = m_perViewInstanceGroupBuckets[viewIndex];
@@ -686,6 +777,14 @@ namespace AZ
                                 const ModelDataInstance::PostCullingInstanceDataList* postCullingInstanceDataList =
                                     static_cast<const ModelDataInstance::PostCullingInstanceDataList*>(visibleObject.m_userData);
 
+                                if (frameCoherentBuckets && !postCullingInstanceDataList->empty() &&
+                                    !frameCoherentBuckets->MarkVisible(
+                                        postCullingInstanceDataList->front().m_objectId, postCullingInstanceDataList, visibleObject.m_depth))
+                                {
+                                    // The instances of this object are still in the buckets from the previous frame
+                                    continue;
+                                }
+
                                 for (const ModelDataInstance::PostCullingInstanceData& postCullingData : *postCullingInstanceDataList)
                                 {
                                     SortInstanceData instanceData;
@@ -722,15 +821,21 @@ namespace AZ
                 "AZ::Render::MeshFeatureProcessor::OnEndCulling - sort instance data buckets", "Graphics"
             };
 
-            for (InstanceGroupBucket& instanceGroupBucket : currentViewInstanceGroupBuckets)
+            FrameCoherentInstanceBuckets* frameCoherentBuckets =
+                m_useFrameCoherentBuckets ? m_perViewFrameCoherentBuckets[viewIndex].get() : nullptr;
+            const float resortThreshold = r_meshInstancingFrameCoherentResortThreshold;
+
+            for (uint32_t bucketIndex = 0; bucketIndex < aznumeric_cast<uint32_t>(currentViewInstanceGroupBuckets.size()); ++bucketIndex)
             {
+                InstanceGroupBucket& instanceGroupBucket = currentViewInstanceGroupBuckets[bucketIndex];
+
                 // We're creating one task per bucket here. That is ideal when the buckets are all close to the same size,
                 // but it can lead to an imperfect distribution of work if one bucket has more objects than any of the others.
                 // If this becomes a performance bottleneck, it could be alleviated by adding an heuristic to sort any overfull
                 // buckets using a parallel std sort rather than using a single task, or by breaking it up into smaller buckets.
                 sortInstanceBufferBucketsTG.AddTask(
                     sortInstanceBufferBucketsTaskDescriptor,
-                    [&instanceGroupBucket]()
+                    [&instanceGroupBucket, frameCoherentBuckets, bucketIndex, resortThreshold]()
                     {
                         // Note: we've previously resized m_sortInstanceData to conservatively fit all possible visible meshes for the bucket,
                         // which allowed us to use an atomic index for parallel lock free insertion.
@@ -738,8 +843,20 @@ namespace AZ
                         // We only care about the real visible objects, so cut off the last unused elements here
                         instanceGroupBucket.m_sortInstanceData.resize(instanceGroupBucket.m_currentElementIndex);
 
-                        // Sort within the bucket
-                        std::sort(instanceGroupBucket.m_sortInstanceData.begin(), instanceGroupBucket.m_sortInstanceData.end());
+                        if (frameCoherentBuckets)
+                        {
+                            // Only the newly visible objects were added to the bucket, merge them with the previous frame
+                            frameCoherentBuckets->UpdateBucket(
+                                bucketIndex,
+                                AZStd::span<SortInstanceData>(
+                                    instanceGroupBucket.m_sortInstanceData.data(), instanceGroupBucket.m_sortInstanceData.size()),
+                                resortThreshold);
+                        }
+                        else
+                        {
+                            // Sort within the bucket
+                            std::sort(instanceGroupBucket.m_sortInstanceData.begin(), instanceGroupBucket.m_sortInstanceData.end());
+                        }
                     });
             }
         }
@@ -803,11 +920,23 @@ namespace AZ
         {
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
             AZStd::vector<InstanceGroupBucket>& currentViewInstanceGroupBuckets = m_perViewInstanceGroupBuckets[viewIndex];
+            const FrameCoherentInstanceBuckets* frameCoherentBuckets =
+                m_useFrameCoherentBuckets ? m_perViewFrameCoherentBuckets[viewIndex].get() : nullptr;
 
             uint32_t currentBatchStart = 0;
-            for (InstanceGroupBucket& instanceGroupBucket : currentViewInstanceGroupBuckets)
+            for (uint32_t bucketIndex = 0; bucketIndex < aznumeric_cast<uint32_t>(currentViewInstanceGroupBuckets.size()); ++bucketIndex)
             {
-                if (instanceGroupBucket.m_currentElementIndex > 0)
+                InstanceGroupBucket& instanceGroupBucket = currentViewInstanceGroupBuckets[bucketIndex];
+                const AZStd::vector<SortInstanceData>& bucketInstanceData =
+                    frameCoherentBuckets ? frameCoherentBuckets->GetBucketInstances(bucketIndex) : instanceGroupBucket.m_sortInstanceData;
+                if (frameCoherentBuckets)
+                {
+                    currentBatchStart = m_bucketInstanceDataOffsets[bucketIndex];
+                }
+                instanceGroupBucket.m_dirtyBeginIndex = 0;
+                instanceGroupBucket.m_dirtyEndIndex = 0;
+
+                if (!bucketInstanceData.empty())
                 {
                     static const AZ::TaskDescriptor buildInstanceBufferTaskDescriptor{
                         "AZ::Render::MeshFeatureProcessor::OnEndCulling - process instance data", "Graphics"
@@ -818,14 +947,17 @@ namespace AZ
                         [currentBatchStart,
                         viewIndex,
                         &view,
-                        &perViewInstanceData, &instanceGroupBucket]()
+                        &perViewInstanceData, &instanceGroupBucket, &bucketInstanceData,
+                        trackDirtyRange = frameCoherentBuckets != nullptr]()
                         {
                             ModelDataInstance::InstanceGroupHandle currentInstanceGroup =
-                                instanceGroupBucket.m_sortInstanceData.begin()->m_instanceGroupHandle;
+                                bucketInstanceData.begin()->m_instanceGroupHandle;
                             uint32_t instanceDataOffset = currentBatchStart;
                             float accumulatedDepth = 0.0f;
                             uint32_t instanceDataIndex = currentBatchStart;
-                            for (SortInstanceData& sortInstanceData : instanceGroupBucket.m_sortInstanceData)
+                            uint32_t dirtyBeginIndex = AZStd::numeric_limits<uint32_t>::max();
+                            uint32_t dirtyEndIndex = 0;
+                            for (const SortInstanceData& sortInstanceData : bucketInstanceData)
                             {
                                 // Anytime the instance group changes, submit a draw for the previous group
                                 if (sortInstanceData.m_instanceGroupHandle != currentInstanceGroup)
@@ -838,7 +970,17 @@ namespace AZ
                                     instanceDataOffset = instanceDataIndex;
                                     currentInstanceGroup = sortInstanceData.m_instanceGroupHandle;
                                 }
-                                perViewInstanceData[instanceDataIndex] = sortInstanceData.m_objectId;
+                                if (!trackDirtyRange)
+                                {
+                                    perViewInstanceData[instanceDataIndex] = sortInstanceData.m_objectId;
+                                }
+                                else if (perViewInstanceData[instanceDataIndex] != sortInstanceData.m_objectId)
+                                {
+                                    // Keep track of the changed range so only that part of the instance buffer is uploaded
+                                    perViewInstanceData[instanceDataIndex] = sortInstanceData.m_objectId;
+                                    dirtyBeginIndex = AZStd::min(dirtyBeginIndex, instanceDataIndex);
+                                    dirtyEndIndex = instanceDataIndex + 1;
+                                }
                                 accumulatedDepth += sortInstanceData.m_depth;
                                 instanceDataIndex++;
                             }
@@ -848,16 +990,30 @@ namespace AZ
                                 AddInstancedDrawPacketToView(
                                     view, viewIndex, currentInstanceGroup, accumulatedDepth, instanceDataOffset, instanceDataIndex);
                             }
+
+                            if (dirtyEndIndex > 0)
+                            {
+                                instanceGroupBucket.m_dirtyBeginIndex = dirtyBeginIndex;
+                                instanceGroupBucket.m_dirtyEndIndex = dirtyEndIndex;
+                            }
                         });
 
-                    // At this point, inserting into the bucket is already complete, so m_currentElementIndex represents the count of all visible meshes in this bucket.
-                    currentBatchStart += instanceGroupBucket.m_currentElementIndex;
+                    // At this point, inserting into the bucket is already complete, so the size represents the count of all visible meshes in this bucket.
+                    currentBatchStart += aznumeric_cast<uint32_t>(bucketInstanceData.size());
                 }
             }
 
-            // currentBatchStart now represents the total count of visible instances in this view.
-            // Re-size the instance data buffer so that we can fill it with the tasks created above
-            perViewInstanceData.resize_no_construct(currentBatchStart);
+            if (frameCoherentBuckets)
+            {
+                // Each bucket owns a fixed range, and the contents from the previous frame are kept to find what changed
+                perViewInstanceData.resize(m_instanceDataCapacity);
+            }
+            else
+            {
+                // currentBatchStart now represents the total count of visible instances in this view.
+                // Re-size the instance data buffer so that we can fill it with the tasks created above
+                perViewInstanceData.resize_no_construct(currentBatchStart);
+            }
         }
 
         void MeshFeatureProcessor::UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view)
@@ -872,7 +1028,31 @@ namespace AZ
 
             // create output buffer descriptors
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
-            instanceDataBufferHandler.UpdateBuffer(perViewInstanceData.data(), static_cast<uint32_t>(perViewInstanceData.size()));
+            if (m_useFrameCoherentBuckets)
+            {
+                // Only upload the range that changed since the previous frame
+                uint32_t dirtyBeginIndex = AZStd::numeric_limits<uint32_t>::max();
+                uint32_t dirtyEndIndex = 0;
+                for (const InstanceGroupBucket& instanceGroupBucket : m_perViewInstanceGroupBuckets[viewIndex])
+                {
+                    if (instanceGroupBucket.m_dirtyEndIndex > instanceGroupBucket.m_dirtyBeginIndex)
+                    {
+                        dirtyBeginIndex = AZStd::min(dirtyBeginIndex, instanceGroupBucket.m_dirtyBeginIndex);
+                        dirtyEndIndex = AZStd::max(dirtyEndIndex, instanceGroupBucket.m_dirtyEndIndex);
+                    }
+                }
+
+                const uint32_t dirtyCount = dirtyEndIndex > dirtyBeginIndex ? dirtyEndIndex - dirtyBeginIndex : 0;
+                instanceDataBufferHandler.UpdateBufferRange(
+                    perViewInstanceData.data(),
+                    static_cast<uint32_t>(perViewInstanceData.size()),
+                    dirtyCount > 0 ? dirtyBeginIndex : 0,
+                    dirtyCount);
+            }
+            else
+            {
+                instanceDataBufferHandler.UpdateBuffer(perViewInstanceData.data(), static_cast<uint32_t>(perViewInstanceData.size()));
+            }
         }
 
         void MeshFeatureProcessor::OnBeginPrepareRender()
@@ -2936,6 +3116,8 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
+                GatherStreamingImages(lodIndex + m_lodBias, lod.m_streamingImages);
+
                 if (!r_meshInstancingEnabled)
                 {
                     const RPI::MeshDrawPacketList& drawPacketList = m_meshDrawPacketListsByLod[lodIndex + m_lodBias];
@@ -2987,6 +3169,43 @@ namespace AZ
             m_flags.m_cullBoundsNeedsUpdate = true;
         }
 
+        void ModelDataInstance::GatherStreamingImages(
+            size_t modelLodIndex, AZStd::vector<Data::Instance<RPI::StreamingImage>>& streamingImages) const
+        {
+            streamingImages.clear();
+            if (modelLodIndex >= m_model->GetLodCount())
+            {
+                return;
+            }
+
+            // Collect the streaming images bound to the material properties of every mesh, so culling can report their texel density
+            const RPI::ModelLod& modelLod = *m_model->GetLods()[modelLodIndex];
+            for (const RPI::ModelLod::Mesh& mesh : modelLod.GetMeshes())
+            {
+                const CustomMaterialId customMaterialId(aznumeric_cast<AZ::u64>(modelLodIndex), mesh.m_materialSlotStableId);
+                const auto& customMaterialInfo = GetCustomMaterialWithFallback(customMaterialId);
+                const auto& material = customMaterialInfo.m_material ? customMaterialInfo.m_material : mesh.m_material;
+                if (!material)
+                {
+                    continue;
+                }
+
+                for (const RPI::MaterialPropertyValue& propertyValue : material->GetPropertyValues())
+                {
+                    if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                    {
+                        continue;
+                    }
+
+                    RPI::StreamingImage* streamingImage = azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                    if (streamingImage && AZStd::find(streamingImages.begin(), streamingImages.end(), streamingImage) == streamingImages.end())
+                    {
+                        streamingImages.emplace_back(streamingImage);
+                    }
+                }
+            }
+        }
+
         void ModelDataInstance::UpdateCullBounds(const MeshFeatureProcessor* meshFeatureProcessor)
         {
             AZ_Assert(m_flags.m_cullBoundsNeedsUpdate, "This function only needs to be called if the culling bounds need to be rebuilt");
@@ -19,6 +19,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/Console.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <Mesh/FrameCoherentInstanceBuckets.h>
 #include <Mesh/MeshInstanceManager.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <TransformService/TransformServiceFeatureProcessor.h>
@@ -129,6 +130,8 @@ namespace AZ
             RPI::Cullable::LodConfiguration GetMeshLodConfiguration() const;
             void UpdateDrawPackets(bool forceUpdate = false);
             void BuildCullable();
+            // Fill streamingImages with the streaming images used by the materials of a model lod
+            void GatherStreamingImages(size_t modelLodIndex, AZStd::vector<Data::Instance<RPI::StreamingImage>>& streamingImages) const;
             void UpdateCullBounds(const MeshFeatureProcessor* meshFeatureProcessor);
             void UpdateObjectSrg(MeshFeatureProcessor* meshFeatureProcessor);
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
@@ -317,7 +320,12 @@ namespace AZ
             
             
             void ResizePerViewInstanceVectors(size_t viewCount);
-            void AddVisibleObjectsToBuckets(TaskGraph& addVisibleObjectsToBucketsTG, size_t viewIndex, const RPI::ViewPtr& view);
+            FrameCoherentInstanceBuckets* BeginFrameCoherentBuckets(size_t viewIndex, const RPI::ViewPtr& view);
+            void AddVisibleObjectsToBuckets(
+                TaskGraph& addVisibleObjectsToBucketsTG,
+                size_t viewIndex,
+                const RPI::ViewPtr& view,
+                FrameCoherentInstanceBuckets* frameCoherentBuckets);
             void SortInstanceBufferBuckets(TaskGraph& sortInstanceBufferBucketsTG, size_t viewIndex);
             void BuildInstanceBufferAndDrawCalls(TaskGraph& taskGraph, size_t viewIndex, const RPI::ViewPtr& view);
             void UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view);
@@ -332,19 +340,7 @@ namespace AZ
 
             MeshInstanceManager m_meshInstanceManager;
 
-            // SortInstanceData represents the data needed to do the sorting (sort by instance group, then by depth)
-            // as well as the data being sorted (ObjectId)
-            struct SortInstanceData
-            {
-                ModelDataInstance::InstanceGroupHandle m_instanceGroupHandle;
-                float m_depth = 0.0f;
-                TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
-
-                bool operator<(const SortInstanceData& rhs) const
-                {
-                    return AZStd::tie(m_instanceGroupHandle, m_depth) < AZStd::tie(rhs.m_instanceGroupHandle, rhs.m_depth);
-                }
-            };
+            using SortInstanceData = FrameCoherentInstanceBuckets::SortInstanceData;
 
             // An InstanceGroupBucket represents all of the instance groups from a single page in the MeshInstanceManager
             // There is one InstanceGroupBucket per-page, per-view
@@ -355,11 +351,17 @@ namespace AZ
                 AZStd::atomic<uint32_t> m_currentElementIndex{};
                 AZStd::vector<SortInstanceData> m_sortInstanceData{};
 
+                // With frame coherent buckets, the range of the instance buffer that changed this frame
+                uint32_t m_dirtyBeginIndex = 0;
+                uint32_t m_dirtyEndIndex = 0;
+
                 InstanceGroupBucket() = default;
 
                 InstanceGroupBucket(const InstanceGroupBucket& rhs)
                     : m_currentElementIndex(rhs.m_currentElementIndex.load())
                     , m_sortInstanceData(rhs.m_sortInstanceData)
+                    , m_dirtyBeginIndex(rhs.m_dirtyBeginIndex)
+                    , m_dirtyEndIndex(rhs.m_dirtyEndIndex)
                 {
                 }
 
@@ -367,12 +369,21 @@ namespace AZ
                 {
                     m_currentElementIndex = rhs.m_currentElementIndex.load();
                     m_sortInstanceData = rhs.m_sortInstanceData;
+                    m_dirtyBeginIndex = rhs.m_dirtyBeginIndex;
+                    m_dirtyEndIndex = rhs.m_dirtyEndIndex;
                 }
             };
             
             AZStd::vector<AZStd::vector<InstanceGroupBucket>> m_perViewInstanceGroupBuckets;
             AZStd::vector<AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>> m_perViewInstanceData;
             AZStd::vector<GpuBufferHandler> m_perViewInstanceDataBufferHandlers;
+
+            // With r_meshInstancingFrameCoherent, the buckets of each view are kept between frames and each bucket owns a
+            // fixed range of the instance buffer, so a change in one bucket doesn't move the instances of the others
+            AZStd::vector<AZStd::unique_ptr<FrameCoherentInstanceBuckets>> m_perViewFrameCoherentBuckets;
+            AZStd::vector<uint32_t> m_bucketInstanceDataOffsets;
+            uint32_t m_instanceDataCapacity = 0;
+            bool m_useFrameCoherentBuckets = false;
             
             TransformServiceFeatureProcessor* m_transformService = nullptr;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
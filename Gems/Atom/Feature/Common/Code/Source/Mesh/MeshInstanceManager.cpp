@@ -16,6 +16,7 @@ namespace AZ
         {
             AZStd::scoped_lock lock(m_instanceDataMutex);
             MeshInstanceManager::InsertResult result = m_instanceData.Add(meshInstanceGroupKey);
+            ++m_layoutVersion;
             if (result.m_instanceCount == 1)
             {
                 // The MeshInstanceManager is including the key as part of the data vector,
@@ -32,12 +33,14 @@ namespace AZ
         {
             AZStd::scoped_lock lock(m_instanceDataMutex);
             m_instanceData.Remove(meshInstanceGroupKey);
+            ++m_layoutVersion;
         }
 
         void MeshInstanceManager::RemoveInstance(Handle handle)
         {
             AZStd::scoped_lock lock(m_instanceDataMutex);
             m_instanceData.Remove(m_instanceData[handle].m_key);
+            ++m_layoutVersion;
         }
         
         uint32_t MeshInstanceManager::GetInstanceGroupCount() const
@@ -45,6 +48,11 @@ namespace AZ
             return m_instanceData.GetInstanceGroupCount();
         }
 
+        uint32_t MeshInstanceManager::GetLayoutVersion() const
+        {
+            return m_layoutVersion;
+        }
+
         MeshInstanceGroupData& MeshInstanceManager::operator[](Handle handle)
         {
             return m_instanceData[handle];
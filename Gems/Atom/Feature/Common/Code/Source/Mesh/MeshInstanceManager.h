@@ -39,6 +39,10 @@ namespace AZ::Render
         //! Get the total number of instance groups being managed by the MeshInstanceManager
         uint32_t GetInstanceGroupCount() const;
 
+        //! Get a version number that changes whenever an instance is added or removed, which invalidates any
+        //! instance group handles or per-instance data cached from a previous frame
+        uint32_t GetLayoutVersion() const;
+
         //! Constant O(1) access to a MeshInstanceGroup via its handle
         MeshInstanceGroupData& operator[](Handle handle);
 
@@ -53,5 +57,7 @@ namespace AZ::Render
         AZStd::mutex m_instanceDataMutex;
 
         AZStd::vector<uint32_t> m_createDrawPacketQueue;
+
+        uint32_t m_layoutVersion = 0;
     };
 } // namespace AZ::Render
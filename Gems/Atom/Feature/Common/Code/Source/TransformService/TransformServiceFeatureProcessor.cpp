@@ -13,14 +13,24 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 
 #include <cinttypes>
 
+AZ_CVAR(uint32_t, r_transformServiceUploadMergeGap, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of clean transform pages between two dirty pages that are uploaded anyway, so both pages are copied with a single buffer map");
+AZ_CVAR(uint32_t, r_transformServiceParallelUploadMinPages, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Minimum number of transform pages in a single upload range before the copy is split across jobs. 0 disables the parallel copy");
+
 namespace AZ
 {
     namespace Render
     {
         constexpr size_t BufferReserveCount = 1024;
+        // Number of pages copied by each job when a large upload range is split across jobs
+        constexpr uint32_t PagesPerUploadJob = 16;
 
         void TransformServiceFeatureProcessor::Reflect(ReflectContext* context)
         {
@@ -37,9 +47,10 @@ namespace AZ
             m_updateSceneSrgHandler = RPI::Scene::PrepareSceneSrgEvent::Handler([this](RPI::ShaderResourceGroup *sceneSrg) { this->UpdateSceneSrg(sceneSrg); });
             GetParentScene()->ConnectEvent(m_updateSceneSrgHandler);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_uploadTracker.MarkAllDirty();
             m_objectToWorldTransforms.reserve(BufferReserveCount);
-            m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
+            m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);
+            m_objectToWorldHistoryTransforms.reserve(BufferReserveCount);
 
             m_isWriteable = true;
 
@@ -50,6 +61,9 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectToWorldHistoryTransforms = {};
+
+            m_uploadTracker.Reset();
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
@@ -67,10 +81,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersRecreated = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +109,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
@@ -100,6 +117,7 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
@@ -120,15 +138,79 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
+
+            return buffersRecreated;
+        }
+
+        void TransformServiceFeatureProcessor::UploadRanges(
+            RPI::Buffer& buffer, const Float4x3* source, AZStd::span<const UploadRange> ranges, Float4x3* historySnapshot)
+        {
+            const uint32_t parallelMinElements = r_transformServiceParallelUploadMinPages * TransformUploadTracker::TransformsPerPage;
+            const uint32_t elementsPerJob = PagesPerUploadJob * TransformUploadTracker::TransformsPerPage;
+
+            for (const UploadRange& range : ranges)
+            {
+                AZStd::unordered_map<int, void*> mappedData =
+                    buffer.Map(range.m_elementCount * sizeof(Float4x3), range.m_firstElement * sizeof(Float4x3));
+                if (mappedData.empty())
+                {
+                    continue;
+                }
+
+                auto copyElements = [&mappedData, &range, source, historySnapshot](uint32_t firstElement, uint32_t elementCount)
+                {
+                    const size_t byteCount = elementCount * sizeof(Float4x3);
+                    for (auto& [deviceIndex, data] : mappedData)
+                    {
+                        if (data)
+                        {
+                            memcpy(static_cast<Float4x3*>(data) + (firstElement - range.m_firstElement), source + firstElement, byteCount);
+                        }
+                    }
+
+                    if (historySnapshot)
+                    {
+                        memcpy(historySnapshot + firstElement, source + firstElement, byteCount);
+                    }
+                };
+
+                if (parallelMinElements == 0 || range.m_elementCount < parallelMinElements)
+                {
+                    copyElements(range.m_firstElement, range.m_elementCount);
+                }
+                else
+                {
+                    AZ_PROFILE_SCOPE(RPI, "TransformServiceFeatureProcessor: UploadRanges: Parallel");
+                    AZ::JobCompletion jobCompletion;
+                    const uint32_t rangeEnd = range.m_firstElement + range.m_elementCount;
+                    for (uint32_t firstElement = range.m_firstElement; firstElement < rangeEnd; firstElement += elementsPerJob)
+                    {
+                        const uint32_t elementCount = AZStd::min(elementsPerJob, rangeEnd - firstElement);
+                        AZ::Job* copyJob = AZ::CreateJobFunction(
+                            [&copyElements, firstElement, elementCount]()
+                            {
+                                copyElements(firstElement, elementCount);
+                            },
+                            true);
+                        copyJob->SetDependent(&jobCompletion);
+                        copyJob->Start();
+                    }
+                    jobCompletion.StartAndWaitForCompletion();
+                }
+
+                buffer.Unmap();
+            }
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -148,27 +230,31 @@ namespace AZ
         {
             m_isWriteable = false;
 
-            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
+            if (!m_uploadTracker.HasPendingUploads())
             {
-                PrepareBuffers();
-                if (m_historyBufferNeedsUpdate)
-                {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
-                    m_historyBufferNeedsUpdate = false;
-                }
-
-                if (m_deviceBufferNeedsUpdate)
-                {
-                    // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+                return;
+            }
 
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+            AZ_PROFILE_SCOPE(RPI, "TransformServiceFeatureProcessor: OnBeginPrepareRender");
 
-                    m_deviceBufferNeedsUpdate = false;
-                    m_historyBufferNeedsUpdate = true;
-                }
+            // Created or resized buffers lose their contents, so everything is uploaded again
+            if (PrepareBuffers())
+            {
+                m_uploadTracker.MarkAllDirty();
             }
+
+            m_uploadTracker.Upload(
+                aznumeric_cast<uint32_t>(m_objectToWorldTransforms.size()),
+                r_transformServiceUploadMergeGap,
+                [this](AZStd::span<const UploadRange> ranges)
+                {
+                    UploadRanges(*m_objectToWorldHistoryBuffer, m_objectToWorldHistoryTransforms.data(), ranges);
+                },
+                [this](AZStd::span<const UploadRange> ranges)
+                {
+                    UploadRanges(*m_objectToWorldBuffer, m_objectToWorldTransforms.data(), ranges, m_objectToWorldHistoryTransforms.data());
+                    UploadRanges(*m_objectToWorldInverseTransposeBuffer, m_objectToWorldInverseTransposeTransforms.data(), ranges);
+                });
         }
 
         void TransformServiceFeatureProcessor::OnEndPrepareRender()
@@ -219,7 +305,7 @@ namespace AZ
 
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
-                m_deviceBufferNeedsUpdate = true;
+                m_uploadTracker.MarkDirty(id.GetIndex());
             }
         }
 
@@ -238,5 +324,10 @@ namespace AZ
             AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromRowMajorFloat12(m_objectToWorldTransforms.at(id.GetIndex()).m_transform);
             return matrix3x4.RetrieveScale();
         }
+
+        uint32_t TransformServiceFeatureProcessor::GetObjectIdCapacity() const
+        {
+            return aznumeric_cast<uint32_t>(m_objectToWorldTransforms.size());
+        }
     }
 }
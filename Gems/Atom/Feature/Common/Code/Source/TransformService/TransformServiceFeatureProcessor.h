@@ -12,6 +12,8 @@
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <TransformService/TransformUploadTracker.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ
 {
@@ -49,6 +51,9 @@ namespace AZ
             AZ::Transform GetTransformForId(ObjectId id) const override;
             AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const override;
 
+            //! Returns one more than the largest object id index that has been reserved so far.
+            uint32_t GetObjectIdCapacity() const;
+
         private:
 
             // Holds both regular 4x3 transforms and 3x3 normal transforms with padding at the end of each float3.
@@ -61,11 +66,19 @@ namespace AZ
             // Flag value for when the buffers have no empty spaces.
             static const uint32_t NoAvailableTransformIndices = std::numeric_limits<uint32_t>::max();
 
+            using UploadRange = TransformUploadTracker::UploadRange;
+
             TransformServiceFeatureProcessor(const TransformServiceFeatureProcessor&) = delete;
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if any buffer was created or resized, which discards its previous contents.
+            bool PrepareBuffers();
+
+            // Copies the ranges of the source transforms into the buffer, splitting large ranges across jobs.
+            // If historySnapshot is set, the same ranges are also copied into it.
+            void UploadRanges(
+                RPI::Buffer& buffer, const Float4x3* source, AZStd::span<const UploadRange> ranges, Float4x3* historySnapshot = nullptr);
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -80,8 +93,13 @@ namespace AZ
             // with an index to their transform, and updates to the transform just update the buffer, not individual mesh SRGs.
             AZStd::vector<Float4x3> m_objectToWorldTransforms;
             AZStd::vector<Float4x3> m_objectToWorldInverseTransposeTransforms;
+            // The history transforms hold the values last uploaded to the current transform buffer. m_uploadTracker uploads
+            // them to the history buffer in the frame after they were uploaded to the current buffer.
             AZStd::vector<Float4x3> m_objectToWorldHistoryTransforms;
 
+            // Tracks the pages that changed since the last upload.
+            TransformUploadTracker m_uploadTracker;
+
             static const size_t TransformValueSize = sizeof(decltype(m_objectToWorldTransforms)::value_type);
             static const size_t NormalValueSize = sizeof(decltype(m_objectToWorldInverseTransposeTransforms)::value_type);
 
@@ -90,8 +108,6 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
 
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
-            bool m_deviceBufferNeedsUpdate = false;
-            bool m_historyBufferNeedsUpdate = false;
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
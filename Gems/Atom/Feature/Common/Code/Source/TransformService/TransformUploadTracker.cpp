@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TransformService/TransformUploadTracker.h>
+
+#include <AzCore/std/algorithm.h>
+
+#include <algorithm>
+
+namespace AZ::Render
+{
+    void TransformUploadTracker::MarkDirty(uint32_t index)
+    {
+        const uint32_t page = index / TransformsPerPage;
+        if (page >= m_pageIsDirty.size())
+        {
+            m_pageIsDirty.resize(page + 1, 0);
+        }
+
+        if (!m_pageIsDirty[page])
+        {
+            m_pageIsDirty[page] = 1;
+            m_dirtyPages.push_back(page);
+        }
+    }
+
+    void TransformUploadTracker::MarkAllDirty()
+    {
+        m_fullUploadNeeded = true;
+    }
+
+    bool TransformUploadTracker::HasPendingUploads() const
+    {
+        return m_fullUploadNeeded || !m_dirtyPages.empty() || !m_historyUploadRanges.empty();
+    }
+
+    void TransformUploadTracker::Upload(
+        uint32_t elementCount, uint32_t mergeGap, const UploadFunction& uploadHistory, const UploadFunction& uploadCurrent)
+    {
+        if (m_fullUploadNeeded)
+        {
+            m_fullUploadNeeded = false;
+            m_dirtyPages.clear();
+            AZStd::fill(m_pageIsDirty.begin(), m_pageIsDirty.end(), uint8_t(0));
+
+            m_uploadRanges.clear();
+            if (elementCount > 0)
+            {
+                m_uploadRanges.push_back({ 0, elementCount });
+            }
+
+            // The history buffer lost its contents too, and the snapshot still holds the values uploaded last frame
+            m_historyUploadRanges = m_uploadRanges;
+        }
+        else
+        {
+            BuildDirtyUploadRanges(elementCount, mergeGap);
+        }
+
+        // Upload the pages that changed last frame, before the snapshot is overwritten with this frame's values
+        if (!m_historyUploadRanges.empty())
+        {
+            uploadHistory(m_historyUploadRanges);
+        }
+
+        if (!m_uploadRanges.empty())
+        {
+            uploadCurrent(m_uploadRanges);
+        }
+
+        // The pages uploaded this frame become the previous frame's transforms next frame
+        m_historyUploadRanges.swap(m_uploadRanges);
+    }
+
+    void TransformUploadTracker::Reset()
+    {
+        m_dirtyPages = {};
+        m_pageIsDirty = {};
+        m_uploadRanges = {};
+        m_historyUploadRanges = {};
+        m_fullUploadNeeded = true;
+    }
+
+    void TransformUploadTracker::BuildDirtyUploadRanges(uint32_t elementCount, uint32_t mergeGap)
+    {
+        m_uploadRanges.clear();
+        std::sort(m_dirtyPages.begin(), m_dirtyPages.end());
+
+        uint32_t rangeBeginPage = 0;
+        uint32_t rangeEndPage = 0;
+        for (uint32_t page : m_dirtyPages)
+        {
+            m_pageIsDirty[page] = 0;
+            if (rangeEndPage > rangeBeginPage && page <= rangeEndPage + mergeGap)
+            {
+                rangeEndPage = page + 1;
+                continue;
+            }
+
+            if (rangeEndPage > rangeBeginPage)
+            {
+                m_uploadRanges.push_back({ rangeBeginPage * TransformsPerPage, (rangeEndPage - rangeBeginPage) * TransformsPerPage });
+            }
+            rangeBeginPage = page;
+            rangeEndPage = page + 1;
+        }
+
+        if (rangeEndPage > rangeBeginPage)
+        {
+            m_uploadRanges.push_back({ rangeBeginPage * TransformsPerPage, (rangeEndPage - rangeBeginPage) * TransformsPerPage });
+        }
+        m_dirtyPages.clear();
+
+        // The last page is usually only partially used
+        while (!m_uploadRanges.empty())
+        {
+            UploadRange& lastRange = m_uploadRanges.back();
+            if (lastRange.m_firstElement >= elementCount)
+            {
+                m_uploadRanges.pop_back();
+                continue;
+            }
+            lastRange.m_elementCount = AZStd::min(lastRange.m_elementCount, elementCount - lastRange.m_firstElement);
+            break;
+        }
+    }
+} // namespace AZ::Render
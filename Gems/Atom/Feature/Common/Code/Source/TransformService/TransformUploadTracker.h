@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace AZ::Render
+{
+    //! TransformUploadTracker decides which transform slots are uploaded to the GPU each frame.
+    //! Slots are tracked in pages of TransformsPerPage consecutive slots. Only the pages that changed since the last upload
+    //! are uploaded to the current transform buffers, and nearby dirty pages are merged into a single range.
+    //! The ranges uploaded to the current buffers are uploaded to the history buffer in the following frame, from a snapshot
+    //! of the values uploaded to the current buffers, so the history buffer holds the previous frame's transforms without
+    //! copying or uploading the pages that did not change.
+    class TransformUploadTracker
+    {
+    public:
+        //! Transforms are tracked and uploaded in pages of this many consecutive slots.
+        static constexpr uint32_t TransformsPerPage = 64;
+
+        //! A range of consecutive transform slots that is uploaded with a single buffer map.
+        struct UploadRange
+        {
+            uint32_t m_firstElement = 0;
+            uint32_t m_elementCount = 0;
+        };
+
+        using UploadFunction = AZStd::function<void(AZStd::span<const UploadRange> ranges)>;
+
+        //! Flags the page containing the transform slot so it is uploaded by the next Upload.
+        void MarkDirty(uint32_t index);
+
+        //! Uploads every slot by the next Upload, to both the current and the history buffers.
+        //! Used when the buffers are created or resized, which discards their previous contents.
+        void MarkAllDirty();
+
+        //! Returns true if the next Upload has anything to upload.
+        bool HasPendingUploads() const;
+
+        //! Uploads the slots that changed and clears the dirty pages.
+        //! @param elementCount the number of transform slots; ranges are clamped to it
+        //! @param mergeGap the number of clean pages between two dirty pages that are uploaded anyway to merge both ranges
+        //! @param uploadHistory called first, with the ranges to copy from the history snapshot to the history buffer.
+        //!        Not called if there are none.
+        //! @param uploadCurrent called second, with the ranges to copy from the current transforms to the current buffers
+        //!        and to the history snapshot. Not called if there are none.
+        void Upload(uint32_t elementCount, uint32_t mergeGap, const UploadFunction& uploadHistory, const UploadFunction& uploadCurrent);
+
+        //! Releases all tracking data.
+        void Reset();
+
+    private:
+        // Converts the dirty pages into upload ranges, merging pages that are separated by at most mergeGap clean pages.
+        void BuildDirtyUploadRanges(uint32_t elementCount, uint32_t mergeGap);
+
+        // Pages that changed since the last upload, with one flag per page so each page is only listed once.
+        AZStd::vector<uint32_t> m_dirtyPages;
+        AZStd::vector<uint8_t> m_pageIsDirty;
+        AZStd::vector<UploadRange> m_uploadRanges;
+        // Ranges uploaded to the current buffers by the last Upload, which are uploaded to the history buffer by the next one.
+        AZStd::vector<UploadRange> m_historyUploadRanges;
+        bool m_fullUploadNeeded = true;
+    };
+} // namespace AZ::Render
@@ -88,6 +88,36 @@ namespace AZ
             return true;
         }
 
+        bool GpuBufferHandler::UpdateBufferRange(uint32_t elementCount, const void* data, uint32_t firstElement, uint32_t updateCount)
+        {
+            if (!IsValid())
+            {
+                return false;
+            }
+
+            AZ_Assert(firstElement + updateCount <= elementCount, "Updated range is outside of the %u elements in the buffer.", elementCount);
+            m_elementCount = elementCount;
+
+            AZ::u64 currentByteCount = m_buffer->GetBufferSize();
+            uint32_t dataSize = elementCount * m_elementSize;
+
+            if (dataSize > currentByteCount)
+            {
+                // Resizing doesn't preserve the previous contents, so everything needs to be uploaded again
+                uint32_t byteCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(BufferMinSize, dataSize));
+                m_buffer->Resize(byteCount);
+                firstElement = 0;
+                updateCount = elementCount;
+            }
+
+            if (updateCount > 0)
+            {
+                const uint32_t byteOffset = firstElement * m_elementSize;
+                return m_buffer->UpdateData(static_cast<const uint8_t*>(data) + byteOffset, updateCount * m_elementSize, byteOffset);
+            }
+            return true;
+        }
+
         bool GpuBufferHandler::UpdateBuffer(const AZStd::unordered_map<int, const void*>& data, uint32_t elementCount)
         {
             if (!IsValid())
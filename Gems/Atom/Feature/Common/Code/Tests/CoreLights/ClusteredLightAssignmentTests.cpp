@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/ClusteredLightAssignment.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    namespace
+    {
+        // The grid uses an identity world to view transform, so world space looks down -Z
+        ClusterGridDescriptor CreateTestGrid()
+        {
+            ClusterGridDescriptor grid;
+            grid.m_tanHalfFovX = 1.0f;
+            grid.m_tanHalfFovY = 0.5f;
+            grid.m_nearDepth = 0.5f;
+            grid.m_farDepth = 200.0f;
+            grid.m_tileCountX = 16;
+            grid.m_tileCountY = 8;
+            grid.m_sliceCount = 16;
+            return grid;
+        }
+
+        AZStd::vector<AZ::Sphere> CreateRandomLights(uint32_t lightCount, uint64_t seed)
+        {
+            SimpleLcgRandom random(seed);
+            AZStd::vector<AZ::Sphere> lights;
+            for (uint32_t lightIndex = 0; lightIndex < lightCount; ++lightIndex)
+            {
+                // Spread the lights around the whole view volume, including some behind the camera and beyond the sides
+                const AZ::Vector3 center(
+                    random.GetRandomFloat() * 120.0f - 60.0f,
+                    random.GetRandomFloat() * 60.0f - 30.0f,
+                    random.GetRandomFloat() * -110.0f + 10.0f);
+                lights.push_back(AZ::Sphere(center, random.GetRandomFloat() * 5.0f + 0.1f));
+            }
+            return lights;
+        }
+
+        // Finds the cluster of a view space point independently of the assignment, returning false outside of the view
+        bool GetPointCluster(const ClusterGridDescriptor& grid, const AZ::Vector3& point, AZ::Vector3& tileAndSlice)
+        {
+            const float depth = -point.GetZ();
+            if (depth <= grid.m_nearDepth)
+            {
+                return false;
+            }
+
+            const float tileX = (point.GetX() / depth + grid.m_tanHalfFovX) / (2.0f * grid.m_tanHalfFovX) * grid.m_tileCountX;
+            const float tileY = (grid.m_tanHalfFovY - point.GetY() / depth) / (2.0f * grid.m_tanHalfFovY) * grid.m_tileCountY;
+            if (tileX < 0.0f || tileX >= grid.m_tileCountX || tileY < 0.0f || tileY >= grid.m_tileCountY)
+            {
+                return false;
+            }
+
+            const float slice = logf(depth / grid.m_nearDepth) / logf(grid.m_farDepth / grid.m_nearDepth) * grid.m_sliceCount;
+            tileAndSlice.Set(floorf(tileX), floorf(tileY), AZStd::min(floorf(slice), grid.m_sliceCount - 1.0f));
+            return true;
+        }
+
+        void ExpectSameClusterLights(const ClusteredLightAssignment& lhs, const ClusteredLightAssignment& rhs)
+        {
+            ASSERT_EQ(lhs.GetClusterCount(), rhs.GetClusterCount());
+            for (uint32_t clusterIndex = 0; clusterIndex < lhs.GetClusterCount(); ++clusterIndex)
+            {
+                AZStd::span<const uint32_t> lhsLights = lhs.GetClusterLights(clusterIndex);
+                AZStd::span<const uint32_t> rhsLights = rhs.GetClusterLights(clusterIndex);
+                ASSERT_EQ(lhsLights.size(), rhsLights.size());
+                EXPECT_TRUE(AZStd::equal(lhsLights.begin(), lhsLights.end(), rhsLights.begin()));
+            }
+        }
+    }
+
+    using ClusteredLightAssignmentTests = LeakDetectionFixture;
+
+    TEST_F(ClusteredLightAssignmentTests, EveryLitPointIsInAClusterWithItsLight)
+    {
+        const ClusterGridDescriptor grid = CreateTestGrid();
+        const AZStd::vector<AZ::Sphere> lights = CreateRandomLights(500, 1234);
+
+        ClusteredLightList lightList;
+        lightList.SetSourceLights(ClusteredLightSource::Point, lights);
+        ClusteredLightAssignment assignment;
+        assignment.Update(lightList, grid, false);
+
+        // Sample points inside each light, and check that the cluster containing the point lists the light
+        SimpleLcgRandom random(5678);
+        uint32_t testedPointCount = 0;
+        for (uint32_t lightIndex = 0; lightIndex < lights.size(); ++lightIndex)
+        {
+            for (uint32_t sampleIndex = 0; sampleIndex < 32; ++sampleIndex)
+            {
+                const AZ::Vector3 offset(
+                    random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f);
+                if (offset.GetLengthSq() > 1.0f)
+                {
+                    continue;
+                }
+
+                const AZ::Vector3 point = lights[lightIndex].GetCenter() + offset * lights[lightIndex].GetRadius();
+                AZ::Vector3 tileAndSlice;
+                if (!GetPointCluster(grid, point, tileAndSlice))
+                {
+                    continue;
+                }
+
+                const uint32_t clusterIndex = assignment.GetClusterIndex(
+                    aznumeric_cast<uint32_t>(tileAndSlice.GetX()),
+                    aznumeric_cast<uint32_t>(tileAndSlice.GetY()),
+                    aznumeric_cast<uint32_t>(tileAndSlice.GetZ()));
+                AZStd::span<const uint32_t> clusterLights = assignment.GetClusterLights(clusterIndex);
+                EXPECT_TRUE(AZStd::binary_search(clusterLights.begin(), clusterLights.end(), lightIndex));
+                ++testedPointCount;
+            }
+        }
+        EXPECT_GT(testedPointCount, 1000);
+    }
+
+    TEST_F(ClusteredLightAssignmentTests, LightsOutsideOfTheViewAreNotAssigned)
+    {
+        const AZStd::vector<AZ::Sphere> lights = {
+            AZ::Sphere(AZ::Vector3(0.0f, 0.0f, 10.0f), 2.0f),    // Behind the camera
+            AZ::Sphere(AZ::Vector3(100.0f, 0.0f, -10.0f), 2.0f), // Beyond the right side of the view
+            AZ::Sphere(AZ::Vector3(0.0f, 0.0f, -10.0f), 2.0f),   // In front of the camera
+        };
+
+        ClusteredLightList lightList;
+        lightList.SetSourceLights(ClusteredLightSource::Point, lights);
+        ClusteredLightAssignment assignment;
+        assignment.Update(lightList, CreateTestGrid(), false);
+
+        EXPECT_TRUE(assignment.GetLightClusterRange(0).IsEmpty());
+        EXPECT_TRUE(assignment.GetLightClusterRange(1).IsEmpty());
+        EXPECT_FALSE(assignment.GetLightClusterRange(2).IsEmpty());
+
+        for (uint32_t clusterIndex = 0; clusterIndex < assignment.GetClusterCount(); ++clusterIndex)
+        {
+            for (uint32_t lightIndex : assignment.GetClusterLights(clusterIndex))
+            {
+                EXPECT_EQ(lightIndex, 2);
+            }
+        }
+    }
+
+    TEST_F(ClusteredLightAssignmentTests, MovingLights_OnlyRebinsChangedLights)
+    {
+        const ClusterGridDescriptor grid = CreateTestGrid();
+        AZStd::vector<AZ::Sphere> lights = CreateRandomLights(200, 4321);
+
+        ClusteredLightList lightList;
+        lightList.SetSourceLights(ClusteredLightSource::Point, lights);
+        ClusteredLightAssignment assignment;
+        assignment.Update(lightList, grid, false);
+        EXPECT_EQ(assignment.GetRebinnedLightCount(), 200);
+
+        // Republishing the same lights doesn't change anything
+        lightList.SetSourceLights(ClusteredLightSource::Point, lights);
+        assignment.Update(lightList, grid, false);
+        EXPECT_EQ(assignment.GetRebinnedLightCount(), 0);
+
+        lights[17].SetCenter(AZ::Vector3(1.0f, 2.0f, -20.0f));
+        lights[150].SetRadius(20.0f);
+        lightList.SetSourceLights(ClusteredLightSource::Point, lights);
+        assignment.Update(lightList, grid, false);
+        EXPECT_EQ(assignment.GetRebinnedLightCount(), 2);
+
+        ClusteredLightAssignment reference;
+        reference.Update(lightList, grid, false);
+        ExpectSameClusterLights(assignment, reference);
+    }
+
+    TEST_F(ClusteredLightAssignmentTests, GridChange_RebinsEveryLight)
+    {
+        ClusterGridDescriptor grid = CreateTestGrid();
+        ClusteredLightList lightList;
+        lightList.SetSourceLights(ClusteredLightSource::Point, CreateRandomLights(100, 8765));
+
+        ClusteredLightAssignment assignment;
+        assignment.Update(lightList, grid, false);
+
+        grid.m_worldToView = AZ::Matrix3x4::CreateTranslation(AZ::Vector3(5.0f, 0.0f, 0.0f));
+        assignment.Update(lightList, grid, false);
+        EXPECT_EQ(assignment.GetRebinnedLightCount(), 100);
+
+        ClusteredLightAssignment reference;
+        reference.Update(lightList, grid, false);
+        ExpectSameClusterLights(assignment, reference);
+    }
+
+    TEST_F(ClusteredLightAssignmentTests, SourcesShareOneCompactedList)
+    {
+        const AZStd::vector<AZ::Sphere> pointLights = CreateRandomLights(2, 1);
+        const AZStd::vector<AZ::Sphere> diskLights = CreateRandomLights(3, 2);
+
+        ClusteredLightList lightList;
+        lightList.SetSourceLights(ClusteredLightSource::Disk, diskLights);
+        lightList.SetSourceLights(ClusteredLightSource::Point, pointLights);
+        EXPECT_EQ(lightList.GetLightCount(), 5);
+        EXPECT_EQ(lightList.GetSourceOffset(ClusteredLightSource::Disk), 2);
+        EXPECT_TRUE(lightList.GetBounds()[3] == diskLights[1]);
+
+        ClusteredLightList::LightReference light = lightList.GetLight(3);
+        EXPECT_EQ(light.m_source, ClusteredLightSource::Disk);
+        EXPECT_EQ(light.m_lightIndex, 1);
+
+        // Removing a point light shifts the disk lights down and changes the layout
+        const uint32_t layoutVersion = lightList.GetLayoutVersion();
+        lightList.SetSourceLights(ClusteredLightSource::Point, AZStd::span<const AZ::Sphere>(pointLights.data(), 1));
+        EXPECT_NE(lightList.GetLayoutVersion(), layoutVersion);
+        EXPECT_EQ(lightList.GetLightCount(), 4);
+        EXPECT_EQ(lightList.GetSourceOffset(ClusteredLightSource::Disk), 1);
+        EXPECT_TRUE(lightList.GetBounds()[2] == diskLights[1]);
+
+        light = lightList.GetLight(2);
+        EXPECT_EQ(light.m_source, ClusteredLightSource::Disk);
+        EXPECT_EQ(light.m_lightIndex, 1);
+    }
+}
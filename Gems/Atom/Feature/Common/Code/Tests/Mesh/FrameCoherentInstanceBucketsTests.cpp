@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/FrameCoherentInstanceBuckets.h>
+#include <Mesh/MeshInstanceManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+
+#include <algorithm>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    using ObjectId = FrameCoherentInstanceBuckets::ObjectId;
+    using SortInstanceData = FrameCoherentInstanceBuckets::SortInstanceData;
+
+    // Adds one instance group per material to the MeshInstanceManager, and one instance list per object
+    class FrameCoherentInstanceBucketsHelper
+    {
+    public:
+        FrameCoherentInstanceBucketsHelper(uint32_t groupCount, uint32_t objectCount)
+            : m_objectCount(objectCount)
+        {
+            const AZ::Data::InstanceId modelId = AZ::Data::InstanceId::CreateFromAssetId({ AZ::Uuid::CreateRandom(), 0 });
+            for (uint32_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+            {
+                const AZ::Data::InstanceId materialId = AZ::Data::InstanceId::CreateFromAssetId({ AZ::Uuid::CreateRandom(), 0 });
+                m_keys.push_back(MeshInstanceGroupKey{ modelId, 0, 0, materialId, Uuid::CreateNull(), 0 });
+                m_groups.push_back(m_meshInstanceManager.AddInstance(m_keys.back()).m_handle);
+            }
+            m_instanceLists.resize(objectCount);
+        }
+
+        ~FrameCoherentInstanceBucketsHelper()
+        {
+            for (const MeshInstanceGroupKey& key : m_keys)
+            {
+                m_meshInstanceManager.RemoveInstance(key);
+            }
+        }
+
+        bool BeginFrame()
+        {
+            m_inserted.clear();
+            return m_buckets.BeginFrame(this, m_meshInstanceManager.GetLayoutVersion(), m_objectCount, 1);
+        }
+
+        //! Reports an object as visible with a single instance in the given group, as the MeshFeatureProcessor does
+        bool MarkVisible(uint32_t objectIndex, uint32_t groupIndex, float depth)
+        {
+            const bool inserted = m_buckets.MarkVisible(ObjectId(objectIndex), &m_instanceLists[objectIndex], depth);
+            if (inserted)
+            {
+                SortInstanceData instanceData;
+                instanceData.m_instanceGroupHandle = m_groups[groupIndex];
+                instanceData.m_depth = m_groups[groupIndex]->m_isTransparent ? -depth : depth;
+                instanceData.m_objectId = ObjectId(objectIndex);
+                m_inserted.push_back(instanceData);
+            }
+            return inserted;
+        }
+
+        void EndFrame(float resortThreshold = 0.25f)
+        {
+            m_buckets.UpdateBucket(0, AZStd::span<SortInstanceData>(m_inserted.data(), m_inserted.size()), resortThreshold);
+        }
+
+        //! Returns the object ids in a bucket in order
+        AZStd::vector<uint32_t> GetObjectOrder() const
+        {
+            AZStd::vector<uint32_t> objectOrder;
+            for (const SortInstanceData& instanceData : m_buckets.GetBucketInstances(0))
+            {
+                objectOrder.push_back(instanceData.m_objectId.GetIndex());
+            }
+            return objectOrder;
+        }
+
+        bool IsGroupedByInstanceGroup() const
+        {
+            const AZStd::vector<SortInstanceData>& instances = m_buckets.GetBucketInstances(0);
+            return AZStd::is_sorted(instances.begin(), instances.end(), [](const SortInstanceData& lhs, const SortInstanceData& rhs)
+            {
+                return lhs.m_instanceGroupHandle < rhs.m_instanceGroupHandle;
+            });
+        }
+
+        MeshInstanceManager m_meshInstanceManager;
+        AZStd::vector<MeshInstanceGroupKey> m_keys;
+        AZStd::vector<MeshInstanceManager::Handle> m_groups;
+        AZStd::vector<int> m_instanceLists;
+        AZStd::vector<SortInstanceData> m_inserted;
+        FrameCoherentInstanceBuckets m_buckets;
+        uint32_t m_objectCount = 0;
+    };
+
+    using FrameCoherentInstanceBucketsTests = LeakDetectionFixture;
+
+    TEST_F(FrameCoherentInstanceBucketsTests, FirstFrame_InsertsAndSortsEveryInstance)
+    {
+        FrameCoherentInstanceBucketsHelper helper(1, 4);
+        EXPECT_TRUE(helper.BeginFrame());
+        EXPECT_TRUE(helper.MarkVisible(0, 0, 3.0f));
+        EXPECT_TRUE(helper.MarkVisible(1, 0, 1.0f));
+        EXPECT_TRUE(helper.MarkVisible(2, 0, 2.0f));
+        helper.EndFrame();
+
+        EXPECT_EQ(helper.GetObjectOrder(), AZStd::vector<uint32_t>({ 1, 2, 0 }));
+        EXPECT_EQ(helper.m_buckets.GetChangedInstanceCount(), 3);
+    }
+
+    TEST_F(FrameCoherentInstanceBucketsTests, UnchangedVisibility_SkipsInsertion)
+    {
+        FrameCoherentInstanceBucketsHelper helper(1, 4);
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 1.0f);
+        helper.MarkVisible(1, 0, 2.0f);
+        helper.EndFrame();
+
+        EXPECT_FALSE(helper.BeginFrame());
+        EXPECT_FALSE(helper.MarkVisible(0, 0, 1.5f));
+        EXPECT_FALSE(helper.MarkVisible(1, 0, 2.5f));
+        helper.EndFrame();
+
+        EXPECT_EQ(helper.GetObjectOrder(), AZStd::vector<uint32_t>({ 0, 1 }));
+        EXPECT_EQ(helper.m_buckets.GetChangedInstanceCount(), 0);
+        EXPECT_EQ(helper.m_buckets.GetResortedBucketCount(), 0);
+
+        // Retained instances have their depth refreshed
+        EXPECT_EQ(helper.m_buckets.GetBucketInstances(0)[0].m_depth, 1.5f);
+    }
+
+    TEST_F(FrameCoherentInstanceBucketsTests, VisibilityChanges_RemoveAndMergeInstances)
+    {
+        FrameCoherentInstanceBucketsHelper helper(2, 8);
+        helper.BeginFrame();
+        for (uint32_t objectIndex = 0; objectIndex < 6; ++objectIndex)
+        {
+            helper.MarkVisible(objectIndex, objectIndex % 2, aznumeric_cast<float>(objectIndex));
+        }
+        helper.EndFrame();
+
+        // Hide object 2, show object 6, and keep the rest
+        helper.BeginFrame();
+        for (uint32_t objectIndex : { 0, 1, 3, 4, 5 })
+        {
+            EXPECT_FALSE(helper.MarkVisible(objectIndex, objectIndex % 2, aznumeric_cast<float>(objectIndex)));
+        }
+        EXPECT_TRUE(helper.MarkVisible(6, 0, 6.0f));
+        helper.EndFrame(1.0f);
+
+        AZStd::vector<uint32_t> objectOrder = helper.GetObjectOrder();
+        EXPECT_EQ(objectOrder.size(), 6);
+        EXPECT_EQ(AZStd::find(objectOrder.begin(), objectOrder.end(), 2u), objectOrder.end());
+        EXPECT_NE(AZStd::find(objectOrder.begin(), objectOrder.end(), 6u), objectOrder.end());
+        EXPECT_TRUE(helper.IsGroupedByInstanceGroup());
+        EXPECT_EQ(helper.m_buckets.GetChangedInstanceCount(), 2);
+        EXPECT_EQ(helper.m_buckets.GetResortedBucketCount(), 0);
+    }
+
+    TEST_F(FrameCoherentInstanceBucketsTests, ManyChanges_ResortsBucket)
+    {
+        FrameCoherentInstanceBucketsHelper helper(1, 8);
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 1.0f);
+        helper.MarkVisible(1, 0, 2.0f);
+        helper.EndFrame();
+
+        // The retained objects swap depths, and half of the bucket is new, so the bucket is re-sorted by depth
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 4.0f);
+        helper.MarkVisible(1, 0, 3.0f);
+        helper.MarkVisible(2, 0, 2.0f);
+        helper.MarkVisible(3, 0, 1.0f);
+        helper.EndFrame(0.25f);
+
+        EXPECT_EQ(helper.m_buckets.GetResortedBucketCount(), 1);
+        EXPECT_EQ(helper.GetObjectOrder(), AZStd::vector<uint32_t>({ 3, 2, 1, 0 }));
+    }
+
+    TEST_F(FrameCoherentInstanceBucketsTests, TransparentGroup_AlwaysSortedBackToFront)
+    {
+        FrameCoherentInstanceBucketsHelper helper(1, 4);
+        helper.m_groups[0]->m_isTransparent = true;
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 1.0f);
+        helper.MarkVisible(1, 0, 2.0f);
+        helper.EndFrame();
+        EXPECT_EQ(helper.GetObjectOrder(), AZStd::vector<uint32_t>({ 1, 0 }));
+
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 2.0f);
+        helper.MarkVisible(1, 0, 1.0f);
+        helper.EndFrame(1.0f);
+        EXPECT_EQ(helper.GetObjectOrder(), AZStd::vector<uint32_t>({ 0, 1 }));
+    }
+
+    TEST_F(FrameCoherentInstanceBucketsTests, ChangedInstanceList_ReinsertsObject)
+    {
+        FrameCoherentInstanceBucketsHelper helper(2, 4);
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 1.0f);
+        helper.EndFrame();
+
+        // The object switches to a different lod, so its previous instances are replaced
+        helper.BeginFrame();
+        SortInstanceData instanceData;
+        instanceData.m_instanceGroupHandle = helper.m_groups[1];
+        instanceData.m_depth = 1.0f;
+        instanceData.m_objectId = ObjectId(0);
+        int otherLod = 0;
+        EXPECT_TRUE(helper.m_buckets.MarkVisible(ObjectId(0), &otherLod, 1.0f));
+        helper.m_inserted.push_back(instanceData);
+        helper.EndFrame();
+
+        const AZStd::vector<SortInstanceData>& instances = helper.m_buckets.GetBucketInstances(0);
+        ASSERT_EQ(instances.size(), 1);
+        EXPECT_EQ(instances[0].m_instanceGroupHandle, helper.m_groups[1]);
+    }
+
+    TEST_F(FrameCoherentInstanceBucketsTests, DuplicateVisibleObject_RequiresFullRebuild)
+    {
+        FrameCoherentInstanceBucketsHelper helper(1, 4);
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 1.0f);
+        helper.EndFrame();
+
+        EXPECT_FALSE(helper.BeginFrame());
+        int otherLod = 0;
+        helper.MarkVisible(0, 0, 1.0f);
+        helper.m_buckets.MarkVisible(ObjectId(0), &otherLod, 1.0f);
+        EXPECT_TRUE(helper.m_buckets.IsFullRebuildRequired());
+        helper.m_buckets.BeginFullRebuild();
+
+        // Tracking stays disabled for the following frames
+        EXPECT_TRUE(helper.BeginFrame());
+    }
+
+    TEST_F(FrameCoherentInstanceBucketsTests, LayoutChange_InvalidatesBuckets)
+    {
+        FrameCoherentInstanceBucketsHelper helper(1, 4);
+        helper.BeginFrame();
+        helper.MarkVisible(0, 0, 1.0f);
+        helper.EndFrame();
+
+        MeshInstanceGroupKey key{ AZ::Data::InstanceId::CreateFromAssetId({ AZ::Uuid::CreateRandom(), 0 }), 0, 0,
+                                  AZ::Data::InstanceId::CreateFromAssetId({ AZ::Uuid::CreateRandom(), 0 }), Uuid::CreateNull(), 0 };
+        helper.m_meshInstanceManager.AddInstance(key);
+        EXPECT_TRUE(helper.BeginFrame());
+        EXPECT_TRUE(helper.MarkVisible(0, 0, 1.0f));
+        helper.m_meshInstanceManager.RemoveInstance(key);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // 100k instances spread over a line of objects, where the camera slowly moves along the line and sees a window of them.
+    // Each frame a small fraction of objects enters and leaves the view, as with a slowly moving camera.
+    class FrameCoherentInstanceBucketsBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t ObjectCount = 100000;
+        static constexpr uint32_t GroupCount = 16;
+        static constexpr float VisibleRange = 25000.0f;
+        static constexpr float CameraSpeed = 20.0f;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_helper = AZStd::make_unique<FrameCoherentInstanceBucketsHelper>(GroupCount, ObjectCount);
+            m_cameraPosition = 0.0f;
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_sorted = {};
+            m_helper.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template<typename VisibleFunction>
+        void ForEachVisibleObject(VisibleFunction visibleFunction)
+        {
+            const float begin = AZStd::max(0.0f, m_cameraPosition - VisibleRange);
+            const float end = AZStd::min(aznumeric_cast<float>(ObjectCount), m_cameraPosition + VisibleRange);
+            for (uint32_t objectIndex = aznumeric_cast<uint32_t>(begin); objectIndex < aznumeric_cast<uint32_t>(end); ++objectIndex)
+            {
+                visibleFunction(objectIndex, objectIndex % GroupCount, AZStd::abs(aznumeric_cast<float>(objectIndex) - m_cameraPosition));
+            }
+        }
+
+        void MoveCamera()
+        {
+            m_cameraPosition += CameraSpeed;
+            if (m_cameraPosition > aznumeric_cast<float>(ObjectCount))
+            {
+                m_cameraPosition = 0.0f;
+            }
+        }
+
+        AZStd::unique_ptr<FrameCoherentInstanceBucketsHelper> m_helper;
+        AZStd::vector<SortInstanceData> m_sorted;
+        float m_cameraPosition = 0.0f;
+    };
+
+    // Scatters and sorts every visible instance each frame, as the MeshFeatureProcessor does without frame coherence
+    BENCHMARK_DEFINE_F(FrameCoherentInstanceBucketsBenchmark, RebuildEveryFrame)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sorted.clear();
+            ForEachVisibleObject([this](uint32_t objectIndex, uint32_t groupIndex, float depth)
+            {
+                SortInstanceData instanceData;
+                instanceData.m_instanceGroupHandle = m_helper->m_groups[groupIndex];
+                instanceData.m_depth = depth;
+                instanceData.m_objectId = ObjectId(objectIndex);
+                m_sorted.push_back(instanceData);
+            });
+            std::sort(m_sorted.begin(), m_sorted.end());
+            benchmark::DoNotOptimize(m_sorted.data());
+            MoveCamera();
+        }
+        state.counters["Instances"] = aznumeric_cast<double>(m_sorted.size());
+    }
+
+    BENCHMARK_DEFINE_F(FrameCoherentInstanceBucketsBenchmark, FrameCoherent)(benchmark::State& state)
+    {
+        double changedInstances = 0.0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_helper->BeginFrame();
+            ForEachVisibleObject([this](uint32_t objectIndex, uint32_t groupIndex, float depth)
+            {
+                m_helper->MarkVisible(objectIndex, groupIndex, depth);
+            });
+            m_helper->EndFrame();
+            benchmark::DoNotOptimize(m_helper->m_buckets.GetBucketInstances(0).data());
+            changedInstances += m_helper->m_buckets.GetChangedInstanceCount();
+            MoveCamera();
+        }
+        state.counters["Instances"] = aznumeric_cast<double>(m_helper->m_buckets.GetBucketInstances(0).size());
+        state.counters["ChangedPerFrame"] = benchmark::Counter(changedInstances, benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(FrameCoherentInstanceBucketsBenchmark, RebuildEveryFrame)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(FrameCoherentInstanceBucketsBenchmark, FrameCoherent)->Unit(benchmark::kMicrosecond);
+#endif
+} // namespace UnitTest
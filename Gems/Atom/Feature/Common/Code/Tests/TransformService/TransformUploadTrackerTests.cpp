@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TransformService/TransformUploadTracker.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    using UploadRange = TransformUploadTracker::UploadRange;
+    constexpr uint32_t PageSize = TransformUploadTracker::TransformsPerPage;
+
+    // Mirrors the buffers of the transform service on the CPU, with one value per transform slot.
+    class TransformUploadTrackerHelper
+    {
+    public:
+        explicit TransformUploadTrackerHelper(uint32_t elementCount)
+            : m_transforms(elementCount, 0)
+            , m_historySnapshot(elementCount, 0)
+            , m_currentBuffer(elementCount, 0)
+            , m_historyBuffer(elementCount, 0)
+        {
+        }
+
+        void SetTransform(uint32_t index, uint32_t value)
+        {
+            m_transforms[index] = value;
+            m_tracker.MarkDirty(index);
+        }
+
+        // Uploads the same way TransformServiceFeatureProcessor::OnBeginPrepareRender does, recording the ranges
+        void UploadFrame(uint32_t mergeGap)
+        {
+            m_historyRanges.clear();
+            m_currentRanges.clear();
+            m_tracker.Upload(
+                aznumeric_cast<uint32_t>(m_transforms.size()),
+                mergeGap,
+                [this](AZStd::span<const UploadRange> ranges)
+                {
+                    m_historyRanges.assign(ranges.begin(), ranges.end());
+                    CopyRanges(ranges, m_historySnapshot, m_historyBuffer);
+                },
+                [this](AZStd::span<const UploadRange> ranges)
+                {
+                    m_currentRanges.assign(ranges.begin(), ranges.end());
+                    CopyRanges(ranges, m_transforms, m_currentBuffer);
+                    CopyRanges(ranges, m_transforms, m_historySnapshot);
+                });
+        }
+
+        TransformUploadTracker m_tracker;
+        AZStd::vector<uint32_t> m_transforms;
+        AZStd::vector<uint32_t> m_historySnapshot;
+        AZStd::vector<uint32_t> m_currentBuffer;
+        AZStd::vector<uint32_t> m_historyBuffer;
+        AZStd::vector<UploadRange> m_historyRanges;
+        AZStd::vector<UploadRange> m_currentRanges;
+
+    private:
+        static void CopyRanges(AZStd::span<const UploadRange> ranges, const AZStd::vector<uint32_t>& source, AZStd::vector<uint32_t>& destination)
+        {
+            for (const UploadRange& range : ranges)
+            {
+                ASSERT_LE(range.m_firstElement + range.m_elementCount, destination.size());
+                for (uint32_t index = range.m_firstElement; index < range.m_firstElement + range.m_elementCount; ++index)
+                {
+                    destination[index] = source[index];
+                }
+            }
+        }
+    };
+
+    class TransformUploadTrackerTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    TEST_F(TransformUploadTrackerTests, FirstUpload_UploadsEverySlot)
+    {
+        TransformUploadTrackerHelper helper(PageSize * 3 + 10);
+        EXPECT_TRUE(helper.m_tracker.HasPendingUploads());
+
+        helper.SetTransform(1, 7);
+        helper.UploadFrame(0);
+
+        ASSERT_EQ(helper.m_currentRanges.size(), 1u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_firstElement, 0u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_elementCount, PageSize * 3 + 10);
+        ASSERT_EQ(helper.m_historyRanges.size(), 1u);
+        EXPECT_EQ(helper.m_historyRanges[0].m_elementCount, PageSize * 3 + 10);
+        EXPECT_EQ(helper.m_currentBuffer, helper.m_transforms);
+    }
+
+    TEST_F(TransformUploadTrackerTests, DirtyPages_OnlyDirtyPagesAreUploaded)
+    {
+        TransformUploadTrackerHelper helper(PageSize * 6);
+        helper.UploadFrame(0);
+        helper.UploadFrame(0);
+        EXPECT_FALSE(helper.m_tracker.HasPendingUploads());
+
+        // Dirty pages 1 and 4, twice in the same page to make sure pages are only listed once
+        helper.SetTransform(PageSize + 3, 1);
+        helper.SetTransform(PageSize + 5, 2);
+        helper.SetTransform(PageSize * 4, 3);
+        EXPECT_TRUE(helper.m_tracker.HasPendingUploads());
+        helper.UploadFrame(0);
+
+        ASSERT_EQ(helper.m_currentRanges.size(), 2u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_firstElement, PageSize);
+        EXPECT_EQ(helper.m_currentRanges[0].m_elementCount, PageSize);
+        EXPECT_EQ(helper.m_currentRanges[1].m_firstElement, PageSize * 4);
+        EXPECT_EQ(helper.m_currentRanges[1].m_elementCount, PageSize);
+        EXPECT_TRUE(helper.m_historyRanges.empty());
+        EXPECT_EQ(helper.m_currentBuffer, helper.m_transforms);
+    }
+
+    TEST_F(TransformUploadTrackerTests, DirtyPages_NearbyPagesAreMerged)
+    {
+        TransformUploadTrackerHelper helper(PageSize * 8);
+        helper.UploadFrame(2);
+        helper.UploadFrame(2);
+
+        // Pages 0 and 3 are separated by two clean pages, page 7 by three
+        helper.SetTransform(0, 1);
+        helper.SetTransform(PageSize * 3, 2);
+        helper.SetTransform(PageSize * 7, 3);
+        helper.UploadFrame(2);
+
+        ASSERT_EQ(helper.m_currentRanges.size(), 2u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_firstElement, 0u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_elementCount, PageSize * 4);
+        EXPECT_EQ(helper.m_currentRanges[1].m_firstElement, PageSize * 7);
+        EXPECT_EQ(helper.m_currentRanges[1].m_elementCount, PageSize);
+    }
+
+    TEST_F(TransformUploadTrackerTests, DirtyPages_LastPageIsClampedToElementCount)
+    {
+        TransformUploadTrackerHelper helper(PageSize * 2 + 5);
+        helper.UploadFrame(0);
+        helper.UploadFrame(0);
+
+        helper.SetTransform(PageSize * 2 + 4, 1);
+        helper.UploadFrame(0);
+
+        ASSERT_EQ(helper.m_currentRanges.size(), 1u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_firstElement, PageSize * 2);
+        EXPECT_EQ(helper.m_currentRanges[0].m_elementCount, 5u);
+    }
+
+    TEST_F(TransformUploadTrackerTests, HistoryBuffer_HoldsPreviousFrameTransformsAcrossTwoFrames)
+    {
+        const uint32_t elementCount = PageSize * 4;
+        TransformUploadTrackerHelper helper(elementCount);
+        for (uint32_t index = 0; index < elementCount; ++index)
+        {
+            helper.SetTransform(index, 100 + index);
+        }
+        helper.UploadFrame(0);
+        const AZStd::vector<uint32_t> firstFrame = helper.m_transforms;
+
+        // Second frame: only page 2 changes
+        helper.SetTransform(PageSize * 2 + 1, 1);
+        helper.UploadFrame(0);
+        const AZStd::vector<uint32_t> secondFrame = helper.m_transforms;
+
+        ASSERT_EQ(helper.m_currentRanges.size(), 1u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_firstElement, PageSize * 2);
+        EXPECT_EQ(helper.m_currentBuffer, secondFrame);
+        EXPECT_EQ(helper.m_historyBuffer, firstFrame);
+
+        // Third frame: page 0 changes, and the page that changed in the second frame is uploaded to the history buffer
+        helper.SetTransform(3, 2);
+        helper.UploadFrame(0);
+
+        ASSERT_EQ(helper.m_historyRanges.size(), 1u);
+        EXPECT_EQ(helper.m_historyRanges[0].m_firstElement, PageSize * 2);
+        EXPECT_EQ(helper.m_historyRanges[0].m_elementCount, PageSize);
+        ASSERT_EQ(helper.m_currentRanges.size(), 1u);
+        EXPECT_EQ(helper.m_currentRanges[0].m_firstElement, 0u);
+        EXPECT_EQ(helper.m_currentBuffer, helper.m_transforms);
+        EXPECT_EQ(helper.m_historyBuffer, secondFrame);
+
+        // Fourth frame: nothing changes, so the history buffer catches up with the current buffer
+        helper.UploadFrame(0);
+        EXPECT_TRUE(helper.m_currentRanges.empty());
+        EXPECT_EQ(helper.m_historyBuffer, helper.m_transforms);
+        EXPECT_FALSE(helper.m_tracker.HasPendingUploads());
+    }
+
+    TEST_F(TransformUploadTrackerTests, MarkAllDirty_UploadsEverySlotToBothBuffers)
+    {
+        const uint32_t elementCount = PageSize * 2;
+        TransformUploadTrackerHelper helper(elementCount);
+        for (uint32_t index = 0; index < elementCount; ++index)
+        {
+            helper.SetTransform(index, index);
+        }
+        helper.UploadFrame(0);
+        helper.UploadFrame(0);
+
+        // Simulate resized buffers that lost their contents
+        helper.SetTransform(PageSize + 1, 5);
+        AZStd::fill(helper.m_currentBuffer.begin(), helper.m_currentBuffer.end(), 0u);
+        AZStd::fill(helper.m_historyBuffer.begin(), helper.m_historyBuffer.end(), 0u);
+        const AZStd::vector<uint32_t> previousFrame = helper.m_historySnapshot;
+        helper.m_tracker.MarkAllDirty();
+        helper.UploadFrame(0);
+
+        EXPECT_EQ(helper.m_currentBuffer, helper.m_transforms);
+        EXPECT_EQ(helper.m_historyBuffer, previousFrame);
+    }
+} // namespace UnitTest
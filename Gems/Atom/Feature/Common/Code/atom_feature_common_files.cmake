@@ -41,6 +41,10 @@ set(FILES
     Source/CoreLights/CapsuleLightFeatureProcessor.cpp
     Source/CoreLights/CascadedShadowmapsPass.h
     Source/CoreLights/CascadedShadowmapsPass.cpp
+    Source/CoreLights/ClusteredLightAssignment.h
+    Source/CoreLights/ClusteredLightAssignment.cpp
+    Source/CoreLights/ClusteredLightFeatureProcessor.h
+    Source/CoreLights/ClusteredLightFeatureProcessor.cpp
     Source/CoreLights/CoreLightsSystemComponent.h
     Source/CoreLights/CoreLightsSystemComponent.cpp
     Source/CoreLights/DepthExponentiationPass.h
@@ -123,6 +127,8 @@ set(FILES
     Source/Math/MathFilter.h
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
+    Source/Mesh/FrameCoherentInstanceBuckets.cpp
+    Source/Mesh/FrameCoherentInstanceBuckets.h
     Source/Mesh/MeshInstanceGroupKey.cpp
     Source/Mesh/MeshInstanceGroupKey.h
     Source/Mesh/MeshInstanceGroupList.cpp
@@ -319,4 +325,6 @@ set(FILES
     Source/SplashScreen/SplashScreenPass.h
     Source/TransformService/TransformServiceFeatureProcessor.cpp
     Source/TransformService/TransformServiceFeatureProcessor.h
+    Source/TransformService/TransformUploadTracker.cpp
+    Source/TransformService/TransformUploadTracker.h
 )
@@ -9,12 +9,15 @@
 set(FILES
     Mocks/MockMeshFeatureProcessor.h
     Tests/CommonTest.cpp
+    Tests/CoreLights/ClusteredLightAssignmentTests.cpp
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
+    Tests/Mesh/FrameCoherentInstanceBucketsTests.cpp
     Tests/Mesh/MeshInstanceManagerTests.cpp
     Tests/MultiIndexedDataVectorTests.cpp
     Tests/IndexableListTests.cpp
     Tests/SparseVectorTests.cpp
     Tests/SkinnedMesh/SkinnedMeshDispatchItemTests.cpp
+    Tests/TransformService/TransformUploadTrackerTests.cpp
     Tests/Decals/DecalTextureArrayTests.cpp
 )
@@ -65,6 +65,9 @@ namespace AZ::RHI
 
             //! The memory usage of the pool.
             PoolMemoryUsage m_memoryUsage;
+
+            //! The number of bytes the pool copied to GPU visible memory during the last frame.
+            size_t m_uploadedBytes = 0;
         };
 
         //! This structure tracks an instance of a physical memory heap. For certain platforms, there
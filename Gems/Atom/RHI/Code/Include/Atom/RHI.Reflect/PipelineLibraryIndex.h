@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace AZ::RHI
+{
+    //! A platform independent record of the pipeline states a pipeline library compiled, identified by the hash of their
+    //! descriptors. Unlike PipelineLibraryData, which some platforms can't serialize, the index can always be written to
+    //! disk and used on the next run to tell which pipeline states are cheap to create from the platform library.
+    struct PipelineLibraryIndex
+    {
+        AZ_CLASS_ALLOCATOR(PipelineLibraryIndex, SystemAllocator);
+        AZ_TYPE_INFO(PipelineLibraryIndex, "{6BFCC96D-B0D2-4FC5-A12B-1DFF8C1D732D}");
+
+        static void Reflect(ReflectContext* context);
+
+        //! Sorted descriptor hashes of the compiled pipeline states.
+        AZStd::vector<uint64_t> m_pipelineStateHashes;
+    };
+}
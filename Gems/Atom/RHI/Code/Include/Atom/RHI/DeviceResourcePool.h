@@ -74,6 +74,10 @@ namespace AZ::RHI
         //! Returns the memory used by this pool.
         const PoolMemoryUsage& GetMemoryUsage() const;
 
+        //! Returns the number of bytes the pool copied to GPU visible memory during the last frame.
+        //! Pools that don't track their uploads return zero.
+        virtual size_t GetUploadedBytesLastFrame() const;
+
     protected:
         DeviceResourcePool() = default;
 
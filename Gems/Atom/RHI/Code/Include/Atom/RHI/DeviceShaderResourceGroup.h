@@ -9,6 +9,8 @@
 
 #include <Atom/RHI/DeviceResource.h>
 #include <Atom/RHI/DeviceShaderResourceGroupData.h>
+#include <Atom/RHI.Reflect/Interval.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AZ::RHI
 {
@@ -72,12 +74,27 @@ namespace AZ::RHI
 
         //! Update the view hash within m_viewHash
         void UpdateViewHash(const AZ::Name& viewName, const HashValue64 viewHash);
+
+        //! Returns the byte range [m_min, m_max) of the constant data that may differ from what the constant buffer being
+        //! compiled currently holds. Platforms that cycle through RHI::Limits::Device::FrameCountMax constant buffers,
+        //! one per compile, only need to copy this range. Only valid within CompileGroupInternal.
+        Interval GetConstantDataUploadRange() const;
             
     protected:
         DeviceShaderResourceGroup() = default;
 
     private:
         void SetData(const DeviceShaderResourceGroupData& data);
+        void SetData(const DeviceShaderResourceGroupData& data, uint32_t updateMask);
+
+        // Adds a changed byte range to the constant data changes since the last compile.
+        void AddConstantDataDirtyRange(Interval byteRange);
+
+        // Records the constant data changes since the last compile. Called once per platform compile.
+        void CommitConstantDataDirtyRange(bool isFullUpload);
+
+        // Forgets the constant data history, so the next FrameCountMax compiles upload all constants.
+        void ResetConstantDataDirtyRanges();
 
         DeviceShaderResourceGroupData m_data;
 
@@ -96,5 +113,11 @@ namespace AZ::RHI
 
         // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
         AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
+
+        // Constant bytes changed by each of the last FrameCountMax compiles, and by data set since the last compile.
+        AZStd::array<Interval, RHI::Limits::Device::FrameCountMax> m_constantDataDirtyRanges;
+        Interval m_pendingConstantDataDirtyRange;
+        Interval m_constantDataUploadRange;
+        uint32_t m_constantDataCompileCount = 0;
     };
 }
@@ -14,6 +14,7 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/DeviceResourcePool.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ::RHI
@@ -76,6 +77,11 @@ namespace AZ::RHI
         //! Returns whether groups in this pool have a sampler table.
         bool HasSamplerGroup() const;
 
+        //////////////////////////////////////////////////////////////////////////
+        // DeviceResourcePool overrides
+        size_t GetUploadedBytesLastFrame() const override;
+        //////////////////////////////////////////////////////////////////////////
+
     protected:
         DeviceShaderResourceGroupPool();
 
@@ -89,6 +95,9 @@ namespace AZ::RHI
         }
         //////////////////////////////////////////////////////////////////////////
 
+        //! Platforms report the bytes they copy to GPU visible memory while compiling groups. Thread safe.
+        void RecordUploadedBytes(size_t byteCount);
+
     private:
         // Queues the shader resource group for compile and provides a new data packet (takes a lock).
         void QueueForCompile(DeviceShaderResourceGroup& group, const DeviceShaderResourceGroupData& groupData);
@@ -108,6 +117,10 @@ namespace AZ::RHI
         // Calculate diffs for updating the resource registry.
         void CalculateGroupDataDiff(DeviceShaderResourceGroup& shaderResourceGroup, const DeviceShaderResourceGroupData& groupData);
 
+        // Assigns new data to the group. Resource types flagged as updated whose content is identical to the group's current
+        // data are dropped from the update mask, and the changed constant bytes are recorded so platforms can upload only those.
+        void SetGroupData(DeviceShaderResourceGroup& shaderResourceGroup, const DeviceShaderResourceGroupData& groupData);
+
         // Calculate the hash for all the views passed in
         template<typename T>
         HashValue64 GetViewHash(AZStd::span<const RHI::ConstPtr<T>> views);
@@ -154,5 +167,8 @@ namespace AZ::RHI
 
         AZStd::mutex m_invalidateRegistryMutex;
         ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
+
+        AZStd::atomic<size_t> m_uploadedBytes{ 0 };
+        size_t m_uploadedBytesLastFrame = 0;
     };
 }
@@ -40,5 +40,33 @@ namespace AZ::RHI
     /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
     DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
+    //! Scratch memory used when radix sorting draw lists. Reusing an instance between sorts avoids
+    //! reallocating the intermediate buffers every frame.
+    struct DrawListSortScratch
+    {
+        struct Entry
+        {
+            uint64_t m_key = 0;
+            uint32_t m_index = 0;
+        };
+
+        AZStd::vector<Entry> m_entries;
+        AZStd::vector<Entry> m_swapEntries;
+        DrawList m_sortedList;
+    };
+
+    //! Sorts the draw list. Large lists are radix sorted using the calling thread's scratch memory from the RHI system.
     void SortDrawList(DrawList& drawList, DrawListSortType sortType);
+
+    //! Sorts the draw list, using the provided scratch memory if the list is large enough to radix sort.
+    void SortDrawList(DrawList& drawList, DrawListSortType sortType, DrawListSortScratch& scratch);
+
+    //! Sorts the draw list with a comparison sort. Items with equal sort key and depth are ordered by draw item address.
+    void SortDrawListComparison(DrawList& drawList, DrawListSortType sortType);
+
+    //! Sorts the draw list with an LSD radix sort over a 64-bit key packing the sort key relative to the smallest
+    //! sort key in the list with the depth. Depth keeps full precision while the range of sort keys fits in 32 bits,
+    //! and is quantized to the remaining bits otherwise. Items with equal keys keep their relative order.
+    //! @return false without modifying the list if the sort keys span too wide a range to leave room for depth
+    bool SortDrawListRadix(DrawList& drawList, DrawListSortType sortType, DrawListSortScratch& scratch);
 }
@@ -14,6 +14,8 @@
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 
 
 //! Struct used as a key for m_imageReverseLookupHash map below. The reason for using a struct instead of a hash directly is
@@ -110,6 +112,26 @@ namespace AZ::RHI
         FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
     };
 
+    //! Statistics for the topology cache of FrameGraphCompiler, accumulated since the compiler was initialized.
+    //! The CPU time covers only the phases the cache can skip: the topology hash, the queue graph and the transient lifetime
+    //! extension. Transient aliasing, resource views and platform barriers are compiled every frame and aren't included.
+    //! Comparing the average time of hits and misses gives the cost saved each frame the graph topology is unchanged.
+    struct FrameGraphCompileCacheStatistics
+    {
+        //! Number of compiles that reused the cached queue graph and attachment lifetimes.
+        uint64_t m_hitCount = 0;
+
+        //! Number of compiles that rebuilt the queue graph and attachment lifetimes, including every compile while
+        //! r_frameGraphCompileCache is disabled.
+        uint64_t m_missCount = 0;
+
+        //! Total CPU time in milliseconds spent in the cacheable phases of compiles that hit the cache.
+        double m_hitCpuTimeMs = 0.0;
+
+        //! Total CPU time in milliseconds spent in the cacheable phases of compiles that missed the cache.
+        double m_missCpuTimeMs = 0.0;
+    };
+
     //! FrameGraphCompiler controls compilation of FrameGraph each frame. FrameScheduler owns
     //! and drives an instance of this class, so end-users should never need to interact with it directly.
     //! Platform implementations, on the other hand, are required to override this class in order to perform
@@ -186,6 +208,9 @@ namespace AZ::RHI
         //! method is invoked.
         MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+        //! Returns statistics for the topology cache. Compiles with r_frameGraphCompileCache disabled count as misses.
+        const FrameGraphCompileCacheStatistics& GetCompileCacheStatistics() const;
+
     protected:
         FrameGraphCompiler() = default;
 
@@ -211,6 +236,22 @@ namespace AZ::RHI
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
 
+        //! Hashes every input of the queue graph and transient lifetime phases: scope order, queues and groups,
+        //! producer / consumer edges, transient attachment usages and descriptors, and the compile flags.
+        HashValue64 HashFrameGraphTopology(const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags) const;
+
+        //! Records the queue graph and transient attachment lifetimes of a freshly compiled frame graph.
+        void StoreCompiledTopology(const FrameGraph& frameGraph, HashValue64 topologyHash);
+
+        //! Re-applies the cached queue graph to a frame graph with the same topology hash.
+        void RestoreCompiledQueueGraph(FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags);
+
+        //! Re-applies the cached transient attachment lifetimes to a frame graph with the same topology hash.
+        void RestoreCompiledAttachmentLifetimes(FrameGraph& frameGraph);
+
+        //! Extends the transient attachment lifetimes across queues and scope groups.
+        void CompileTransientAttachmentLifetimes(FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags);
+
         void ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
@@ -263,5 +304,33 @@ namespace AZ::RHI
         // once they have been replaced with a new view instance. 
         AZStd::unordered_map<ImageResourceViewData, HashValue64> m_imageReverseLookupHash;
         AZStd::unordered_map<BufferResourceViewData, HashValue64> m_bufferReverseLookupHash;
+
+        // The results of the queue graph and transient lifetime phases depend only on the frame graph topology, which
+        // rarely changes between frames. They are stored by scope and attachment index so they can be re-applied to the
+        // new scope and attachment instances of a later frame with the same topology hash.
+        static constexpr uint32_t InvalidScopeIndex = static_cast<uint32_t>(-1);
+        using ScopeIndicesByQueue = AZStd::array<uint32_t, HardwareQueueClassCount>;
+
+        struct AttachmentLifetime
+        {
+            uint32_t m_attachmentIndex = 0;
+            int m_deviceIndex = MultiDevice::InvalidDeviceIndex;
+            uint32_t m_firstScopeIndex = InvalidScopeIndex;
+            uint32_t m_lastScopeIndex = InvalidScopeIndex;
+        };
+
+        struct CompiledTopology
+        {
+            bool m_isValid = false;
+            HashValue64 m_hash = HashValue64{ 0 };
+            AZStd::vector<ScopeIndicesByQueue> m_producersByQueueLast;
+            AZStd::vector<ScopeIndicesByQueue> m_producersByQueue;
+            AZStd::vector<ScopeIndicesByQueue> m_consumersByQueue;
+            AZStd::vector<AttachmentLifetime> m_bufferLifetimes;
+            AZStd::vector<AttachmentLifetime> m_imageLifetimes;
+        };
+
+        CompiledTopology m_compiledTopology;
+        FrameGraphCompileCacheStatistics m_compileCacheStatistics;
     };
 }
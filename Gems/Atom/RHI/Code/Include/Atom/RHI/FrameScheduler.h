@@ -171,6 +171,9 @@ namespace AZ::RHI
         //! Returns current CPU frame to frame time in milliseconds.
         double GetCpuFrameTime() const;
 
+        //! Returns statistics for the topology cache of the frame graph compiler.
+        const FrameGraphCompileCacheStatistics& GetFrameGraphCompileCacheStatistics() const;
+
         //! Returns memory statistics for the previous frame.
         const MemoryStatistics* GetMemoryStatistics() const;
 
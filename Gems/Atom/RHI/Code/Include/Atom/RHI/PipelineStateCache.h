@@ -7,10 +7,12 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/PipelineLibraryIndex.h>
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -23,11 +25,42 @@ namespace AZ::RHI
 {
     using PipelineStateHash = HashValue64;
 
+    //! The order in which queued asynchronous pipeline state compiles are processed.
+    enum class PipelineStateCompilePriority : uint32_t
+    {
+        //! The pipeline state is needed to render something this frame.
+        Visible = 0,
+        //! The pipeline state is expected to be needed soon, for example when a material finishes loading.
+        Prewarm,
+        Count
+    };
+
+    //! Progress of a pipeline state compiled by a background job, shared by every cache entry of that pipeline state.
+    struct PipelineStateCompileStatus
+        : public AZStd::intrusive_base
+    {
+        AZ_CLASS_ALLOCATOR(PipelineStateCompileStatus, SystemAllocator);
+
+        enum class State : uint32_t
+        {
+            Queued,
+            Compiling,
+            Complete
+        };
+
+        AZStd::atomic<State> m_state = { State::Queued };
+        AZStd::atomic<PipelineStateCompilePriority> m_priority = { PipelineStateCompilePriority::Prewarm };
+
+        //! The pipeline state being compiled. Only the thread that moves m_state to Compiling may initialize it.
+        Ptr<PipelineState> m_pipelineState;
+    };
+
     //! Used for storing a PipelineState object in a hash table structure (set, map, etc)
     struct PipelineStateEntry
     {
         PipelineStateEntry(
-            PipelineStateHash hash, ConstPtr<PipelineState> pipelineState, const PipelineStateDescriptor& descriptor);
+            PipelineStateHash hash, ConstPtr<PipelineState> pipelineState, const PipelineStateDescriptor& descriptor,
+            Ptr<PipelineStateCompileStatus> compileStatus = nullptr);
 
         bool operator < (const PipelineStateEntry& rhs) const
         {
@@ -44,6 +77,12 @@ namespace AZ::RHI
         //! Pipeline state descriptor variant for dispatch, draw, and ray tracing
         using PipelineStateDescriptorVariant = AZStd::variant<AZ::RHI::PipelineStateDescriptorForDraw, AZ::RHI::PipelineStateDescriptorForDispatch, AZ::RHI::PipelineStateDescriptorForRayTracing>;
         PipelineStateDescriptorVariant m_pipelineStateDescriptorVariant;
+
+        //! Non-null if the pipeline state is compiled by a background job.
+        Ptr<PipelineStateCompileStatus> m_compileStatus;
+
+        //! Returns the descriptor held by the variant.
+        const PipelineStateDescriptor& GetDescriptor() const;
     };
 
     //! Hash calculator for a PipelineStateEntry
@@ -120,6 +159,18 @@ namespace AZ::RHI
     //!      This is the fast-path case where multiple threads are now able to resolve pipeline states with very
     //!      little performance overhead.
     //!
+    //! Asynchronous Compilation:
+    //!
+    //!  AcquirePipelineStateAsync never compiles on the calling thread. A pipeline state that isn't compiled yet is queued
+    //!  for a background job and the caller's fallback pipeline state is returned until the job completes, so draw
+    //!  submission doesn't stall on first-time pipeline state creation. Visible requests are compiled before prewarm
+    //!  requests, and a prewarm request is promoted when the pipeline state is requested as visible. If a synchronous
+    //!  AcquirePipelineState finds a pipeline state that is still queued, it compiles it immediately on the calling thread.
+    //!
+    //!  Each library also keeps a PipelineLibraryIndex of the pipeline states it compiled. The index is backend agnostic and
+    //!  can be persisted by the owner of the library and handed back at startup. Pipeline states found in the index are
+    //!  expected to be cheap to create from the platform pipeline library, so they are compiled inline instead of falling back.
+    //!
     //! Example Usage:
     //! @code{.cpp}
     //!      // Create library instance.
@@ -178,11 +229,33 @@ namespace AZ::RHI
         const PipelineState* AcquirePipelineState(
             PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, const AZ::Name& name = AZ::Name());
 
+        //! Acquires a pipeline state without blocking on its compilation. If the pipeline state has been compiled, it is returned.
+        //! Otherwise its compilation is queued on a background job with the requested priority, and the fallback is returned
+        //! (which may be null). Callers must request the pipeline state again on a later frame to pick up the compiled result.
+        const PipelineState* AcquirePipelineStateAsync(
+            PipelineLibraryHandle library,
+            const PipelineStateDescriptor& descriptor,
+            const PipelineState* fallbackPipelineState,
+            PipelineStateCompilePriority priority = PipelineStateCompilePriority::Visible,
+            const AZ::Name& name = AZ::Name());
+
+        //! Blocks until every queued asynchronous compile has completed.
+        void WaitForAsyncCompiles();
+
+        //! Provides the pipeline states a library compiled in a previous session, usually loaded from disk at startup.
+        void SetLibraryIndex(PipelineLibraryHandle handle, const PipelineLibraryIndex& index);
+
+        //! Returns the index of pipeline states known to the library, including those compiled during this session.
+        //! Like GetMergedLibrary, this is intended to be written to disk when the library is released.
+        PipelineLibraryIndex GetLibraryIndex(PipelineLibraryHandle handle) const;
+
         //! This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
         //! This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
         //! once per frame.
         void Compact();
 
+        ~PipelineStateCache();
+
     private:
         PipelineStateCache(MultiDevice::DeviceMask deviceMask);
 
@@ -203,6 +276,12 @@ namespace AZ::RHI
             // Contains the initial serialized data (Used to prime the thread libraries)
             // or the file name that contains the serialized data
             PipelineLibraryDescriptor m_pipelineLibraryDescriptor;
+
+            // Hashes of the pipeline states compiled by this library in a previous session.
+            AZStd::unordered_set<PipelineStateHash> m_knownPipelineStates;
+
+            // Incremented whenever the library is reset, so that stale queued compiles are discarded.
+            uint32_t m_generation = 0;
         };
 
         using GlobalLibrarySet = AZStd::fixed_vector<GlobalLibraryEntry, LibraryCountMax>;
@@ -224,20 +303,51 @@ namespace AZ::RHI
         //! The size of the global set should be used when traversing the thread library entries.
         using ThreadLibrarySet = AZStd::array<ThreadLibraryEntry, LibraryCountMax>;
 
+        //! An asynchronous compile waiting for a background job.
+        struct QueuedCompile
+        {
+            PipelineStateEntry m_entry;
+            AZ::Name m_name;
+            PipelineLibraryHandle m_library;
+            uint32_t m_libraryGeneration = 0;
+        };
+
         //! Helper function which binary searches a pipeline state set looking for an entry which matches the requested descriptor.
-        static const PipelineState* FindPipelineState(
+        static const PipelineStateEntry* FindPipelineState(
             const PipelineStateSet& pipelineStateSet, const PipelineStateDescriptor& descriptor);
 
         //! Helper function which inserts an entry into the set. Returns true if the entry was inserted, or false is a duplicate entry existed.
         static bool InsertPipelineState(PipelineStateSet& pipelineStateSet, PipelineStateEntry pipelineStateEntry);
 
         //! Performs a pipeline state compilation on the global cache using the thread-local pipeline library.
+        //! If the pipeline state is already pending, it is returned instead, along with its asynchronous compile status if it has one.
         ConstPtr<PipelineState> CompilePipelineState(
+            PipelineLibraryHandle handle,
             GlobalLibraryEntry& globalLibraryEntry,
             ThreadLibraryEntry& threadLibraryEntry,
             const PipelineStateDescriptor& pipelineStateDescriptor,
             PipelineStateHash pipelineStateHash,
-            const AZ::Name& name);
+            const AZ::Name& name,
+            Ptr<PipelineStateCompileStatus>& compileStatus);
+
+        //! Returns the calling thread's entry for the library, lazily initializing its pipeline library.
+        ThreadLibraryEntry& GetThreadLibraryEntry(PipelineLibraryHandle handle, GlobalLibraryEntry& globalLibraryEntry);
+
+        //! Returns the pipeline state of an entry, first completing its asynchronous compile if it has one in flight.
+        const PipelineState* ResolvePipelineState(
+            const PipelineStateEntry& entry, PipelineLibraryHandle handle, GlobalLibraryEntry& globalLibraryEntry, const AZ::Name& name);
+
+        //! Compiles a pipeline state owned by an asynchronous compile, unless another thread already claimed it.
+        //! The calling thread's pipeline library must not be reset or merged until it returns, which is guaranteed by holding
+        //! either m_mutex or m_asyncCompileMutex shared.
+        void CompileQueuedPipelineState(
+            const PipelineStateEntry& entry, PipelineLibrary* pipelineLibrary, const AZ::Name& name);
+
+        //! Adds a compile to the queue of its priority and starts a background job if fewer than the maximum are running.
+        void QueueAsyncCompile(QueuedCompile&& queuedCompile, PipelineStateCompilePriority priority);
+
+        //! Body of a background compile job. Processes queued compiles, highest priority first, until the queues are empty.
+        void ProcessAsyncCompiles();
 
         //! Resets the library without validating the handle or taking a lock.
         void ResetLibraryImpl(PipelineLibraryHandle handle);
@@ -251,6 +361,9 @@ namespace AZ::RHI
         /// This mutex guards library creation / reset / deletion.
         mutable AZStd::shared_mutex m_mutex;
 
+        /// Held shared by background jobs while they compile, and exclusively (before m_mutex) when libraries are reset or merged.
+        mutable AZStd::shared_mutex m_asyncCompileMutex;
+
         /// The set of library entries. The RHI::PipelineLibraryHandle maps into this array.
         GlobalLibrarySet m_globalLibrarySet;
 
@@ -261,6 +374,13 @@ namespace AZ::RHI
         /// to recycle slots in m_globalLibrarySet.
         AZStd::fixed_vector<PipelineLibraryHandle, LibraryCountMax> m_libraryFreeList;
 
+        /// Asynchronous compiles waiting for a background job, one queue per PipelineStateCompilePriority.
+        AZStd::array<AZStd::deque<QueuedCompile>, static_cast<size_t>(PipelineStateCompilePriority::Count)> m_compileQueues;
+        AZStd::mutex m_compileQueueMutex;
+
+        /// The number of background compile jobs currently running. Guarded by m_compileQueueMutex.
+        uint32_t m_compileJobCount = 0;
+
         // Friends
         friend class UnitTest::PipelineStateTests;
     };
@@ -9,11 +9,13 @@
 #pragma once
 
 #include <Atom/RHI/Device.h>
+#include <Atom/RHI/DrawList.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/FrameScheduler.h>
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/RHIMemoryStatisticsInterface.h>
+#include <Atom/RHI/ThreadLocalContext.h>
 #include <Atom/RHI/XRRenderingInterface.h>
 
 namespace AZ
@@ -71,6 +73,7 @@ namespace AZ::RHI
         MultiDevice::DeviceMask GetRayTracingSupport() override;
         RHI::DrawListTagRegistry* GetDrawListTagRegistry() override;
         RHI::PipelineStateCache* GetPipelineStateCache() override;
+        RHI::DrawListSortScratch& GetDrawListSortScratch() override;
         void ModifyFrameSchedulerStatisticsFlags(RHI::FrameSchedulerStatisticsFlags statisticsFlags, bool enableFlags) override;
         double GetCpuFrameTime() const override;
         const AZStd::unordered_map<int, TransientAttachmentPoolDescriptor>* GetTransientAttachmentPoolDescriptor() const override;
@@ -109,6 +112,7 @@ namespace AZ::RHI
         RHI::FrameSchedulerCompileRequest m_compileRequest;
         RHI::Ptr<RHI::DrawListTagRegistry> m_drawListTagRegistry;
         RHI::Ptr<RHI::PipelineStateCache> m_pipelineStateCache;
+        RHI::ThreadLocalContext<RHI::DrawListSortScratch> m_drawListSortScratch;
         XRRenderingInterface* m_xrSystem = nullptr;
 
         //Used for better verbosity related to gpu markers
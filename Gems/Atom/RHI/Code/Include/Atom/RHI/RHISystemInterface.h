@@ -27,6 +27,7 @@ namespace AZ::RHI
     class PlatformLimitsDescriptor;
     class PhysicalDeviceDescriptor;
     class DeviceRayTracingShaderTable;
+    struct DrawListSortScratch;
     struct FrameSchedulerCompileRequest;
     struct TransientAttachmentStatistics;
     struct TransientAttachmentPoolDescriptor;
@@ -58,6 +59,9 @@ namespace AZ::RHI
 
         virtual RHI::PipelineStateCache* GetPipelineStateCache() = 0;
 
+        //! Returns the calling thread's scratch memory for sorting draw lists.
+        virtual RHI::DrawListSortScratch& GetDrawListSortScratch() = 0;
+
         virtual void ModifyFrameSchedulerStatisticsFlags(RHI::FrameSchedulerStatisticsFlags statisticsFlags, bool enableFlags) = 0;
 
         virtual double GetCpuFrameTime() const = 0;
@@ -24,6 +24,7 @@
 #include <Atom/RHI.Reflect/RenderStates.h>
 #include <Atom/RHI.Reflect/PipelineLayoutDescriptor.h>
 #include <Atom/RHI.Reflect/PipelineLibraryData.h>
+#include <Atom/RHI.Reflect/PipelineLibraryIndex.h>
 #include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 #include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
 #include <Atom/RHI.Reflect/ResolveScopeAttachmentDescriptor.h>
@@ -64,6 +65,7 @@ namespace AZ::RHI
         MultisampleState::Reflect(context);
         RenderStates::Reflect(context);
         PipelineLibraryData::Reflect(context);
+        PipelineLibraryIndex::Reflect(context);
         ReflectRenderStateEnums(context);
         ReflectSamplerStateEnums(context);
         //////////////////////////////////////////////////////////////////////////
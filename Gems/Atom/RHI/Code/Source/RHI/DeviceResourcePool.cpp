@@ -253,6 +253,12 @@ namespace AZ::RHI
 
         poolStats->m_name = GetName();
         poolStats->m_memoryUsage = m_memoryUsage;
+        poolStats->m_uploadedBytes = GetUploadedBytesLastFrame();
         builder.EndPool();
     }
+
+    size_t DeviceResourcePool::GetUploadedBytesLastFrame() const
+    {
+        return 0;
+    }
 }
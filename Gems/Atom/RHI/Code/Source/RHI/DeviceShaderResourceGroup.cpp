@@ -12,6 +12,23 @@
 
 namespace AZ::RHI
 {
+    namespace
+    {
+        // Byte ranges are half open [m_min, m_max), and empty when m_min == m_max.
+        Interval MergeByteRanges(Interval lhs, Interval rhs)
+        {
+            if (lhs.m_min == lhs.m_max)
+            {
+                return rhs;
+            }
+            if (rhs.m_min == rhs.m_max)
+            {
+                return lhs;
+            }
+            return Interval(AZStd::min(lhs.m_min, rhs.m_min), AZStd::max(lhs.m_max, rhs.m_max));
+        }
+    }
+
     void DeviceShaderResourceGroup::Compile(const DeviceShaderResourceGroupData& groupData, CompileMode compileMode /*= CompileMode::Async*/)
     {
         switch (compileMode)
@@ -54,10 +71,14 @@ namespace AZ::RHI
     }
 
     void DeviceShaderResourceGroup::SetData(const DeviceShaderResourceGroupData& data)
+    {
+        SetData(data, data.GetUpdateMask());
+    }
+
+    void DeviceShaderResourceGroup::SetData(const DeviceShaderResourceGroupData& data, uint32_t sourceUpdateMask)
     {
         m_data = data;
-        uint32_t sourceUpdateMask = data.GetUpdateMask();
-            
+
         //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
         m_rhiUpdateMask |= sourceUpdateMask;
         for (uint32_t i = 0; i < static_cast<uint32_t>(DeviceShaderResourceGroupData::ResourceType::Count); i++)
@@ -116,6 +137,45 @@ namespace AZ::RHI
         m_viewHash[viewName] = viewHash;
     }
     
+    Interval DeviceShaderResourceGroup::GetConstantDataUploadRange() const
+    {
+        return m_constantDataUploadRange;
+    }
+
+    void DeviceShaderResourceGroup::AddConstantDataDirtyRange(Interval byteRange)
+    {
+        m_pendingConstantDataDirtyRange = MergeByteRanges(m_pendingConstantDataDirtyRange, byteRange);
+    }
+
+    void DeviceShaderResourceGroup::CommitConstantDataDirtyRange(bool isFullUpload)
+    {
+        m_constantDataDirtyRanges[m_constantDataCompileCount % m_constantDataDirtyRanges.size()] = m_pendingConstantDataDirtyRange;
+        m_pendingConstantDataDirtyRange = Interval();
+        ++m_constantDataCompileCount;
+
+        // The first FrameCountMax compiles each write a constant buffer that was never written before.
+        if (isFullUpload || m_constantDataCompileCount <= m_constantDataDirtyRanges.size())
+        {
+            m_constantDataUploadRange = Interval(0, aznumeric_cast<uint32_t>(m_data.GetConstantData().size()));
+            return;
+        }
+
+        // The buffer being written was last written FrameCountMax compiles ago, so it is missing the changes of every compile since.
+        m_constantDataUploadRange = Interval();
+        for (const Interval& dirtyRange : m_constantDataDirtyRanges)
+        {
+            m_constantDataUploadRange = MergeByteRanges(m_constantDataUploadRange, dirtyRange);
+        }
+    }
+
+    void DeviceShaderResourceGroup::ResetConstantDataDirtyRanges()
+    {
+        m_constantDataDirtyRanges.fill(Interval());
+        m_pendingConstantDataDirtyRange = Interval();
+        m_constantDataUploadRange = Interval();
+        m_constantDataCompileCount = 0;
+    }
+
     void DeviceShaderResourceGroup::ReportMemoryUsage(MemoryStatisticsBuilder& builder) const
     {
         AZ_UNUSED(builder);
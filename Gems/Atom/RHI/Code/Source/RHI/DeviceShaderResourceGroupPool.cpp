@@ -9,6 +9,7 @@
 #include <Atom/RHI/DeviceBufferView.h>
 #include <Atom/RHI/DeviceImageView.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ::RHI
 {
@@ -73,6 +74,15 @@ namespace AZ::RHI
 
             // Cache off the binding slot for one less indirection.
             group.m_bindingSlot = layout->GetBindingSlot();
+
+            // The platform constant buffers start out uninitialized, so the first compiles must upload the constants even if
+            // they match the default data.
+            group.ResetConstantDataDirtyRanges();
+            if (HasConstants())
+            {
+                group.EnableRhiResourceTypeCompilation(DeviceShaderResourceGroupData::ResourceTypeMask::ConstantDataMask);
+                group.ResetResourceTypeIteration(DeviceShaderResourceGroupData::ResourceType::ConstantData);
+            }
         }
         return resultCode;
     }
@@ -122,7 +132,7 @@ namespace AZ::RHI
         {
             CalculateGroupDataDiff(shaderResourceGroup, groupData);
 
-            shaderResourceGroup.SetData(groupData);
+            SetGroupData(shaderResourceGroup, groupData);
 
             QueueForCompileNoLock(shaderResourceGroup);
         }
@@ -156,7 +166,7 @@ namespace AZ::RHI
     void DeviceShaderResourceGroupPool::Compile(DeviceShaderResourceGroup& group, const DeviceShaderResourceGroupData& groupData)
     {
         CalculateGroupDataDiff(group, groupData);
-        group.SetData(groupData);
+        SetGroupData(group, groupData);
         CompileGroup(group, group.GetData());
     }
 
@@ -226,6 +236,60 @@ namespace AZ::RHI
         }
     }
 
+    void DeviceShaderResourceGroupPool::SetGroupData(DeviceShaderResourceGroup& shaderResourceGroup, const DeviceShaderResourceGroupData& groupData)
+    {
+        uint32_t updateMask = groupData.GetUpdateMask();
+        const DeviceShaderResourceGroupData& currentData = shaderResourceGroup.GetData();
+
+        const uint32_t constantDataMask = static_cast<uint32_t>(DeviceShaderResourceGroupData::ResourceTypeMask::ConstantDataMask);
+        if (HasConstants() && CheckBitsAny(updateMask, constantDataMask))
+        {
+            AZStd::span<const uint8_t> constantsOld = currentData.GetConstantData();
+            AZStd::span<const uint8_t> constantsNew = groupData.GetConstantData();
+            if (r_DisablePartialSrgCompilation || constantsOld.size() != constantsNew.size())
+            {
+                shaderResourceGroup.AddConstantDataDirtyRange(Interval(0, aznumeric_cast<uint32_t>(constantsNew.size())));
+            }
+            else
+            {
+                // Setting a constant marks all constants dirty, so narrow it down to the bytes that actually differ.
+                size_t first = 0;
+                while (first < constantsNew.size() && constantsOld[first] == constantsNew[first])
+                {
+                    ++first;
+                }
+
+                if (first == constantsNew.size())
+                {
+                    updateMask = ResetBits(updateMask, constantDataMask);
+                }
+                else
+                {
+                    size_t last = constantsNew.size();
+                    while (last > first && constantsOld[last - 1] == constantsNew[last - 1])
+                    {
+                        --last;
+                    }
+                    shaderResourceGroup.AddConstantDataDirtyRange(Interval(aznumeric_cast<uint32_t>(first), aznumeric_cast<uint32_t>(last)));
+                }
+            }
+        }
+
+        // Views are left to the view hash check in CompileGroup, since a view can be invalidated without its pointer changing.
+        const uint32_t samplerMask = static_cast<uint32_t>(DeviceShaderResourceGroupData::ResourceTypeMask::SamplerMask);
+        if (!r_DisablePartialSrgCompilation && CheckBitsAny(updateMask, samplerMask))
+        {
+            AZStd::span<const SamplerState> samplersOld = currentData.GetSamplerGroup();
+            AZStd::span<const SamplerState> samplersNew = groupData.GetSamplerGroup();
+            if (AZStd::equal(samplersOld.begin(), samplersOld.end(), samplersNew.begin(), samplersNew.end()))
+            {
+                updateMask = ResetBits(updateMask, samplerMask);
+            }
+        }
+
+        shaderResourceGroup.SetData(groupData, updateMask);
+    }
+
     void DeviceShaderResourceGroupPool::CompileGroupsBegin()
     {
         AZ_Assert(m_isCompiling == false, "Already compiling! Deadlock imminent.");
@@ -238,9 +302,20 @@ namespace AZ::RHI
         AZ_Assert(m_isCompiling, "CompileGroupsBegin() was never called.");
         m_isCompiling = false;
         m_groupsToCompile.clear();
+        m_uploadedBytesLastFrame = m_uploadedBytes.exchange(0);
         m_groupsToCompileMutex.unlock();
     }
 
+    void DeviceShaderResourceGroupPool::RecordUploadedBytes(size_t byteCount)
+    {
+        m_uploadedBytes.fetch_add(byteCount, AZStd::memory_order_relaxed);
+    }
+
+    size_t DeviceShaderResourceGroupPool::GetUploadedBytesLastFrame() const
+    {
+        return m_uploadedBytesLastFrame;
+    }
+
     uint32_t DeviceShaderResourceGroupPool::GetGroupsToCompileCount() const
     {
         AZ_Assert(m_isCompiling, "You must call this function within a CompileGroups{Begin, End} region!");
@@ -345,6 +420,7 @@ namespace AZ::RHI
         // Check if any part of the Srg was updated before trying to compile it
         if (shaderResourceGroup.IsAnyResourceTypeUpdated())
         {
+            shaderResourceGroup.CommitConstantDataDirtyRange(r_DisablePartialSrgCompilation);
             ResultCode resultCode = CompileGroupInternal(shaderResourceGroup, shaderResourceGroupData);
                 
             //Reset update mask if the latency check has been fulfilled
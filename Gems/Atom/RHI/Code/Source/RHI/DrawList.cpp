@@ -6,11 +6,45 @@
  *
  */
 #include <Atom/RHI/DrawList.h>
+#include <Atom/RHI/RHISystemInterface.h>
 
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
 {
+    namespace
+    {
+        // Below this size the setup cost of the radix sort outweighs its benefits
+        constexpr size_t RadixSortMinItemCount = 256;
+
+        // Quantizing depth any further than this produces too many false ties to be useful
+        constexpr uint32_t RadixSortMinDepthBits = 16;
+
+        constexpr uint32_t RadixBits = 8;
+        constexpr uint32_t RadixBucketCount = 1 << RadixBits;
+        constexpr uint32_t RadixMaxPassCount = 64 / RadixBits;
+
+        //! Maps a float onto an unsigned integer with the same ordering.
+        uint32_t GetOrderedDepthBits(float depth)
+        {
+            uint32_t bits;
+            memcpy(&bits, &depth, sizeof(bits));
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        }
+
+        bool IsDepthFirst(DrawListSortType sortType)
+        {
+            return (sortType == DrawListSortType::DepthThenKey) || (sortType == DrawListSortType::ReverseDepthThenKey);
+        }
+
+        bool IsReverseDepth(DrawListSortType sortType)
+        {
+            return (sortType == DrawListSortType::KeyThenReverseDepth) || (sortType == DrawListSortType::ReverseDepthThenKey);
+        }
+    }
+
     DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
     {
         if (drawList.empty())
@@ -25,6 +59,126 @@ namespace AZ::RHI
     }
 
     void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+    {
+        if (drawList.size() < RadixSortMinItemCount)
+        {
+            SortDrawListComparison(drawList, sortType);
+            return;
+        }
+
+        if (RHISystemInterface* rhiSystem = RHISystemInterface::Get())
+        {
+            SortDrawList(drawList, sortType, rhiSystem->GetDrawListSortScratch());
+        }
+        else
+        {
+            DrawListSortScratch scratch;
+            SortDrawList(drawList, sortType, scratch);
+        }
+    }
+
+    void SortDrawList(DrawList& drawList, DrawListSortType sortType, DrawListSortScratch& scratch)
+    {
+        if (drawList.size() < RadixSortMinItemCount || !SortDrawListRadix(drawList, sortType, scratch))
+        {
+            SortDrawListComparison(drawList, sortType);
+        }
+    }
+
+    bool SortDrawListRadix(DrawList& drawList, DrawListSortType sortType, DrawListSortScratch& scratch)
+    {
+        const size_t itemCount = drawList.size();
+        if (itemCount < 2)
+        {
+            return true;
+        }
+
+        // Sort keys are packed relative to the smallest key, so only the bits spanned by the range are needed
+        DrawItemSortKey minSortKey = drawList.front().m_sortKey;
+        DrawItemSortKey maxSortKey = minSortKey;
+        for (const DrawItemProperties& item : drawList)
+        {
+            minSortKey = AZStd::min(minSortKey, item.m_sortKey);
+            maxSortKey = AZStd::max(maxSortKey, item.m_sortKey);
+        }
+
+        const uint64_t sortKeyRange = static_cast<uint64_t>(maxSortKey) - static_cast<uint64_t>(minSortKey);
+        const uint32_t sortKeyBits = (sortKeyRange == 0) ? 0 : (64 - az_clz_u64(sortKeyRange));
+        const uint32_t depthBits = AZStd::min(64 - sortKeyBits, 32u);
+        if (depthBits < RadixSortMinDepthBits)
+        {
+            return false;
+        }
+
+        const bool depthFirst = IsDepthFirst(sortType);
+        const bool reverseDepth = IsReverseDepth(sortType);
+        const uint32_t depthShift = 32 - depthBits;
+
+        scratch.m_entries.resize_no_construct(itemCount);
+        scratch.m_swapEntries.resize_no_construct(itemCount);
+        DrawListSortScratch::Entry* source = scratch.m_entries.data();
+        DrawListSortScratch::Entry* destination = scratch.m_swapEntries.data();
+
+        // Build the packed keys and the histograms for every digit in a single pass
+        uint32_t histograms[RadixMaxPassCount][RadixBucketCount] = {};
+        for (size_t index = 0; index < itemCount; ++index)
+        {
+            const DrawItemProperties& item = drawList[index];
+            const uint64_t sortKeyOffset = static_cast<uint64_t>(item.m_sortKey) - static_cast<uint64_t>(minSortKey);
+            uint32_t depthKey = GetOrderedDepthBits(item.m_depth);
+            depthKey = (reverseDepth ? ~depthKey : depthKey) >> depthShift;
+
+            const uint64_t key = depthFirst
+                ? ((static_cast<uint64_t>(depthKey) << sortKeyBits) | sortKeyOffset)
+                : ((sortKeyOffset << depthBits) | depthKey);
+
+            source[index] = { key, aznumeric_cast<uint32_t>(index) };
+            for (uint32_t pass = 0; pass < RadixMaxPassCount; ++pass)
+            {
+                ++histograms[pass][(key >> (pass * RadixBits)) & (RadixBucketCount - 1)];
+            }
+        }
+
+        const uint32_t passCount = AZ::DivideAndRoundUp(sortKeyBits + depthBits, RadixBits);
+        for (uint32_t pass = 0; pass < passCount; ++pass)
+        {
+            uint32_t* histogram = histograms[pass];
+            const uint32_t shift = pass * RadixBits;
+
+            // Digits shared by every item don't change the order, sort keys in particular often only differ in a few bits
+            if (histogram[(source[0].m_key >> shift) & (RadixBucketCount - 1)] == itemCount)
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (uint32_t bucket = 0; bucket < RadixBucketCount; ++bucket)
+            {
+                const uint32_t count = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += count;
+            }
+
+            for (size_t index = 0; index < itemCount; ++index)
+            {
+                const DrawListSortScratch::Entry& entry = source[index];
+                destination[histogram[(entry.m_key >> shift) & (RadixBucketCount - 1)]++] = entry;
+            }
+            AZStd::swap(source, destination);
+        }
+
+        scratch.m_sortedList.resize_no_construct(itemCount);
+        for (size_t index = 0; index < itemCount; ++index)
+        {
+            scratch.m_sortedList[index] = drawList[source[index].m_index];
+        }
+
+        // Swapping keeps both allocations around for the next sort
+        drawList.swap(scratch.m_sortedList);
+        return true;
+    }
+
+    void SortDrawListComparison(DrawList& drawList, DrawListSortType sortType)
     {
         switch (sortType)
         {
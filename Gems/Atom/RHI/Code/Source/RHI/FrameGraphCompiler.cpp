@@ -19,10 +19,21 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/std/sort.h>
 
+AZ_CVAR(
+    bool,
+    r_frameGraphCompileCache,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Reuse the queue graph and transient attachment lifetimes of the previous frame graph compile while its topology is unchanged. "
+    "Transient aliasing, resource views and platform barriers are still compiled every frame.");
+
 namespace AZ::RHI
 {
     ResultCode FrameGraphCompiler::Init()
@@ -44,6 +55,8 @@ namespace AZ::RHI
 
     void FrameGraphCompiler::Shutdown()
     {
+        m_compiledTopology = {};
+        m_compileCacheStatistics = {};
         m_imageViewCache.Clear();
         m_bufferViewCache.Clear();
         m_imageReverseLookupHash.clear();
@@ -101,6 +114,10 @@ namespace AZ::RHI
     //
     //          The final phase is to compile the platform specific scopes and hand-off compilation to the platform-specific
     //          implementation, which may introduce more phases specific to the platform API.
+    //
+    // While r_frameGraphCompileCache is enabled and the graph topology matches the previous compile, phase 1 and the transient
+    // lifetime extension at the start of phase 2 are restored from the previous compile. The transient pool allocations (and
+    // so the aliasing), the resource views and the platform-specific compile, including barriers, are rebuilt every frame.
     MessageOutcome FrameGraphCompiler::Compile(const FrameGraphCompileRequest& request)
     {
         AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Compile");
@@ -113,10 +130,52 @@ namespace AZ::RHI
 
         FrameGraph& frameGraph = *request.m_frameGraph;
 
+        // The queue graph and transient lifetimes are reused from the previous compile when the topology is unchanged.
+        // Only these phases are timed, so the statistics show what the cache saves rather than the cost of the whole compile.
+        const bool useCompileCache = r_frameGraphCompileCache;
+        const auto topologyStartTime = AZStd::chrono::steady_clock::now();
+        const HashValue64 topologyHash = useCompileCache ? HashFrameGraphTopology(frameGraph, request.m_compileFlags) : HashValue64{ 0 };
+        const bool isCacheHit = useCompileCache && m_compiledTopology.m_isValid && m_compiledTopology.m_hash == topologyHash;
+
         /// [Phase 1] Compiles the cross-queue scope graph.
-        CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+        if (isCacheHit)
+        {
+            RestoreCompiledQueueGraph(frameGraph, request.m_compileFlags);
+        }
+        else
+        {
+            CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+        }
 
-        /// [Phase 2] Compile transient attachments across all scopes.
+        /// [Phase 2a] Extends the transient attachment lifetimes across queues and scope groups.
+        if (isCacheHit)
+        {
+            RestoreCompiledAttachmentLifetimes(frameGraph);
+        }
+        else
+        {
+            CompileTransientAttachmentLifetimes(frameGraph, request.m_compileFlags);
+        }
+
+        if (useCompileCache && !isCacheHit)
+        {
+            StoreCompiledTopology(frameGraph, topologyHash);
+        }
+
+        const double topologyTimeMs =
+            AZStd::chrono::duration<double, AZStd::milli>(AZStd::chrono::steady_clock::now() - topologyStartTime).count();
+        if (isCacheHit)
+        {
+            ++m_compileCacheStatistics.m_hitCount;
+            m_compileCacheStatistics.m_hitCpuTimeMs += topologyTimeMs;
+        }
+        else
+        {
+            ++m_compileCacheStatistics.m_missCount;
+            m_compileCacheStatistics.m_missCpuTimeMs += topologyTimeMs;
+        }
+
+        /// [Phase 2b] Compile transient attachments across all scopes.
         CompileTransientAttachments(
             frameGraph,
             *request.m_transientAttachmentPool,
@@ -140,6 +199,171 @@ namespace AZ::RHI
         return CompileInternal(request);
     }
 
+    const FrameGraphCompileCacheStatistics& FrameGraphCompiler::GetCompileCacheStatistics() const
+    {
+        return m_compileCacheStatistics;
+    }
+
+    HashValue64 FrameGraphCompiler::HashFrameGraphTopology(const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags) const
+    {
+        AZ_PROFILE_FUNCTION(RHI);
+
+        const int deviceCount = RHISystemInterface::Get()->GetDeviceCount();
+        const auto& scopes = frameGraph.GetScopes();
+
+        HashValue64 hash = TypeHash64(compileFlags);
+        hash = TypeHash64(deviceCount, hash);
+        hash = TypeHash64(scopes.size(), hash);
+
+        for (const Scope* scope : scopes)
+        {
+            hash = TypeHash64(scope->GetId().GetHash(), hash);
+            hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+            hash = TypeHash64(scope->GetDeviceIndex(), hash);
+            hash = TypeHash64(scope->GetFrameGraphGroupId().GetIndex(), hash);
+
+            const auto& consumers = frameGraph.GetConsumers(*scope);
+            hash = TypeHash64(consumers.size(), hash);
+            for (const Scope* consumer : consumers)
+            {
+                hash = TypeHash64(consumer->GetIndex(), hash);
+            }
+
+            const auto& transientAttachments = scope->GetTransientAttachments();
+            hash = TypeHash64(transientAttachments.size(), hash);
+            for (const ScopeAttachment* scopeAttachment : transientAttachments)
+            {
+                hash = TypeHash64(scopeAttachment->GetFrameAttachment().GetId().GetHash(), hash);
+            }
+        }
+
+        auto hashLifetimes = [&hash, deviceCount](const FrameAttachment& frameAttachment)
+        {
+            hash = TypeHash64(frameAttachment.GetId().GetHash(), hash);
+            for (int deviceIndex{ 0 }; deviceIndex < deviceCount; ++deviceIndex)
+            {
+                const Scope* firstScope = frameAttachment.GetFirstScope(deviceIndex);
+                const Scope* lastScope = frameAttachment.GetLastScope(deviceIndex);
+                hash = TypeHash64(firstScope ? firstScope->GetIndex() : InvalidScopeIndex, hash);
+                hash = TypeHash64(lastScope ? lastScope->GetIndex() : InvalidScopeIndex, hash);
+            }
+        };
+
+        const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+        const auto& transientBuffers = attachmentDatabase.GetTransientBufferAttachments();
+        hash = TypeHash64(transientBuffers.size(), hash);
+        for (const BufferFrameAttachment* transientBuffer : transientBuffers)
+        {
+            hashLifetimes(*transientBuffer);
+            hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+        }
+
+        const auto& transientImages = attachmentDatabase.GetTransientImageAttachments();
+        hash = TypeHash64(transientImages.size(), hash);
+        for (const ImageFrameAttachment* transientImage : transientImages)
+        {
+            hashLifetimes(*transientImage);
+            hash = TypeHash64(transientImage->GetSupportedQueueMask(), hash);
+            hash = transientImage->GetImageDescriptor().GetHash(hash);
+        }
+
+        return hash;
+    }
+
+    void FrameGraphCompiler::StoreCompiledTopology(const FrameGraph& frameGraph, HashValue64 topologyHash)
+    {
+        AZ_PROFILE_FUNCTION(RHI);
+
+        auto getScopeIndex = [](const Scope* scope)
+        {
+            return scope ? scope->GetIndex() : InvalidScopeIndex;
+        };
+
+        const auto& scopes = frameGraph.GetScopes();
+        m_compiledTopology.m_producersByQueueLast.resize(scopes.size());
+        m_compiledTopology.m_producersByQueue.resize(scopes.size());
+        m_compiledTopology.m_consumersByQueue.resize(scopes.size());
+        for (uint32_t scopeIndex = 0; scopeIndex < static_cast<uint32_t>(scopes.size()); ++scopeIndex)
+        {
+            const Scope* scope = scopes[scopeIndex];
+            AZ_Assert(scope->GetIndex() == scopeIndex, "Scope index does not match its position in the sorted scope list.");
+
+            for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+            {
+                m_compiledTopology.m_producersByQueueLast[scopeIndex][hardwareQueueClassIdx] = getScopeIndex(scope->m_producersByQueueLast[hardwareQueueClassIdx]);
+                m_compiledTopology.m_producersByQueue[scopeIndex][hardwareQueueClassIdx] = getScopeIndex(scope->m_producersByQueue[hardwareQueueClassIdx]);
+                m_compiledTopology.m_consumersByQueue[scopeIndex][hardwareQueueClassIdx] = getScopeIndex(scope->m_consumersByQueue[hardwareQueueClassIdx]);
+            }
+        }
+
+        auto storeLifetimes = [&getScopeIndex](const auto& frameAttachments, AZStd::vector<AttachmentLifetime>& lifetimes)
+        {
+            lifetimes.clear();
+            for (uint32_t attachmentIndex = 0; attachmentIndex < static_cast<uint32_t>(frameAttachments.size()); ++attachmentIndex)
+            {
+                for (const auto& [deviceIndex, scopeInfo] : frameAttachments[attachmentIndex]->m_scopeInfos)
+                {
+                    lifetimes.push_back({ attachmentIndex, deviceIndex, getScopeIndex(scopeInfo.m_firstScope), getScopeIndex(scopeInfo.m_lastScope) });
+                }
+            }
+        };
+
+        const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+        storeLifetimes(attachmentDatabase.GetTransientBufferAttachments(), m_compiledTopology.m_bufferLifetimes);
+        storeLifetimes(attachmentDatabase.GetTransientImageAttachments(), m_compiledTopology.m_imageLifetimes);
+
+        m_compiledTopology.m_hash = topologyHash;
+        m_compiledTopology.m_isValid = true;
+    }
+
+    void FrameGraphCompiler::RestoreCompiledQueueGraph(FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags)
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: RestoreCompiledQueueGraph");
+
+        const auto& scopes = frameGraph.GetScopes();
+        auto getScope = [&scopes](uint32_t scopeIndex)
+        {
+            return scopeIndex != InvalidScopeIndex ? scopes[scopeIndex] : nullptr;
+        };
+
+        const bool disableAsyncQueues = CheckBitsAll(compileFlags, FrameSchedulerCompileFlags::DisableAsyncQueues);
+        for (uint32_t scopeIndex = 0; scopeIndex < static_cast<uint32_t>(scopes.size()); ++scopeIndex)
+        {
+            Scope* scope = scopes[scopeIndex];
+            if (disableAsyncQueues)
+            {
+                scope->m_hardwareQueueClass = HardwareQueueClass::Graphics;
+            }
+
+            for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+            {
+                scope->m_producersByQueueLast[hardwareQueueClassIdx] = getScope(m_compiledTopology.m_producersByQueueLast[scopeIndex][hardwareQueueClassIdx]);
+                scope->m_producersByQueue[hardwareQueueClassIdx] = getScope(m_compiledTopology.m_producersByQueue[scopeIndex][hardwareQueueClassIdx]);
+                scope->m_consumersByQueue[hardwareQueueClassIdx] = getScope(m_compiledTopology.m_consumersByQueue[scopeIndex][hardwareQueueClassIdx]);
+            }
+        }
+    }
+
+    void FrameGraphCompiler::RestoreCompiledAttachmentLifetimes(FrameGraph& frameGraph)
+    {
+        AZ_PROFILE_FUNCTION(RHI);
+
+        const auto& scopes = frameGraph.GetScopes();
+        auto restoreLifetimes = [&scopes](const auto& frameAttachments, const AZStd::vector<AttachmentLifetime>& lifetimes)
+        {
+            for (const AttachmentLifetime& lifetime : lifetimes)
+            {
+                auto& scopeInfo = frameAttachments[lifetime.m_attachmentIndex]->m_scopeInfos[lifetime.m_deviceIndex];
+                scopeInfo.m_firstScope = lifetime.m_firstScopeIndex != InvalidScopeIndex ? scopes[lifetime.m_firstScopeIndex] : nullptr;
+                scopeInfo.m_lastScope = lifetime.m_lastScopeIndex != InvalidScopeIndex ? scopes[lifetime.m_lastScopeIndex] : nullptr;
+            }
+        };
+
+        const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+        restoreLifetimes(attachmentDatabase.GetTransientBufferAttachments(), m_compiledTopology.m_bufferLifetimes);
+        restoreLifetimes(attachmentDatabase.GetTransientImageAttachments(), m_compiledTopology.m_imageLifetimes);
+    }
+
     void FrameGraphCompiler::CompileQueueCentricScopeGraph(
         FrameGraph& frameGraph,
         FrameSchedulerCompileFlags compileFlags)
@@ -539,6 +763,20 @@ namespace AZ::RHI
         }
     }
 
+    void FrameGraphCompiler::CompileTransientAttachmentLifetimes(FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags)
+    {
+        const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+        if (attachmentDatabase.GetTransientBufferAttachments().empty() && attachmentDatabase.GetTransientImageAttachments().empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachmentLifetimes");
+
+        ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+        ExtendTransientAttachmentGroupLifetimes(frameGraph, compileFlags);
+    }
+
     void FrameGraphCompiler::CompileTransientAttachments(
         FrameGraph& frameGraph,
         TransientAttachmentPool& transientAttachmentPool,
@@ -553,9 +791,6 @@ namespace AZ::RHI
 
         AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-        ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-        ExtendTransientAttachmentGroupLifetimes(frameGraph, compileFlags);
-
         OptimizeTransientLoadStoreActions(frameGraph, compileFlags);
 
         // Builds a sortable key. It iterates each scope and performs deactivations
@@ -701,6 +701,11 @@ namespace AZ::RHI
         return 0;
     }
 
+    const FrameGraphCompileCacheStatistics& FrameScheduler::GetFrameGraphCompileCacheStatistics() const
+    {
+        return m_frameGraphCompiler->GetCompileCacheStatistics();
+    }
+
     ScopeId FrameScheduler::GetRootScopeId(int deviceIndex)
     {
         auto iterator{ m_rootScopeIds.find(deviceIndex) };
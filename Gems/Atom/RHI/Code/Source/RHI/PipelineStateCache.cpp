@@ -9,12 +9,18 @@
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/Factory.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(uint32_t, r_pipelineStateCompileJobCount, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of background jobs compiling pipeline states requested with AcquirePipelineStateAsync");
+
     Ptr<PipelineStateCache> PipelineStateCache::Create(MultiDevice::DeviceMask deviceMask)
     {
         return aznew PipelineStateCache(deviceMask);
@@ -25,6 +31,12 @@ namespace AZ::RHI
     {
     }
 
+    PipelineStateCache::~PipelineStateCache()
+    {
+        // Background jobs reference the cache, so they must all finish before it goes away.
+        WaitForAsyncCompiles();
+    }
+
     void PipelineStateCache::ValidateCacheIntegrity() const
     {
 #if defined(AZ_ENABLE_TRACING)
@@ -69,6 +81,7 @@ namespace AZ::RHI
 
     void PipelineStateCache::Reset()
     {
+        AZStd::unique_lock<AZStd::shared_mutex> compileLock(m_asyncCompileMutex);
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
 
         for (size_t i = 0; i < m_globalLibrarySet.size(); ++i)
@@ -121,6 +134,7 @@ namespace AZ::RHI
     {
         if (handle.IsValid())
         {
+            AZStd::unique_lock<AZStd::shared_mutex> compileLock(m_asyncCompileMutex);
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
             AZ_Assert(m_globalLibraryActiveBits[handle.GetIndex()], "Releasing a library that is no longer valid.");
 
@@ -129,6 +143,7 @@ namespace AZ::RHI
             GlobalLibraryEntry& libraryEntry = m_globalLibrarySet[handle.GetIndex()];
             libraryEntry.m_readOnlyCache.clear();
             libraryEntry.m_pipelineLibraryDescriptor.Init(m_deviceMask, {}, {});
+            libraryEntry.m_knownPipelineStates.clear();
 
             m_globalLibraryActiveBits[handle.GetIndex()] = false;
             m_libraryFreeList.push_back(handle);
@@ -139,6 +154,7 @@ namespace AZ::RHI
     {
         if (handle.IsValid())
         {
+            AZStd::unique_lock<AZStd::shared_mutex> compileLock(m_asyncCompileMutex);
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
             ResetLibraryImpl(handle);
         }
@@ -156,6 +172,9 @@ namespace AZ::RHI
 
         GlobalLibraryEntry& libraryEntry = m_globalLibrarySet[handle.GetIndex()];
 
+        // The caller holds m_asyncCompileMutex exclusively, so no asynchronous compile is in flight. Any that are still queued are discarded.
+        ++libraryEntry.m_generation;
+
         AZ_Assert(libraryEntry.m_pendingCompileCount == 0, "Reseting library while compiles are still pending!");
         libraryEntry.m_readOnlyCache.clear();
         libraryEntry.m_pendingCacheMutex.lock();
@@ -170,6 +189,8 @@ namespace AZ::RHI
             return nullptr;
         }
 
+        // Background jobs compile into their thread libraries without holding m_mutex, so they are excluded separately.
+        AZStd::unique_lock<AZStd::shared_mutex> compileLock(m_asyncCompileMutex);
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
         const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
 
@@ -272,13 +293,13 @@ namespace AZ::RHI
         ValidateCacheIntegrity();
     }
 
-    const PipelineState* PipelineStateCache::FindPipelineState(
+    const PipelineStateEntry* PipelineStateCache::FindPipelineState(
         const PipelineStateSet& pipelineStateSet, const PipelineStateDescriptor& descriptor)
     {
         auto pipelineStateIt = pipelineStateSet.find(PipelineStateEntry(descriptor.GetHash(), nullptr, descriptor));
         if (pipelineStateIt != pipelineStateSet.end())
         {
-            return pipelineStateIt->m_pipelineState.get();
+            return &*pipelineStateIt;
         }
         return nullptr;
     }
@@ -303,84 +324,399 @@ namespace AZ::RHI
         PipelineStateHash pipelineStateHash = descriptor.GetHash();
 
         // Search the read-only cache first.
-        if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
+        if (const PipelineStateEntry* entry = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
         {
-            return pipelineState;
+            return ResolvePipelineState(*entry, handle, globalLibraryEntry, name);
         }
 
         // Search the thread-local cache next.
         {
             ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
-            ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
-            PipelineStateSet& threadLocalCache = threadLibraryEntry.m_threadLocalCache;
+            PipelineStateSet& threadLocalCache = threadLibrarySet[handle.GetIndex()].m_threadLocalCache;
 
-            if (const PipelineState* pipelineState = FindPipelineState(threadLocalCache, descriptor))
+            if (const PipelineStateEntry* entry = FindPipelineState(threadLocalCache, descriptor))
             {
-                return pipelineState;
+                return ResolvePipelineState(*entry, handle, globalLibraryEntry, name);
             }
 
             // No entry in the thread-local set. Request a pipeline state from the pending cache and add
             // it to the thread-local cache to reduce contention on the pending cache.
             {
-                // Lazy-init the library on first access.
-                if (!threadLibraryEntry.m_library)
+                ThreadLibraryEntry& threadLibraryEntry = GetThreadLibraryEntry(handle, globalLibraryEntry);
+
+                Ptr<PipelineStateCompileStatus> compileStatus;
+                ConstPtr<PipelineState> pipelineState = CompilePipelineState(
+                    handle, globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash, name, compileStatus);
+
+                [[maybe_unused]] bool success = InsertPipelineState(
+                    threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor, AZStd::move(compileStatus)));
+                AZ_Assert(success, "PipelineStateEntry already exists in the thread cache.");
+
+                return pipelineState.get();
+            }
+        }
+    }
+
+    const PipelineState* PipelineStateCache::AcquirePipelineStateAsync(
+        PipelineLibraryHandle handle,
+        const PipelineStateDescriptor& descriptor,
+        const PipelineState* fallbackPipelineState,
+        PipelineStateCompilePriority priority /*= PipelineStateCompilePriority::Visible*/,
+        const AZ::Name& name /*= AZ::Name()*/)
+    {
+        if (handle.IsNull())
+        {
+            return nullptr;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+        PipelineStateHash pipelineStateHash = descriptor.GetHash();
+
+        const PipelineStateEntry* entry = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor);
+        if (!entry)
+        {
+            ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+            PipelineStateSet& threadLocalCache = threadLibrarySet[handle.GetIndex()].m_threadLocalCache;
+            entry = FindPipelineState(threadLocalCache, descriptor);
+
+            if (!entry)
+            {
+                bool isNewCompile = false;
                 {
-                    Ptr<PipelineLibrary> pipelineLibrary = aznew PipelineLibrary;
-                    RHI::ResultCode resultCode = pipelineLibrary->Init(m_deviceMask, globalLibraryEntry.m_pipelineLibraryDescriptor);
-                    if (resultCode != RHI::ResultCode::Success)
+                    AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+
+                    entry = FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor);
+                    if (!entry)
                     {
-                        AZ_Warning(
-                            "PipelineStateCache",
-                            false,
-                            "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+                        Ptr<PipelineState> pipelineState = aznew PipelineState;
+                        pipelineState->PreInitialize(m_deviceMask);
+
+                        Ptr<PipelineStateCompileStatus> compileStatus = aznew PipelineStateCompileStatus;
+                        compileStatus->m_priority = priority;
+                        compileStatus->m_pipelineState = pipelineState;
+
+                        // Node based sets don't move their elements, so the entry stays valid while the shared lock is held.
+                        entry = &*globalLibraryEntry.m_pendingCache
+                                      .insert(PipelineStateEntry(pipelineStateHash, pipelineState, descriptor, AZStd::move(compileStatus)))
+                                      .first;
+                        isNewCompile = true;
                     }
+                }
+
+                InsertPipelineState(threadLocalCache, *entry);
 
-                    // We store a valid pointer even if initialization failed, to avoid attempting
-                    // to re-create it with every access.
-                    threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+                if (isNewCompile)
+                {
+                    // Pipeline states compiled in a previous session come out of the platform pipeline library quickly,
+                    // so compiling them inline avoids drawing with the fallback for a frame.
+                    if (globalLibraryEntry.m_knownPipelineStates.contains(pipelineStateHash) || !AZ::JobContext::GetGlobalContext())
+                    {
+                        CompileQueuedPipelineState(*entry, GetThreadLibraryEntry(handle, globalLibraryEntry).m_library.get(), name);
+                        return entry->m_pipelineState.get();
+                    }
+
+                    QueueAsyncCompile(QueuedCompile{ *entry, name, handle, globalLibraryEntry.m_generation }, priority);
+                    return fallbackPipelineState;
                 }
+            }
+        }
 
-                ConstPtr<PipelineState> pipelineState =
-                    CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash, name);
+        PipelineStateCompileStatus* compileStatus = entry->m_compileStatus.get();
+        if (!compileStatus)
+        {
+            return entry->m_pipelineState.get();
+        }
 
-                [[maybe_unused]] bool success =
-                    InsertPipelineState(threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
-                AZ_Assert(success, "PipelineStateEntry already exists in the thread cache.");
+        const PipelineStateCompileStatus::State state = compileStatus->m_state.load(AZStd::memory_order_acquire);
+        if (state == PipelineStateCompileStatus::State::Complete)
+        {
+            return entry->m_pipelineState.get();
+        }
 
-                return pipelineState.get();
+        // Promote a queued prewarm request once the pipeline state is needed on screen. The duplicate left in the prewarm
+        // queue is skipped by whichever job finds it already claimed.
+        if (state == PipelineStateCompileStatus::State::Queued && priority == PipelineStateCompilePriority::Visible &&
+            compileStatus->m_priority.exchange(PipelineStateCompilePriority::Visible) != PipelineStateCompilePriority::Visible)
+        {
+            QueueAsyncCompile(QueuedCompile{ *entry, name, handle, globalLibraryEntry.m_generation }, priority);
+        }
+
+        return fallbackPipelineState;
+    }
+
+    void PipelineStateCache::WaitForAsyncCompiles()
+    {
+        AZStd::exponential_backoff backoff;
+        for (;;)
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+                if (m_compileJobCount == 0)
+                {
+                    return;
+                }
+            }
+            backoff.wait();
+        }
+    }
+
+    void PipelineStateCache::SetLibraryIndex(PipelineLibraryHandle handle, const PipelineLibraryIndex& index)
+    {
+        if (handle.IsNull())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
+        entry.m_knownPipelineStates.clear();
+        for (uint64_t hash : index.m_pipelineStateHashes)
+        {
+            entry.m_knownPipelineStates.insert(PipelineStateHash(hash));
+        }
+    }
+
+    PipelineLibraryIndex PipelineStateCache::GetLibraryIndex(PipelineLibraryHandle handle) const
+    {
+        PipelineLibraryIndex index;
+        if (handle.IsNull())
+        {
+            return index;
+        }
+
+        // The exclusive lock guarantees that no synchronous compile is in flight. Pipeline states compiled by a background job
+        // are only inspected once their compile has completed.
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
+
+        for (PipelineStateHash hash : entry.m_knownPipelineStates)
+        {
+            index.m_pipelineStateHashes.push_back(static_cast<uint64_t>(hash));
+        }
+
+        const auto addCompiledPipelineStates = [&index](const PipelineStateSet& pipelineStateSet)
+        {
+            for (const PipelineStateEntry& pipelineStateEntry : pipelineStateSet)
+            {
+                const PipelineStateCompileStatus* compileStatus = pipelineStateEntry.m_compileStatus.get();
+                if (compileStatus && compileStatus->m_state.load(AZStd::memory_order_acquire) != PipelineStateCompileStatus::State::Complete)
+                {
+                    continue;
+                }
+
+                if (pipelineStateEntry.m_pipelineState && pipelineStateEntry.m_pipelineState->IsInitialized())
+                {
+                    index.m_pipelineStateHashes.push_back(static_cast<uint64_t>(pipelineStateEntry.m_hash));
+                }
+            }
+        };
+        addCompiledPipelineStates(entry.m_readOnlyCache);
+        addCompiledPipelineStates(entry.m_pendingCache);
+
+        AZStd::sort(index.m_pipelineStateHashes.begin(), index.m_pipelineStateHashes.end());
+        index.m_pipelineStateHashes.erase(
+            AZStd::unique(index.m_pipelineStateHashes.begin(), index.m_pipelineStateHashes.end()), index.m_pipelineStateHashes.end());
+        return index;
+    }
+
+    PipelineStateCache::ThreadLibraryEntry& PipelineStateCache::GetThreadLibraryEntry(
+        PipelineLibraryHandle handle, GlobalLibraryEntry& globalLibraryEntry)
+    {
+        ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+
+        // Lazy-init the library on first access.
+        if (!threadLibraryEntry.m_library)
+        {
+            Ptr<PipelineLibrary> pipelineLibrary = aznew PipelineLibrary;
+            RHI::ResultCode resultCode = pipelineLibrary->Init(m_deviceMask, globalLibraryEntry.m_pipelineLibraryDescriptor);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Warning(
+                    "PipelineStateCache",
+                    false,
+                    "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+            }
+
+            // We store a valid pointer even if initialization failed, to avoid attempting
+            // to re-create it with every access.
+            threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+        }
+        return threadLibraryEntry;
+    }
+
+    const PipelineState* PipelineStateCache::ResolvePipelineState(
+        const PipelineStateEntry& entry, PipelineLibraryHandle handle, GlobalLibraryEntry& globalLibraryEntry, const AZ::Name& name)
+    {
+        PipelineStateCompileStatus* compileStatus = entry.m_compileStatus.get();
+        if (compileStatus && compileStatus->m_state.load(AZStd::memory_order_acquire) != PipelineStateCompileStatus::State::Complete)
+        {
+            // Synchronous callers need a compiled pipeline state. Take over the compile if no job has started it yet,
+            // otherwise wait for the job, which compiles without holding m_mutex and so makes progress while we hold it.
+            CompileQueuedPipelineState(entry, GetThreadLibraryEntry(handle, globalLibraryEntry).m_library.get(), name);
+
+            AZStd::exponential_backoff backoff;
+            while (compileStatus->m_state.load(AZStd::memory_order_acquire) != PipelineStateCompileStatus::State::Complete)
+            {
+                backoff.wait();
+            }
+        }
+        return entry.m_pipelineState.get();
+    }
+
+    void PipelineStateCache::CompileQueuedPipelineState(
+        const PipelineStateEntry& entry, PipelineLibrary* pipelineLibrary, const AZ::Name& name)
+    {
+        PipelineStateCompileStatus& compileStatus = *entry.m_compileStatus;
+        PipelineStateCompileStatus::State expectedState = PipelineStateCompileStatus::State::Queued;
+        if (!compileStatus.m_state.compare_exchange_strong(expectedState, PipelineStateCompileStatus::State::Compiling))
+        {
+            return;
+        }
+
+        // If the pipeline library failed to initialize, then we don't use it.
+        if (!pipelineLibrary->IsInitialized())
+        {
+            pipelineLibrary = nullptr;
+        }
+
+        [[maybe_unused]] ResultCode resultCode = compileStatus.m_pipelineState->Init(m_deviceMask, entry.GetDescriptor(), pipelineLibrary);
+        compileStatus.m_pipelineState->SetName(name);
+
+        AZ_Error(
+            "PipelineStateCache",
+            resultCode == ResultCode::Success,
+            "Failed to compile pipeline state. It will remain in an initialized state.");
+
+        compileStatus.m_state.store(PipelineStateCompileStatus::State::Complete, AZStd::memory_order_release);
+    }
+
+    void PipelineStateCache::QueueAsyncCompile(QueuedCompile&& queuedCompile, PipelineStateCompilePriority priority)
+    {
+        bool startJob = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+            m_compileQueues[static_cast<size_t>(priority)].push_back(AZStd::move(queuedCompile));
+
+            if (m_compileJobCount < AZStd::max<uint32_t>(r_pipelineStateCompileJobCount, 1))
+            {
+                ++m_compileJobCount;
+                startJob = true;
+            }
+        }
+
+        if (startJob)
+        {
+            AZ::Job* job = AZ::CreateJobFunction(
+                [this]()
+                {
+                    ProcessAsyncCompiles();
+                },
+                true,
+                nullptr);
+            job->Start();
+        }
+    }
+
+    void PipelineStateCache::ProcessAsyncCompiles()
+    {
+        AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: ProcessAsyncCompiles");
+
+        for (;;)
+        {
+            AZStd::unique_lock<AZStd::mutex> queueLock(m_compileQueueMutex);
+
+            // Queues are ordered by priority.
+            auto queueIt = AZStd::find_if(
+                m_compileQueues.begin(),
+                m_compileQueues.end(),
+                [](const AZStd::deque<QueuedCompile>& queue)
+                {
+                    return !queue.empty();
+                });
+
+            if (queueIt == m_compileQueues.end())
+            {
+                // Nothing may touch the cache once the count is released, since it may be destroyed.
+                --m_compileJobCount;
+                return;
+            }
+
+            QueuedCompile queuedCompile = AZStd::move(queueIt->front());
+            queueIt->pop_front();
+            queueLock.unlock();
+
+            // Libraries can't be reset or merged while this is held, which keeps the thread library valid for the whole compile.
+            AZStd::shared_lock<AZStd::shared_mutex> compileLock(m_asyncCompileMutex);
+
+            // Only hold m_mutex to look up the thread library, so that Compact and threads acquiring pipeline states
+            // don't wait for the compile. The entry is already in the caches and is published by its compile status.
+            Ptr<PipelineLibrary> pipelineLibrary;
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+                const size_t libraryIndex = queuedCompile.m_library.GetIndex();
+                GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[libraryIndex];
+                if (m_globalLibraryActiveBits[libraryIndex] && globalLibraryEntry.m_generation == queuedCompile.m_libraryGeneration)
+                {
+                    pipelineLibrary = GetThreadLibraryEntry(queuedCompile.m_library, globalLibraryEntry).m_library;
+                }
+            }
+
+            if (pipelineLibrary)
+            {
+                AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: Compile %s", queuedCompile.m_name.GetCStr());
+                CompileQueuedPipelineState(queuedCompile.m_entry, pipelineLibrary.get(), queuedCompile.m_name);
+            }
+            else
+            {
+                // The library was reset after the compile was queued, so the cache no longer hands out this pipeline state.
+                PipelineStateCompileStatus::State expectedState = PipelineStateCompileStatus::State::Queued;
+                queuedCompile.m_entry.m_compileStatus->m_state.compare_exchange_strong(
+                    expectedState, PipelineStateCompileStatus::State::Complete);
             }
         }
     }
 
     ConstPtr<PipelineState> PipelineStateCache::CompilePipelineState(
+        PipelineLibraryHandle handle,
         GlobalLibraryEntry& globalLibraryEntry,
         ThreadLibraryEntry& threadLibraryEntry,
         const PipelineStateDescriptor& descriptor,
         PipelineStateHash pipelineStateHash,
-        const AZ::Name& name)
+        const AZ::Name& name,
+        Ptr<PipelineStateCompileStatus>& compileStatus)
     {
         Ptr<PipelineState> pipelineState;
 
         PipelineStateSet& pendingCache = globalLibraryEntry.m_pendingCache;
 
+        const PipelineStateEntry* pendingEntry = nullptr;
         {
             AZStd::lock_guard<AZStd::mutex> lock(globalLibraryEntry.m_pendingCacheMutex);
 
             // Another thread may have started compiling this pipeline state. Check the pending cache.
-            if (const PipelineState* pipeline = FindPipelineState(pendingCache, descriptor))
+            pendingEntry = FindPipelineState(pendingCache, descriptor);
+            if (!pendingEntry)
             {
-                return pipeline;
-            }
 
-            // We need to create and insert the pipeline state into the locked cache. Create the pipeline state
-            // but don't initialize it yet. We can safely allocate the 'empty' instance and cache it.
-            pipelineState = aznew PipelineState;
+                // We need to create and insert the pipeline state into the locked cache. Create the pipeline state
+                // but don't initialize it yet. We can safely allocate the 'empty' instance and cache it.
+                pipelineState = aznew PipelineState;
 
-            pipelineState->PreInitialize(m_deviceMask);
+                pipelineState->PreInitialize(m_deviceMask);
 
-            [[maybe_unused]] bool success =
-                InsertPipelineState(pendingCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
-            AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
+                [[maybe_unused]] bool success =
+                    InsertPipelineState(pendingCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
+                AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
+            }
+        }
+
+        if (pendingEntry)
+        {
+            // Entries are only erased under the exclusive lock, so the entry remains valid after releasing the pending cache lock.
+            compileStatus = pendingEntry->m_compileStatus;
+            return ResolvePipelineState(*pendingEntry, handle, globalLibraryEntry, name);
         }
 
         [[maybe_unused]] ResultCode resultCode = ResultCode::InvalidArgument;
@@ -421,9 +757,13 @@ namespace AZ::RHI
     }
 
     PipelineStateEntry::PipelineStateEntry(
-        PipelineStateHash hash, ConstPtr<PipelineState> pipelineState, const PipelineStateDescriptor& descriptor)
+        PipelineStateHash hash,
+        ConstPtr<PipelineState> pipelineState,
+        const PipelineStateDescriptor& descriptor,
+        Ptr<PipelineStateCompileStatus> compileStatus /*= nullptr*/)
         : m_hash{ hash }
         , m_pipelineState{ AZStd::move(pipelineState) }
+        , m_compileStatus{ AZStd::move(compileStatus) }
     {
         switch (descriptor.GetType())
         {
@@ -441,6 +781,16 @@ namespace AZ::RHI
         }
     }
 
+    const PipelineStateDescriptor& PipelineStateEntry::GetDescriptor() const
+    {
+        return AZStd::visit(
+            [](const auto& descriptor) -> const PipelineStateDescriptor&
+            {
+                return descriptor;
+            },
+            m_pipelineStateDescriptorVariant);
+    }
+
     bool PipelineStateEntry::operator == (const PipelineStateEntry& rhs) const
     {
         if(AZStd::get_if<AZ::RHI::PipelineStateDescriptorForDispatch>(&rhs.m_pipelineStateDescriptorVariant) &&
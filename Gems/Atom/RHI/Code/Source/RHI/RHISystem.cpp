@@ -251,6 +251,7 @@ namespace AZ::RHI
     {
         m_frameScheduler.Shutdown();
         m_pipelineStateCache = nullptr;
+        m_drawListSortScratch.Clear();
 
         while (!m_devices.empty())
         {
@@ -367,6 +368,11 @@ namespace AZ::RHI
         return m_drawListTagRegistry.get();
     }
 
+    RHI::DrawListSortScratch& RHISystem::GetDrawListSortScratch()
+    {
+        return m_drawListSortScratch.GetStorage();
+    }
+
     void RHISystem::ModifyFrameSchedulerStatisticsFlags(RHI::FrameSchedulerStatisticsFlags statisticsFlags, bool enableFlags)
     {
         m_compileRequest.m_statisticsFlags =
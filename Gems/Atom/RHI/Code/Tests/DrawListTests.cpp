@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+
+#include <Atom/RHI/DrawList.h>
+#include <AzCore/Math/Random.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace
+    {
+        RHI::DrawList CreateRandomDrawList(size_t itemCount, uint64_t sortKeyMask, uint64_t seed)
+        {
+            SimpleLcgRandom random(seed);
+            RHI::DrawList drawList(itemCount);
+            for (RHI::DrawItemProperties& item : drawList)
+            {
+                const uint64_t sortKey = (static_cast<uint64_t>(random.GetRandom()) << 32) | random.GetRandom();
+                item.m_sortKey = static_cast<RHI::DrawItemSortKey>(sortKey & sortKeyMask);
+                item.m_depth = random.GetRandomFloat() * 2000.0f - 1000.0f;
+            }
+            return drawList;
+        }
+
+        // Ties are ordered differently by the two sorts, so only compare the values that are sorted on
+        void ExpectSameOrder(const RHI::DrawList& lhs, const RHI::DrawList& rhs)
+        {
+            ASSERT_EQ(lhs.size(), rhs.size());
+            for (size_t index = 0; index < lhs.size(); ++index)
+            {
+                EXPECT_EQ(lhs[index].m_sortKey, rhs[index].m_sortKey);
+                EXPECT_EQ(lhs[index].m_depth, rhs[index].m_depth);
+            }
+        }
+    }
+
+    using DrawListTests = RHITestFixture;
+
+    class DrawListSortTypeTests
+        : public RHITestFixture
+        , public ::testing::WithParamInterface<RHI::DrawListSortType>
+    {
+    };
+
+    TEST_P(DrawListSortTypeTests, RadixSortMatchesComparisonSort)
+    {
+        // A small sort key range leaves room for full precision depth
+        RHI::DrawList expected = CreateRandomDrawList(4096, 0xFF, 1234);
+        RHI::DrawList sorted = expected;
+
+        RHI::DrawListSortScratch scratch;
+        RHI::SortDrawListComparison(expected, GetParam());
+        EXPECT_TRUE(RHI::SortDrawListRadix(sorted, GetParam(), scratch));
+        ExpectSameOrder(sorted, expected);
+    }
+
+    TEST_F(DrawListTests, RadixSortWideKeysOrdersByKey)
+    {
+        // With 40 bits of sort key, depth is quantized but sort keys must still be strictly ordered
+        RHI::DrawList drawList = CreateRandomDrawList(4096, 0xFFFFFFFFFF, 5678);
+
+        RHI::DrawListSortScratch scratch;
+        EXPECT_TRUE(RHI::SortDrawListRadix(drawList, RHI::DrawListSortType::KeyThenDepth, scratch));
+        for (size_t index = 1; index < drawList.size(); ++index)
+        {
+            EXPECT_LE(drawList[index - 1].m_sortKey, drawList[index].m_sortKey);
+        }
+    }
+
+    TEST_P(DrawListSortTypeTests, SortDrawListFallsBackForFullRangeKeys)
+    {
+        RHI::DrawList expected = CreateRandomDrawList(1024, AZStd::numeric_limits<uint64_t>::max(), 9012);
+        RHI::DrawList sorted = expected;
+
+        RHI::DrawListSortScratch scratch;
+        EXPECT_FALSE(RHI::SortDrawListRadix(sorted, GetParam(), scratch));
+
+        RHI::SortDrawListComparison(expected, GetParam());
+        RHI::SortDrawList(sorted, GetParam(), scratch);
+        ExpectSameOrder(sorted, expected);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(
+        DrawList,
+        DrawListSortTypeTests,
+        ::testing::Values(
+            RHI::DrawListSortType::KeyThenDepth,
+            RHI::DrawListSortType::KeyThenReverseDepth,
+            RHI::DrawListSortType::DepthThenKey,
+            RHI::DrawListSortType::ReverseDepthThenKey));
+
+#if defined(HAVE_BENCHMARK)
+    class DrawListSortBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            // Sort keys typically combine a handful of fields, so only the low bits vary
+            m_source = CreateRandomDrawList(aznumeric_cast<size_t>(state.range(0)), 0xFFFF, 4321);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_source = {};
+            m_drawList = {};
+            m_scratch = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        RHI::DrawList m_source;
+        RHI::DrawList m_drawList;
+        RHI::DrawListSortScratch m_scratch;
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, ComparisonSort)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_drawList = m_source;
+            state.ResumeTiming();
+
+            RHI::SortDrawListComparison(m_drawList, RHI::DrawListSortType::KeyThenDepth);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, RadixSort)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_drawList = m_source;
+            state.ResumeTiming();
+
+            RHI::SortDrawListRadix(m_drawList, RHI::DrawListSortType::KeyThenDepth, m_scratch);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, ComparisonSort)
+        ->RangeMultiplier(10)
+        ->Range(1000, 1000000)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, RadixSort)
+        ->RangeMultiplier(10)
+        ->Range(1000, 1000000)
+        ->Unit(benchmark::kMicrosecond);
+#endif
+}
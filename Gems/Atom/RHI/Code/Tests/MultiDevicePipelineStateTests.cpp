@@ -16,6 +16,8 @@
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI/PipelineStateCache.h>
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/Random.h>
 
 namespace UnitTest
@@ -71,6 +73,27 @@ namespace UnitTest
             cache->ValidateCacheIntegrity();
         }
 
+        // Asynchronous compiles run on the global job context.
+        void CreateJobContext()
+        {
+            AZ::JobManagerDesc jobDesc;
+            jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void DestroyJobContext()
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+
     private:
         void SetUp() override
         {
@@ -363,4 +386,95 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(MultiDevicePipelineStateTests, PipelineStateCache_AcquireAsync_ReturnsFallbackUntilCompiled_Test)
+    {
+        CreateJobContext();
+        {
+            RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(DeviceMask);
+            RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary({}, {});
+
+            const RHI::PipelineState* fallback = pipelineStateCache->AcquirePipelineState(libraryHandle, CreatePipelineStateDescriptor(0));
+            ASSERT_NE(fallback, nullptr);
+
+            const RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(1);
+            EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, fallback), fallback);
+
+            pipelineStateCache->WaitForAsyncCompiles();
+            pipelineStateCache->Compact();
+            ValidateCacheIntegrity(pipelineStateCache);
+
+            const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, fallback);
+            EXPECT_NE(pipelineState, fallback);
+            ASSERT_NE(pipelineState, nullptr);
+            EXPECT_TRUE(pipelineState->IsInitialized());
+            EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+        }
+        DestroyJobContext();
+    }
+
+    TEST_F(MultiDevicePipelineStateTests, PipelineStateCache_AcquireAsync_SyncAcquireCompletesQueuedCompile_Test)
+    {
+        CreateJobContext();
+        {
+            RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(DeviceMask);
+            RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary({}, {});
+
+            static const uint32_t PipelineStateCount = 64;
+            for (uint32_t i = 0; i < PipelineStateCount; ++i)
+            {
+                pipelineStateCache->AcquirePipelineStateAsync(
+                    libraryHandle, CreatePipelineStateDescriptor(i), nullptr, RHI::PipelineStateCompilePriority::Prewarm);
+            }
+
+            // Whether a compile is still queued, in flight, or done, a synchronous acquire never returns an uncompiled pipeline state.
+            for (uint32_t i = 0; i < PipelineStateCount; ++i)
+            {
+                const RHI::PipelineState* pipelineState =
+                    pipelineStateCache->AcquirePipelineState(libraryHandle, CreatePipelineStateDescriptor(i));
+                ASSERT_NE(pipelineState, nullptr);
+                EXPECT_TRUE(pipelineState->IsInitialized());
+            }
+
+            pipelineStateCache->WaitForAsyncCompiles();
+            pipelineStateCache->Compact();
+            ValidateCacheIntegrity(pipelineStateCache);
+        }
+        DestroyJobContext();
+    }
+
+    TEST_F(MultiDevicePipelineStateTests, PipelineStateCache_LibraryIndex_Test)
+    {
+        CreateJobContext();
+        {
+            RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(DeviceMask);
+            const RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(0);
+
+            RHI::PipelineLibraryIndex index;
+            {
+                RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary({}, {});
+                EXPECT_TRUE(pipelineStateCache->GetLibraryIndex(libraryHandle).m_pipelineStateHashes.empty());
+
+                pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+                index = pipelineStateCache->GetLibraryIndex(libraryHandle);
+                pipelineStateCache->ReleaseLibrary(libraryHandle);
+            }
+
+            ASSERT_EQ(index.m_pipelineStateHashes.size(), 1);
+            EXPECT_EQ(index.m_pipelineStateHashes[0], static_cast<uint64_t>(descriptor.GetHash()));
+
+            // Pipeline states compiled in a previous session are compiled inline rather than returning the fallback.
+            RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary({}, {});
+            pipelineStateCache->SetLibraryIndex(libraryHandle, index);
+            const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, nullptr);
+            ASSERT_NE(pipelineState, nullptr);
+            EXPECT_TRUE(pipelineState->IsInitialized());
+
+            pipelineStateCache->WaitForAsyncCompiles();
+            pipelineStateCache->Compact();
+            ValidateCacheIntegrity(pipelineStateCache);
+        }
+        DestroyJobContext();
+    }
+
 } // namespace UnitTest
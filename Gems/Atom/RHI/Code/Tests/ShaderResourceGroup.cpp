@@ -29,8 +29,14 @@ namespace UnitTest
     {
     }
 
-    RHI::ResultCode ShaderResourceGroupPool::CompileGroupInternal(RHI::DeviceShaderResourceGroup&, const RHI::DeviceShaderResourceGroupData&)
+    RHI::ResultCode ShaderResourceGroupPool::CompileGroupInternal(RHI::DeviceShaderResourceGroup& group, const RHI::DeviceShaderResourceGroupData&)
     {
+        // Mirror a ring buffered platform so tests can observe how many constant bytes would be uploaded.
+        if (group.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(RHI::DeviceShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)))
+        {
+            const RHI::Interval uploadRange = group.GetConstantDataUploadRange();
+            RecordUploadedBytes(uploadRange.m_max - uploadRange.m_min);
+        }
         return RHI::ResultCode::Success;
     }
 }
@@ -763,4 +763,60 @@ namespace UnitTest
             EXPECT_NE(otherLayout->GetHash(), layout->GetHash());
         }
     }
+
+    TEST_F(ShaderResourceGroupTests, CompileUploadsOnlyChangedConstants)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::DeviceShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::DeviceShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        const RHI::ShaderInputConstantIndex floatValueIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        const RHI::ShaderInputConstantIndex vector4Index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+        const size_t constantDataSize = srgLayout->GetConstantDataSize();
+
+        RHI::DeviceShaderResourceGroupData srgData(srgLayout.get());
+        const auto compileFrame = [&](const Vector4& vector4)
+        {
+            srgData.ResetUpdateMask();
+            srgData.SetConstant(floatValueIndex, 1.0f);
+            srgData.SetConstant(vector4Index, vector4);
+            srg->Compile(srgData, RHI::DeviceShaderResourceGroup::CompileMode::Sync);
+
+            // Bytes recorded by sync compiles are attributed to the next compile region of the pool
+            srgPool->CompileGroupsBegin();
+            srgPool->CompileGroupsEnd();
+            return srgPool->GetUploadedBytesLastFrame();
+        };
+
+        // Every constant buffer in the ring is written in full once
+        for (uint32_t frame = 0; frame < RHI::Limits::Device::FrameCountMax; ++frame)
+        {
+            EXPECT_EQ(compileFrame(Vector4(0.0f)), constantDataSize);
+        }
+
+        // Settle so that no compiles are pending
+        for (uint32_t frame = 0; frame < RHI::Limits::Device::FrameCountMax; ++frame)
+        {
+            compileFrame(Vector4(0.0f));
+        }
+        EXPECT_FALSE(srg->IsResourceTypeEnabledForCompilation(
+            static_cast<uint32_t>(RHI::DeviceShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)));
+        EXPECT_EQ(compileFrame(Vector4(0.0f)), 0u);
+
+        // Changing one constant only uploads that constant, to each buffer of the ring in turn
+        for (uint32_t frame = 0; frame < RHI::Limits::Device::FrameCountMax; ++frame)
+        {
+            const size_t uploadedBytes = compileFrame(Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+            EXPECT_GT(uploadedBytes, 0u);
+            EXPECT_LE(uploadedBytes, sizeof(float) * 4);
+        }
+        EXPECT_EQ(compileFrame(Vector4(1.0f, 2.0f, 3.0f, 4.0f)), 0u);
+    }
 }
@@ -69,6 +69,7 @@ set(FILES
     Include/Atom/RHI.Reflect/RenderAttachmentLayout.h
     Include/Atom/RHI.Reflect/RenderAttachmentLayoutBuilder.h
     Include/Atom/RHI.Reflect/PipelineLibraryData.h
+    Include/Atom/RHI.Reflect/PipelineLibraryIndex.h
     Include/Atom/RHI.Reflect/RenderStates.h
     Include/Atom/RHI.Reflect/SamplerState.h
     Include/Atom/RHI.Reflect/ShaderSemantic.h
@@ -78,6 +79,7 @@ set(FILES
     Source/RHI.Reflect/RenderAttachmentLayout.cpp
     Source/RHI.Reflect/RenderAttachmentLayoutBuilder.cpp
     Source/RHI.Reflect/PipelineLibraryData.cpp
+    Source/RHI.Reflect/PipelineLibraryIndex.cpp
     Source/RHI.Reflect/RenderStates.cpp
     Source/RHI.Reflect/SamplerState.cpp
     Source/RHI.Reflect/ShaderSemantic.cpp
@@ -210,7 +210,17 @@ namespace AZ
             
             if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                // Each compile writes the next constant buffer in the ring, so only the bytes changed since it was last written are copied.
+                const RHI::Interval uploadRange = groupBase.GetConstantDataUploadRange();
+                const size_t uploadSize = uploadRange.m_max - uploadRange.m_min;
+                if (uploadSize)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + uploadRange.m_min,
+                        groupData.GetConstantData().data() + uploadRange.m_min,
+                        uploadSize);
+                    RecordUploadedBytes(uploadSize);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
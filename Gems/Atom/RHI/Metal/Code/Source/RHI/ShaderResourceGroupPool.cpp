@@ -70,6 +70,7 @@ namespace AZ
             if (!constantData.empty() && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
                 argBuffer.UpdateConstantBufferViews(groupData.GetConstantData());
+                RecordUploadedBytes(constantData.size());
             }
 
             const RHI::ShaderResourceGroupLayout* layout = groupData.GetLayout();
@@ -186,6 +186,7 @@ namespace AZ
             if (!constantData.empty())
             {
                 descriptorSet.UpdateConstantData(constantData);
+                RecordUploadedBytes(constantData.size());
             }
             descriptorSet.CommitUpdates();
 
@@ -27,6 +27,7 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
 #include <Atom/RPI.Public/Configuration.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/View.h>
 #include <Atom/RHI/DrawList.h>
 
@@ -104,6 +105,9 @@ namespace AZ
                     float m_screenCoverageMax = 1.0f;
                     AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
                     void* m_visibleObjectUserData = nullptr;
+                    //! Streaming images drawn by this lod. When a camera view selects the lod, the images are reported to the
+                    //! streaming controller with the screen size of the lod selection sphere as their texel density.
+                    AZStd::vector<Data::Instance<StreamingImage>> m_streamingImages;
                 };
 
                 AZStd::vector<Lod> m_lods;
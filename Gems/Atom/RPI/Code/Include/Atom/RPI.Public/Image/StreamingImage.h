@@ -77,6 +77,13 @@ namespace AZ
             //! Requests the image mips be made available.
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Reports that a view draws the whole UV range of the image over screenPixelsPerUv pixels on screen.
+            //! Culling reports the images of the lods that camera views select (see Cullable::LodData::Lod::m_streamingImages).
+            //! Views may report the image any number of times per frame, from any thread. At each streaming update, the largest
+            //! report since the previous update sets the target mip to the least detailed mip with at least one texel per pixel.
+            //! Images which are never reported keep the target mip set with SetTargetMip.
+            void ReportTexelDensity(float screenPixelsPerUv);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
@@ -120,7 +127,7 @@ namespace AZ
             using Priority = uint64_t;
             Priority GetStreamingPriority() const;
 
-            //! Set the image's streaming priority 
+            //! Set the image's streaming priority. Images with higher priority expand first and are evicted last.
             void SetStreamingPriority(Priority priority);
             
             //! Returns whether the image has mipchains which can be evicted from device memory
@@ -85,6 +85,13 @@ namespace AZ
             uint16_t m_missingMips = 0;
             // The size of the most detailed mip
             uint32_t m_residentMipSize = 1;
+
+            // The largest on-screen size, in pixels, which views reported for the whole UV range of the image since the last update
+            AZStd::atomic<float> m_reportedScreenPixelsPerUv = {0.0f};
+            // Whether views reported the image in the last update
+            bool m_isVisible = false;
+            // The estimated device memory of the mip chains up to the streaming target, including the ones which are still loading
+            size_t m_estimatedMemoryUsage = 0;
         };
 
         using StreamingImageContextPtr = AZStd::intrusive_ptr<StreamingImageContext>;
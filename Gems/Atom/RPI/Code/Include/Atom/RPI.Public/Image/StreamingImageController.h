@@ -14,6 +14,7 @@
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Asset/AssetCommon.h>
 
 #include <Atom/RPI.Public/Configuration.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -38,12 +39,41 @@ namespace AZ
             friend class StreamingImageContext;
 
         public:
+            //! Statistics of one update of the controller. Evictions caused by low memory notifications between two
+            //! updates are counted in the stats of the next update.
+            struct StreamingStats
+            {
+                //! The number of images which views reported a texel density for
+                uint32_t m_visibleImageCount = 0;
+                //! The number of mip chains requested from the asset system
+                uint32_t m_requestedMipChainCount = 0;
+                //! The number of images which uploaded newly loaded mip chains
+                uint32_t m_expandedImageCount = 0;
+                //! The number of mip chains evicted because of memory pressure
+                uint32_t m_evictedMipChainCount = 0;
+                //! Whether expanding stopped because the next mip chain didn't fit in the memory budget
+                bool m_isBudgetLimited = false;
+                //! The estimated device memory of the streamed mips, including the mips which are still loading
+                size_t m_estimatedMemoryUsage = 0;
+                //! The estimated device memory needed for every image to reach its target mip
+                size_t m_targetMemoryUsage = 0;
+                //! The device memory budget of the pool. 0 means the budget is unlimited
+                size_t m_memoryBudget = 0;
+            };
+
             //! Create a StreamingImageController
             static AZStd::unique_ptr<StreamingImageController> Create(RHI::StreamingImagePool& pool);
 
+            //! Returns the least detailed mip level which still has at least one texel per screen pixel when the whole UV range
+            //! of an image covers screenPixelsPerUv pixels on screen.
+            static uint16_t CalculateRequiredMip(const RHI::Size& imageSize, uint16_t mipLevels, float screenPixelsPerUv);
+
             StreamingImageController() = default;
             ~StreamingImageController() = default;
 
+            //! Returns the stats of the last update
+            const StreamingStats& GetStreamingStats() const;
+
         protected:
 
             //! Attaches an instance of an image streaming asset to the controller.
@@ -61,6 +91,13 @@ namespace AZ
             //! Called by the streaming image when events occur.
             void OnSetTargetMip(StreamingImage* image, uint16_t targetMipLevel);
             void OnMipChainAssetReady(StreamingImage* image);
+            void OnReportTexelDensity(StreamingImage* image, float screenPixelsPerUv);
+            void OnSetStreamingPriority(StreamingImage* image, StreamingImage::Priority priority);
+
+            //! Returns the streamer priority and deadline used to load the mip chains of an image.
+            //! Images reported by views in the last update load before the others, and images with a streaming priority above
+            //! the default load before the images with the default priority.
+            Data::AssetLoadParameters GetMipChainLoadParameters(const StreamingImage* image) const;
 
             //! Returns the number of images which are expanding their mipmaps
             uint32_t GetExpandingImageCount() const;
@@ -89,8 +126,34 @@ namespace AZ
             // Evict one mip chain for the streaming image with lowest priority
             bool EvictOneMipChain();
 
-            // Stream in one mip chain for the streaming image with highest priority
-            bool ExpandOneMipChain();
+            // Evict the most detailed mip chain of an image
+            bool TrimOneMipChain(StreamingImage* image);
+
+            // Set the target mip of the images reported by views since the last update, from their largest reported texel density
+            void UpdateReportedTargetMips();
+
+            // Evict the least needed mip chains until the memory usage is within the budget
+            void EnforceMemoryBudget();
+
+            // Return whether the lhs image is needed less than the rhs image, from their streaming priority and last access
+            static bool IsLessNeeded(const StreamingImage* lhs, const StreamingImage* rhs);
+
+            // Estimate the device memory of the mips in [beginMipChain, endMipChain) of an image
+            static size_t GetMipChainMemorySize(const StreamingImage* image, size_t beginMipChain, size_t endMipChain);
+
+            // Update the estimated memory usage of an image after its streaming target changed
+            void UpdateEstimatedMemoryUsage(StreamingImage* image);
+
+            // Return the larger of the estimated memory usage and the memory usage reported by the pool
+            size_t GetMemoryUsage();
+
+            // Get the device memory budget of the streaming image pool, 0 if it's unlimited
+            size_t GetPoolMemoryBudget() const;
+
+            // Stream in the next mip chain of up to maxExpandCount images, from the image with the highest priority.
+            // An image whose next mip chain doesn't fit in the memory budget may evict mip chains of less needed images if that
+            // frees enough memory. Returns the number of images which were expanded.
+            uint32_t ExpandMipChains(uint32_t maxExpandCount);
 
             // Evict mipmaps for specific image
             // Return true if any mipmaps were evicted
@@ -172,6 +235,13 @@ namespace AZ
 
             // a global option to add a bias to all the streaming images' target mip level
             int16_t m_globalMipBias = 0;
+
+            // The estimated device memory of the mip chains up to the streaming target of all the streamable images
+            size_t m_estimatedMemoryUsage = 0;
+
+            // The stats being gathered for the current update, and the stats of the last update
+            StreamingStats m_currentStats;
+            StreamingStats m_stats;
         };
     }
 }
@@ -80,6 +80,9 @@ namespace AZ
                         
             int16_t GetMipBias() const;
 
+            //! Returns the stats of the last streaming update of the pool
+            const StreamingImageController::StreamingStats& GetStreamingStats() const;
+
         private:
             StreamingImagePool() = default;
 
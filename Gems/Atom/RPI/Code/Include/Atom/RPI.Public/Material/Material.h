@@ -102,6 +102,13 @@ namespace AZ
             //! Does nothing if NeedsCompile() is false or CanCompile() is false.
             //! @return whether compilation occurred
             bool Compile();
+
+            //! Queues the material to be compiled by the MaterialSystem before the next simulation tick, together with the other
+            //! queued materials. Use this instead of Compile() when the compiled result isn't needed right away.
+            void QueueCompile();
+
+            //! Returns whether all the functors of this material support parallel processing, so it can be compiled on a worker thread.
+            bool CanCompileInParallel() const;
             
             //! Returns an ID that can be used to track whether the material has changed since the last time client code read it.
             //! This gets incremented every time a change is made, like by calling SetPropertyValue().
@@ -185,6 +192,13 @@ namespace AZ
             //! Helper function to reinitialize the material while preserving property values.
             void ReInitKeepPropertyValues();
 
+            //! Copies the initial compile of another material that was created from the same asset during this frame.
+            //! @return false if there is no such compile to copy
+            bool ApplySharedCompileResult(IMaterialInstanceHandler* instanceHandler);
+
+            //! Compiles the initial property values and shares the result with the materials created from the same asset this frame.
+            void CompileAndShareResult(IMaterialInstanceHandler* instanceHandler);
+
             //! Helper function for setting the value of a shader option, allowing for specialized handling of specific types.
             //! This template is explicitly specialized in the cpp file.
             bool SetShaderOption(ShaderOptionGroup& options, ShaderOptionIndex shaderOptionIndex, const MaterialPropertyValue & value);
@@ -237,6 +251,9 @@ namespace AZ
 
             bool m_isInitializing = false;
 
+            //! Whether every functor of the material supports parallel processing.
+            bool m_canCompileInParallel = false;
+
             MaterialPropertyPsoHandling m_psoHandling = MaterialPropertyPsoHandling::Warning;
 
             //! AZ::Event is not thread safe, so we have to do our own thread safe code
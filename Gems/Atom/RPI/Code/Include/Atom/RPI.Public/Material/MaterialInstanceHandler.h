@@ -9,8 +9,11 @@
 
 #include <Atom/RPI.Public/Configuration.h>
 #include <Atom/RPI.Public/Material/MaterialInstanceData.h>
+#include <Atom/RPI.Public/Material/MaterialShaderParameter.h>
 #include <Atom/RPI.Public/Material/SharedSamplerState.h>
 #include <Atom/RPI.Reflect/Image/Image.h>
+#include <Atom/RPI.Reflect/Material/MaterialPipelineState.h>
+#include <Atom/RPI.Reflect/Material/ShaderCollection.h>
 #include <AtomCore/Instance/Instance.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Interface/Interface.h>
@@ -18,8 +21,17 @@
 namespace AZ::RPI
 {
     class Material;
+    class MaterialAsset;
     class Buffer;
 
+    //! The state a Material is left in by a compile, which can be copied to other materials that compile the same inputs.
+    struct MaterialCompileResult
+    {
+        ShaderCollection m_generalShaderCollection;
+        MaterialPipelineDataMap m_materialPipelineData;
+        MaterialShaderParameter::ParameterWriteList m_shaderParameterWrites;
+    };
+
     // Interface to hold and maintain the global SceneMaterialSrg. Each Material registers itself in the Init() function and
     // gets a 'MaterialInstanceData', which contains either the SceneMaterialSrg and the indices to access the right MaterialParameter -
     // buffer, or a unique MaterialSrg for the material. Also manages the TextureSamplers, and registers them in the appropriate
@@ -48,6 +60,21 @@ namespace AZ::RPI
         virtual const RHI::SamplerState GetRegisteredTextureSampler(
             const int materialTypeIndex, const int materialInstanceIndex, const uint32_t samplerIndex) = 0;
 
+        //! Returns the initial compile result of a Material that was created from the same MaterialAsset during this frame, or null.
+        virtual AZStd::shared_ptr<const MaterialCompileResult> FindSharedCompileResult(
+            [[maybe_unused]] const Data::Asset<MaterialAsset>& materialAsset) = 0;
+        //! Shares the initial compile result of a Material with the Materials created from the same MaterialAsset until the next Compile().
+        virtual void StoreSharedCompileResult(
+            [[maybe_unused]] const Data::Asset<MaterialAsset>& materialAsset,
+            [[maybe_unused]] AZStd::shared_ptr<const MaterialCompileResult> compileResult) = 0;
+        //! Forgets the shared compile result of a MaterialAsset, for instance because its shaders were reloaded.
+        virtual void ReleaseSharedCompileResult([[maybe_unused]] const Data::Asset<MaterialAsset>& materialAsset) = 0;
+
+        //! Queues a Material to be compiled together with the other queued materials by CompileQueuedMaterials().
+        virtual void QueueMaterialCompile([[maybe_unused]] Data::Instance<Material> material) = 0;
+        //! Compiles the queued materials. Materials whose functors support parallel processing are compiled on worker threads.
+        virtual void CompileQueuedMaterials() = 0;
+
         virtual void Compile() = 0;
     };
 
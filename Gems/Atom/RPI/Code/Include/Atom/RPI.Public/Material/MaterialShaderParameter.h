@@ -14,9 +14,12 @@
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Reflect/Image/Image.h>
 #include <AzCore/Math/Color.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Name/Name.h>
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 
@@ -31,6 +34,22 @@ namespace AZ::RPI
         friend class TypedParameterHelper;
 
     public:
+        //! A value passed to SetParameter(), see SetRecordedWrites().
+        using ParameterValue = AZStd::variant<
+            int,
+            uint32_t,
+            float,
+            bool,
+            Vector2,
+            Vector3,
+            Vector4,
+            Color,
+            Matrix3x3,
+            Matrix4x4,
+            Data::Instance<Image>,
+            RHI::SamplerState>;
+        using ParameterWriteList = AZStd::vector<AZStd::pair<MaterialShaderParameterLayout::Index, ParameterValue>>;
+
         MaterialShaderParameter(
             const int materialTypeIndex,
             const int materialInstanceIndex,
@@ -78,6 +97,13 @@ namespace AZ::RPI
         bool SetParameter(const MaterialShaderParameterLayout::Index& index, Data::Instance<Image> image);
         bool SetParameter(const MaterialShaderParameterLayout::Index& index, const RHI::SamplerState& samplerState);
 
+        //! While a list is set, every call to SetParameter() is also appended to it, so the same writes can be applied to another
+        //! MaterialShaderParameter with ApplyWrites(). Pass nullptr to stop recording.
+        void SetRecordedWrites(ParameterWriteList* recordedWrites);
+
+        //! Repeats the writes recorded from a MaterialShaderParameter that uses the same layout.
+        void ApplyWrites(const ParameterWriteList& writes);
+
         AZStd::unordered_map<int, const void*> GetStructuredBufferData() const;
 
         // These differ only in the return value, so overloading doesn't work.
@@ -184,6 +210,15 @@ namespace AZ::RPI
         }
 
     private:
+        template<typename T>
+        void RecordWrite(const MaterialShaderParameterLayout::Index& index, const T& value)
+        {
+            if (m_recordedWrites)
+            {
+                m_recordedWrites->emplace_back(index, ParameterValue(AZStd::in_place_type<T>, value));
+            }
+        }
+
         RHI::SamplerState GetSharedSamplerState(const uint32_t samplerIndex) const;
         bool SetMaterialSrgDeviceReadIndex(
             const MaterialShaderParameterDescriptor* desc, [[maybe_unused]] const int deviceIndex, const int32_t readIndex);
@@ -203,6 +238,8 @@ namespace AZ::RPI
 
         // keep a reference to the registered non-bindless textures, if AZ_TRAIT_REGISTER_TEXTURES_PER_MATERIAL is defined
         AZStd::unordered_map<MaterialShaderParameterLayout::Index, int32_t> m_materialTextureIndices;
+
+        ParameterWriteList* m_recordedWrites = nullptr;
     };
 
 } // namespace AZ::RPI
\ No newline at end of file
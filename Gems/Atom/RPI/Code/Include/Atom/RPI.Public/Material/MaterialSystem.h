@@ -15,6 +15,8 @@
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Image/Image.h>
 
+#include <AzCore/std/parallel/mutex.h>
+
 namespace AZ
 {
     class ReflectContext;
@@ -36,7 +38,8 @@ namespace AZ::RPI
         static void Reflect(AZ::ReflectContext* context);
         static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
-        MaterialSystem() = default;
+        MaterialSystem();
+        ~MaterialSystem();
         MaterialSystem(const MaterialSystem& other) = delete;
         MaterialSystem& operator=(const MaterialSystem& other) = delete;
 
@@ -49,6 +52,12 @@ namespace AZ::RPI
             const int materialTypeIndex, const int materialInstanceIndex, const RHI::SamplerState& samplerState) override;
         const RHI::SamplerState GetRegisteredTextureSampler(
             const int materialTypeIndex, const int materialInstanceIndex, const uint32_t samplerIndex) override;
+        AZStd::shared_ptr<const MaterialCompileResult> FindSharedCompileResult(const Data::Asset<MaterialAsset>& materialAsset) override;
+        void StoreSharedCompileResult(
+            const Data::Asset<MaterialAsset>& materialAsset, AZStd::shared_ptr<const MaterialCompileResult> compileResult) override;
+        void ReleaseSharedCompileResult(const Data::Asset<MaterialAsset>& materialAsset) override;
+        void QueueMaterialCompile(Data::Instance<Material> material) override;
+        void CompileQueuedMaterials() override;
 
         void Compile() override;
 
@@ -127,6 +136,23 @@ namespace AZ::RPI
         Data::Instance<Buffer> m_materialTypeBufferIndicesBuffer;
         bool m_bufferReadIndicesDirty = false;
         bool m_sharedSamplerStatesDirty = false;
+
+        // Guards the instance, texture and sampler registries, which are also used by materials compiling on worker threads
+        AZStd::mutex m_materialInstanceMutex;
+
+        struct SharedCompileResult
+        {
+            // Keeps the asset alive so its address can't be reused by another asset while the entry exists
+            Data::Asset<MaterialAsset> m_materialAsset;
+            AZStd::shared_ptr<const MaterialCompileResult> m_compileResult;
+        };
+
+        // Initial compile results of the materials created during the current frame, by material asset
+        AZStd::mutex m_sharedCompileResultMutex;
+        AZStd::unordered_map<const MaterialAsset*, SharedCompileResult> m_sharedCompileResults;
+
+        AZStd::mutex m_compileQueueMutex;
+        AZStd::vector<Data::Instance<Material>> m_compileQueue;
     };
 
 } // namespace AZ::RPI
@@ -92,6 +92,9 @@ namespace AZ
 
         private:
             bool DoUpdate(const Scene& parentScene);
+
+            //! Returns true once every pipeline state that was drawn with a fallback has finished compiling.
+            bool ArePendingPipelineStatesCompiled() const;
             void ForValidShaderOptionName(const Name& shaderOptionName, const AZStd::function<bool(const ShaderCollection::Item&, ShaderOptionIndex)>& callback);
 
             Ptr<RHI::DrawPacket> m_drawPacket;
@@ -148,6 +151,15 @@ namespace AZ
             //! A flag to indicate if the DrawPacket need to be rebuild when updating
             bool m_needUpdate = true;
 
+            //! Pipeline states of shader variants that are still compiling. The draw packet uses the pipeline state of the
+            //! root variant in their place, and is rebuilt once they are all compiled.
+            struct PendingPipelineState
+            {
+                Data::Instance<Shader> m_shader;
+                RHI::PipelineStateDescriptorForDraw m_descriptor;
+            };
+            AZStd::vector<PendingPipelineState> m_pendingPipelineStates;
+
 #ifdef DEBUG_MESH_SHADERVARIANTS
             // For debug shader variants
             // The list of shader variant asset names used by the DrawPackets
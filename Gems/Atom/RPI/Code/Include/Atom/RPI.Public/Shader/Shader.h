@@ -9,6 +9,7 @@
 
 #include <Atom/RPI.Public/Configuration.h>
 #include <Atom/RPI.Public/Shader/ShaderVariant.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h>
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
@@ -128,6 +129,11 @@ namespace AZ
             //! Acquires a pipeline state directly from a descriptor.
             const RHI::PipelineState* AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
 
+            //! Acquires a pipeline state directly from a descriptor without waiting for it to compile.
+            //! Returns the fallback until the background compile has completed.
+            const RHI::PipelineState* AcquirePipelineStateAsync(
+                const RHI::PipelineStateDescriptor& descriptor, const RHI::PipelineState* fallbackPipelineState) const;
+
             //! Finds and returns the shader resource group asset with the requested name. Returns an empty handle if no matching group was found.
             const RHI::Ptr<RHI::ShaderResourceGroupLayout>& FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const;
 
@@ -174,6 +180,12 @@ namespace AZ
 
             AZStd::unordered_map<int, ConstPtr<RHI::PipelineLibraryData>> LoadPipelineLibrary() const;
             void SavePipelineLibrary() const;
+
+            //! The pipeline library index records which pipeline states were compiled, independently of the RHI backend
+            //! serializing its pipeline library, so that they can be compiled without a fallback on the next run.
+            AZStd::string GetPipelineLibraryIndexPath() const;
+            void LoadPipelineLibraryIndex();
+            void SavePipelineLibraryIndex() const;
             
             const ShaderVariant& GetVariantInternal(ShaderVariantStableId shaderVariantStableId);
 
@@ -181,7 +193,7 @@ namespace AZ
             void OnAssetReloaded(Data::Asset<Data::AssetData> asset) override;
 
             // ShaderVariantFinderNotificationBus overrides...
-            void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> /*shaderVariantTreeAsset*/, bool /*isError*/) override {};
+            void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset, bool isError) override;
             void OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset, bool IsError) override;
 
             //! A strong reference to the shader asset.
@@ -224,6 +236,11 @@ namespace AZ
             //! Local cache of ShaderVariants (except for the root variant), searchable by StableId.
             //! Gets populated when GetVariant() is called.
             AZStd::unordered_map<ShaderVariantStableId, ShaderVariant> m_shaderVariants;
+
+            //! Remembers which entry of m_shaderVariants was resolved for a requested ShaderVariantId, so draw packet
+            //! rebuilds don't have to search the variant tree again. Entries are added while holding m_variantCacheMutex
+            //! for reading, and the cache is cleared while holding it for writing whenever m_shaderVariants loses an entry.
+            ShaderVariantLookupCache m_variantLookupCache;
             
             //! DrawListTag associated with this shader.
             RHI::DrawListTag m_drawListTag;
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Configuration.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class ShaderVariant;
+
+        //! A small, fixed size cache that remembers which ShaderVariant a Shader resolved for a requested ShaderVariantId.
+        //! Lookups never take a lock: every slot is guarded by a sequence counter, and a lookup that overlaps with a write to
+        //! the same slot is reported as a miss. Writers that find a slot busy drop their entry, since it is only a cache.
+        //! The owner is responsible for calling Clear() before any cached ShaderVariant is destroyed, and for making sure
+        //! Insert() and Clear() don't run at the same time.
+        class ATOM_RPI_PUBLIC_API ShaderVariantLookupCache final
+        {
+        public:
+            //! Number of entries in the cache. Each entry is direct-mapped from the hash of the requested ShaderVariantId.
+            static constexpr uint32_t SlotCount = 128;
+
+            ShaderVariantLookupCache() = default;
+            AZ_DISABLE_COPY_MOVE(ShaderVariantLookupCache);
+
+            //! Returns the ShaderVariant cached for the requested ID, or null if there is none.
+            const ShaderVariant* Find(const ShaderVariantId& shaderVariantId) const;
+
+            //! Caches the ShaderVariant resolved for the requested ID, replacing whichever entry used the same slot.
+            void Insert(const ShaderVariantId& shaderVariantId, const ShaderVariant* shaderVariant);
+
+            //! Removes all the entries.
+            void Clear();
+
+        private:
+            //! The masked key followed by the mask, so IDs that only differ on bits outside the mask share an entry.
+            static constexpr uint32_t KeyWordCount = ShaderVariantKeyBitCount / 32;
+            using SearchKey = AZStd::array<uint32_t, KeyWordCount * 2>;
+
+            struct Slot
+            {
+                //! Odd while a writer owns the slot.
+                AZStd::atomic<uint32_t> m_sequence{ 0 };
+                AZStd::atomic<uint32_t> m_key[KeyWordCount * 2] = {};
+                AZStd::atomic<const ShaderVariant*> m_shaderVariant{ nullptr };
+            };
+
+            static SearchKey MakeSearchKey(const ShaderVariantId& shaderVariantId);
+            static size_t GetSlotIndex(const SearchKey& searchKey);
+
+            void Write(Slot& slot, const SearchKey& searchKey, const ShaderVariant* shaderVariant);
+
+            Slot m_slots[SlotCount];
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -348,6 +348,10 @@ namespace AZ
             //! based on some internal material property values.
             virtual void Process([[maybe_unused]] MaterialFunctorAPI::PipelineRuntimeContext& context) {}
 
+            //! Returns true if the runtime Process() functions only read and write through the context they are given,
+            //! so different materials using this functor can be compiled on different threads at the same time.
+            virtual bool SupportsParallelProcessing() const { return false; }
+
         private:
 
             //! The material properties associated with this functor.
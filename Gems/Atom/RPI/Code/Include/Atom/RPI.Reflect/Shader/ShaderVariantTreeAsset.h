@@ -7,8 +7,11 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Configuration.h>
@@ -34,6 +37,10 @@ namespace AZ
         //! The variant searched using the tree has a key that matches the requested key, but some values can be undefined.
         //! For example, requesting a key equal to "00101" could return a variant with ID "0?10?", in which ? stands for undefined values.
         //! The undefined values must be provided to the fallback constant buffer. (See Shader::FindFallbackShaderResourceGroupAsset).
+        //!
+        //! Walking the tree is only required the first time a key is requested. The first search flattens every variant stored
+        //! in the tree into a hashed index keyed by its ShaderVariantId, and the best-fit results of keys that are not baked
+        //! in the tree (the fallback chain) are added to that index as they are found.
         AZ_PUSH_DISABLE_DLL_EXPORT_BASECLASS_WARNING
         class ATOM_RPI_REFLECT_API ShaderVariantTreeAsset final
             : public Data::AssetData
@@ -75,12 +82,38 @@ namespace AZ
             //! The search involves two general steps:
             //! - Search the tree to find all possible matches for the specified shader variant ID.
             //! - Search the best match from those results.
+            //! Results are served from the hashed search index when the key was requested before or is baked in the tree.
+            //! This function is thread safe.
             ShaderVariantSearchResult FindVariantStableId(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const;
 
+            //! Maximum number of best-fit results for keys that are not baked in the tree which are kept in the search index.
+            //! Keys beyond this limit are still resolved correctly, they just walk the tree every time.
+            static constexpr size_t MaxIndexedFallbackCount = 16 * 1024;
+
         private:
 
             static constexpr uint32_t UnspecifiedIndex = std::numeric_limits<uint32_t>::max();
 
+            //! There can't be more options than bits in the shader variant key.
+            using ValueChain = AZStd::fixed_vector<uint32_t, ShaderVariantKeyBitCount>;
+
+            struct SearchKeyHasher
+            {
+                size_t operator()(const ShaderVariantId& shaderVariantId) const;
+            };
+
+            using SearchIndex = AZStd::unordered_map<ShaderVariantId, ShaderVariantSearchResult, SearchKeyHasher>;
+
+            //! Walks the tree to find the best-fit variant for the specified shader variant ID.
+            ShaderVariantSearchResult SearchTree(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const;
+
+            //! Flattens all the variants stored in the tree into m_searchIndex. Must be called with m_searchIndexMutex locked for writing.
+            void BuildSearchIndex(const ShaderOptionGroupLayout* shaderOptionGroupLayout) const;
+
+            //! Returns the key used by the search index: only the bits of the options that are set in the mask are kept,
+            //! so every ID that produces the same value chain maps to the same entry.
+            static ShaderVariantId MakeSearchKey(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId);
+
             //! Returns the node associated with the provided index.
             const ShaderVariantTreeNode& GetNode(uint32_t index) const;
 
@@ -88,7 +121,7 @@ namespace AZ
             void SetNode(uint32_t index, const ShaderVariantTreeNode& node);
 
             //! Build a list of values from the specified shader variant ID.
-            static AZStd::vector<uint32_t> ConvertToValueChain(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId);
+            static ValueChain ConvertToValueChain(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId);
 
             //! Called by asset creators to assign the asset to a ready state.
             void SetReady();
@@ -99,6 +132,14 @@ namespace AZ
             //! .shadervariantlist file.
             AZ::u64 m_shaderHash = 0;
             AZStd::vector<ShaderVariantTreeNode> m_nodes;
+
+            //! Flat, hashed index of search results. It is built from the tree the first time a search is requested, because
+            //! the option layout that gives meaning to the tree levels is owned by the ShaderAsset.
+            mutable AZStd::shared_mutex m_searchIndexMutex;
+            mutable SearchIndex m_searchIndex;
+            mutable HashValue64 m_searchIndexLayoutHash = HashValue64{ 0 };
+            mutable bool m_isSearchIndexBuilt = false;
+            mutable size_t m_indexedFallbackCount = 0;
         };
 
         AZ_PUSH_DISABLE_DLL_EXPORT_BASECLASS_WARNING
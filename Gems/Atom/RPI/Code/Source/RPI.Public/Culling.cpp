@@ -53,6 +53,10 @@ namespace AZ
         // Node work lists using node count
         AZ_CVAR(uint32_t, r_numNodesPerCullingJob, 25, nullptr, AZ::ConsoleFunctorFlags::Null, "Controls amount of nodes to collect for jobs when not using the entry count");
 
+        // Screen height used for the texel density of the streaming images drawn by visible lods
+        AZ_CVAR(uint32_t, r_texelDensityScreenHeight, 1080, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Screen height in pixels used to turn the screen coverage of visible lods into texel density reports for their streaming images. 0 disables the reports");
+
         // This value dictates the amount to extrude the octree node OBB when doing a frustum intersection test against the camera frustum to help cut draw calls for shadow cascade passes.
         // Default is set to -1 as this is optimization needs to be triggered by the content developer by setting a reasonable non-negative value applicable for their content. 
         AZ_CVAR(int, r_shadowCascadeExtrusionAmount, -1, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount of meters to extrude the Obb towards light direction when doing frustum overlap test against camera frustum");
@@ -931,8 +935,32 @@ namespace AZ
 
             uint32_t numVisibleDrawPackets = 0;
 
-            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
+            const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+            auto getApproxScreenPercentage = [&]()
+            {
+                // the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to
+                // 2*nearPlaneDistance/nearPlaneHeight), which is used to determine the (vertical) projected size in screen space
+                const float yScale = viewToClip.GetElement(1, 1);
+                const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
+                return ModelLodUtils::ApproxScreenPercentage(pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+            };
+
+            // Only camera views decide how much texture detail is visible
+            const uint32_t texelDensityScreenHeight = (view.GetUsageFlags() & View::UsageCamera) ? static_cast<uint32_t>(r_texelDensityScreenHeight) : 0;
+
+            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod, float approxScreenPercentage)
             {
+                // The UV range of the images is assumed to span the lod selection sphere
+                if (texelDensityScreenHeight > 0 && !lod.m_streamingImages.empty())
+                {
+                    const float screenPixelsPerUv = approxScreenPercentage * static_cast<float>(texelDensityScreenHeight);
+                    for (const Data::Instance<StreamingImage>& streamingImage : lod.m_streamingImages)
+                    {
+                        streamingImage->ReportTexelDensity(screenPixelsPerUv);
+                    }
+                }
+
 #ifdef AZ_CULL_PROFILE_VERBOSE
                 AZ_PROFILE_SCOPE(RPI, "add draw packets: %zu", lod.m_drawPackets.size());
 #endif
@@ -959,22 +987,14 @@ namespace AZ
                 case Cullable::LodType::SpecificLod:
                     if (lodData.m_lodConfiguration.m_lodOverride < lodData.m_lods.size())
                     {
-                    addLodToDrawPacket(
-                        lodData.m_lods.at(lodData.m_lodConfiguration.m_lodOverride));
+                        const Cullable::LodData::Lod& lod = lodData.m_lods.at(lodData.m_lodConfiguration.m_lodOverride);
+                        addLodToDrawPacket(lod, (texelDensityScreenHeight > 0 && !lod.m_streamingImages.empty()) ? getApproxScreenPercentage() : 0.0f);
                     }
                     break;
                 case Cullable::LodType::ScreenCoverage:
                 default:
                 {
-                    const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
-                    // the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to
-                    // 2*nearPlaneDistance/nearPlaneHeight), which is used to determine the (vertical) projected size in screen space
-                    const float yScale = viewToClip.GetElement(1, 1);
-                    const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
-                    const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
-
-                    const float approxScreenPercentage =
-                        ModelLodUtils::ApproxScreenPercentage(pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                    const float approxScreenPercentage = getApproxScreenPercentage();
 
                     for (uint32_t lodIndex = 0; lodIndex < static_cast<uint32_t>(lodData.m_lods.size()); ++lodIndex)
                     {
@@ -982,7 +1002,7 @@ namespace AZ
                         // Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                         if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                         {
-                            addLodToDrawPacket(lod);
+                            addLodToDrawPacket(lod, approxScreenPercentage);
                         }
                     }
                     break;
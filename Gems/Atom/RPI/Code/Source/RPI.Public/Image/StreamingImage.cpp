@@ -254,6 +254,14 @@ namespace AZ
                 m_streamingController->OnSetTargetMip(this, aznumeric_cast<uint16_t>(clampedMipLevel));
             }
         }
+
+        void StreamingImage::ReportTexelDensity(float screenPixelsPerUv)
+        {
+            if (m_streamingController)
+            {
+                m_streamingController->OnReportTexelDensity(this, screenPixelsPerUv);
+            }
+        }
         
         uint16_t StreamingImage::GetResidentMipLevel()
         {
@@ -272,7 +280,15 @@ namespace AZ
 
         void StreamingImage::SetStreamingPriority(Priority priority)
         {
-            m_streamingPriority = priority;
+            if (m_streamingController)
+            {
+                // The controller sorts its images by priority, so it needs to update its lists
+                m_streamingController->OnSetStreamingPriority(this, priority);
+            }
+            else
+            {
+                m_streamingPriority = priority;
+            }
         }
 
         bool StreamingImage::IsTrimmable() const
@@ -444,8 +460,13 @@ namespace AZ
                 Data::Asset<ImageMipChainAsset>& mipChainAsset = m_mipChains[mipChainIndex];
                 AZ_Assert(mipChainAsset.Get() == nullptr, "Asset marked as inactive, but has a valid reference.");
 
-                // And we request that the asset be loaded in case it isn't already.
-                mipChainAsset.QueueLoad();
+                // And we request that the asset be loaded in case it isn't already. The streaming controller decides how urgent the load is.
+                Data::AssetLoadParameters loadParameters;
+                if (m_streamingController)
+                {
+                    loadParameters = m_streamingController->GetMipChainLoadParameters(this);
+                }
+                mipChainAsset.QueueLoad(loadParameters);
 
                 // Connect to the AssetBus so we are ready to receive OnAssetReady(), which will call OnMipChainAssetReady().
                 // If the asset happens to already be loaded, OnAssetReady() will be called immediately.
@@ -10,8 +10,12 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Time/ITime.h>
+#include <AzCore/std/algorithm.h>
 
 ATOM_RPI_PUBLIC_API AZ_DECLARE_BUDGET(RPI);
 
@@ -27,6 +31,10 @@ namespace AZ
         #define StreamingDebugOutput(window, ...)
 #endif
 
+        AZ_CVAR(uint32_t, r_streamingImageFetchDeadlineMs, 100, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Deadline for loading the mip chains of streaming images with the highest priority. "
+            "Each lower priority doubles the deadline");
+
         AZStd::unique_ptr<StreamingImageController> StreamingImageController::Create(RHI::StreamingImagePool& pool)
         {
             AZStd::unique_ptr<StreamingImageController> controller = AZStd::make_unique<StreamingImageController>();
@@ -35,6 +43,24 @@ namespace AZ
             return controller;
         }
 
+        uint16_t StreamingImageController::CalculateRequiredMip(const RHI::Size& imageSize, uint16_t mipLevels, float screenPixelsPerUv)
+        {
+            const float maxExtent = aznumeric_cast<float>(AZStd::max(imageSize.m_width, imageSize.m_height));
+            if (mipLevels == 0 || screenPixelsPerUv >= maxExtent)
+            {
+                return 0;
+            }
+
+            // Each mip halves the size, so the least detailed mip with a texel per pixel is log2(size / pixels) rounded down
+            const float mipLevel = floorf(log2f(maxExtent / AZStd::max(screenPixelsPerUv, 1.0f)));
+            return aznumeric_cast<uint16_t>(AZStd::min(mipLevel, aznumeric_cast<float>(mipLevels - 1)));
+        }
+
+        const StreamingImageController::StreamingStats& StreamingImageController::GetStreamingStats() const
+        {
+            return m_stats;
+        }
+
         void StreamingImageController::AttachImage(StreamingImage* image)
         {
             AZ_PROFILE_FUNCTION(RPI);
@@ -72,6 +98,7 @@ namespace AZ
                 m_expandingImages.erase(image);
                 m_expandableImages.erase(image);
                 m_evictableImages.erase(image);
+                m_estimatedMemoryUsage -= image->m_streamingContext->m_estimatedMemoryUsage;
             }
 
             const StreamingImageContextPtr& context = image->m_streamingContext;
@@ -94,6 +121,8 @@ namespace AZ
             m_expandableImages.erase(image);
             m_evictableImages.erase(image);
 
+            UpdateEstimatedMemoryUsage(image);
+
             if (!image->IsExpanding())
             {
                 image->m_streamingContext->UpdateMipStats();
@@ -127,6 +156,8 @@ namespace AZ
             const uint32_t c_jobCount = 30;
             uint32_t jobCount = 0;
 
+            UpdateReportedTargetMips();
+
             // if the memory was low, cancel all expanding images
             if (m_lastLowMemory)
             {
@@ -169,6 +200,7 @@ namespace AZ
                             {
                                 EndExpandImage(image);
                                 m_expandingImages.erase(image);
+                                ++m_currentStats.m_expandedImageCount;
 
                                 StreamingDebugOutput("StreamingImageController", "Image [%s] expanded mip level to %d\n",
                                     image->GetRHIImage()->GetName().GetCStr(), image->m_imageAsset->GetMipChainIndex(image->m_mipChainState.m_residencyTarget));
@@ -190,22 +222,119 @@ namespace AZ
             {
                 m_lastLowMemory = 0;
             }
+
+            EnforceMemoryBudget();
             
             // Try to expand if it's not in low memory state
-            jobCount = 0;
-            while (jobCount < c_jobCount && m_lastLowMemory == 0)
+            if (m_lastLowMemory == 0)
             {
-                if (ExpandOneMipChain())
+                ExpandMipChains(c_jobCount);
+            }
+
+            m_currentStats.m_estimatedMemoryUsage = m_estimatedMemoryUsage;
+            m_currentStats.m_memoryBudget = GetPoolMemoryBudget();
+            m_stats = m_currentStats;
+            m_currentStats = {};
+
+            ++m_timestamp;
+        }
+
+        void StreamingImageController::UpdateReportedTargetMips()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            for (StreamingImage* image : m_streamableImages)
+            {
+                StreamingImageContext* context = image->m_streamingContext.get();
+                const float screenPixelsPerUv = context->m_reportedScreenPixelsPerUv.exchange(0.0f);
+                context->m_isVisible = screenPixelsPerUv > 0.0f;
+                if (context->m_isVisible)
                 {
-                    jobCount++;
+                    ++m_currentStats.m_visibleImageCount;
+
+                    // This also refreshes the last access timestamp, which keeps the image ahead of unreported images
+                    const RHI::ImageDescriptor& imageDescriptor = image->m_imageAsset->GetImageDescriptor();
+                    image->SetTargetMip(CalculateRequiredMip(imageDescriptor.m_size, imageDescriptor.m_mipLevels, screenPixelsPerUv));
                 }
-                else
+
+                const size_t targetMipChain = image->m_imageAsset->GetMipChainIndex(GetImageTargetMip(image));
+                m_currentStats.m_targetMemoryUsage += GetMipChainMemorySize(image, targetMipChain, image->m_imageAsset->GetMipChainCount());
+            }
+        }
+
+        void StreamingImageController::EnforceMemoryBudget()
+        {
+            const size_t memoryBudget = GetPoolMemoryBudget();
+            if (memoryBudget == 0)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            while (GetMemoryUsage() > memoryBudget)
+            {
+                if (!EvictOneMipChain())
                 {
                     break;
                 }
             }
+        }
 
-            ++m_timestamp;
+        bool StreamingImageController::IsLessNeeded(const StreamingImage* lhs, const StreamingImage* rhs)
+        {
+            if (lhs->GetStreamingPriority() != rhs->GetStreamingPriority())
+            {
+                return lhs->GetStreamingPriority() < rhs->GetStreamingPriority();
+            }
+            return lhs->m_streamingContext->GetLastAccessTimestamp() < rhs->m_streamingContext->GetLastAccessTimestamp();
+        }
+
+        size_t StreamingImageController::GetMipChainMemorySize(const StreamingImage* image, size_t beginMipChain, size_t endMipChain)
+        {
+            const StreamingImageAsset& imageAsset = *image->m_imageAsset;
+            const RHI::ImageDescriptor& imageDescriptor = imageAsset.GetImageDescriptor();
+            const size_t mipChainCount = imageAsset.GetMipChainCount();
+            endMipChain = AZStd::min(endMipChain, mipChainCount);
+            if (beginMipChain >= endMipChain)
+            {
+                return 0;
+            }
+
+            const size_t beginMip = imageAsset.GetMipLevel(beginMipChain);
+            const size_t endMip = imageAsset.GetMipLevel(endMipChain - 1) + imageAsset.GetMipCount(endMipChain - 1);
+
+            size_t memorySize = 0;
+            for (size_t mipLevel = beginMip; mipLevel < endMip; ++mipLevel)
+            {
+                const RHI::Size mipSize = imageDescriptor.m_size.GetReducedMip(aznumeric_cast<uint32_t>(mipLevel));
+                const RHI::DeviceImageSubresourceLayout layout = RHI::GetImageSubresourceLayout(mipSize, imageDescriptor.m_format);
+                memorySize += size_t(layout.m_bytesPerImage) * mipSize.m_depth * imageDescriptor.m_arraySize;
+            }
+            return memorySize;
+        }
+
+        void StreamingImageController::UpdateEstimatedMemoryUsage(StreamingImage* image)
+        {
+            StreamingImageContext* context = image->m_streamingContext.get();
+            const size_t mipChainCount = image->m_imageAsset->GetMipChainCount();
+            const size_t streamingTarget = AZStd::min<size_t>(image->m_mipChainState.m_streamingTarget, mipChainCount - 1);
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            m_estimatedMemoryUsage -= context->m_estimatedMemoryUsage;
+            context->m_estimatedMemoryUsage = GetMipChainMemorySize(image, streamingTarget, mipChainCount);
+            m_estimatedMemoryUsage += context->m_estimatedMemoryUsage;
+        }
+
+        size_t StreamingImageController::GetMemoryUsage()
+        {
+            // The estimate includes mips which are still loading, while the pool includes the allocation overhead
+            return AZStd::max(m_estimatedMemoryUsage, GetPoolMemoryUsage());
+        }
+
+        size_t StreamingImageController::GetPoolMemoryBudget() const
+        {
+            return m_pool->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device).m_budgetInBytes;
         }
 
         size_t StreamingImageController::GetTimestamp() const
@@ -217,6 +346,11 @@ namespace AZ
         {
             StreamingImageContext* context = image->m_streamingContext.get();
 
+            // The target and the timestamp are sort keys of the image lists, so the image needs to be removed before they change
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            m_expandableImages.erase(image);
+            m_evictableImages.erase(image);
+
             context->m_mipLevelTarget = mipLevelTarget;
             context->m_lastAccessTimestamp = m_timestamp;
 
@@ -230,8 +364,56 @@ namespace AZ
             ReinsertImageToLists(image);
         }
 
+        void StreamingImageController::OnSetStreamingPriority(StreamingImage* image, StreamingImage::Priority priority)
+        {
+            // The priority is a sort key of the image lists, so the image needs to be removed before it changes
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            m_expandableImages.erase(image);
+            m_evictableImages.erase(image);
+            image->m_streamingPriority = priority;
+            ReinsertImageToLists(image);
+        }
+
+        void StreamingImageController::OnReportTexelDensity(StreamingImage* image, float screenPixelsPerUv)
+        {
+            // Keep the largest report since the last update. Views may report from several threads.
+            AZStd::atomic<float>& reportedScreenPixelsPerUv = image->m_streamingContext->m_reportedScreenPixelsPerUv;
+            float currentScreenPixelsPerUv = reportedScreenPixelsPerUv.load();
+            while (screenPixelsPerUv > currentScreenPixelsPerUv &&
+                !reportedScreenPixelsPerUv.compare_exchange_weak(currentScreenPixelsPerUv, screenPixelsPerUv))
+            {
+            }
+        }
+
+        Data::AssetLoadParameters StreamingImageController::GetMipChainLoadParameters(const StreamingImage* image) const
+        {
+            // Rank the load from 0 (most urgent) to 3 from whether views need the image now and its streaming priority
+            const bool isVisible = image->m_streamingContext->m_isVisible;
+            const bool isPrioritized = image->GetStreamingPriority() > 0;
+            const uint32_t rank = (isVisible ? 0 : 2) + (isPrioritized ? 0 : 1);
+
+            static constexpr IO::IStreamerTypes::Priority RankPriorities[] = {
+                IO::IStreamerTypes::s_priorityHighest,
+                IO::IStreamerTypes::s_priorityHigh,
+                IO::IStreamerTypes::s_priorityMedium,
+                IO::IStreamerTypes::s_priorityLow
+            };
+
+            Data::AssetLoadParameters loadParameters;
+            loadParameters.m_priority = RankPriorities[rank];
+            loadParameters.m_deadline = AZStd::chrono::duration_cast<IO::IStreamerTypes::Deadline>(
+                AZStd::chrono::milliseconds(uint64_t(r_streamingImageFetchDeadlineMs) << rank));
+            return loadParameters;
+        }
+
         bool StreamingImageController::ExpandPriorityComparator::operator()(const StreamingImage* lhs, const StreamingImage* rhs) const
         {
+            // images with higher streaming priority expand first
+            if (lhs->GetStreamingPriority() != rhs->GetStreamingPriority())
+            {
+                return lhs->GetStreamingPriority() > rhs->GetStreamingPriority();
+            }
+
             // use the resident mip size and missing mip count to decide the expand priority
             auto lhsMipSize = lhs->m_streamingContext->m_residentMipSize;
             auto rhsMipSize = rhs->m_streamingContext->m_residentMipSize;
@@ -265,21 +447,22 @@ namespace AZ
         
         bool StreamingImageController::EvictPriorityComparator::operator()(const StreamingImage* lhs, const StreamingImage* rhs) const
         {
+            // the least needed images are evicted first: lower streaming priority, then least recently visited
+            if (IsLessNeeded(lhs, rhs))
+            {
+                return true;
+            }
+            if (IsLessNeeded(rhs, lhs))
+            {
+                return false;
+            }
+
             auto lhsEvictableMips = lhs->m_streamingContext->m_evictableMips;
             auto rhsEvictableMips = rhs->m_streamingContext->m_evictableMips;
-
             if (lhsEvictableMips == rhsEvictableMips)
             {
-                auto lhsTimestamp = lhs->m_streamingContext->GetLastAccessTimestamp();
-                auto rhsTimestamp = rhs->m_streamingContext->GetLastAccessTimestamp();
-                if (lhsTimestamp == rhsTimestamp)
-                {
-                    // we need this to avoid same key in the AZStd::set
-                    return lhs < rhs;
-                }
-
-                // Last visited image will be evicted later
-                return lhsTimestamp < rhsTimestamp;
+                // we need this to avoid same key in the AZStd::set
+                return lhs < rhs;
             }
 
             // images with higher evictable mip count will be evict first
@@ -328,6 +511,7 @@ namespace AZ
             for (auto image : m_streamableImages)
             {
                 EvictUnusedMips(image);
+                UpdateEstimatedMemoryUsage(image);
                 image->m_streamingContext->UpdateMipStats();
                 if (!image->IsExpanding())
                 {
@@ -363,20 +547,8 @@ namespace AZ
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
             for (auto itr = m_evictableImages.begin(); itr != m_evictableImages.end(); itr++)
             {
-                StreamingImage* image = *itr;
-
-                RHI::ResultCode success = image->TrimOneMipChain();
-
-                if (success == RHI::ResultCode::Success)
+                if (TrimOneMipChain(*itr))
                 {
-                    // update the image's priority and re-insert the image
-                    ReinsertImageToLists(image);
-
-                    StreamingDebugOutput(
-                        "StreamingImageController",
-                        "Image [%s] has one mipchain released; Current resident mip: %d\n",
-                        image->GetRHIImage()->GetName().GetCStr(),
-                        image->GetRHIImage()->GetResidentMipLevel());
                     return true;
                 }
                 else
@@ -388,6 +560,26 @@ namespace AZ
             return false;
         }
 
+        bool StreamingImageController::TrimOneMipChain(StreamingImage* image)
+        {
+            RHI::ResultCode success = image->TrimOneMipChain();
+            if (success != RHI::ResultCode::Success)
+            {
+                return false;
+            }
+
+            // update the image's priority and re-insert the image
+            ReinsertImageToLists(image);
+            ++m_currentStats.m_evictedMipChainCount;
+
+            StreamingDebugOutput(
+                "StreamingImageController",
+                "Image [%s] has one mipchain released; Current resident mip: %d\n",
+                image->GetRHIImage()->GetName().GetCStr(),
+                image->GetRHIImage()->GetResidentMipLevel());
+            return true;
+        }
+
         bool StreamingImageController::NeedExpand(const StreamingImage* image) const
         {
             uint16_t targetMip = GetImageTargetMip(image);
@@ -395,24 +587,116 @@ namespace AZ
             return image->m_mipChainState.m_streamingTarget > image->m_imageAsset->GetMipChainIndex(targetMip);
         }
 
-        bool StreamingImageController::ExpandOneMipChain()
+        uint32_t StreamingImageController::ExpandMipChains(uint32_t maxExpandCount)
         {
+            AZ_PROFILE_FUNCTION(RPI);
+
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
-            if (m_expandableImages.size() == 0)
+            if (m_expandableImages.empty())
             {
-                return false; 
+                return 0;
             }
-            auto itr = m_expandableImages.begin();
-            StreamingImage* image = *itr;
-            image->QueueExpandToNextMipChainLevel();
-            if (image->IsExpanding())
+
+            // Expanding and evicting reorder the image lists, so the pass walks copies of them
+            const AZStd::vector<StreamingImage*> expandableImages(m_expandableImages.begin(), m_expandableImages.end());
+
+            // Only images which are less needed than the expanding image may be evicted, which keeps images from evicting each
+            // other every update. The evictable images are sorted from the least needed, so those are always a prefix of the list.
+            // The memory each prefix can free is computed once per pass instead of once per image that doesn't fit.
+            const size_t memoryBudget = GetPoolMemoryBudget();
+            AZStd::vector<StreamingImage*> evictableImages;
+            AZStd::vector<size_t> reclaimableMemory; // The memory freed by trimming the images before each index to their last mip chain
+            if (memoryBudget > 0)
             {
-                StreamingDebugOutput("StreamingImageController", "Image [%s] is expanding mip level to %d\n",
-                    image->GetRHIImage()->GetName().GetCStr(), image->m_imageAsset->GetMipChainIndex(image->m_mipChainState.m_streamingTarget));
-                m_expandingImages.insert(image);
-                ReinsertImageToLists(image);
+                evictableImages.assign(m_evictableImages.begin(), m_evictableImages.end());
+                reclaimableMemory.reserve(evictableImages.size() + 1);
+                reclaimableMemory.push_back(0);
+                for (const StreamingImage* evictableImage : evictableImages)
+                {
+                    const size_t mipChainCount = evictableImage->m_imageAsset->GetMipChainCount();
+                    reclaimableMemory.push_back(reclaimableMemory.back() +
+                        GetMipChainMemorySize(evictableImage, evictableImage->m_mipChainState.m_streamingTarget, mipChainCount - 1));
+                }
             }
-            return true;
+            size_t evictedMemory = 0;
+            size_t nextEvictableIndex = 0;
+
+            // When the next mip chain of an image doesn't fit in the budget, the less needed images may still use what's left
+            // of the budget, but without evicting anything
+            bool allowEviction = true;
+            uint32_t expandCount = 0;
+            for (StreamingImage* image : expandableImages)
+            {
+                if (expandCount >= maxExpandCount)
+                {
+                    break;
+                }
+
+                if (memoryBudget > 0 && image->m_mipChainState.m_streamingTarget > 0)
+                {
+                    const size_t nextMipChain = image->m_mipChainState.m_streamingTarget - 1;
+                    const size_t nextMipChainSize = GetMipChainMemorySize(image, nextMipChain, nextMipChain + 1);
+                    size_t memoryUsage = GetMemoryUsage();
+
+                    bool fits = memoryUsage + nextMipChainSize <= memoryBudget;
+                    if (!fits && allowEviction)
+                    {
+                        const size_t lessNeededCount = AZStd::lower_bound(evictableImages.begin(), evictableImages.end(), image,
+                            [](const StreamingImage* evictableImage, const StreamingImage* expandingImage)
+                            {
+                                return IsLessNeeded(evictableImage, expandingImage);
+                            }) - evictableImages.begin();
+                        const size_t remainingReclaimableMemory = reclaimableMemory[lessNeededCount] - AZStd::min(evictedMemory, reclaimableMemory[lessNeededCount]);
+
+                        // Check that evicting the less needed images frees enough memory before evicting anything
+                        fits = memoryUsage + nextMipChainSize <= memoryBudget + remainingReclaimableMemory;
+                        while (fits && memoryUsage + nextMipChainSize > memoryBudget)
+                        {
+                            while (nextEvictableIndex < lessNeededCount &&
+                                (evictableImages[nextEvictableIndex]->IsExpanding() || !evictableImages[nextEvictableIndex]->IsTrimmable()))
+                            {
+                                ++nextEvictableIndex;
+                            }
+                            if (nextEvictableIndex >= lessNeededCount)
+                            {
+                                fits = false;
+                                break;
+                            }
+
+                            StreamingImage* leastNeededImage = evictableImages[nextEvictableIndex];
+                            const size_t trimmedMipChain = leastNeededImage->m_mipChainState.m_streamingTarget;
+                            const size_t trimmedMipChainSize = GetMipChainMemorySize(leastNeededImage, trimmedMipChain, trimmedMipChain + 1);
+                            if (!TrimOneMipChain(leastNeededImage))
+                            {
+                                fits = false;
+                                break;
+                            }
+                            evictedMemory += trimmedMipChainSize;
+                            memoryUsage = GetMemoryUsage();
+                        }
+                    }
+
+                    if (!fits)
+                    {
+                        m_currentStats.m_isBudgetLimited = true;
+                        allowEviction = false;
+                        continue;
+                    }
+                }
+
+                image->QueueExpandToNextMipChainLevel();
+                ++m_currentStats.m_requestedMipChainCount;
+                ++expandCount;
+                UpdateEstimatedMemoryUsage(image);
+                if (image->IsExpanding())
+                {
+                    StreamingDebugOutput("StreamingImageController", "Image [%s] is expanding mip level to %d\n",
+                        image->GetRHIImage()->GetName().GetCStr(), image->m_imageAsset->GetMipChainIndex(image->m_mipChainState.m_streamingTarget));
+                    m_expandingImages.insert(image);
+                    ReinsertImageToLists(image);
+                }
+            }
+            return expandCount;
         }
 
         uint16_t StreamingImageController::GetImageTargetMip(const StreamingImage* image) const
@@ -146,5 +146,10 @@ namespace AZ
         {
             return m_controller->GetMipBias();
         }
+
+        const StreamingImageController::StreamingStats& StreamingImagePool::GetStreamingStats() const
+        {
+            return m_controller->GetStreamingStats();
+        }
     }
 }
@@ -24,6 +24,8 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <AtomCore/Utils/ScopedValue.h>
 
+#include <AzCore/std/algorithm.h>
+
 namespace AZ
 {
     namespace RPI
@@ -138,12 +140,34 @@ namespace AZ
                     return true;
                 });
 
+            auto supportsParallelProcessing = [](const MaterialFunctorList& functors)
+            {
+                return AZStd::all_of(
+                    functors.begin(),
+                    functors.end(),
+                    [](const Ptr<MaterialFunctor>& functor)
+                    {
+                        return functor && functor->SupportsParallelProcessing();
+                    });
+            };
+
+            m_canCompileInParallel = supportsParallelProcessing(m_materialAsset->GetMaterialFunctors());
+            for (const auto& materialPipelinePair : m_materialAsset->GetMaterialPipelinePayloads())
+            {
+                m_canCompileInParallel = m_canCompileInParallel && supportsParallelProcessing(materialPipelinePair.second.m_materialFunctors);
+            }
+
             // Usually SetProperties called above will increment this change ID to invalidate
             // the material, but some materials might not have any properties, and we need
             // the material to be invalidated particularly when hot-reloading.
             ++m_currentChangeId;
 
-            Compile();
+            // Every material created from the same asset compiles the same initial property values to the same state, so only the
+            // first one created in a frame runs the functors, and the others copy its result.
+            if (!ApplySharedCompileResult(instanceHandler))
+            {
+                CompileAndShareResult(instanceHandler);
+            }
 
             return RHI::ResultCode::Success;
         }
@@ -380,6 +404,55 @@ namespace AZ
             }
         }
 
+        bool Material::ApplySharedCompileResult(IMaterialInstanceHandler* instanceHandler)
+        {
+            AZStd::shared_ptr<const MaterialCompileResult> compileResult = instanceHandler->FindSharedCompileResult(m_materialAsset);
+            if (!compileResult || !CanCompile())
+            {
+                return false;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "Material: ApplySharedCompileResult");
+
+            m_generalShaderCollection = compileResult->m_generalShaderCollection;
+            m_materialPipelineData = compileResult->m_materialPipelineData;
+
+            if (m_instanceData.m_materialShaderParameter)
+            {
+                m_instanceData.m_materialShaderParameter->ApplyWrites(compileResult->m_shaderParameterWrites);
+            }
+
+            m_materialProperties.ClearAllPropertyDirtyFlags();
+            m_compiledChangeId = m_currentChangeId;
+
+            return true;
+        }
+
+        void Material::CompileAndShareResult(IMaterialInstanceHandler* instanceHandler)
+        {
+            auto compileResult = AZStd::make_shared<MaterialCompileResult>();
+
+            MaterialShaderParameter* shaderParameter = m_instanceData.m_materialShaderParameter.get();
+            if (shaderParameter)
+            {
+                shaderParameter->SetRecordedWrites(&compileResult->m_shaderParameterWrites);
+            }
+
+            Compile();
+
+            if (shaderParameter)
+            {
+                shaderParameter->SetRecordedWrites(nullptr);
+            }
+
+            if (!NeedsCompile())
+            {
+                compileResult->m_generalShaderCollection = m_generalShaderCollection;
+                compileResult->m_materialPipelineData = m_materialPipelineData;
+                instanceHandler->StoreSharedCompileResult(m_materialAsset, AZStd::move(compileResult));
+            }
+        }
+
         void Material::ReInitKeepPropertyValues()
         {
             // Save the material property values to be reapplied after reinitialization. The mapping is stored by name in case the property
@@ -392,6 +465,12 @@ namespace AZ
                 properties.emplace(descriptor->GetName(), GetPropertyValue(AZ::RPI::MaterialPropertyIndex{ propertyIndex }));
             }
 
+            if (auto instanceHandler = MaterialInstanceHandlerInterface::Get())
+            {
+                // The shaders were reloaded, so the compile results shared by the materials created from this asset are stale
+                instanceHandler->ReleaseSharedCompileResult(m_materialAsset);
+            }
+
             if (Init(*m_materialAsset) == RHI::ResultCode::Success)
             {
                 for (const auto& [propertyName, propertyValue] : properties)
@@ -702,6 +781,23 @@ namespace AZ
             return false;
         }
 
+        void Material::QueueCompile()
+        {
+            if (auto instanceHandler = MaterialInstanceHandlerInterface::Get())
+            {
+                instanceHandler->QueueMaterialCompile(this);
+            }
+            else
+            {
+                Compile();
+            }
+        }
+
+        bool Material::CanCompileInParallel() const
+        {
+            return m_canCompileInParallel;
+        }
+
         Material::ChangeId Material::GetCurrentChangeId() const
         {
             return m_currentChangeId;
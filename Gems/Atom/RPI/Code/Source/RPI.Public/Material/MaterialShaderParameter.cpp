@@ -214,37 +214,45 @@ namespace AZ::RPI
 
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const int value)
     {
+        RecordWrite(index, value);
         return TypedParameterHelper{ this }.SetBasicParameter(index, value);
     }
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const uint32_t value)
     {
+        RecordWrite(index, value);
         return TypedParameterHelper{ this }.SetBasicParameter(index, value);
     }
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const float value)
     {
+        RecordWrite(index, value);
         return TypedParameterHelper{ this }.SetBasicParameter(index, value);
     }
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const bool value)
     {
+        RecordWrite(index, value);
         // booleans use 4 bytes on the GPU
         uint32_t boolean = value;
         return TypedParameterHelper{ this }.SetBasicParameter(index, boolean);
     }
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const Vector2& value)
     {
+        RecordWrite(index, value);
         return TypedParameterHelper{ this }.SetVectorParameter<Vector2, 2>(index, value);
     }
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const Vector3& value)
     {
+        RecordWrite(index, value);
         return TypedParameterHelper{ this }.SetVectorParameter<Vector3, 3>(index, value);
     }
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const Vector4& value)
     {
+        RecordWrite(index, value);
         return TypedParameterHelper{ this }.SetVectorParameter<Vector4, 4>(index, value);
     }
 
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const Color& value)
     {
+        RecordWrite(index, value);
         bool result = false;
         // first set the color as 4 floats in the parameter buffer
         const auto* desc{ m_layout->GetDescriptor(index) };
@@ -277,6 +285,7 @@ namespace AZ::RPI
     }
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const Matrix3x3& matrix)
     {
+        RecordWrite(index, matrix);
         const auto* desc{ m_layout->GetDescriptor(index) };
         if (desc)
         {
@@ -293,6 +302,7 @@ namespace AZ::RPI
 
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const Matrix4x4& matrix)
     {
+        RecordWrite(index, matrix);
         const auto* desc{ m_layout->GetDescriptor(index) };
         if (desc)
         {
@@ -308,6 +318,7 @@ namespace AZ::RPI
 
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, Data::Instance<Image> image)
     {
+        RecordWrite(index, image);
         const auto* desc{ m_layout->GetDescriptor(index) };
         if (desc)
         {
@@ -372,6 +383,7 @@ namespace AZ::RPI
 
     bool MaterialShaderParameter::SetParameter(const MaterialShaderParameterLayout::Index& index, const RHI::SamplerState& samplerState)
     {
+        RecordWrite(index, samplerState);
         const auto* desc{ m_layout->GetDescriptor(index) };
         if (desc)
         {
@@ -391,6 +403,24 @@ namespace AZ::RPI
         return false;
     }
 
+    void MaterialShaderParameter::SetRecordedWrites(ParameterWriteList* recordedWrites)
+    {
+        m_recordedWrites = recordedWrites;
+    }
+
+    void MaterialShaderParameter::ApplyWrites(const ParameterWriteList& writes)
+    {
+        for (const auto& [index, value] : writes)
+        {
+            AZStd::visit(
+                [this, &index](const auto& typedValue)
+                {
+                    SetParameter(index, typedValue);
+                },
+                value);
+        }
+    }
+
     RHI::SamplerState MaterialShaderParameter::GetSharedSamplerState(const uint32_t samplerIndex) const
     {
         return MaterialInstanceHandlerInterface::Get()->GetRegisteredTextureSampler(
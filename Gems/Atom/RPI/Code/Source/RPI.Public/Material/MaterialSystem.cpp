@@ -16,7 +16,13 @@
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 #include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/sort.h>
 
 #include <Atom_RPI_Traits_Platform.h>
 
@@ -27,8 +33,23 @@
 // enable this if you want debug-prints whenever a material-Instance is registered
 // #define DEBUG_MATERIALINSTANCES
 
+AZ_CVAR(bool, r_materialShareInitialCompile, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Copy the initial compile of a material to the other materials that are created from the same material asset in the same frame.");
+AZ_CVAR(uint32_t, r_materialParallelCompileMinBatch, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Minimum number of queued materials that support parallel compilation before they are compiled on worker threads.");
+
 namespace AZ::RPI
 {
+    namespace
+    {
+        // Number of queued materials compiled by each task, so small materials don't pay for a task each
+        constexpr size_t MaterialsPerCompileTask = 8;
+    }
+
+    MaterialSystem::MaterialSystem() = default;
+
+    MaterialSystem::~MaterialSystem() = default;
+
     void MaterialSystem::Reflect(AZ::ReflectContext* context)
     {
         MaterialPropertyValue::Reflect(context);
@@ -112,6 +133,7 @@ namespace AZ::RPI
             return textureIndex;
         }
 
+        AZStd::scoped_lock lock(m_materialInstanceMutex);
         auto& materialTypeData = m_materialTypeData[materialTypeIndex];
         auto& instanceData = materialTypeData.m_instanceData[materialInstanceIndex];
         if (instanceData.m_materialTextureRegistry)
@@ -130,6 +152,7 @@ namespace AZ::RPI
         [[maybe_unused]] int32_t textureIndex)
     {
 #ifdef AZ_TRAIT_REGISTER_TEXTURES_PER_MATERIAL
+        AZStd::scoped_lock lock(m_materialInstanceMutex);
         auto& materialTypeData = m_materialTypeData[materialTypeIndex];
         auto& instanceData = materialTypeData.m_instanceData[materialInstanceIndex];
         if (instanceData.m_materialTextureRegistry)
@@ -142,7 +165,7 @@ namespace AZ::RPI
     AZStd::shared_ptr<SharedSamplerState> MaterialSystem::RegisterTextureSampler(
         const int materialTypeIndex, const int materialInstanceIndex, const RHI::SamplerState& samplerState)
     {
-        AZStd::shared_ptr<SharedSamplerState> sharedSampler = nullptr;
+        AZStd::scoped_lock lock(m_materialInstanceMutex);
         auto& materialTypeData = m_materialTypeData[materialTypeIndex];
 
         TextureSamplerRegistry* registry;
@@ -167,6 +190,7 @@ namespace AZ::RPI
     const RHI::SamplerState MaterialSystem::GetRegisteredTextureSampler(
         const int materialTypeIndex, const int materialInstanceIndex, const uint32_t samplerIndex)
     {
+        AZStd::scoped_lock lock(m_materialInstanceMutex);
         auto& materialTypeData = m_materialTypeData[materialTypeIndex];
         TextureSamplerRegistry* registry;
         if (materialTypeData.m_useSceneMaterialSrg)
@@ -193,6 +217,8 @@ namespace AZ::RPI
         {
             LoadMaterialSrgShaderAsset();
         }
+
+        AZStd::scoped_lock lock(m_materialInstanceMutex);
         m_bufferReadIndicesDirty = true;
 
         int32_t materialTypeIndex{ -1 };
@@ -314,6 +340,7 @@ namespace AZ::RPI
 
     void MaterialSystem::ReleaseMaterialInstance(const MaterialInstanceData& materialInstance)
     {
+        AZStd::scoped_lock lock(m_materialInstanceMutex);
         m_bufferReadIndicesDirty = true;
 
         MaterialTypeData* materialTypeData = &m_materialTypeData[materialInstance.m_materialTypeId];
@@ -635,8 +662,155 @@ namespace AZ::RPI
         }
     }
 
+    AZStd::shared_ptr<const MaterialCompileResult> MaterialSystem::FindSharedCompileResult(const Data::Asset<MaterialAsset>& materialAsset)
+    {
+        if (!r_materialShareInitialCompile)
+        {
+            return nullptr;
+        }
+
+        AZStd::scoped_lock lock(m_sharedCompileResultMutex);
+        auto sharedResultIt = m_sharedCompileResults.find(materialAsset.Get());
+        return sharedResultIt != m_sharedCompileResults.end() ? sharedResultIt->second.m_compileResult : nullptr;
+    }
+
+    void MaterialSystem::StoreSharedCompileResult(
+        const Data::Asset<MaterialAsset>& materialAsset, AZStd::shared_ptr<const MaterialCompileResult> compileResult)
+    {
+        if (!r_materialShareInitialCompile || !materialAsset.Get())
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_sharedCompileResultMutex);
+        m_sharedCompileResults[materialAsset.Get()] = SharedCompileResult{ materialAsset, AZStd::move(compileResult) };
+    }
+
+    void MaterialSystem::ReleaseSharedCompileResult(const Data::Asset<MaterialAsset>& materialAsset)
+    {
+        AZStd::scoped_lock lock(m_sharedCompileResultMutex);
+        m_sharedCompileResults.erase(materialAsset.Get());
+    }
+
+    void MaterialSystem::QueueMaterialCompile(Data::Instance<Material> material)
+    {
+        if (material)
+        {
+            AZStd::scoped_lock lock(m_compileQueueMutex);
+            m_compileQueue.emplace_back(AZStd::move(material));
+        }
+    }
+
+    void MaterialSystem::CompileQueuedMaterials()
+    {
+        AZStd::vector<Data::Instance<Material>> queuedMaterials;
+        {
+            AZStd::scoped_lock lock(m_compileQueueMutex);
+            queuedMaterials.swap(m_compileQueue);
+        }
+
+        if (queuedMaterials.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(RPI, "MaterialSystem: CompileQueuedMaterials");
+
+        // A material can be queued several times before the queue is processed, but it must only be compiled by one thread.
+        AZStd::sort(
+            queuedMaterials.begin(),
+            queuedMaterials.end(),
+            [](const Data::Instance<Material>& lhs, const Data::Instance<Material>& rhs)
+            {
+                return lhs.get() < rhs.get();
+            });
+        queuedMaterials.erase(AZStd::unique(queuedMaterials.begin(), queuedMaterials.end()), queuedMaterials.end());
+
+        AZStd::vector<Material*> parallelMaterials;
+        parallelMaterials.reserve(queuedMaterials.size());
+        for (const Data::Instance<Material>& material : queuedMaterials)
+        {
+            if (!material->NeedsCompile())
+            {
+                continue;
+            }
+
+            if (material->CanCompileInParallel())
+            {
+                parallelMaterials.push_back(material.get());
+            }
+            else
+            {
+                // Lua functors share the default script context, so these materials are compiled on this thread
+                material->Compile();
+            }
+        }
+
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        const bool useJobs = !useTaskGraph && AZ::JobContext::GetGlobalContext();
+
+        if (parallelMaterials.size() < r_materialParallelCompileMinBatch || (!useTaskGraph && !useJobs))
+        {
+            for (Material* material : parallelMaterials)
+            {
+                material->Compile();
+            }
+            return;
+        }
+
+        auto compileMaterials = [&parallelMaterials](size_t firstMaterial)
+        {
+            const size_t endMaterial = AZStd::min(firstMaterial + MaterialsPerCompileTask, parallelMaterials.size());
+            for (size_t materialIndex = firstMaterial; materialIndex < endMaterial; ++materialIndex)
+            {
+                parallelMaterials[materialIndex]->Compile();
+            }
+        };
+
+        if (useTaskGraph)
+        {
+            static const AZ::TaskDescriptor compileTaskDescriptor{ "RPI::MaterialSystem::CompileQueuedMaterials", "Graphics" };
+            AZ::TaskGraph compileTaskGraph{ "RPI::MaterialSystem::CompileQueuedMaterials" };
+            for (size_t firstMaterial = 0; firstMaterial < parallelMaterials.size(); firstMaterial += MaterialsPerCompileTask)
+            {
+                compileTaskGraph.AddTask(
+                    compileTaskDescriptor,
+                    [&compileMaterials, firstMaterial]()
+                    {
+                        compileMaterials(firstMaterial);
+                    });
+            }
+            AZ::TaskGraphEvent compileFinishedEvent{ "RPI::MaterialSystem::CompileQueuedMaterials Wait" };
+            compileTaskGraph.Submit(&compileFinishedEvent);
+            compileFinishedEvent.Wait();
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t firstMaterial = 0; firstMaterial < parallelMaterials.size(); firstMaterial += MaterialsPerCompileTask)
+            {
+                AZ::Job* compileJob = AZ::CreateJobFunction(
+                    [&compileMaterials, firstMaterial]()
+                    {
+                        compileMaterials(firstMaterial);
+                    },
+                    true);
+                compileJob->SetDependent(&jobCompletion);
+                compileJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+
     void MaterialSystem::Compile()
     {
+        {
+            // Shared compile results only cover the materials created within a single frame
+            AZStd::scoped_lock lock(m_sharedCompileResultMutex);
+            m_sharedCompileResults.clear();
+        }
+
         bool compileSceneMaterialSrg = false;
         if (m_sharedSamplerStatesDirty)
         {
@@ -679,6 +853,15 @@ namespace AZ::RPI
 
     void MaterialSystem::Shutdown()
     {
+        {
+            AZStd::scoped_lock lock(m_compileQueueMutex);
+            m_compileQueue.clear();
+        }
+        {
+            AZStd::scoped_lock lock(m_sharedCompileResultMutex);
+            m_sharedCompileResults.clear();
+        }
+
         if (m_sceneMaterialSrgShaderAsset)
         {
             AZ::Data::AssetBus::Handler::BusDisconnect(m_sceneMaterialSrgShaderAsset.GetId());
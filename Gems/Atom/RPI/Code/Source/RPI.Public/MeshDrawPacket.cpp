@@ -17,6 +17,7 @@
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/algorithm.h>
 
 
 namespace AZ
@@ -214,6 +215,11 @@ namespace AZ
             //      - MeshDrawPacket::Update() is called. But since the GetCurrentChangeId() hasn't changed since last time, DoUpdate() is not called.
             //      - The mesh continues rendering with only the "foo" change applied, indefinitely.
 
+            if (!m_pendingPipelineStates.empty() && ArePendingPipelineStatesCompiled())
+            {
+                m_needUpdate = true;
+            }
+
             if (forceUpdate || (!m_material->NeedsCompile() && m_materialChangeId != m_material->GetCurrentChangeId())
                 || m_needUpdate)
             {
@@ -228,6 +234,15 @@ namespace AZ
             return false;
         }
 
+        bool MeshDrawPacket::ArePendingPipelineStatesCompiled() const
+        {
+            return AZStd::all_of(m_pendingPipelineStates.begin(), m_pendingPipelineStates.end(),
+                [](const PendingPipelineState& pendingPipelineState)
+                {
+                    return pendingPipelineState.m_shader->AcquirePipelineStateAsync(pendingPipelineState.m_descriptor, nullptr) != nullptr;
+                });
+        }
+
         static bool HasRootConstants(const RHI::ConstantsLayout* rootConstantsLayout)
         {
             return rootConstantsLayout && rootConstantsLayout->GetDataSize() > 0;
@@ -260,6 +275,8 @@ namespace AZ
 
         bool MeshDrawPacket::DoUpdate(const Scene& parentScene)
         {
+            AZ_PROFILE_FUNCTION(RPI);
+
             auto meshes = m_modelLod->GetMeshes();
             ModelLod::Mesh& mesh = meshes[m_modelLodMeshIndex];
 
@@ -281,6 +298,7 @@ namespace AZ
             // if DoUpdate() fails it won't modify any member data.
             MeshDrawPacket::ShaderList shaderList;
             shaderList.reserve(m_activeShaders.size());
+            AZStd::vector<PendingPipelineState> pendingPipelineStates;
 
             // The root constants are shared by all draw items in the draw packet. We must populate them with default values.
             // The draw packet builder needs to know where the data is coming from during appendShader, but it's not actually read
@@ -449,7 +467,28 @@ namespace AZ
                     drawSrg->Compile();
                 };
 
-                const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(*pipelineStateDescriptor);
+                const RHI::PipelineState* pipelineState = nullptr;
+                if (isRasterShader && !variant.IsRootVariant() && shader->GetRootVariant().UseKeyFallback() && drawSrg &&
+                    drawSrg->HasShaderVariantKeyFallbackEntry())
+                {
+                    // The root variant produces the same result from the shader variant key in the draw srg, so draw with it
+                    // while the pipeline state of the requested variant compiles, instead of stalling on the compile here.
+                    pipelineState = shader->AcquirePipelineStateAsync(pipelineStateDescriptorDraw, nullptr);
+                    if (!pipelineState)
+                    {
+                        RHI::PipelineStateDescriptorForDraw rootPipelineStateDescriptor = pipelineStateDescriptorDraw;
+                        shader->GetRootVariant().ConfigurePipelineState(rootPipelineStateDescriptor, shaderOptions);
+                        rootPipelineStateDescriptor.m_renderStates = pipelineStateDescriptorDraw.m_renderStates;
+
+                        pipelineState = shader->AcquirePipelineState(rootPipelineStateDescriptor);
+                        pendingPipelineStates.push_back({ shader, pipelineStateDescriptorDraw });
+                    }
+                }
+                else
+                {
+                    pipelineState = shader->AcquirePipelineState(*pipelineStateDescriptor);
+                }
+
                 if (!pipelineState)
                 {
                     AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to acquire default pipeline state", shaderItem.GetShaderAsset()->GetName().GetCStr());
@@ -545,6 +584,7 @@ namespace AZ
             {
                 m_activeShaders = shaderList;
                 m_materialSrg = m_material->GetRHIShaderResourceGroup();
+                m_pendingPipelineStates = AZStd::move(pendingPipelineStates);
                 return true;
             }
             else
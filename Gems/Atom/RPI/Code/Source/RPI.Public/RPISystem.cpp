@@ -277,6 +277,9 @@ namespace AZ
 
             AssetInitBus::Broadcast(&AssetInitBus::Events::PostLoadInit);
 
+            // Compile the materials queued by property edits before the feature processors build draw packets from them
+            m_materialSystem.CompileQueuedMaterials();
+
             m_currentSimulationTime = GetCurrentTime();
 
             for (auto& scene : m_scenes)
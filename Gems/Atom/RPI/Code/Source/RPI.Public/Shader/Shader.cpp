@@ -150,6 +150,7 @@ namespace AZ
 
             {
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                m_variantLookupCache.Clear();
                 m_shaderVariants.clear();
             }
             auto rootShaderVariantAsset = shaderAsset.GetRootVariantAsset(m_supervariantIndex);
@@ -175,6 +176,11 @@ namespace AZ
 
                 m_pipelineLibraryHandle = pipelineLibraryHandle;
                 m_pipelineStateCache = pipelineStateCache;
+
+                if (r_enablePsoCaching)
+                {
+                    LoadPipelineLibraryIndex();
+                }
             }
 
             const Name& drawListName = shaderAsset.GetDrawListName();
@@ -210,6 +216,7 @@ namespace AZ
                 if (r_enablePsoCaching)
                 {
                     SavePipelineLibrary();
+                    SavePipelineLibraryIndex();
                 }
                 
                 m_pipelineStateCache->ReleaseLibrary(m_pipelineLibraryHandle);
@@ -305,6 +312,13 @@ namespace AZ
 
         ///////////////////////////////////////////////////////////////////
         /// ShaderVariantFinderNotificationBus overrides
+        void Shader::OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> /*shaderVariantTreeAsset*/, bool /*isError*/)
+        {
+            // A new tree may resolve the requested variants differently.
+            AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            m_variantLookupCache.Clear();
+        }
+
         void Shader::OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset, bool isError)
         {
             ShaderReloadDebugTracker::ScopedSection reloadSection("{%p}->Shader::OnShaderVariantAssetReady %s", this, shaderVariantAsset.GetHint().c_str());
@@ -335,6 +349,7 @@ namespace AZ
                     return;
                 }
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                m_variantLookupCache.Clear();
                 m_shaderVariants.erase(stableId);
             }
             else
@@ -351,6 +366,7 @@ namespace AZ
                     if (!shaderVariant.Init(m_asset, shaderVariantAsset, m_supervariantIndex))
                     {
                         AZ_Error("Shader", false, "Failed to init shaderVariant with StableId=%u", shaderVariantAsset->GetStableId());
+                        m_variantLookupCache.Clear();
                         m_shaderVariants.erase(stableId);
                     }
                     else
@@ -422,6 +438,44 @@ namespace AZ
             }
         }
         
+        AZStd::string Shader::GetPipelineLibraryIndexPath() const
+        {
+            // The index doesn't depend on the device, so it is stored next to the library of the first device.
+            auto pathIt = m_pipelineLibraryPaths.find(0);
+            return pathIt != m_pipelineLibraryPaths.end() ? pathIt->second + ".index" : AZStd::string();
+        }
+
+        void Shader::LoadPipelineLibraryIndex()
+        {
+            const AZStd::string indexPath = GetPipelineLibraryIndexPath();
+            if (indexPath.empty() || !IO::FileIOBase::GetInstance() || !IO::FileIOBase::GetInstance()->Exists(indexPath.c_str()))
+            {
+                return;
+            }
+
+            AZStd::unique_ptr<RHI::PipelineLibraryIndex> index(Utils::LoadObjectFromFile<RHI::PipelineLibraryIndex>(indexPath));
+            if (index)
+            {
+                m_pipelineStateCache->SetLibraryIndex(m_pipelineLibraryHandle, *index);
+            }
+        }
+
+        void Shader::SavePipelineLibraryIndex() const
+        {
+            const AZStd::string indexPath = GetPipelineLibraryIndexPath();
+            if (indexPath.empty())
+            {
+                return;
+            }
+
+            RHI::PipelineLibraryIndex index = m_pipelineStateCache->GetLibraryIndex(m_pipelineLibraryHandle);
+            if (!index.m_pipelineStateHashes.empty())
+            {
+                [[maybe_unused]] bool result = Utils::SaveObjectToFile(indexPath, DataStream::ST_BINARY, &index);
+                AZ_Error("Shader", result, "Pipeline library index %s was not saved", indexPath.c_str());
+            }
+        }
+
         ShaderOptionGroup Shader::CreateShaderOptionGroup() const
         {
             return ShaderOptionGroup(m_asset->GetShaderOptionGroupLayout());
@@ -429,13 +483,32 @@ namespace AZ
 
         const ShaderVariant& Shader::GetVariant(const ShaderVariantId& shaderVariantId)
         {
+            if (const ShaderVariant* cachedVariant = m_variantLookupCache.Find(shaderVariantId))
+            {
+                return *cachedVariant;
+            }
+
             Data::Asset<ShaderVariantAsset> shaderVariantAsset = m_asset->GetVariantAsset(shaderVariantId, m_supervariantIndex);
             if (!shaderVariantAsset || shaderVariantAsset->IsRootVariant())
             {
+                // Not cached: the root is also returned while the tree or the best-fit variant is still loading.
                 return m_rootVariant;
             }
 
-            return GetVariant(shaderVariantAsset->GetStableId());
+            const ShaderVariantStableId shaderVariantStableId = shaderVariantAsset->GetStableId();
+            const ShaderVariant& variant = GetVariant(shaderVariantStableId);
+            if (&variant != &m_rootVariant)
+            {
+                AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+
+                // The variant could have been removed from the cache since it was returned.
+                auto findIt = m_shaderVariants.find(shaderVariantStableId);
+                if (findIt != m_shaderVariants.end() && &findIt->second == &variant)
+                {
+                    m_variantLookupCache.Insert(shaderVariantId, &variant);
+                }
+            }
+            return variant;
         }
 
         const ShaderVariant& Shader::GetRootVariant()
@@ -538,6 +611,13 @@ namespace AZ
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor, m_asset->GetName());
         }
 
+        const RHI::PipelineState* Shader::AcquirePipelineStateAsync(
+            const RHI::PipelineStateDescriptor& descriptor, const RHI::PipelineState* fallbackPipelineState) const
+        {
+            return m_pipelineStateCache->AcquirePipelineStateAsync(
+                m_pipelineLibraryHandle, descriptor, fallbackPipelineState, RHI::PipelineStateCompilePriority::Visible, m_asset->GetName());
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
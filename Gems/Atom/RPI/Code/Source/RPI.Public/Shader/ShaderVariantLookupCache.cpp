@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
+
+#include <AzCore/std/hash.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        static_assert(sizeof(ShaderVariantKey::word_t) == sizeof(uint32_t), "The lookup cache copies shader variant keys 32 bits at a time");
+        static_assert(ShaderVariantKeyBitCount % 32 == 0, "The lookup cache copies shader variant keys 32 bits at a time");
+
+        const ShaderVariant* ShaderVariantLookupCache::Find(const ShaderVariantId& shaderVariantId) const
+        {
+            const SearchKey searchKey = MakeSearchKey(shaderVariantId);
+            const Slot& slot = m_slots[GetSlotIndex(searchKey)];
+
+            const uint32_t sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+            if (sequence & 1)
+            {
+                return nullptr;
+            }
+
+            const ShaderVariant* shaderVariant = slot.m_shaderVariant.load(AZStd::memory_order_relaxed);
+            bool isMatch = shaderVariant != nullptr;
+            for (uint32_t wordIndex = 0; wordIndex < searchKey.size(); ++wordIndex)
+            {
+                isMatch &= slot.m_key[wordIndex].load(AZStd::memory_order_relaxed) == searchKey[wordIndex];
+            }
+
+            // The entry is only valid if no writer touched the slot while it was being read.
+            AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+            if (slot.m_sequence.load(AZStd::memory_order_relaxed) != sequence)
+            {
+                return nullptr;
+            }
+
+            return isMatch ? shaderVariant : nullptr;
+        }
+
+        void ShaderVariantLookupCache::Insert(const ShaderVariantId& shaderVariantId, const ShaderVariant* shaderVariant)
+        {
+            const SearchKey searchKey = MakeSearchKey(shaderVariantId);
+            Write(m_slots[GetSlotIndex(searchKey)], searchKey, shaderVariant);
+        }
+
+        void ShaderVariantLookupCache::Clear()
+        {
+            const SearchKey emptyKey = {};
+            for (Slot& slot : m_slots)
+            {
+                Write(slot, emptyKey, nullptr);
+            }
+        }
+
+        void ShaderVariantLookupCache::Write(Slot& slot, const SearchKey& searchKey, const ShaderVariant* shaderVariant)
+        {
+            uint32_t sequence = slot.m_sequence.load(AZStd::memory_order_relaxed);
+            if ((sequence & 1) || !slot.m_sequence.compare_exchange_strong(sequence, sequence + 1, AZStd::memory_order_acquire))
+            {
+                // Another thread is writing to this slot.
+                return;
+            }
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+
+            for (uint32_t wordIndex = 0; wordIndex < searchKey.size(); ++wordIndex)
+            {
+                slot.m_key[wordIndex].store(searchKey[wordIndex], AZStd::memory_order_relaxed);
+            }
+            slot.m_shaderVariant.store(shaderVariant, AZStd::memory_order_relaxed);
+
+            slot.m_sequence.store(sequence + 2, AZStd::memory_order_release);
+        }
+
+        ShaderVariantLookupCache::SearchKey ShaderVariantLookupCache::MakeSearchKey(const ShaderVariantId& shaderVariantId)
+        {
+            const ShaderVariantKey maskedKey = shaderVariantId.m_key & shaderVariantId.m_mask;
+
+            SearchKey searchKey;
+            for (uint32_t wordIndex = 0; wordIndex < KeyWordCount; ++wordIndex)
+            {
+                searchKey[wordIndex] = maskedKey.data()[wordIndex];
+                searchKey[KeyWordCount + wordIndex] = shaderVariantId.m_mask.data()[wordIndex];
+            }
+            return searchKey;
+        }
+
+        size_t ShaderVariantLookupCache::GetSlotIndex(const SearchKey& searchKey)
+        {
+            return AZStd::hash_range(searchKey.begin(), searchKey.end()) % SlotCount;
+        }
+    } // namespace RPI
+} // namespace AZ
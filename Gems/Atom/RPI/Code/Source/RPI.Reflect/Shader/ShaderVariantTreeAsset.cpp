@@ -11,6 +11,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroupLayout.h>
@@ -71,6 +72,42 @@ namespace AZ
         }
 
         ShaderVariantSearchResult ShaderVariantTreeAsset::FindVariantStableId(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const
+        {
+            const ShaderVariantId searchKey = MakeSearchKey(shaderOptionGroupLayout, shaderVariantId);
+            const HashValue64 layoutHash = shaderOptionGroupLayout->GetHash();
+
+            {
+                AZStd::shared_lock<decltype(m_searchIndexMutex)> lock(m_searchIndexMutex);
+                if (m_isSearchIndexBuilt && m_searchIndexLayoutHash == layoutHash)
+                {
+                    auto findIt = m_searchIndex.find(searchKey);
+                    if (findIt != m_searchIndex.end())
+                    {
+                        return findIt->second;
+                    }
+                }
+            }
+
+            const ShaderVariantSearchResult searchResult = SearchTree(shaderOptionGroupLayout, searchKey);
+
+            AZStd::unique_lock<decltype(m_searchIndexMutex)> lock(m_searchIndexMutex);
+            if (!m_isSearchIndexBuilt || m_searchIndexLayoutHash != layoutHash)
+            {
+                BuildSearchIndex(shaderOptionGroupLayout);
+                m_searchIndexLayoutHash = layoutHash;
+                m_isSearchIndexBuilt = true;
+            }
+
+            // Keys baked in the tree are already in the index, so only the fallback results are counted against the limit.
+            if (m_indexedFallbackCount < MaxIndexedFallbackCount && m_searchIndex.emplace(searchKey, searchResult).second)
+            {
+                ++m_indexedFallbackCount;
+            }
+
+            return searchResult;
+        }
+
+        ShaderVariantSearchResult ShaderVariantTreeAsset::SearchTree(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const
         {
             struct NodeToVisit
             {
@@ -87,23 +124,31 @@ namespace AZ
             // The list of specified options, in order of priority, built from the variant key mask.
             auto optionValues = ConvertToValueChain(shaderOptionGroupLayout, shaderVariantId);
 
-            // Always add the root to the results.
-            AZStd::vector<SearchResult> searchResults;
-            searchResults.push_back({ 0, ShaderAsset::RootShaderVariantStableId });
+            // Always add the root to the results. The results are visited in order, and the first one with the most
+            // static branches wins, so the best result is tracked as the search goes instead of being collected.
+            SearchResult bestFit{ 0, ShaderAsset::RootShaderVariantStableId };
+            auto addSearchResult = [&bestFit](uint32_t branchCount, ShaderVariantStableId variantStableId)
+            {
+                // More static branches is a better fit.
+                if (branchCount > bestFit.m_branchCount)
+                {
+                    bestFit = { branchCount, variantStableId };
+                }
+            };
 
-            // All the indices are guaranteed to be unique, so we use queues.
-            AZStd::queue<NodeToVisit> nodesToVisit;
-            AZStd::queue<NodeToVisit> nodesToVisitNext;
+            // All the indices are guaranteed to be unique, so each level is a flat list visited in order.
+            AZStd::vector<NodeToVisit> nodesToVisit;
+            AZStd::vector<NodeToVisit> nodesToVisitNext;
 
             // Always visit the root node.
-            nodesToVisit.push({ 0, 0 });
+            nodesToVisit.push_back({ 0, 0 });
 
             for (uint32_t optionValue : optionValues)
             {
-                while (!nodesToVisit.empty())
+                nodesToVisitNext.clear();
+
+                for (const NodeToVisit& nextNode : nodesToVisit)
                 {
-                    const NodeToVisit nextNode = nodesToVisit.front();
-                    nodesToVisit.pop();
 
                     // Leaf node
                     if (!GetNode(nextNode.m_nodeIndex).HasChildren())
@@ -127,24 +172,24 @@ namespace AZ
                     {
                         // Visit this specified node, and increase the weight of visiting the node by 1.
                         // [GFX TODO] [ATOM-3883] Improve the evaluation of visiting the variant search tree.
-                        nodesToVisitNext.push({ nextNode.m_branchCount + 1, requestedIndex });
+                        nodesToVisitNext.push_back({ nextNode.m_branchCount + 1, requestedIndex });
 
                         // If the specified node has valid data, add it to the matches.
                         if (GetNode(requestedIndex).GetStableId().IsValid())
                         {
                             // Specified nodes have one more static branch than their parent.
-                            searchResults.push_back({ nextNode.m_branchCount + 1, GetNode(requestedIndex).GetStableId() });
+                            addSearchResult(nextNode.m_branchCount + 1, GetNode(requestedIndex).GetStableId());
                         }
                     }
 
                     // Always visit the unspecified node.
-                    nodesToVisitNext.push({ nextNode.m_branchCount, unspecifiedIndex });
+                    nodesToVisitNext.push_back({ nextNode.m_branchCount, unspecifiedIndex });
 
                     // If the unspecified node has valid data, add it to the matches.
                     if (GetNode(unspecifiedIndex).GetStableId().IsValid())
                     {
                         // Unspecified nodes have the same number of static branches as their parent.
-                        searchResults.push_back({ nextNode.m_branchCount, GetNode(unspecifiedIndex).GetStableId() });
+                        addSearchResult(nextNode.m_branchCount, GetNode(unspecifiedIndex).GetStableId());
                     }
                 }
 
@@ -152,23 +197,101 @@ namespace AZ
                 AZStd::swap(nodesToVisit, nodesToVisitNext);
             }
 
-            // Count the number of static branches.
-            uint32_t totalBranchCount = 0;
-            ShaderVariantStableId bestFitStableId = ShaderAsset::RootShaderVariantStableId;
+            // Calculate the number of dynamic branches. 
+            const uint32_t optionCount = aznumeric_cast<uint32_t>(shaderOptionGroupLayout->GetShaderOptions().size());
+            return ShaderVariantSearchResult{ bestFit.m_variantStableId, optionCount - bestFit.m_branchCount };
+        }
+
+        void ShaderVariantTreeAsset::BuildSearchIndex(const ShaderOptionGroupLayout* shaderOptionGroupLayout) const
+        {
+            struct NodeToVisit
+            {
+                uint32_t m_nodeIndex;   // Index of the node to visit
+                uint32_t m_optionIndex; // Index of the option that selects the children of the node
+                uint32_t m_branchCount; // Number of static branches
+                ShaderVariantId m_shaderVariantId; // The values chosen on the path to the node
+            };
+
+            m_searchIndex.clear();
+            m_indexedFallbackCount = 0;
+
+            const auto& options = shaderOptionGroupLayout->GetShaderOptions();
+            const uint32_t optionCount = aznumeric_cast<uint32_t>(options.size());
+            const uint32_t nodeCount = aznumeric_cast<uint32_t>(m_nodes.size());
+
+            // An empty request always resolves to the root.
+            m_searchIndex.emplace(ShaderVariantId{}, ShaderVariantSearchResult{ ShaderAsset::RootShaderVariantStableId, optionCount });
+            if (nodeCount == 0)
+            {
+                return;
+            }
+
+            AZStd::vector<NodeToVisit> nodesToVisit;
+            nodesToVisit.push_back({ 0, 0, 0, ShaderVariantId{} });
+
+            while (!nodesToVisit.empty())
+            {
+                const NodeToVisit node = nodesToVisit.back();
+                nodesToVisit.pop_back();
 
-            AZStd::for_each(searchResults.begin(), searchResults.end(), [&](const SearchResult& searchResult)
+                if (!GetNode(node.m_nodeIndex).HasChildren() || node.m_optionIndex >= optionCount)
                 {
-                    // More static branches is a better fit.
-                    if (searchResult.m_branchCount > totalBranchCount)
+                    continue;
+                }
+
+                const ShaderOptionDescriptor& option = options[node.m_optionIndex];
+                const uint32_t unspecifiedIndex = node.m_nodeIndex + GetNode(node.m_nodeIndex).GetOffset();
+
+                // A variant that ends on an unspecified value is never a best fit (the value chain of a request is trimmed),
+                // so the unspecified branch only needs to be visited for its descendants.
+                if (unspecifiedIndex < nodeCount)
+                {
+                    nodesToVisit.push_back({ unspecifiedIndex, node.m_optionIndex + 1, node.m_branchCount, node.m_shaderVariantId });
+                }
+
+                for (uint32_t optionValue = 0; optionValue < option.GetValuesCount(); ++optionValue)
+                {
+                    const uint32_t childIndex = unspecifiedIndex + optionValue + 1;
+                    if (childIndex >= nodeCount)
                     {
-                        totalBranchCount = searchResult.m_branchCount;
-                        bestFitStableId = searchResult.m_variantStableId;
+                        break;
                     }
-                });
 
-            // Calculate the number of dynamic branches. 
-            const uint32_t optionCount = aznumeric_cast<uint32_t>(shaderOptionGroupLayout->GetShaderOptions().size());
-            return ShaderVariantSearchResult{ bestFitStableId, optionCount - totalBranchCount };
+                    NodeToVisit child{ childIndex, node.m_optionIndex + 1, node.m_branchCount + 1, node.m_shaderVariantId };
+                    option.Set(child.m_shaderVariantId.m_key, ShaderOptionValue{ option.GetMinValue().GetIndex() + optionValue });
+                    child.m_shaderVariantId.m_mask |= option.GetBitMask();
+
+                    // A request for exactly this chain of values can't match any other variant with as many static branches.
+                    const ShaderVariantStableId stableId = GetNode(childIndex).GetStableId();
+                    if (stableId.IsValid())
+                    {
+                        m_searchIndex.emplace(child.m_shaderVariantId, ShaderVariantSearchResult{ stableId, optionCount - child.m_branchCount });
+                    }
+
+                    nodesToVisit.push_back(child);
+                }
+            }
+        }
+
+        ShaderVariantId ShaderVariantTreeAsset::MakeSearchKey(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId)
+        {
+            ShaderVariantId searchKey;
+            for (const ShaderOptionDescriptor& option : shaderOptionGroupLayout->GetShaderOptions())
+            {
+                if ((shaderVariantId.m_mask & option.GetBitMask()).any())
+                {
+                    searchKey.m_mask |= option.GetBitMask();
+                }
+            }
+            searchKey.m_key = shaderVariantId.m_key & searchKey.m_mask;
+            return searchKey;
+        }
+
+        size_t ShaderVariantTreeAsset::SearchKeyHasher::operator()(const ShaderVariantId& shaderVariantId) const
+        {
+            size_t hash = AZStd::hash_range(shaderVariantId.m_key.data(), shaderVariantId.m_key.data() + shaderVariantId.m_key.num_words());
+            AZStd::hash_range(hash, shaderVariantId.m_mask.data(), shaderVariantId.m_mask.data() + shaderVariantId.m_mask.num_words());
+            return hash;
         }
 
         const ShaderVariantTreeNode& ShaderVariantTreeAsset::GetNode(uint32_t index) const
@@ -185,12 +308,11 @@ namespace AZ
             m_nodes[index] = node;
         }
 
-        AZStd::vector<uint32_t> ShaderVariantTreeAsset::ConvertToValueChain(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId)
+        ShaderVariantTreeAsset::ValueChain ShaderVariantTreeAsset::ConvertToValueChain(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId)
         {
             const auto& options = shaderOptionGroupLayout->GetShaderOptions();
 
-            AZStd::vector<uint32_t> optionValues;
-            optionValues.reserve(options.size());
+            ValueChain optionValues;
 
             for (const ShaderOptionDescriptor& option : options)
             {
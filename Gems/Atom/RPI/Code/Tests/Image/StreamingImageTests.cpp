@@ -17,14 +17,17 @@
 #include <Atom/RPI.Reflect/Image/StreamingImagePoolAssetCreator.h>
 #include <Atom/RPI.Reflect/Asset/BuiltInAssetHandler.h>
 
+#include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/RPIUtils.h>
+#include <Atom/RPI.Public/View.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/std/containers/intrusive_list.h>
 
 #include <Common/RPITestFixture.h>
@@ -391,13 +394,13 @@ namespace UnitTest
             return poolAsset;
         }
 
-        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage(AZ::RHI::Format format = AZ::RHI::Format::R8G8B8A8_UNORM)
+        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage(
+            AZ::RHI::Format format = AZ::RHI::Format::R8G8B8A8_UNORM, uint32_t mipCountHead = 1)
         {
             using namespace AZ;
 
             const uint32_t arraySize = 2;
             const uint32_t pixelSize = RHI::GetFormatSize(format);
-            const uint32_t mipCountHead = 1;
             const uint32_t mipCountMiddle = 2;
             const uint32_t mipCountTail = 3;
             const uint32_t mipCountTotal = mipCountHead + mipCountMiddle + mipCountTail;
@@ -406,7 +409,7 @@ namespace UnitTest
 
             Data::Asset<RPI::ImageMipChainAsset> mipTail = BuildMipChainAsset(0, mipCountTail, arraySize, pixelSize);
             Data::Asset<RPI::ImageMipChainAsset> mipMiddle = BuildMipChainAsset(mipCountTail, mipCountMiddle, arraySize, pixelSize);
-            Data::Asset<RPI::ImageMipChainAsset> mipHead = BuildMipChainAsset(mipCountTail + mipCountMiddle, mipCountHead, arraySize, pixelSize);
+            Data::Asset<RPI::ImageMipChainAsset> mipHead = BuildMipChainAsset(aznumeric_cast<uint16_t>(mipCountTail + mipCountMiddle), aznumeric_cast<uint16_t>(mipCountHead), arraySize, pixelSize);
 
             RPI::StreamingImageAssetCreator assetCreator;
             assetCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
@@ -723,4 +726,181 @@ namespace UnitTest
             EXPECT_NEAR(pixelDataValue, pixelExpectedValue, Constants::Tolerance);
         }
     }
+
+    TEST_F(StreamingImageTests, CalculateRequiredMip)
+    {
+        using namespace AZ;
+
+        const RHI::Size imageSize(256, 128, 1);
+        const uint16_t mipLevels = 9;
+
+        EXPECT_EQ(RPI::StreamingImageController::CalculateRequiredMip(imageSize, mipLevels, 512.0f), 0);
+        EXPECT_EQ(RPI::StreamingImageController::CalculateRequiredMip(imageSize, mipLevels, 256.0f), 0);
+        EXPECT_EQ(RPI::StreamingImageController::CalculateRequiredMip(imageSize, mipLevels, 255.0f), 0);
+        EXPECT_EQ(RPI::StreamingImageController::CalculateRequiredMip(imageSize, mipLevels, 128.0f), 1);
+        EXPECT_EQ(RPI::StreamingImageController::CalculateRequiredMip(imageSize, mipLevels, 100.0f), 1);
+        EXPECT_EQ(RPI::StreamingImageController::CalculateRequiredMip(imageSize, mipLevels, 1.0f), 8);
+        // Tiny coverage is clamped to the least detailed mip
+        EXPECT_EQ(RPI::StreamingImageController::CalculateRequiredMip(imageSize, 4, 0.01f), 3);
+    }
+
+    TEST_F(StreamingImageTests, TexelDensitySetsTargetMip)
+    {
+        using namespace AZ;
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        // A 64x64 image with mip chains of mips [0], [1, 2] and [3, 5]
+        Data::Asset<RPI::StreamingImageAsset> imageAsset = BuildTestImage();
+        Data::Instance<RPI::StreamingImage> imageInstance = RPI::StreamingImage::FindOrCreate(imageAsset);
+
+        auto updateWithReport = [&](float screenPixelsPerUv)
+        {
+            for (uint32_t updateIndex = 0; updateIndex < 4; ++updateIndex)
+            {
+                // Only the largest report counts
+                imageInstance->ReportTexelDensity(screenPixelsPerUv * 0.5f);
+                imageInstance->ReportTexelDensity(screenPixelsPerUv);
+                imageSystem->Update();
+            }
+        };
+
+        // 16 pixels need mip 2, which is streamed with its mip chain
+        updateWithReport(16.0f);
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 1);
+        EXPECT_EQ(m_defaultPool->GetStreamingStats().m_visibleImageCount, 1);
+
+        updateWithReport(64.0f);
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 0);
+
+        // Lower detail is evicted right away
+        imageInstance->ReportTexelDensity(4.0f);
+        imageSystem->Update();
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 3);
+
+        // Images which aren't reported keep their target
+        for (uint32_t updateIndex = 0; updateIndex < 4; ++updateIndex)
+        {
+            imageSystem->Update();
+        }
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 3);
+        EXPECT_EQ(m_defaultPool->GetStreamingStats().m_visibleImageCount, 0);
+    }
+
+    TEST_F(StreamingImageTests, CulledLodsReportTexelDensity)
+    {
+        using namespace AZ;
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        // A 64x64 image with mip chains of mips [0], [1, 2] and [3, 5]
+        Data::Asset<RPI::StreamingImageAsset> imageAsset = BuildTestImage();
+        Data::Instance<RPI::StreamingImage> imageInstance = RPI::StreamingImage::FindOrCreate(imageAsset);
+
+        // With a 90 degree field of view, a sphere of radius 1 covers 1/distance of the screen height
+        Matrix4x4 viewToClip = Matrix4x4::CreateIdentity();
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.0f, 0.1f, 1000.0f, true);
+
+        RPI::ViewPtr cameraView = RPI::View::CreateView(Name("TexelDensityCamera"), RPI::View::UsageCamera);
+        cameraView->SetCameraTransform(Matrix3x4::CreateIdentity());
+        cameraView->SetViewToClipMatrix(viewToClip);
+
+        RPI::ViewPtr shadowView = RPI::View::CreateView(Name("TexelDensityShadow"), RPI::View::UsageShadow);
+        shadowView->SetCameraTransform(Matrix3x4::CreateIdentity());
+        shadowView->SetViewToClipMatrix(viewToClip);
+
+        RPI::Cullable::LodData lodData;
+        lodData.m_lodSelectionRadius = 1.0f;
+        lodData.m_lods.resize(1);
+        lodData.m_lods[0].m_streamingImages.push_back(imageInstance);
+
+        auto cullAndUpdate = [&](RPI::View& view, float distance)
+        {
+            for (uint32_t updateIndex = 0; updateIndex < 4; ++updateIndex)
+            {
+                RPI::AddLodDataToView(Vector3(0.0f, distance, 0.0f), lodData, view, AzFramework::VisibilityEntry::TYPE_RPI_Cullable);
+                imageSystem->Update();
+            }
+        };
+
+        // 1080 / 90 = 12 pixels need mip 2, which is streamed with its mip chain
+        cullAndUpdate(*cameraView, 90.0f);
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 1);
+        EXPECT_EQ(m_defaultPool->GetStreamingStats().m_visibleImageCount, 1);
+
+        // 1080 / 360 = 3 pixels only need the last mip chain
+        cullAndUpdate(*cameraView, 360.0f);
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 3);
+
+        // Shadow views don't report the images they draw
+        cullAndUpdate(*shadowView, 1.0f);
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 3);
+        EXPECT_EQ(m_defaultPool->GetStreamingStats().m_visibleImageCount, 0);
+    }
+
+    TEST_F(StreamingImageTests, MemoryBudgetEvictsLeastNeededImages)
+    {
+        using namespace AZ;
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        // Eight 256x256 RGBA32F images of about 2.7MB each don't all fit in the 16MB budget of the default pool
+        const uint32_t imageCount = 8;
+        AZStd::vector<Data::Asset<RPI::StreamingImageAsset>> imageAssets;
+        AZStd::vector<Data::Instance<RPI::StreamingImage>> images;
+        for (uint32_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+        {
+            imageAssets.push_back(BuildTestImage(RHI::Format::R32G32B32A32_FLOAT, 3));
+            images.push_back(RPI::StreamingImage::FindOrCreate(imageAssets.back()));
+            images.back()->SetStreamingPriority(imageIndex);
+        }
+
+        auto update = [&](uint32_t invisibleImageIndex)
+        {
+            for (uint32_t updateIndex = 0; updateIndex < 10; ++updateIndex)
+            {
+                for (uint32_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+                {
+                    if (imageIndex != invisibleImageIndex)
+                    {
+                        images[imageIndex]->ReportTexelDensity(256.0f);
+                    }
+                }
+                imageSystem->Update();
+
+                const RPI::StreamingImageController::StreamingStats& stats = m_defaultPool->GetStreamingStats();
+                EXPECT_LE(stats.m_estimatedMemoryUsage, stats.m_memoryBudget);
+            }
+        };
+
+        update(imageCount);
+
+        const RPI::StreamingImageController::StreamingStats& stats = m_defaultPool->GetStreamingStats();
+        EXPECT_EQ(stats.m_visibleImageCount, imageCount);
+        EXPECT_TRUE(stats.m_isBudgetLimited);
+        EXPECT_GT(stats.m_targetMemoryUsage, stats.m_memoryBudget);
+
+        // Images with a higher priority are at least as detailed as the ones with a lower priority
+        EXPECT_EQ(images[imageCount - 1]->GetResidentMipLevel(), 0);
+        EXPECT_NE(images[0]->GetResidentMipLevel(), 0);
+        uint32_t fullyResidentImageCount = 0;
+        for (uint32_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+        {
+            if (imageIndex > 0)
+            {
+                EXPECT_LE(images[imageIndex]->GetResidentMipLevel(), images[imageIndex - 1]->GetResidentMipLevel());
+            }
+            fullyResidentImageCount += images[imageIndex]->GetResidentMipLevel() == 0 ? 1 : 0;
+        }
+
+        // Make the most detailed image the least needed one: it stops being visible and loses its priority.
+        // The first image which didn't fit takes its place.
+        const uint32_t firstPartialImageIndex = imageCount - 1 - fullyResidentImageCount;
+        images[imageCount - 1]->SetStreamingPriority(0);
+        update(imageCount - 1);
+
+        EXPECT_NE(images[imageCount - 1]->GetResidentMipLevel(), 0);
+        EXPECT_EQ(images[firstPartialImageIndex]->GetResidentMipLevel(), 0);
+        EXPECT_GT(m_defaultPool->GetStreamingStats().m_memoryBudget, 0);
+    }
 }
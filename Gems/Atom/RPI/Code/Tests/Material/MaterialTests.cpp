@@ -1629,4 +1629,111 @@ namespace UnitTest
         CheckPropertyValueRoundTrip(Data::Instance<Image>{m_testAttachmentImage});
         CheckPropertyValueRoundTrip(AZStd::string{"hello"});
     }
+    TEST_F(MaterialTests, TestMaterialsFromSameAssetShareInitialCompile)
+    {
+        // The first material runs the initial compile, the second one copies its result
+        Data::Instance<Material> material1 = Material::Create(m_testMaterialAsset);
+        Data::Instance<Material> material2 = Material::Create(m_testMaterialAsset);
+        EXPECT_NE(material1, material2);
+        EXPECT_NE(material1->GetMaterialShaderParameter(), material2->GetMaterialShaderParameter());
+        EXPECT_FALSE(material2->NeedsCompile());
+
+        MaterialInstanceHandlerInterface::Get()->Compile();
+        ValidateInitialValuesFromMaterial(material1);
+        ValidateInitialValuesFromMaterial(material2);
+
+        // The copied state belongs to the second material only
+        EXPECT_TRUE(material2->SetPropertyValue<float>(material2->FindPropertyIndex(Name{ "MyFloat" }), 4.5f));
+        material2->Compile();
+
+        auto layout = m_testMaterialAsset->GetMaterialTypeAsset()->GetMaterialShaderParameterLayout();
+        EXPECT_EQ(material1->GetMaterialShaderParameter()->GetShaderParameterData<float>(layout.GetParameterIndex("m_float")), 1.5f);
+        EXPECT_EQ(material2->GetMaterialShaderParameter()->GetShaderParameterData<float>(layout.GetParameterIndex("m_float")), 4.5f);
+    }
+
+    TEST_F(MaterialTests, TestMaterialsFromSameAssetShareInitialCompile_MaterialPipelineState)
+    {
+        // A functor sets an internal property that enables a shader in a material pipeline. The material that copies the initial
+        // compile has to end up in the same state, and still respond to its own property changes afterwards.
+
+        MaterialTypeAssetCreator materialTypeCreator;
+        materialTypeCreator.Begin(Uuid::CreateRandom());
+        materialTypeCreator.AddShader(m_testMaterialShaderAsset, ShaderVariantId{}, Name{"shader1"}, Name{"PipalineA"});
+        materialTypeCreator.AddShader(m_testMaterialShaderAsset, ShaderVariantId{}, Name{"special"}, Name{"PipalineA"});
+        materialTypeCreator.SetMaterialShaderParameterLayout(m_testMaterialShaderParameterLayout);
+
+        materialTypeCreator.BeginMaterialProperty(Name{"EnableSpecialFeature"}, MaterialPropertyDataType::Bool, Name{"PipalineA"});
+        materialTypeCreator.ConnectMaterialPropertyToShaderEnabled(Name{"special"});
+        materialTypeCreator.EndMaterialProperty();
+
+        materialTypeCreator.BeginMaterialProperty(Name{"general.useSpecialFeature"}, MaterialPropertyDataType::Bool, MaterialPipelineNone);
+        materialTypeCreator.EndMaterialProperty();
+
+        SetInternalPropertyFunctorSourceData functorCreator;
+        functorCreator.m_inputPropertyName = Name{"general.useSpecialFeature"};
+        functorCreator.m_outputPropertyName = Name{"EnableSpecialFeature"};
+        MaterialNameContext nameContext;
+        MaterialFunctorSourceData::FunctorResult result = functorCreator.CreateFunctor(
+            MaterialFunctorSourceData::RuntimeContext{ "", materialTypeCreator.GetMaterialPropertiesLayout(), &nameContext });
+        materialTypeCreator.AddMaterialFunctor(result.GetValue(), MaterialPipelineNone);
+
+        materialTypeCreator.End(m_testMaterialTypeAsset);
+
+        MaterialAssetCreator materialAssetCreator;
+        materialAssetCreator.Begin(Uuid::CreateRandom(), m_testMaterialTypeAsset);
+        materialAssetCreator.SetPropertyValue(Name{"general.useSpecialFeature"}, true);
+        materialAssetCreator.End(m_testMaterialAsset);
+
+        Data::Instance<Material> material1 = Material::Create(m_testMaterialAsset);
+        Data::Instance<Material> material2 = Material::Create(m_testMaterialAsset);
+
+        // The test functor doesn't opt in to parallel processing
+        EXPECT_FALSE(material2->CanCompileInParallel());
+
+        EXPECT_TRUE(material1->GetShaderCollection(Name{"PipalineA"})[1].IsEnabled());
+        EXPECT_TRUE(material2->GetShaderCollection(Name{"PipalineA"})[1].IsEnabled());
+
+        material2->SetPropertyValue(material2->FindPropertyIndex(Name{"general.useSpecialFeature"}), false);
+        material2->Compile();
+
+        EXPECT_TRUE(material1->GetShaderCollection(Name{"PipalineA"})[1].IsEnabled());
+        EXPECT_FALSE(material2->GetShaderCollection(Name{"PipalineA"})[1].IsEnabled());
+    }
+
+    TEST_F(MaterialTests, TestCompileQueuedMaterials)
+    {
+        constexpr uint32_t MaterialCount = 40;
+
+        AZStd::vector<Data::Instance<Material>> materials;
+        for (uint32_t materialIndex = 0; materialIndex < MaterialCount; ++materialIndex)
+        {
+            Data::Instance<Material> material = Material::Create(m_testMaterialAsset);
+
+            // Materials without functors can always be compiled on worker threads
+            EXPECT_TRUE(material->CanCompileInParallel());
+
+            material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), aznumeric_cast<float>(materialIndex));
+            material->SetPropertyValue<int32_t>(material->FindPropertyIndex(Name{ "MyInt" }), -aznumeric_cast<int32_t>(materialIndex));
+            material->QueueCompile();
+            EXPECT_TRUE(material->NeedsCompile());
+
+            materials.push_back(material);
+        }
+
+        // Queueing a material again must not compile it twice
+        materials.front()->QueueCompile();
+
+        MaterialInstanceHandlerInterface::Get()->CompileQueuedMaterials();
+
+        auto layout = m_testMaterialAsset->GetMaterialTypeAsset()->GetMaterialShaderParameterLayout();
+        for (uint32_t materialIndex = 0; materialIndex < MaterialCount; ++materialIndex)
+        {
+            const Data::Instance<Material>& material = materials[materialIndex];
+            EXPECT_FALSE(material->NeedsCompile());
+
+            auto paramData = material->GetMaterialShaderParameter();
+            EXPECT_EQ(paramData->GetShaderParameterData<float>(layout.GetParameterIndex("m_float")), aznumeric_cast<float>(materialIndex));
+            EXPECT_EQ(paramData->GetShaderParameterData<int32_t>(layout.GetParameterIndex("m_int")), -aznumeric_cast<int32_t>(materialIndex));
+        }
+    }
 }
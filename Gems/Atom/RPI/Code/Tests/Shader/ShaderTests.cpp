@@ -19,6 +19,7 @@
 
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
 
 #include <Common/RPITestFixture.h>
 #include <Common/ErrorMessageFinder.h>
@@ -26,8 +27,12 @@
 
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Utils/TypeHash.h>
+#include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
 #include <AzCore/std/string/conversions.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ
 {
@@ -1959,6 +1964,160 @@ namespace UnitTest
         EXPECT_EQ(resultG.GetStableId().GetIndex(), stableId5);
     }
 
+    TEST_F(ShaderTests, ShaderVariantTreeAsset_IndexedSearchMatchesTreeSearch)
+    {
+        using namespace AZ;
+        using namespace AZ::RPI;
+
+        auto shaderAsset = CreateShaderAsset();
+        const ShaderOptionGroupLayout* layout = shaderAsset->GetShaderOptionGroupLayout();
+
+        // Every combination of these values, including unspecified (empty) ones, covers the variants baked in the tree,
+        // requests that fall back to one of their parents, and requests that fall back to the root.
+        const AZStd::vector<AZStd::vector<AZStd::string>> optionValues = {
+            { "", "Fuchsia", "Teal", "Navy" },
+            { "", "Quality::Auto", "Quality::Sublime", "Quality::Poor" },
+            { "", "50", "150" },
+            { "", "Off", "On" }
+        };
+
+        AZStd::vector<ShaderVariantId> requests;
+        ShaderOptionGroup shaderOptionGroup(layout);
+        for (const auto& color : optionValues[0])
+        {
+            for (const auto& quality : optionValues[1])
+            {
+                for (const auto& numberSamples : optionValues[2])
+                {
+                    for (const auto& raytracing : optionValues[3])
+                    {
+                        shaderOptionGroup.Clear();
+                        const AZStd::string* values[] = { &color, &quality, &numberSamples, &raytracing };
+                        for (uint32_t optionIndex = 0; optionIndex < 4; ++optionIndex)
+                        {
+                            if (!values[optionIndex]->empty())
+                            {
+                                shaderOptionGroup.SetValue(ShaderOptionIndex{ optionIndex }, Name(*values[optionIndex]));
+                            }
+                        }
+                        requests.push_back(shaderOptionGroup.GetShaderVariantId());
+                    }
+                }
+            }
+        }
+
+        // Warm up a single tree with all the requests, so the second pass is served by its search index.
+        auto indexedTreeAsset = CreateShaderVariantTreeAssetForSearch(shaderAsset);
+        ASSERT_TRUE(indexedTreeAsset);
+        for (const ShaderVariantId& request : requests)
+        {
+            indexedTreeAsset->FindVariantStableId(layout, request);
+        }
+
+        for (const ShaderVariantId& request : requests)
+        {
+            // The first search on a new tree always walks the tree.
+            auto treeAsset = CreateShaderVariantTreeAssetForSearch(shaderAsset);
+            const ShaderVariantSearchResult expected = treeAsset->FindVariantStableId(layout, request);
+            const ShaderVariantSearchResult indexed = indexedTreeAsset->FindVariantStableId(layout, request);
+            EXPECT_EQ(indexed.GetStableId(), expected.GetStableId());
+            EXPECT_EQ(indexed.GetDynamicOptionCount(), expected.GetDynamicOptionCount());
+
+            // Key bits that are not covered by the mask don't change the result.
+            ShaderVariantId noisyRequest = request;
+            noisyRequest.m_key |= ~request.m_mask;
+            const ShaderVariantSearchResult noisy = indexedTreeAsset->FindVariantStableId(layout, noisyRequest);
+            EXPECT_EQ(noisy.GetStableId(), expected.GetStableId());
+        }
+    }
+
+    TEST_F(ShaderTests, ShaderVariantLookupCache_FindInsertClear)
+    {
+        using namespace AZ;
+        using namespace AZ::RPI;
+
+        ShaderVariantLookupCache cache;
+        ShaderVariant variants[2];
+
+        RPI::ShaderOptionGroup shaderOptionGroup(m_shaderOptionGroupLayoutForVariants);
+        shaderOptionGroup.SetValue(Name("Color"), Name("Teal"));
+        const ShaderVariantId tealId = shaderOptionGroup.GetShaderVariantId();
+        shaderOptionGroup.SetValue(Name("Quality"), Name("Quality::Sublime"));
+        const ShaderVariantId tealSublimeId = shaderOptionGroup.GetShaderVariantId();
+
+        EXPECT_EQ(cache.Find(tealId), nullptr);
+
+        cache.Insert(tealId, &variants[0]);
+        cache.Insert(tealSublimeId, &variants[1]);
+
+        // The slots are direct-mapped, so one entry may have replaced the other.
+        const ShaderVariant* foundTeal = cache.Find(tealId);
+        const ShaderVariant* foundTealSublime = cache.Find(tealSublimeId);
+        EXPECT_TRUE(foundTeal == nullptr || foundTeal == &variants[0]);
+        EXPECT_EQ(foundTealSublime, &variants[1]);
+
+        // Bits outside of the mask are not part of the key.
+        ShaderVariantId noisyId = tealSublimeId;
+        noisyId.m_key |= ~tealSublimeId.m_mask;
+        EXPECT_EQ(cache.Find(noisyId), &variants[1]);
+
+        // The same key with a different mask is a different request.
+        ShaderVariantId widerMaskId = tealSublimeId;
+        widerMaskId.m_mask |= m_bindings[3].GetBitMask();
+        EXPECT_EQ(cache.Find(widerMaskId), nullptr);
+
+        cache.Clear();
+        EXPECT_EQ(cache.Find(tealId), nullptr);
+        EXPECT_EQ(cache.Find(tealSublimeId), nullptr);
+    }
+
+    TEST_F(ShaderTests, ShaderVariantLookupCache_ConcurrentReadersOnlySeeInsertedEntries)
+    {
+        using namespace AZ;
+        using namespace AZ::RPI;
+
+        constexpr uint32_t RequestCount = 64;
+        ShaderVariantLookupCache cache;
+        AZStd::vector<ShaderVariant> variants(RequestCount);
+        AZStd::vector<ShaderVariantId> requests(RequestCount);
+        for (uint32_t i = 0; i < RequestCount; ++i)
+        {
+            requests[i].m_key = ShaderVariantKey(i);
+            requests[i].m_mask = ShaderVariantKey(0xFF);
+        }
+
+        AZStd::atomic_bool mismatch{ false };
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([&, threadIndex]()
+                {
+                    for (uint32_t iteration = 0; iteration < 1000; ++iteration)
+                    {
+                        for (uint32_t i = 0; i < RequestCount; ++i)
+                        {
+                            // Half of the threads write, all of them read.
+                            if (threadIndex % 2 == 0)
+                            {
+                                cache.Insert(requests[i], &variants[i]);
+                            }
+                            const ShaderVariant* found = cache.Find(requests[i]);
+                            if (found && found != &variants[i])
+                            {
+                                mismatch = true;
+                            }
+                        }
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_FALSE(mismatch);
+    }
+
     TEST_F(ShaderTests, ShaderAsset_SpecializationConstants)
     {
         {
@@ -2060,5 +2219,191 @@ namespace UnitTest
              EXPECT_TRUE(rootShaderVariant.UseSpecializationConstants());
          }
     }
+
+#if defined(HAVE_BENCHMARK)
+    // Builds a shader variant tree shaped like the ones of the material shaders: a dozen options, mostly booleans, and a
+    // variant list where each variant bakes a prefix of the options. Requests are fully specified, as the ones built by
+    // the MeshDrawPacket from the material and object shader options, so most of them fall back to a partially baked variant.
+    class ShaderVariantTreeBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t RequestCount = 1024;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::NameDictionary::Create();
+            AZ::Data::AssetManager::Descriptor desc;
+            AZ::Data::AssetManager::Create(desc);
+
+            AZ::SimpleLcgRandom random(1234);
+            BuildLayout();
+            BuildVariantList(aznumeric_cast<uint32_t>(state.range(0)), random);
+            BuildRequests(random);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_requests = {};
+            m_variantInfos = {};
+            m_layout = nullptr;
+            AZ::Data::AssetManager::Destroy();
+            AZ::NameDictionary::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> CreateTree() const
+        {
+            AZ::RPI::ShaderVariantTreeAssetCreator creator;
+            creator.Begin(AZ::Uuid::CreateRandom());
+            creator.SetShaderOptionGroupLayout(*m_layout);
+            creator.SetVariantInfos(m_variantInfos);
+            AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> treeAsset;
+            creator.End(treeAsset);
+            return treeAsset;
+        }
+
+        AZ::RPI::Ptr<AZ::RPI::ShaderOptionGroupLayout> m_layout;
+        AZStd::vector<AZ::RPI::ShaderVariantListSourceData::VariantInfo> m_variantInfos;
+        AZStd::vector<AZ::RPI::ShaderVariantId> m_requests;
+
+    private:
+        static AZ::Name GetValueName(uint32_t value)
+        {
+            return AZ::Name(AZStd::string::format("Value%u", value));
+        }
+
+        void BuildLayout()
+        {
+            const uint32_t valueCounts[] = { 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 8, 3 };
+
+            m_layout = AZ::RPI::ShaderOptionGroupLayout::Create();
+            uint32_t bitOffset = 0;
+            uint32_t order = 0;
+            for (uint32_t valueCount : valueCounts)
+            {
+                AZStd::vector<AZ::RPI::ShaderOptionValuePair> values;
+                for (uint32_t value = 0; value < valueCount; ++value)
+                {
+                    values.push_back({ GetValueName(value), AZ::RPI::ShaderOptionValue(value) });
+                }
+                AZ::RPI::ShaderOptionDescriptor option{ AZ::Name(AZStd::string::format("Option%u", order)),
+                                                        AZ::RPI::ShaderOptionType::Enumeration,
+                                                        bitOffset,
+                                                        order,
+                                                        values,
+                                                        GetValueName(0) };
+                bitOffset = option.GetBitOffset() + option.GetBitCount();
+                ++order;
+                m_layout->AddShaderOption(option);
+            }
+            m_layout->Finalize();
+        }
+
+        void BuildVariantList(uint32_t variantCount, AZ::SimpleLcgRandom& random)
+        {
+            const auto& options = m_layout->GetShaderOptions();
+            AZStd::unordered_set<AZStd::string> uniqueVariants;
+            uint32_t stableId = 1;
+            while (m_variantInfos.size() < variantCount)
+            {
+                AZ::RPI::ShaderVariantListSourceData::VariantInfo variantInfo;
+                AZStd::string variantString;
+                const uint32_t bakedOptionCount = 1 + random.GetRandom() % aznumeric_cast<uint32_t>(options.size());
+                for (uint32_t optionIndex = 0; optionIndex < bakedOptionCount; ++optionIndex)
+                {
+                    const uint32_t value = random.GetRandom() % options[optionIndex].GetValuesCount();
+                    variantInfo.m_options[options[optionIndex].GetName()] = GetValueName(value);
+                    variantString += AZStd::string::format("%u,", value);
+                }
+                if (uniqueVariants.insert(variantString).second)
+                {
+                    variantInfo.m_stableId = stableId++;
+                    m_variantInfos.push_back(variantInfo);
+                }
+            }
+        }
+
+        void BuildRequests(AZ::SimpleLcgRandom& random)
+        {
+            AZ::RPI::ShaderOptionGroup shaderOptionGroup(m_layout);
+            const auto& options = m_layout->GetShaderOptions();
+            for (uint32_t requestIndex = 0; requestIndex < RequestCount; ++requestIndex)
+            {
+                for (uint32_t optionIndex = 0; optionIndex < options.size(); ++optionIndex)
+                {
+                    const uint32_t value = random.GetRandom() % options[optionIndex].GetValuesCount();
+                    shaderOptionGroup.SetValue(AZ::RPI::ShaderOptionIndex{ optionIndex }, AZ::RPI::ShaderOptionValue{ value });
+                }
+                m_requests.push_back(shaderOptionGroup.GetShaderVariantId());
+            }
+        }
+    };
+
+    // Every request walks the tree, as the first request for each key does
+    BENCHMARK_DEFINE_F(ShaderVariantTreeBenchmark, FindVariantStableId_TreeSearch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> treeAsset = CreateTree();
+            state.ResumeTiming();
+
+            for (const AZ::RPI::ShaderVariantId& request : m_requests)
+            {
+                benchmark::DoNotOptimize(treeAsset->FindVariantStableId(m_layout.get(), request));
+            }
+
+            state.PauseTiming();
+            treeAsset.Reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * RequestCount);
+    }
+
+    // Every request is served by the search index, as in steady state when draw packets are rebuilt
+    BENCHMARK_DEFINE_F(ShaderVariantTreeBenchmark, FindVariantStableId_Indexed)(benchmark::State& state)
+    {
+        AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> treeAsset = CreateTree();
+        for (const AZ::RPI::ShaderVariantId& request : m_requests)
+        {
+            treeAsset->FindVariantStableId(m_layout.get(), request);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::RPI::ShaderVariantId& request : m_requests)
+            {
+                benchmark::DoNotOptimize(treeAsset->FindVariantStableId(m_layout.get(), request));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * RequestCount);
+    }
+
+    // The per-shader lookup cache in front of the tree, as used by Shader::GetVariant
+    BENCHMARK_DEFINE_F(ShaderVariantTreeBenchmark, ShaderVariantLookupCache_Find)(benchmark::State& state)
+    {
+        AZ::RPI::ShaderVariantLookupCache cache;
+        AZ::RPI::ShaderVariant variant;
+        for (const AZ::RPI::ShaderVariantId& request : m_requests)
+        {
+            cache.Insert(request, &variant);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::RPI::ShaderVariantId& request : m_requests)
+            {
+                benchmark::DoNotOptimize(cache.Find(request));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * RequestCount);
+    }
+
+    BENCHMARK_REGISTER_F(ShaderVariantTreeBenchmark, FindVariantStableId_TreeSearch)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(ShaderVariantTreeBenchmark, FindVariantStableId_Indexed)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(ShaderVariantTreeBenchmark, ShaderVariantLookupCache_Find)->Arg(256)->Unit(benchmark::kMicrosecond);
+#endif
 }
 
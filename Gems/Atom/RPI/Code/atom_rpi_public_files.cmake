@@ -109,6 +109,7 @@ set(FILES
     Include/Atom/RPI.Public/Shader/ShaderSystem.h
     Include/Atom/RPI.Public/Shader/ShaderSystemInterface.h
     Include/Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h
+    Include/Atom/RPI.Public/Shader/ShaderVariantLookupCache.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystem.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystemInterface.h
     Include/Atom/RPI.Public/GpuQuery/GpuQueryTypes.h
@@ -197,6 +198,7 @@ set(FILES
     Source/RPI.Public/Shader/ShaderResourceGroupPool.cpp
     Source/RPI.Public/Shader/ShaderSystem.cpp
     Source/RPI.Public/Shader/ShaderVariantAsyncLoader.cpp
+    Source/RPI.Public/Shader/ShaderVariantLookupCache.cpp
     Source/RPI.Public/ColorManagement/GeneratedTransforms/ColorConversionConstants.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/LinearSrgb_To_AcesCg.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/AcesCg_To_LinearSrgb.inl
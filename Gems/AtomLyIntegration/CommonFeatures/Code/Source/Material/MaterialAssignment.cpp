@@ -189,8 +189,20 @@ namespace AZ
                 }
             }
 
-            // Return true if there is nothing to compile, meaning no properties changed, or the compile succeeded
-            return !m_materialInstance->NeedsCompile() || m_materialInstance->Compile();
+            // Return true if there is nothing to compile, meaning no properties changed, or the compile was queued. The material
+            // system compiles the queued materials together before the next simulation tick.
+            if (!m_materialInstance->NeedsCompile())
+            {
+                return true;
+            }
+
+            if (!m_materialInstance->CanCompile())
+            {
+                return false;
+            }
+
+            m_materialInstance->QueueCompile();
+            return true;
         }
 
         AZStd::string MaterialAssignment::ToString() const
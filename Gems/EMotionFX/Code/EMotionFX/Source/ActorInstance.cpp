@@ -221,6 +221,13 @@ namespace EMotionFX
 
     // update the transformation data
     void ActorInstance::UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms, bool sampleMotions)
+    {
+        UpdatePose(timePassedInSeconds, updateJointTransforms, sampleMotions);
+        UpdateSkinningMatricesAndBounds(timePassedInSeconds, updateJointTransforms);
+    }
+
+    // update the motion system or anim graph, the joint transforms and the attachments
+    void ActorInstance::UpdatePose(float timePassedInSeconds, bool updateJointTransforms, bool sampleMotions)
     {
         // Update the LOD level in case a change was requested.
         UpdateLODLevel();
@@ -255,20 +262,7 @@ namespace EMotionFX
 
             // perform forward kinematics etc
             UpdateWorldTransform();
-            UpdateSkinningMatrices();
             UpdateAttachments(); // update the attachment parent matrices
-
-            // update the bounds when needed
-            if (GetBoundsUpdateEnabled())
-            {
-                m_boundsUpdatePassedTime += timePassedInSeconds;
-                if (m_boundsUpdatePassedTime >= m_boundsUpdateFrequency)
-                {
-                    UpdateBounds(m_lodLevel, m_boundsUpdateType, m_boundsUpdateItemFreq);
-                    m_boundsUpdatePassedTime = 0.0f;
-                }
-            }
-
             return;
         } // if the recorder is in playback mode and we recorded this actor instance
 
@@ -305,18 +299,12 @@ namespace EMotionFX
             // when the actor instance isn't visible, we don't want to do more things
             if (!updateJointTransforms)
             {
-                if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
-                {
-                    UpdateBounds(m_lodLevel, m_boundsUpdateType);
-                }
-
                 return;
             }
 
             m_transformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
 
-            UpdateSkinningMatrices();
             UpdateAttachments();
         }
         else // we are a skin attachment
@@ -344,19 +332,34 @@ namespace EMotionFX
             // when the actor instance isn't visible, we don't want to do more things
             if (!updateJointTransforms)
             {
-                if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
-                {
-                    UpdateBounds(m_lodLevel, m_boundsUpdateType);
-                }
                 return;
             }
 
             m_selfAttachment->UpdateJointTransforms(*m_transformData->GetCurrentPose());
             m_transformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
-            UpdateSkinningMatrices();
             UpdateAttachments();
         }
+    }
+
+    // update the skinning matrices and bounds from the pose calculated by UpdatePose()
+    void ActorInstance::UpdateSkinningMatricesAndBounds(float timePassedInSeconds, bool updateJointTransforms)
+    {
+        const Recorder& recorder = GetRecorder();
+        timePassedInSeconds *= GetEMotionFX().GetGlobalSimulationSpeed();
+
+        // the recorder playback always outputs the joint transforms, so only skip the skinning when the motion system didn't
+        const bool isRecorderPlayback = recorder.GetIsInPlayMode() && recorder.GetHasRecorded(this);
+        if (!isRecorderPlayback && !updateJointTransforms)
+        {
+            if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
+            {
+                UpdateBounds(m_lodLevel, m_boundsUpdateType);
+            }
+            return;
+        }
+
+        UpdateSkinningMatrices();
 
         // update the bounds when needed
         if (GetBoundsUpdateEnabled())
@@ -572,6 +575,18 @@ namespace EMotionFX
     // set the attachment matrices
     void ActorInstance::UpdateAttachments()
     {
+        // Skin attachments read the model space transforms of our pose while updating their own pose, which the schedulers can run
+        // at the same time as our skinning matrix and bounds update. Those lazily calculate the model space transforms too, so
+        // calculate all of them now, after which the pose is only read.
+        const bool hasSkinAttachments = AZStd::any_of(m_attachments.begin(), m_attachments.end(), [](const Attachment* attachment)
+        {
+            return attachment->GetIsInfluencedByMultipleJoints();
+        });
+        if (hasSkinAttachments)
+        {
+            m_transformData->GetCurrentPose()->ForceUpdateFullModelSpacePose();
+        }
+
         for (Attachment* attachment : m_attachments)
         {
             attachment->Update();
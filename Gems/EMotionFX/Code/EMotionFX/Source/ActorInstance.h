@@ -279,6 +279,25 @@ namespace EMotionFX
          */
         void UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true);
 
+        /**
+         * The first half of UpdateTransformations(). Updates the motion system or anim graph, outputs the joint transforms and updates the attachments.
+         * Attachments read the pose of their parent, so this has to finish for the parent before it is called on any of its attachments.
+         * @param timePassedInSeconds The time passed in seconds, since the last frame or update.
+         * @param updateJointTransforms When set to true the joint transformations will be calculated by calculating the animation graph output for example.
+         * @param sampleMotions When set to true motions will be sampled, or whole anim graphs if using those.
+         */
+        void UpdatePose(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true);
+
+        /**
+         * The second half of UpdateTransformations(). Updates the skinning matrices and the bounds from the pose calculated by UpdatePose().
+         * This only writes to the data of this actor instance, so it can run at the same time as the pose update of its attachments.
+         * Skin attachments read the pose of this actor instance, which is why UpdatePose() calculates all of its model space transforms
+         * up front when there are any, so that neither side lazily updates the shared pose.
+         * @param timePassedInSeconds The time passed in seconds, since the last frame or update.
+         * @param updateJointTransforms The same value that has been passed to UpdatePose().
+         */
+        void UpdateSkinningMatricesAndBounds(float timePassedInSeconds, bool updateJointTransforms = true);
+
         /**
          * Update/Process the mesh deformers.
          * This will apply skinning and morphing deformations to the meshes used by the actor instance.
@@ -506,6 +506,23 @@ namespace EMotionFX
     }
 
 
+    // add thread datas for the extra threads, keeping the existing ones
+    void EMotionFXManager::GrowNumThreads(uint32 numThreads)
+    {
+        const uint32 oldNumThreads = aznumeric_cast<uint32>(m_threadDatas.size());
+        if (numThreads <= oldNumThreads)
+        {
+            return;
+        }
+
+        m_threadDatas.resize(numThreads);
+        for (uint32 i = oldNumThreads; i < numThreads; ++i)
+        {
+            m_threadDatas[i] = ThreadData::Create(i);
+        }
+    }
+
+
     // shrink internal pools to minimize memory usage
     void EMotionFXManager::ShrinkPools()
     {
@@ -285,6 +285,14 @@ namespace EMotionFX
          */
         MCORE_INLINE size_t GetNumThreads() const                                   { return m_threadDatas.size(); }
 
+        /**
+         * Make sure there is thread data for at least the given number of threads.
+         * Unlike changing the number of threads, the existing thread datas and their pose pools are kept as they are.
+         * This must not be called while other threads are using the thread datas.
+         * @param numThreads The minimum number of threads to have thread data for.
+         */
+        void GrowNumThreads(uint32 numThreads);
+
         /**
          * Shrink the memory pools, to reduce memory usage.
          * When you create many actor instances and destroy them later again, the pools have been grown internally, which increases memory usage.
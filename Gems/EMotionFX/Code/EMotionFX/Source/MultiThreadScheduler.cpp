@@ -16,10 +16,13 @@
 #include <EMotionFX/Source/Allocators.h>
 #include <MCore/Source/LogManager.h>
 
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 
 namespace EMotionFX
@@ -53,6 +56,7 @@ namespace EMotionFX
     {
         Lock();
         m_steps.clear();
+        m_taskGraphDirty = true;
         Unlock();
     }
 
@@ -146,6 +150,48 @@ namespace EMotionFX
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
 
+        const auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            ExecuteTaskGraph(timePassedInSeconds);
+        }
+        else
+        {
+            ExecuteJobs(timePassedInSeconds);
+        }
+    }
+
+
+    // update the stats and the motion sampling timer, returns whether the motions should be sampled
+    bool MultiThreadScheduler::PrepareActorInstanceUpdate(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        return sampleMotions;
+    }
+
+
+    // execute the schedule step by step, using a batch of jobs per step
+    void MultiThreadScheduler::ExecuteJobs(float timePassedInSeconds)
+    {
         for (const ScheduleStep& currentStep : m_steps)
         {
             if (currentStep.m_actorInstances.empty())
@@ -170,28 +216,10 @@ namespace EMotionFX
                     const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
                     actorInstance->SetThreadIndex(threadIndex);
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        m_numVisible.Increment();
-                    }
-
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
+                    const bool sampleMotions = PrepareActorInstanceUpdate(actorInstance, timePassedInSeconds);
 
                     // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    actorInstance->UpdateTransformations(timePassedInSeconds, actorInstance->GetIsVisible(), sampleMotions);
                 }, true, jobContext);
 
                 job->SetDependent(&jobCompletion);               
@@ -205,6 +233,106 @@ namespace EMotionFX
     }
 
 
+    // execute the schedule as a task graph
+    void MultiThreadScheduler::ExecuteTaskGraph(float timePassedInSeconds)
+    {
+        if (m_taskGraphDirty)
+        {
+            BuildTaskGraph();
+        }
+
+        // The tasks use the index of the task worker they run on to pick the thread data with the pose pools, so make sure
+        // there is one for every task worker. Existing thread datas are kept and this happens before any task is running.
+        GetEMotionFX().GrowNumThreads(AZ::TaskExecutor::Instance().GetThreadCount());
+
+        m_taskGraphTimePassedInSeconds = timePassedInSeconds;
+
+        AZ::TaskGraphEvent finishedEvent{ "MultiThreadScheduler Wait" };
+        m_taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+
+    // rebuild the task graph from the schedule steps
+    void MultiThreadScheduler::BuildTaskGraph()
+    {
+        m_taskGraph.Reset();
+        m_taskGraphDirty = false;
+
+        size_t numActorInstances = 0;
+        for (const ScheduleStep& step : m_steps)
+        {
+            numActorInstances += step.m_actorInstances.size();
+        }
+
+        AZStd::vector<AZ::TaskToken> poseTasks;
+        poseTasks.reserve(numActorInstances);
+        AZStd::unordered_map<const ActorInstance*, size_t> poseTaskIndices;
+        poseTaskIndices.reserve(numActorInstances);
+
+        const AZ::TaskDescriptor poseTaskDescriptor{ "ActorInstance UpdatePose", "Animation" };
+        const AZ::TaskDescriptor skinningTaskDescriptor{ "ActorInstance UpdateSkinningMatricesAndBounds", "Animation" };
+        for (const ScheduleStep& step : m_steps)
+        {
+            for (ActorInstance* actorInstance : step.m_actorInstances)
+            {
+                // The pose task samples the motions or evaluates the anim graph, outputs the joint transforms and updates the attachment transforms.
+                // The enabled state is checked when executing, so that enabling or disabling an actor instance doesn't require a rebuild.
+                AZ::TaskToken poseTask = m_taskGraph.AddTask(poseTaskDescriptor, [this, actorInstance]()
+                {
+                    if (!actorInstance->GetIsEnabled())
+                    {
+                        return;
+                    }
+
+                    const int32_t workerIndex = AZ::TaskExecutor::Instance().GetCurrentWorkerIndex();
+                    AZ_Assert(workerIndex >= 0, "Expected the actor instance update task to run on a task worker.");
+                    actorInstance->SetThreadIndex(static_cast<AZ::u32>(AZStd::max(workerIndex, 0)));
+
+                    const bool sampleMotions = PrepareActorInstanceUpdate(actorInstance, m_taskGraphTimePassedInSeconds);
+                    actorInstance->UpdatePose(m_taskGraphTimePassedInSeconds, actorInstance->GetIsVisible(), sampleMotions);
+                    m_numUpdated.Increment();
+                });
+
+                // The skinning task only writes to the actor instance itself, so it can run while its attachments are updating their poses.
+                // Skin attachments read its pose, which UpdatePose fully calculates beforehand so that it is only read from then on.
+                AZ::TaskToken skinningTask = m_taskGraph.AddTask(skinningTaskDescriptor, [this, actorInstance]()
+                {
+                    if (!actorInstance->GetIsEnabled())
+                    {
+                        return;
+                    }
+
+                    actorInstance->UpdateSkinningMatricesAndBounds(m_taskGraphTimePassedInSeconds, actorInstance->GetIsVisible());
+                });
+
+                poseTask.Precedes(skinningTask);
+                poseTaskIndices.emplace(actorInstance, poseTasks.size());
+                poseTasks.emplace_back(poseTask);
+            }
+        }
+
+        // Attachments read the pose of the actor instance they are attached to and get their transform updated by it.
+        for (const ScheduleStep& step : m_steps)
+        {
+            for (const ActorInstance* actorInstance : step.m_actorInstances)
+            {
+                const ActorInstance* attachedTo = actorInstance->GetAttachedTo();
+                if (!attachedTo)
+                {
+                    continue;
+                }
+
+                const auto parentIterator = poseTaskIndices.find(attachedTo);
+                if (parentIterator != poseTaskIndices.end())
+                {
+                    poseTasks[parentIterator->second].Precedes(poseTasks[poseTaskIndices[actorInstance]]);
+                }
+            }
+        }
+    }
+
+
     // find the next free spot in the schedule
     bool MultiThreadScheduler::FindNextFreeItem(ActorInstance* actorInstance, size_t startStep, size_t* outStepNr)
     {
@@ -270,6 +398,7 @@ namespace EMotionFX
         // add the actor instance and its dependencies
         m_steps[ outStep ].m_actorInstances.reserve(GetEMotionFX().GetNumThreads());
         m_steps[ outStep ].m_actorInstances.emplace_back(instance);
+        m_taskGraphDirty = true;
         AddDependenciesToStep(instance, &m_steps[outStep]);
 
         // recursively add all attachments too
@@ -304,6 +433,8 @@ namespace EMotionFX
             // and if so, reconstruct the dependencies of this step
             if (step.m_actorInstances.size() < numActorInstancesPreRemove)
             {
+                m_taskGraphDirty = true;
+
                 // clear the dependencies (but don't delete the memory)
                 step.m_dependencies.clear();
 
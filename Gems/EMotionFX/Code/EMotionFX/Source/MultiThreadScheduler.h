@@ -13,6 +13,7 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace EMotionFX
 {
@@ -28,6 +29,9 @@ namespace EMotionFX
      * If however you wish to let EMotion FX only use one single CPU, or if the target system ahs only one CPU, it is recommended
      * to use the SingleThreadScheduler class instead, as that will be faster in that specific case.
      * Significant performance gains can be achieved by using this scheduler on multi-processor or multi-core systems though.
+     * When the task graph is active (cl_activateTaskGraph), the schedule is executed as a task graph instead of one job batch per step.
+     * Every actor instance gets a pose task and a skinning task, and an attachment only waits for the pose task of the actor instance it is attached to,
+     * rather than for the whole previous step.
      */
     class EMFX_API MultiThreadScheduler
         : public ActorUpdateScheduler
@@ -126,6 +130,9 @@ namespace EMotionFX
         AZStd::vector< ScheduleStep >    m_steps;         /**< An array of update steps, that together form the schedule. */
         float                           m_cleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           m_mutex;
+        AZ::TaskGraph                   m_taskGraph{ "MultiThreadScheduler" };   /**< The update tasks of all scheduled actor instances, retained across frames. */
+        float                           m_taskGraphTimePassedInSeconds = 0.0f;  /**< The time passed that the tasks of the task graph read when executing. */
+        bool                            m_taskGraphDirty = true;                /**< Set when the schedule changed and the task graph has to be rebuilt. */
 
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
@@ -166,5 +173,32 @@ namespace EMotionFX
          * @param outStep The scheduler step to add the dependencies to.
          */
         void AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep);
+
+        /**
+         * Execute the schedule step by step, where all actor instances inside a step are updated by parallel jobs.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteJobs(float timePassedInSeconds);
+
+        /**
+         * Execute the schedule using the task graph, rebuilding it first in case the schedule changed.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteTaskGraph(float timePassedInSeconds);
+
+        /**
+         * Rebuild the task graph from the schedule steps.
+         * Each actor instance gets a pose task that is followed by its skinning task. The pose task of an attachment follows
+         * the pose task of the actor instance it is attached to.
+         */
+        void BuildTaskGraph();
+
+        /**
+         * Update the statistics and the motion sampling timer of an actor instance that is about to be updated.
+         * @param actorInstance The actor instance to prepare.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         * @result Returns true when the motions of the actor instance should be sampled during this update.
+         */
+        bool PrepareActorInstanceUpdate(ActorInstance* actorInstance, float timePassedInSeconds);
     };
 }   // namespace EMotionFX
@@ -6,15 +6,32 @@
  *
  */
 
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/AttachmentSkin.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/MotionSet.h>
 #include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/JackGraphFixture.h>
 #include <Tests/SystemComponentFixture.h>
 #include <Tests/TestAssetCode/JackActor.h>
 #include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/TestMotionAssets.h>
 
 namespace EMotionFX
 {
@@ -44,4 +61,266 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    class TaskGraphActiveToggle
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override { return m_isActive; }
+
+        bool m_isActive = false;
+    };
+
+    // A crowd of walking characters, each with a second actor instance attached to one of its joints.
+    class MultiThreadSchedulerTaskGraphFixture
+        : public JackGraphFixture
+    {
+    public:
+        void SetUp() override
+        {
+            JackGraphFixture::SetUp();
+
+            m_taskExecutor = aznew AZ::TaskExecutor(4);
+            AZ::TaskExecutor::SetInstance(m_taskExecutor); // SetInstance is a null-op if there is already a default instance set
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+        }
+
+        void TearDown() override
+        {
+            DestroyCrowd();
+
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+            if (&AZ::TaskExecutor::Instance() == m_taskExecutor) // if this test created the default instance unset it before destroying it
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_taskExecutor);
+
+            JackGraphFixture::TearDown();
+        }
+
+        void ConstructGraph() override
+        {
+            JackGraphFixture::ConstructGraph();
+
+            MotionSet::MotionEntry* motionEntry = aznew MotionSet::MotionEntry();
+            motionEntry->SetMotion(TestMotionAssets::GetJackWalkForward());
+            m_motionSet->AddMotionEntry(motionEntry);
+            m_motionSet->SetMotionEntryId(motionEntry, "jack_walk_forward_aim_zup");
+
+            AnimGraphMotionNode* motionNode = aznew AnimGraphMotionNode();
+            motionNode->AddMotionId("jack_walk_forward_aim_zup");
+            motionNode->SetLoop(true);
+            m_animGraph->GetRootStateMachine()->AddChildNode(motionNode);
+            m_animGraph->GetRootStateMachine()->SetEntryState(motionNode);
+        }
+
+        void CreateCrowd(size_t numCharacters)
+        {
+            m_attachToJointIndex = m_actor->GetSkeleton()->FindNodeByName("r_ball")->GetNodeIndex();
+
+            for (size_t i = 0; i < numCharacters; ++i)
+            {
+                ActorInstance* character = ActorInstance::Create(m_actor.get());
+                character->SetLocalSpacePosition(AZ::Vector3(static_cast<float>(i), 0.0f, 0.0f));
+                AnimGraphInstance* animGraphInstance = AnimGraphInstance::Create(m_animGraph.get(), character, m_motionSet);
+                character->SetAnimGraphInstance(animGraphInstance);
+
+                ActorInstance* attachment = ActorInstance::Create(m_actor.get());
+                character->AddAttachment(AttachmentNode::Create(character, m_attachToJointIndex, attachment));
+
+                m_characters.emplace_back(character);
+                m_attachments.emplace_back(attachment);
+            }
+        }
+
+        void DestroyCrowd()
+        {
+            for (ActorInstance* attachment : m_attachments)
+            {
+                attachment->Destroy();
+            }
+            m_attachments.clear();
+
+            for (ActorInstance* character : m_characters)
+            {
+                character->Destroy();
+            }
+            m_characters.clear();
+        }
+
+        // The joint transforms, skinning matrices and attachment transform of every character after updating the crowd.
+        struct CrowdState
+        {
+            AZStd::vector<Transform> m_jointTransforms;
+            AZStd::vector<AZ::Matrix3x4> m_skinningMatrices;
+            AZStd::vector<Transform> m_attachmentTransforms;
+        };
+
+        CrowdState UpdateCrowd(size_t numCharacters, size_t numFrames, bool useTaskGraph)
+        {
+            m_taskGraphActive.m_isActive = useTaskGraph;
+            CreateCrowd(numCharacters);
+
+            for (size_t frame = 0; frame < numFrames; ++frame)
+            {
+                GetEMotionFX().Update(1.0f / 30.0f);
+            }
+
+            CrowdState result;
+            for (size_t i = 0; i < numCharacters; ++i)
+            {
+                const TransformData* transformData = m_characters[i]->GetTransformData();
+                const Pose* pose = transformData->GetCurrentPose();
+                for (size_t jointIndex = 0; jointIndex < transformData->GetNumTransforms(); ++jointIndex)
+                {
+                    result.m_jointTransforms.emplace_back(pose->GetWorldSpaceTransform(jointIndex));
+                    result.m_skinningMatrices.emplace_back(transformData->GetSkinningMatrices()[jointIndex]);
+                }
+                result.m_attachmentTransforms.emplace_back(m_attachments[i]->GetWorldSpaceTransform());
+            }
+
+            DestroyCrowd();
+            return result;
+        }
+
+    protected:
+        AZ::TaskExecutor* m_taskExecutor = nullptr;
+        TaskGraphActiveToggle m_taskGraphActive;
+        AZStd::vector<ActorInstance*> m_characters;
+        AZStd::vector<ActorInstance*> m_attachments;
+        size_t m_attachToJointIndex = 0;
+    };
+
+    TEST_F(MultiThreadSchedulerTaskGraphFixture, TaskGraphMatchesJobs)
+    {
+        const size_t numCharacters = 16;
+        const size_t numFrames = 10;
+        const CrowdState jobsResult = UpdateCrowd(numCharacters, numFrames, /*useTaskGraph=*/false);
+        const CrowdState taskGraphResult = UpdateCrowd(numCharacters, numFrames, /*useTaskGraph=*/true);
+
+        ASSERT_EQ(jobsResult.m_jointTransforms.size(), taskGraphResult.m_jointTransforms.size());
+        for (size_t i = 0; i < jobsResult.m_jointTransforms.size(); ++i)
+        {
+            EXPECT_THAT(taskGraphResult.m_jointTransforms[i], IsClose(jobsResult.m_jointTransforms[i]));
+            EXPECT_TRUE(taskGraphResult.m_skinningMatrices[i].IsClose(jobsResult.m_skinningMatrices[i], 0.001f));
+        }
+
+        ASSERT_EQ(jobsResult.m_attachmentTransforms.size(), taskGraphResult.m_attachmentTransforms.size());
+        for (size_t i = 0; i < jobsResult.m_attachmentTransforms.size(); ++i)
+        {
+            EXPECT_THAT(taskGraphResult.m_attachmentTransforms[i], IsClose(jobsResult.m_attachmentTransforms[i]));
+        }
+    }
+
+    TEST_F(MultiThreadSchedulerTaskGraphFixture, TaskGraphUpdatesAttachmentsAfterTheirParent)
+    {
+        m_taskGraphActive.m_isActive = true;
+        CreateCrowd(32);
+
+        for (size_t frame = 0; frame < 10; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 30.0f);
+
+            // The attachment has to follow the joint it is attached to within the same frame, not lag behind by one.
+            for (size_t i = 0; i < m_characters.size(); ++i)
+            {
+                const Transform jointTransform = m_characters[i]->GetTransformData()->GetCurrentPose()->GetWorldSpaceTransform(m_attachToJointIndex);
+                EXPECT_THAT(m_attachments[i]->GetWorldSpaceTransform(), IsClose(jointTransform));
+            }
+        }
+    }
+
+    TEST_F(MultiThreadSchedulerTaskGraphFixture, TaskGraphUpdatesSkinAttachmentsFromTheParentPose)
+    {
+        m_taskGraphActive.m_isActive = true;
+
+        // Skin attachments read the model space pose of their parent while the parent updates its skinning matrices and bounds.
+        for (size_t i = 0; i < 32; ++i)
+        {
+            ActorInstance* character = ActorInstance::Create(m_actor.get());
+            character->SetLocalSpacePosition(AZ::Vector3(static_cast<float>(i), 0.0f, 0.0f));
+            AnimGraphInstance* animGraphInstance = AnimGraphInstance::Create(m_animGraph.get(), character, m_motionSet);
+            character->SetAnimGraphInstance(animGraphInstance);
+
+            ActorInstance* attachment = ActorInstance::Create(m_actor.get());
+            character->AddAttachment(AttachmentSkin::Create(character, attachment));
+
+            m_characters.emplace_back(character);
+            m_attachments.emplace_back(attachment);
+        }
+
+        for (size_t frame = 0; frame < 10; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 30.0f);
+
+            // Both use the same actor, so every joint of the skin attachment follows the same joint of its parent.
+            for (size_t i = 0; i < m_characters.size(); ++i)
+            {
+                const Pose* characterPose = m_characters[i]->GetTransformData()->GetCurrentPose();
+                const Pose* attachmentPose = m_attachments[i]->GetTransformData()->GetCurrentPose();
+                for (size_t jointIndex = 0; jointIndex < m_actor->GetNumNodes(); ++jointIndex)
+                {
+                    EXPECT_THAT(attachmentPose->GetModelSpaceTransform(jointIndex), IsClose(characterPose->GetModelSpaceTransform(jointIndex)));
+                }
+            }
+        }
+    }
+
+    TEST_F(MultiThreadSchedulerTaskGraphFixture, TaskGraphRebuildsAfterScheduleChange)
+    {
+        m_taskGraphActive.m_isActive = true;
+        ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+
+        CreateCrowd(8);
+        GetEMotionFX().Update(1.0f / 30.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 17) << "Expected the fixture actor instance plus eight characters and their attachments.";
+
+        m_attachments.back()->Destroy();
+        m_attachments.pop_back();
+        m_characters.back()->Destroy();
+        m_characters.pop_back();
+        GetEMotionFX().Update(1.0f / 30.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 15) << "Expected the destroyed character and its attachment to be gone from the task graph.";
+
+        m_characters.front()->SetIsEnabled(false);
+        GetEMotionFX().Update(1.0f / 30.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 14) << "Expected the disabled character to be skipped.";
+    }
+
+    // Compares the update time of a large crowd between the step based jobs and the task graph.
+    // Disabled by default, as it only reports timings and takes a while to run.
+    TEST_F(MultiThreadSchedulerTaskGraphFixture, DISABLED_CrowdUpdatePerformance)
+    {
+        const size_t numFrames = 300;
+        for (const size_t numCharacters : { 512, 1024 })
+        {
+            for (const bool useTaskGraph : { false, true })
+            {
+                m_taskGraphActive.m_isActive = useTaskGraph;
+                CreateCrowd(numCharacters);
+
+                // Warm up the pose pools and the task graph.
+                GetEMotionFX().Update(1.0f / 30.0f);
+
+                float totalTime = 0.0f;
+                float worstTime = 0.0f;
+                AZ::Debug::Timer timer;
+                for (size_t frame = 0; frame < numFrames; ++frame)
+                {
+                    timer.Stamp();
+                    GetEMotionFX().Update(1.0f / 30.0f);
+                    const float frameTime = timer.GetDeltaTimeInSeconds();
+                    totalTime += frameTime;
+                    worstTime = AZStd::max(worstTime, frameTime);
+                }
+
+                printf("- %s, %zu characters with an attachment each:\n", useTaskGraph ? "Task graph" : "Jobs", numCharacters);
+                printf("    Mean Frame:                      %.4f ms\n", totalTime / static_cast<float>(numFrames) * 1000.0f);
+                printf("    Worst Frame:                     %.4f ms\n", worstTime * 1000.0f);
+
+                DestroyCrowd();
+            }
+        }
+    }
 } // namespace EMotionFX
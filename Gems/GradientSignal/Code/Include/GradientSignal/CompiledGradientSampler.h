@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <GradientSignal/GradientEvaluationPlan.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
+
+namespace GradientSignal
+{
+    //! Queries a GradientSampler through a GradientEvaluationPlan, for callers that repeatedly query large regions of the same gradient.
+    //! The plan is compiled on the first query and recompiled on the query after the sampled gradient reports a change through the
+    //! DependencyNotificationBus. Gradient components forward changes from their inputs, so listening to the sampled gradient
+    //! covers the whole graph.
+    //! GetValues() can be called from multiple threads at the same time.
+    class CompiledGradientSampler final
+        : private LmbrCentral::DependencyNotificationBus::Handler
+        , private AZ::EntityBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompiledGradientSampler, AZ::SystemAllocator);
+
+        CompiledGradientSampler() = default;
+        explicit CompiledGradientSampler(const GradientSampler& sampler);
+        ~CompiledGradientSampler();
+        AZ_DISABLE_COPY_MOVE(CompiledGradientSampler);
+
+        //! Changes the sampler to query. The plan is recompiled on the next query.
+        void SetGradientSampler(const GradientSampler& sampler);
+
+        //! Generates the same values as GradientSampler::GetValues() on the current sampler.
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        //! Forces the plan to be recompiled on the next query.
+        void Invalidate();
+
+        //! Number of stages in the current plan that don't go through the GradientRequestBus.
+        size_t GetFusedStageCount() const;
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        // DependencyNotificationBus
+        void OnCompositionChanged() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // EntityBus
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+
+        void CompileIfNeeded() const;
+
+        GradientSampler m_sampler;
+        mutable GradientEvaluationPlan m_plan;
+        mutable AZStd::shared_mutex m_planMutex;
+        mutable AZStd::atomic_bool m_planDirty{ true };
+    };
+} // namespace GradientSignal
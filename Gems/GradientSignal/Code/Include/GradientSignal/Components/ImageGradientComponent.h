@@ -22,6 +22,7 @@
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Ebuses/ImageGradientRequestBus.h>
 #include <GradientSignal/Ebuses/ImageGradientModificationBus.h>
+#include <GradientSignal/ImageGradientMipPyramid.h>
 #include <GradientSignal/Util.h>
 
 namespace GradientSignal
@@ -100,6 +101,9 @@ namespace GradientSignal
         float m_scaleRangeMax = 1.0f;
         //! Which sampling method to use for querying gradient values (Point = exact image data, Bilinear = interpolated image data)
         SamplingType m_samplingType = SamplingType::Point;
+        //! Answer bulk queries that are spaced further apart than the image pixels from a downsampled copy of the image.
+        //! While the image is being painted, queries use the full resolution image and the copy is rebuilt when painting ends.
+        bool m_useFootprintMips = false;
 
         // Non-serialized properties used by the Editor for display purposes.
 
@@ -172,6 +176,9 @@ namespace GradientSignal
 
         bool ImageIsModified() const;
 
+        //! Returns the number of bytes used by the downsampled image levels used for coarse bulk queries.
+        size_t GetFootprintMipsMemoryUsage() const;
+
     protected:
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> GetImageAsset() const;
         void SetImageAsset(const AZ::Data::Asset<AZ::RPI::StreamingImageAsset>& asset);
@@ -195,6 +202,13 @@ namespace GradientSignal
         void GetValuesInternal(SamplingType samplingType, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
         float GetValueFromImageData(SamplingType samplingType, const AZ::Vector3& uvw, float defaultValue) const;
 
+        //! Rebuild or clear the downsampled image levels, based on the current configuration and image data.
+        void UpdateFootprintMips();
+        //! Returns the downsampled image level that matches the spacing of the query positions, or 0 for the full resolution image.
+        size_t SelectFootprintMipLevel(AZStd::span<const AZ::Vector3> positions) const;
+        void GetValuesFromFootprintMip(
+            size_t mipLevel, SamplingType samplingType, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
         //! Read the pixel from our image data at the given XY coordinates.
         //! This will read from image modification buffer if it exists or else from the image asset, using the component's
         //! mip and channel settings.
@@ -258,6 +272,9 @@ namespace GradientSignal
         AZ::RHI::ImageDescriptor m_imageDescriptor;
         AZStd::span<const uint8_t> m_imageData;
 
+        //! Downsampled copies of the image data, used for bulk queries that are much coarser than the image pixels.
+        ImageGradientMipPyramid m_footprintMips;
+
         //! Temporary buffer for runtime modifications of the image data.
         AZStd::vector<float> m_modifiedImageData;
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <GradientSignal/GradientSampler.h>
+
+namespace GradientSignal
+{
+    //! A gradient graph flattened into a list of stages that can be evaluated without going through the GradientRequestBus
+    //! for every gradient in the chain.
+    //! Compile() walks the gradient references starting at a GradientSampler. Modifier gradients with a known, position-independent
+    //! operation (Levels, Invert, Threshold, Posterize, Smooth Step, Mixed, Reference, Constant) are fused into the plan, and every
+    //! other gradient becomes a leaf that is queried through the GradientRequestBus. The plan evaluates the positions in tiles,
+    //! using a fixed set of stack buffers for the intermediate values, so a query doesn't allocate per stage.
+    //! A plan is a snapshot of the gradient settings at the time it was compiled; see CompiledGradientSampler for a wrapper that
+    //! recompiles it whenever the gradient graph changes.
+    class GradientEvaluationPlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientEvaluationPlan, AZ::SystemAllocator);
+
+        //! Number of positions evaluated by every stage before moving to the next stage.
+        static constexpr size_t TileSize = 256;
+        //! Number of intermediate tiles that can be live at the same time. Graphs that need more than this aren't fused.
+        static constexpr size_t MaxStackDepth = 8;
+
+        //! Builds the plan for the gradient graph referenced by the given sampler.
+        //! Graphs that can't be fused (cyclic references or very deep mixes) compile to a plan that forwards to the sampler.
+        static GradientEvaluationPlan Compile(const GradientSampler& sampler);
+
+        //! Generates the same values as GradientSampler::GetValues() on the sampler this plan was compiled from.
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        //! Number of stages that run inside the plan instead of through the GradientRequestBus.
+        size_t GetFusedStageCount() const;
+
+        //! Number of gradients that are still queried through the GradientRequestBus.
+        size_t GetLeafCount() const;
+
+    private:
+        enum class StageType : AZ::u8
+        {
+            Constant,       //!< Push a tile filled with m_params[0].
+            Leaf,           //!< Push the values of the gradient m_leaves[m_index].
+            Sampler,        //!< Push the values of the sampler m_samplers[m_index].
+            InvertInput,    //!< 1 - value
+            Invert,         //!< 1 - clamp(value)
+            Levels,         //!< Levels remap, see GetLevels().
+            Scale,          //!< value * m_params[0]
+            Threshold,      //!< (value <= m_params[0]) ? 0 : 1
+            Posterize,      //!< Band quantization, see PosterizeGradientComponent.
+            SmoothStep,     //!< Smooth step falloff, see SmoothStep::GetSmoothedValue().
+            Mix,            //!< Pop a layer tile and blend it into the tile below, see MixedGradientComponent.
+            Clamp,          //!< clamp(value)
+        };
+
+        struct Stage
+        {
+            StageType m_type = StageType::Constant;
+            //! Mixing operation for Mix stages.
+            AZ::u8 m_operation = 0;
+            //! Index into m_leaves or m_samplers.
+            AZ::u32 m_index = 0;
+            float m_params[6] = {};
+        };
+
+        struct CompileContext;
+
+        bool CompileSampler(const GradientSampler& sampler, bool applyOpacity, CompileContext& context);
+        bool CompileGradient(const AZ::EntityId& gradientId, CompileContext& context);
+        void PushStage(const Stage& stage, CompileContext& context);
+
+        void EvaluateTile(AZStd::span<const AZ::Vector3> positions, float (*registers)[TileSize]) const;
+
+        AZStd::vector<Stage> m_stages;
+        AZStd::vector<AZ::EntityId> m_leaves;
+        AZStd::vector<GradientSampler> m_samplers;
+    };
+} // namespace GradientSignal
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <GradientSignal/GradientTransform.h>
+
+namespace GradientSignal
+{
+    //! A chain of progressively downsampled copies of a single image channel, used by the Image Gradient to answer queries whose
+    //! sample spacing is much larger than the image pixels.
+    //! Level 0 is the source image itself and isn't stored here. Every other level is a 2x2 box filter of the level before it, down
+    //! to a 1x1 level. The values are stored as floats in world orientation, so row 0 is the bottom row of the image.
+    //! The Sample methods process many positions at once and follow the same filtering and wrapping rules as the
+    //! ImageGradientComponent does for the full resolution image.
+    class ImageGradientMipPyramid final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ImageGradientMipPyramid, AZ::SystemAllocator);
+
+        struct Level
+        {
+            AZ::u32 m_width = 0;
+            AZ::u32 m_height = 0;
+            AZStd::vector<float> m_values;
+        };
+
+        //! Reads a level 0 pixel, where y = 0 is the bottom row of the image.
+        using PixelReader = AZStd::function<float(AZ::u32 x, AZ::u32 y)>;
+
+        //! Builds every level below the given level 0 image size.
+        void Build(AZ::u32 width, AZ::u32 height, const PixelReader& getPixelValue);
+        void Clear();
+
+        bool IsEmpty() const;
+
+        //! Returns the number of stored levels. Valid level indices are 1 to GetLevelCount(), inclusive.
+        size_t GetLevelCount() const;
+        const Level& GetLevel(size_t levelIndex) const;
+
+        //! Returns the number of bytes used by all of the stored levels.
+        size_t GetMemoryUsage() const;
+
+        //! Returns the level that best matches queries spaced footprintPixels level 0 pixels apart, which is the coarsest level
+        //! whose pixels are still no bigger than the footprint. Returns 0 when the full resolution image should be used.
+        size_t SelectLevel(float footprintPixels) const;
+
+        //! Sample a level at positions given in that level's pixel space (uv * level size * tiling).
+        //! All of the spans need to be the same size.
+        void SamplePoint(size_t levelIndex, AZStd::span<const float> pixelX, AZStd::span<const float> pixelY,
+            AZStd::span<float> outValues) const;
+        void SampleBilinear(size_t levelIndex, WrappingType wrappingType, AZStd::span<const float> pixelX,
+            AZStd::span<const float> pixelY, AZStd::span<float> outValues) const;
+        void SampleBicubic(size_t levelIndex, WrappingType wrappingType, AZStd::span<const float> pixelX,
+            AZStd::span<const float> pixelY, AZStd::span<float> outValues) const;
+
+    private:
+        //! m_levels[0] holds pyramid level 1.
+        AZStd::vector<Level> m_levels;
+    };
+} // namespace GradientSignal
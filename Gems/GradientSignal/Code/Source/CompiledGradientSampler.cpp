@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/CompiledGradientSampler.h>
+
+namespace GradientSignal
+{
+    CompiledGradientSampler::CompiledGradientSampler(const GradientSampler& sampler)
+    {
+        SetGradientSampler(sampler);
+    }
+
+    CompiledGradientSampler::~CompiledGradientSampler()
+    {
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        AZ::EntityBus::Handler::BusDisconnect();
+    }
+
+    void CompiledGradientSampler::SetGradientSampler(const GradientSampler& sampler)
+    {
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        AZ::EntityBus::Handler::BusDisconnect();
+
+        {
+            AZStd::unique_lock lock(m_planMutex);
+            m_sampler = sampler;
+            m_plan = {};
+            m_planDirty = true;
+        }
+
+        if (m_sampler.m_gradientId.IsValid())
+        {
+            LmbrCentral::DependencyNotificationBus::Handler::BusConnect(m_sampler.m_gradientId);
+            AZ::EntityBus::Handler::BusConnect(m_sampler.m_gradientId);
+        }
+    }
+
+    void CompiledGradientSampler::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        CompileIfNeeded();
+
+        AZStd::shared_lock lock(m_planMutex);
+        m_plan.GetValues(positions, outValues);
+    }
+
+    void CompiledGradientSampler::CompileIfNeeded() const
+    {
+        if (!m_planDirty.load(AZStd::memory_order_acquire))
+        {
+            return;
+        }
+
+        AZStd::unique_lock lock(m_planMutex);
+
+        // Clear the flag before compiling, so a change that arrives while compiling triggers another compile on the next query.
+        if (m_planDirty.exchange(false, AZStd::memory_order_acq_rel))
+        {
+            m_plan = GradientEvaluationPlan::Compile(m_sampler);
+        }
+    }
+
+    void CompiledGradientSampler::Invalidate()
+    {
+        m_planDirty = true;
+    }
+
+    size_t CompiledGradientSampler::GetFusedStageCount() const
+    {
+        CompileIfNeeded();
+
+        AZStd::shared_lock lock(m_planMutex);
+        return m_plan.GetFusedStageCount();
+    }
+
+    void CompiledGradientSampler::OnCompositionChanged()
+    {
+        Invalidate();
+    }
+
+    void CompiledGradientSampler::OnEntityActivated([[maybe_unused]] const AZ::EntityId& entityId)
+    {
+        Invalidate();
+    }
+
+    void CompiledGradientSampler::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& entityId)
+    {
+        Invalidate();
+    }
+} // namespace GradientSignal
@@ -159,7 +159,7 @@ namespace GradientSignal
         if (serialize)
         {
             serialize->Class<ImageGradientConfig, AZ::ComponentConfig>()
-                ->Version(6)
+                ->Version(7)
                 ->Field("StreamingImageAsset", &ImageGradientConfig::m_imageAsset)
                 ->Field("SamplingType", &ImageGradientConfig::m_samplingType)
                 ->Field("Tiling", &ImageGradientConfig::m_tiling)
@@ -168,6 +168,7 @@ namespace GradientSignal
                 ->Field("CustomScale", &ImageGradientConfig::m_customScaleType)
                 ->Field("ScaleRangeMin", &ImageGradientConfig::m_scaleRangeMin)
                 ->Field("ScaleRangeMax", &ImageGradientConfig::m_scaleRangeMax)
+                ->Field("UseFootprintMips", &ImageGradientConfig::m_useFootprintMips)
                 ;
 
         }
@@ -350,6 +351,112 @@ namespace GradientSignal
             SetupDefaultMultiplierAndOffset();
             break;
         }
+
+        UpdateFootprintMips();
+    }
+
+    void ImageGradientComponent::UpdateFootprintMips()
+    {
+        m_footprintMips.Clear();
+
+        // The downsampled levels are a snapshot of the image data, so they aren't used while the image is being painted.
+        // EndImageModification rebuilds them from the modified image data.
+        if (!m_configuration.m_useFootprintMips || m_imageData.empty() || (m_configuration.m_numImageModificationsActive > 0))
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        m_footprintMips.Build(
+            m_imageDescriptor.m_size.m_width, m_imageDescriptor.m_size.m_height,
+            [this](AZ::u32 x, AZ::u32 y)
+            {
+                return InvertYAndGetPixelValue(x, y);
+            });
+    }
+
+    size_t ImageGradientComponent::SelectFootprintMipLevel(AZStd::span<const AZ::Vector3> positions) const
+    {
+        // Single lookups and small lists always use the exact full resolution values.
+        constexpr size_t MinPositionsForFootprintMips = 16;
+        if (m_footprintMips.IsEmpty() || (positions.size() < MinPositionsForFootprintMips))
+        {
+            return 0;
+        }
+
+        // Estimate the spacing between the query positions from the XY area they cover. For region queries, which are regular
+        // grids, this is the step size. Positions along a single line fall back to the line length divided by the position count.
+        AZ::Vector2 minPosition(positions[0]);
+        AZ::Vector2 maxPosition(positions[0]);
+        for (const AZ::Vector3& position : positions)
+        {
+            minPosition = minPosition.GetMin(AZ::Vector2(position));
+            maxPosition = maxPosition.GetMax(AZ::Vector2(position));
+        }
+
+        const AZ::Vector2 extents = maxPosition - minPosition;
+        const float positionCount = aznumeric_cast<float>(positions.size());
+        const float area = extents.GetX() * extents.GetY();
+        const float spacingMeters = (area > 0.0f) ? (AZStd::sqrt(area) / (AZStd::sqrt(positionCount) - 1.0f))
+                                                  : (AZ::GetMax(extents.GetX(), extents.GetY()) / (positionCount - 1.0f));
+
+        // Use the finer of the two pixel densities so that anisotropic scales don't select an overly blurry level.
+        const AZ::Vector2 pixelsPerMeter = GetImagePixelsPerMeter();
+        const float footprintPixels = spacingMeters * AZ::GetMin(pixelsPerMeter.GetX(), pixelsPerMeter.GetY());
+
+        return m_footprintMips.SelectLevel(footprintPixels);
+    }
+
+    void ImageGradientComponent::GetValuesFromFootprintMip(
+        size_t mipLevel, SamplingType samplingType, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        const ImageGradientMipPyramid::Level& level = m_footprintMips.GetLevel(mipLevel);
+        const AZ::Vector2 tiledDimensions(level.m_width * GetTilingX(), level.m_height * GetTilingY());
+        const WrappingType wrappingType = m_gradientTransform.GetWrappingType();
+
+        // Convert the positions to pixel coordinates in batches so that the sampling kernels can process many values at once.
+        constexpr size_t BatchSize = 256;
+        float pixelX[BatchSize];
+        float pixelY[BatchSize];
+        bool rejected[BatchSize];
+
+        for (size_t batchStart = 0; batchStart < positions.size(); batchStart += BatchSize)
+        {
+            const size_t batchCount = AZStd::min(BatchSize, positions.size() - batchStart);
+
+            AZ::Vector3 uvw;
+            for (size_t index = 0; index < batchCount; ++index)
+            {
+                m_gradientTransform.TransformPositionToUVWNormalized(positions[batchStart + index], uvw, rejected[index]);
+                const AZ::Vector2 pixelLookup = AZ::Vector2(uvw) * tiledDimensions;
+                pixelX[index] = pixelLookup.GetX();
+                pixelY[index] = pixelLookup.GetY();
+            }
+
+            const AZStd::span<const float> batchX(pixelX, batchCount);
+            const AZStd::span<const float> batchY(pixelY, batchCount);
+            const AZStd::span<float> batchValues = outValues.subspan(batchStart, batchCount);
+
+            switch (samplingType)
+            {
+            case SamplingType::Bilinear:
+                m_footprintMips.SampleBilinear(mipLevel, wrappingType, batchX, batchY, batchValues);
+                break;
+            case SamplingType::Bicubic:
+                m_footprintMips.SampleBicubic(mipLevel, wrappingType, batchX, batchY, batchValues);
+                break;
+            case SamplingType::Point:
+            default:
+                m_footprintMips.SamplePoint(mipLevel, batchX, batchY, batchValues);
+                break;
+            }
+
+            for (size_t index = 0; index < batchCount; ++index)
+            {
+                batchValues[index] = rejected[index] ? 0.0f : AZStd::clamp((batchValues[index] - m_offset) * m_multiplier, 0.0f, 1.0f);
+            }
+        }
     }
 
     float ImageGradientComponent::GetValueFromImageData(SamplingType samplingType, const AZ::Vector3& uvw, float defaultValue) const
@@ -700,6 +807,9 @@ namespace GradientSignal
         m_imageDescriptor = imageDescriptor;
         m_imageData = imageData;
 
+        // Any downsampled levels were built from the previous image data.
+        m_footprintMips.Clear();
+
         m_maxX = imageDescriptor.m_size.m_width - 1;
         m_maxY = imageDescriptor.m_size.m_height - 1;
 
@@ -769,6 +879,10 @@ namespace GradientSignal
         }
 
         m_configuration.m_numImageModificationsActive++;
+
+        // The downsampled levels would go stale as soon as a pixel is painted.
+        AZStd::unique_lock lock(m_queryMutex);
+        m_footprintMips.Clear();
     }
 
     void ImageGradientComponent::EndImageModification()
@@ -780,6 +894,10 @@ namespace GradientSignal
         if (m_configuration.m_numImageModificationsActive == 0)
         {
             m_imageModifier = {};
+
+            // Painting is done, so downsample the modified image data.
+            AZStd::unique_lock lock(m_queryMutex);
+            UpdateFootprintMips();
         }
     }
 
@@ -859,6 +977,12 @@ namespace GradientSignal
             (reinterpret_cast<const void*>(m_imageData.data()) == reinterpret_cast<const void*>(m_modifiedImageData.data()));
     }
 
+    size_t ImageGradientComponent::GetFootprintMipsMemoryUsage() const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+        return m_footprintMips.GetMemoryUsage();
+    }
+
     float ImageGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
         AZ::Vector3 position(sampleParams.m_position);
@@ -891,6 +1015,13 @@ namespace GradientSignal
             return;
         }
 
+        // Coarse bulk queries can be answered from a downsampled copy of the image.
+        if (const size_t mipLevel = SelectFootprintMipLevel(positions); mipLevel > 0)
+        {
+            GetValuesFromFootprintMip(mipLevel, samplingType, positions, outValues);
+            return;
+        }
+
         AZ::Vector3 uvw;
         bool wasPointRejected = false;
 
@@ -1230,6 +1361,9 @@ namespace GradientSignal
                 return;
             }
 
+            // Pixels can also be set outside of a paint session, which makes any downsampled levels stale.
+            m_footprintMips.Clear();
+
             // If we're set to auto-scaling, we need to do a bit more tracking while modifying our data to see if our auto-scaling
             // values have changed. If so, we'll need to refresh the entire image.
             if (m_currentScaleType == CustomScaleType::Auto)
@@ -323,7 +323,7 @@ namespace GradientSignal
 
     float LevelsGradientComponent::GetOutputMax() const
     {
-        return m_configuration.m_outputMin;
+        return m_configuration.m_outputMax;
     }
 
     void LevelsGradientComponent::SetOutputMax(float value)
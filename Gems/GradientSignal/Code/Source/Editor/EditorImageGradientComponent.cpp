@@ -51,6 +51,12 @@ namespace GradientSignal
                         ->EnumAttribute(SamplingType::Bicubic, "Bicubic")
                         ->Attribute(AZ::Edit::Attributes::ReadOnly, &ImageGradientConfig::AreImageOptionsReadOnly)
 
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &ImageGradientConfig::m_useFootprintMips,
+                        "Footprint Mips", "When enabled, bulk queries that are spaced further apart than the image pixels are sampled "
+                        "from a downsampled copy of the image. This is faster and smoother for coarse queries, but the values no longer "
+                        "match the exact pixels.")
+                        ->Attribute(AZ::Edit::Attributes::ReadOnly, &ImageGradientConfig::AreImageOptionsReadOnly)
+
                     ->DataElement(AZ::Edit::UIHandlers::Vector2, &ImageGradientConfig::m_tiling,
                         "Tiling", "Number of times to tile horizontally/vertically.")
                         ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
@@ -0,0 +1,627 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientEvaluationPlan.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <GradientSignal/Components/MixedGradientComponent.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/Ebuses/ConstantGradientRequestBus.h>
+#include <GradientSignal/Ebuses/InvertGradientRequestBus.h>
+#include <GradientSignal/Ebuses/LevelsGradientRequestBus.h>
+#include <GradientSignal/Ebuses/MixedGradientRequestBus.h>
+#include <GradientSignal/Ebuses/PosterizeGradientRequestBus.h>
+#include <GradientSignal/Ebuses/ReferenceGradientRequestBus.h>
+#include <GradientSignal/Ebuses/SmoothStepGradientRequestBus.h>
+#include <GradientSignal/Ebuses/SmoothStepRequestBus.h>
+#include <GradientSignal/Ebuses/ThresholdGradientRequestBus.h>
+
+namespace GradientSignal
+{
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        static_assert(GradientEvaluationPlan::TileSize % Vec4::ElementCount == 0, "Tiles are processed 4 values at a time");
+
+        // Every kernel processes whole Vec4s. Tiles are padded to a multiple of 4 values, and the padding lanes are never read back.
+
+        void InvertInputKernel(float* values, size_t count)
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                Vec4::StoreAligned(values + index, Vec4::Sub(one, Vec4::LoadAligned(values + index)));
+            }
+        }
+
+        void InvertKernel(float* values, size_t count)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadAligned(values + index), zero, one);
+                Vec4::StoreAligned(values + index, Vec4::Sub(one, value));
+            }
+        }
+
+        void ClampKernel(float* values, size_t count)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                Vec4::StoreAligned(values + index, Vec4::Clamp(Vec4::LoadAligned(values + index), zero, one));
+            }
+        }
+
+        void ScaleKernel(float* values, size_t count, float scale)
+        {
+            const Vec4::FloatType scaleVec = Vec4::Splat(scale);
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                Vec4::StoreAligned(values + index, Vec4::Mul(Vec4::LoadAligned(values + index), scaleVec));
+            }
+        }
+
+        void ThresholdKernel(float* values, size_t count, float threshold)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType thresholdVec = Vec4::Splat(threshold);
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType belowThreshold = Vec4::CmpLtEq(Vec4::LoadAligned(values + index), thresholdVec);
+                Vec4::StoreAligned(values + index, Vec4::Select(zero, one, belowThreshold));
+            }
+        }
+
+        // Params: input min, input max, output min, output max, 1 / input mid, 1 / (input max - input min).
+        void LevelsKernel(float* values, size_t count, const float* params)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType inputMin = Vec4::Splat(params[0]);
+            const Vec4::FloatType outputMin = Vec4::Splat(params[2]);
+            const Vec4::FloatType outputMax = Vec4::Splat(params[3]);
+
+            if (params[0] == params[1])
+            {
+                for (size_t index = 0; index < count; index += Vec4::ElementCount)
+                {
+                    const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadAligned(values + index), zero, one);
+                    Vec4::StoreAligned(values + index, Vec4::Select(outputMin, outputMax, Vec4::CmpLtEq(value, inputMin)));
+                }
+                return;
+            }
+
+            const float inputMidReciprocal = params[4];
+            const Vec4::FloatType inputExtentsReciprocal = Vec4::Splat(params[5]);
+            const Vec4::FloatType outputExtents = Vec4::Splat(params[3] - params[2]);
+
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadAligned(values + index), zero, one);
+                Vec4::FloatType inputCorrected =
+                    Vec4::Min(Vec4::Mul(Vec4::Max(Vec4::Sub(value, inputMin), zero), inputExtentsReciprocal), one);
+
+                // There's no vector pow, so the midpoint correction is the one scalar step. It's skipped for the default midpoint.
+                if (inputMidReciprocal != 1.0f)
+                {
+                    alignas(16) float remapped[Vec4::ElementCount];
+                    Vec4::StoreAligned(remapped, inputCorrected);
+                    for (float& remappedValue : remapped)
+                    {
+                        remappedValue = powf(remappedValue, inputMidReciprocal);
+                    }
+                    inputCorrected = Vec4::LoadAligned(remapped);
+                }
+
+                Vec4::StoreAligned(values + index, Vec4::Add(outputMin, Vec4::Mul(outputExtents, inputCorrected)));
+            }
+        }
+
+        // Params: bands, band offset, band divisor.
+        void PosterizeKernel(float* values, size_t count, const float* params)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType bands = Vec4::Splat(params[0]);
+            const Vec4::FloatType lastBand = Vec4::Splat(params[0] - 1.0f);
+            const Vec4::FloatType bandOffset = Vec4::Splat(params[1]);
+            const Vec4::FloatType bandDivisor = Vec4::Splat(params[2]);
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadAligned(values + index), zero, one);
+                const Vec4::FloatType band = Vec4::Min(Vec4::Floor(Vec4::Mul(value, bands)), lastBand);
+                Vec4::StoreAligned(values + index, Vec4::Min(Vec4::Div(Vec4::Add(band, bandOffset), bandDivisor), one));
+            }
+        }
+
+        // Vector version of GetRatio() followed by GetSmoothStep().
+        Vec4::FloatType SmoothRatio(float a, float b, Vec4::FloatArgType value)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+            Vec4::FloatType ratio;
+            if (a == b)
+            {
+                ratio = Vec4::Select(zero, one, Vec4::CmpLtEq(value, Vec4::Splat(a)));
+            }
+            else
+            {
+                ratio = Vec4::Clamp(Vec4::Div(Vec4::Sub(value, Vec4::Splat(a)), Vec4::Splat(b - a)), zero, one);
+            }
+
+            return Vec4::Mul(Vec4::Mul(ratio, ratio), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), ratio)));
+        }
+
+        // Params: falloff min, falloff max, falloff strength.
+        void SmoothStepKernel(float* values, size_t count, const float* params)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const float min = params[0];
+            const float max = params[1];
+            const float strength = params[2];
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadAligned(values + index), zero, one);
+                const Vec4::FloatType rampUp = SmoothRatio(min, min + strength, value);
+                const Vec4::FloatType rampDown = SmoothRatio(max - strength, max, value);
+                Vec4::StoreAligned(values + index, Vec4::Mul(rampUp, Vec4::Sub(one, rampDown)));
+            }
+        }
+
+        // Vector version of MixedGradientComponent::PerformMixingOperation().
+        Vec4::FloatType MixingOperation(MixedGradientLayer::MixingOperation operation, Vec4::FloatArgType prev, Vec4::FloatArgType current)
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+
+            switch (operation)
+            {
+            case MixedGradientLayer::MixingOperation::Multiply:
+                return Vec4::Mul(prev, current);
+            case MixedGradientLayer::MixingOperation::Screen:
+                return Vec4::Sub(one, Vec4::Mul(Vec4::Sub(one, prev), Vec4::Sub(one, current)));
+            case MixedGradientLayer::MixingOperation::Add:
+                return Vec4::Add(prev, current);
+            case MixedGradientLayer::MixingOperation::Subtract:
+                return Vec4::Sub(prev, current);
+            case MixedGradientLayer::MixingOperation::Min:
+                return Vec4::Min(prev, current);
+            case MixedGradientLayer::MixingOperation::Max:
+                return Vec4::Max(prev, current);
+            case MixedGradientLayer::MixingOperation::Average:
+                return Vec4::Mul(Vec4::Add(prev, current), Vec4::Splat(0.5f));
+            case MixedGradientLayer::MixingOperation::Overlay:
+                return Vec4::Select(
+                    Vec4::Sub(one, Vec4::Mul(Vec4::Mul(two, Vec4::Sub(one, prev)), Vec4::Sub(one, current))),
+                    Vec4::Mul(Vec4::Mul(two, prev), current),
+                    Vec4::CmpGtEq(prev, Vec4::Splat(0.5f)));
+            case MixedGradientLayer::MixingOperation::Initialize:
+            case MixedGradientLayer::MixingOperation::Normal:
+            default:
+                return current;
+            }
+        }
+
+        // Params: layer opacity, inverse opacity for the accumulated value.
+        void MixKernel(float* accumulated, const float* layer, size_t count, AZ::u8 operation, const float* params)
+        {
+            const auto mixingOperation = static_cast<MixedGradientLayer::MixingOperation>(operation);
+            const Vec4::FloatType opacity = Vec4::Splat(params[0]);
+            const Vec4::FloatType inverseOpacity = Vec4::Splat(params[1]);
+            for (size_t index = 0; index < count; index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType prev = Vec4::LoadAligned(accumulated + index);
+                const Vec4::FloatType operationResult = MixingOperation(mixingOperation, prev, Vec4::LoadAligned(layer + index));
+                Vec4::StoreAligned(accumulated + index, Vec4::Add(Vec4::Mul(prev, inverseOpacity), Vec4::Mul(operationResult, opacity)));
+            }
+        }
+    } // namespace
+
+    struct GradientEvaluationPlan::CompileContext
+    {
+        //! Gradients currently being compiled, used to detect cyclic references.
+        AZStd::vector<AZ::EntityId> m_gradientStack;
+        size_t m_depth = 0;
+        size_t m_maxDepth = 0;
+    };
+
+    GradientEvaluationPlan GradientEvaluationPlan::Compile(const GradientSampler& sampler)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GradientEvaluationPlan plan;
+        CompileContext context;
+        if (!plan.CompileSampler(sampler, true, context) || context.m_maxDepth > MaxStackDepth)
+        {
+            // Let the sampler handle the whole graph, including reporting any cyclic references.
+            GradientEvaluationPlan fallbackPlan;
+            fallbackPlan.m_samplers.push_back(sampler);
+            Stage stage;
+            stage.m_type = StageType::Sampler;
+            fallbackPlan.m_stages.push_back(stage);
+            return fallbackPlan;
+        }
+
+        AZ_Assert(context.m_depth == 1, "Gradient evaluation plan leaves %zu values on the stack instead of 1.", context.m_depth);
+        return plan;
+    }
+
+    void GradientEvaluationPlan::PushStage(const Stage& stage, CompileContext& context)
+    {
+        switch (stage.m_type)
+        {
+        case StageType::Constant:
+        case StageType::Leaf:
+        case StageType::Sampler:
+            ++context.m_depth;
+            context.m_maxDepth = AZStd::max(context.m_maxDepth, context.m_depth);
+            break;
+        case StageType::Mix:
+            --context.m_depth;
+            break;
+        default:
+            break;
+        }
+
+        m_stages.push_back(stage);
+    }
+
+    bool GradientEvaluationPlan::CompileSampler(const GradientSampler& sampler, bool applyOpacity, CompileContext& context)
+    {
+        Stage stage;
+
+        if (sampler.m_opacity <= 0.0f || !sampler.m_gradientId.IsValid())
+        {
+            stage.m_type = StageType::Constant;
+            stage.m_params[0] = 0.0f;
+            PushStage(stage, context);
+            return true;
+        }
+
+        // Transformed samplers query their gradient at different positions, so they're left to evaluate their own subgraph.
+        if (sampler.m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(sampler))
+        {
+            stage.m_type = StageType::Sampler;
+            stage.m_index = aznumeric_cast<AZ::u32>(m_samplers.size());
+            m_samplers.push_back(sampler);
+            if (!applyOpacity)
+            {
+                m_samplers.back().m_opacity = 1.0f;
+            }
+            PushStage(stage, context);
+            return true;
+        }
+
+        if (!CompileGradient(sampler.m_gradientId, context))
+        {
+            return false;
+        }
+
+        if (sampler.m_invertInput)
+        {
+            stage.m_type = StageType::InvertInput;
+            PushStage(stage, context);
+        }
+
+        if (sampler.m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(sampler))
+        {
+            const float inputMid = AZ::GetClamp(sampler.m_inputMid, 0.01f, 10.0f);
+            const float inputMin = AZ::GetClamp(sampler.m_inputMin, 0.0f, 1.0f);
+            const float inputMax = AZ::GetClamp(sampler.m_inputMax, 0.0f, 1.0f);
+
+            stage.m_type = StageType::Levels;
+            stage.m_params[0] = inputMin;
+            stage.m_params[1] = inputMax;
+            stage.m_params[2] = AZ::GetClamp(sampler.m_outputMin, 0.0f, 1.0f);
+            stage.m_params[3] = AZ::GetClamp(sampler.m_outputMax, 0.0f, 1.0f);
+            stage.m_params[4] = 1.0f / inputMid;
+            stage.m_params[5] = (inputMin != inputMax) ? 1.0f / (inputMax - inputMin) : 0.0f;
+            PushStage(stage, context);
+        }
+
+        if (applyOpacity && sampler.m_opacity != 1.0f)
+        {
+            stage.m_type = StageType::Scale;
+            stage.m_params[0] = sampler.m_opacity;
+            PushStage(stage, context);
+        }
+
+        return true;
+    }
+
+    bool GradientEvaluationPlan::CompileGradient(const AZ::EntityId& gradientId, CompileContext& context)
+    {
+        if (AZStd::find(context.m_gradientStack.begin(), context.m_gradientStack.end(), gradientId) != context.m_gradientStack.end())
+        {
+            return false;
+        }
+
+        Stage stage;
+
+        // Gradients that aren't active produce 0, the same as an EBus query with no handler.
+        if (!GradientRequestBus::HasHandlers(gradientId))
+        {
+            stage.m_type = StageType::Constant;
+            stage.m_params[0] = 0.0f;
+            PushStage(stage, context);
+            return true;
+        }
+
+        context.m_gradientStack.push_back(gradientId);
+
+        GradientSampler inputSampler;
+        bool compiled = true;
+
+        if (ConstantGradientRequestBus::HasHandlers(gradientId))
+        {
+            stage.m_type = StageType::Constant;
+            ConstantGradientRequestBus::EventResult(stage.m_params[0], gradientId, &ConstantGradientRequestBus::Events::GetConstantValue);
+            PushStage(stage, context);
+        }
+        else if (LevelsGradientRequestBus::HasHandlers(gradientId))
+        {
+            float inputMid = 1.0f;
+            float inputMin = 0.0f;
+            float inputMax = 1.0f;
+            float outputMin = 0.0f;
+            float outputMax = 1.0f;
+            LevelsGradientRequestBus::EventResult(inputMid, gradientId, &LevelsGradientRequestBus::Events::GetInputMid);
+            LevelsGradientRequestBus::EventResult(inputMin, gradientId, &LevelsGradientRequestBus::Events::GetInputMin);
+            LevelsGradientRequestBus::EventResult(inputMax, gradientId, &LevelsGradientRequestBus::Events::GetInputMax);
+            LevelsGradientRequestBus::EventResult(outputMin, gradientId, &LevelsGradientRequestBus::Events::GetOutputMin);
+            LevelsGradientRequestBus::EventResult(outputMax, gradientId, &LevelsGradientRequestBus::Events::GetOutputMax);
+            LevelsGradientRequestBus::EventResult(inputSampler, gradientId, &LevelsGradientRequestBus::Events::GetGradientSampler);
+
+            inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f);
+            inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
+            inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
+
+            compiled = CompileSampler(inputSampler, true, context);
+            stage.m_type = StageType::Levels;
+            stage.m_params[0] = inputMin;
+            stage.m_params[1] = inputMax;
+            stage.m_params[2] = AZ::GetClamp(outputMin, 0.0f, 1.0f);
+            stage.m_params[3] = AZ::GetClamp(outputMax, 0.0f, 1.0f);
+            stage.m_params[4] = 1.0f / inputMid;
+            stage.m_params[5] = (inputMin != inputMax) ? 1.0f / (inputMax - inputMin) : 0.0f;
+            PushStage(stage, context);
+        }
+        else if (InvertGradientRequestBus::HasHandlers(gradientId))
+        {
+            InvertGradientRequestBus::EventResult(inputSampler, gradientId, &InvertGradientRequestBus::Events::GetGradientSampler);
+            compiled = CompileSampler(inputSampler, true, context);
+            stage.m_type = StageType::Invert;
+            PushStage(stage, context);
+        }
+        else if (ThresholdGradientRequestBus::HasHandlers(gradientId))
+        {
+            ThresholdGradientRequestBus::EventResult(stage.m_params[0], gradientId, &ThresholdGradientRequestBus::Events::GetThreshold);
+            ThresholdGradientRequestBus::EventResult(inputSampler, gradientId, &ThresholdGradientRequestBus::Events::GetGradientSampler);
+            compiled = CompileSampler(inputSampler, true, context);
+            stage.m_type = StageType::Threshold;
+            PushStage(stage, context);
+        }
+        else if (PosterizeGradientRequestBus::HasHandlers(gradientId))
+        {
+            AZ::s32 bandCount = 0;
+            AZ::u8 mode = 0;
+            PosterizeGradientRequestBus::EventResult(bandCount, gradientId, &PosterizeGradientRequestBus::Events::GetBands);
+            PosterizeGradientRequestBus::EventResult(mode, gradientId, &PosterizeGradientRequestBus::Events::GetModeType);
+            PosterizeGradientRequestBus::EventResult(inputSampler, gradientId, &PosterizeGradientRequestBus::Events::GetGradientSampler);
+            compiled = CompileSampler(inputSampler, true, context);
+
+            // Each mode maps a band to (band + offset) / divisor, see PosterizeGradientComponent::PosterizeValue().
+            const float bands = AZ::GetMax(static_cast<float>(bandCount), 2.0f);
+            stage.m_type = StageType::Posterize;
+            stage.m_params[0] = bands;
+            switch (static_cast<PosterizeGradientConfig::ModeType>(mode))
+            {
+            default:
+            case PosterizeGradientConfig::ModeType::Floor:
+                stage.m_params[1] = 0.0f;
+                stage.m_params[2] = bands;
+                break;
+            case PosterizeGradientConfig::ModeType::Round:
+                stage.m_params[1] = 0.5f;
+                stage.m_params[2] = bands;
+                break;
+            case PosterizeGradientConfig::ModeType::Ceiling:
+                stage.m_params[1] = 1.0f;
+                stage.m_params[2] = bands;
+                break;
+            case PosterizeGradientConfig::ModeType::Ps:
+                stage.m_params[1] = 0.0f;
+                stage.m_params[2] = bands - 1.0f;
+                break;
+            }
+            PushStage(stage, context);
+        }
+        else if (SmoothStepGradientRequestBus::HasHandlers(gradientId) && SmoothStepRequestBus::HasHandlers(gradientId))
+        {
+            float falloffMidpoint = 0.0f;
+            float falloffRange = 0.0f;
+            float falloffStrength = 0.0f;
+            SmoothStepRequestBus::EventResult(falloffMidpoint, gradientId, &SmoothStepRequestBus::Events::GetFallOffMidpoint);
+            SmoothStepRequestBus::EventResult(falloffRange, gradientId, &SmoothStepRequestBus::Events::GetFallOffRange);
+            SmoothStepRequestBus::EventResult(falloffStrength, gradientId, &SmoothStepRequestBus::Events::GetFallOffStrength);
+            SmoothStepGradientRequestBus::EventResult(
+                inputSampler, gradientId, &SmoothStepGradientRequestBus::Events::GetGradientSampler);
+            compiled = CompileSampler(inputSampler, true, context);
+
+            stage.m_type = StageType::SmoothStep;
+            stage.m_params[0] = falloffMidpoint - falloffRange / 2.0f;
+            stage.m_params[1] = falloffMidpoint + falloffRange / 2.0f;
+            stage.m_params[2] = AZ::GetClamp(falloffStrength, 0.0f, 1.0f);
+            PushStage(stage, context);
+        }
+        else if (ReferenceGradientRequestBus::HasHandlers(gradientId))
+        {
+            ReferenceGradientRequestBus::EventResult(inputSampler, gradientId, &ReferenceGradientRequestBus::Events::GetGradientSampler);
+            compiled = CompileSampler(inputSampler, true, context);
+        }
+        else if (MixedGradientRequestBus::HasHandlers(gradientId))
+        {
+            // Copy the layers out before compiling them, so the Mixed gradient isn't being dispatched to while its inputs compile.
+            size_t layerCount = 0;
+            MixedGradientRequestBus::EventResult(layerCount, gradientId, &MixedGradientRequestBus::Events::GetNumLayers);
+            AZStd::vector<MixedGradientLayer> layers;
+            layers.reserve(layerCount);
+            for (size_t layerIndex = 0; layerIndex < layerCount; ++layerIndex)
+            {
+                MixedGradientLayer* layer = nullptr;
+                MixedGradientRequestBus::EventResult(
+                    layer, gradientId, &MixedGradientRequestBus::Events::GetLayer, aznumeric_cast<int>(layerIndex));
+                if (layer && layer->m_enabled && layer->m_gradientSampler.m_opacity != 0.0f)
+                {
+                    layers.push_back(*layer);
+                }
+            }
+
+            // The layers blend into an accumulated value that starts at 0.
+            stage.m_type = StageType::Constant;
+            stage.m_params[0] = 0.0f;
+            PushStage(stage, context);
+
+            for (const MixedGradientLayer& layer : layers)
+            {
+                // The layer is blended using its unpremultiplied value, so its opacity is applied by the Mix stage instead.
+                compiled = compiled && CompileSampler(layer.m_gradientSampler, false, context);
+
+                const float opacity = layer.m_gradientSampler.m_opacity;
+                Stage mixStage;
+                mixStage.m_type = StageType::Mix;
+                mixStage.m_operation = static_cast<AZ::u8>(layer.m_operation);
+                mixStage.m_params[0] = opacity;
+                mixStage.m_params[1] = (layer.m_operation == MixedGradientLayer::MixingOperation::Initialize) ? 0.0f : (1.0f - opacity);
+                PushStage(mixStage, context);
+            }
+
+            stage.m_type = StageType::Clamp;
+            PushStage(stage, context);
+        }
+        else
+        {
+            stage.m_type = StageType::Leaf;
+            stage.m_index = aznumeric_cast<AZ::u32>(m_leaves.size());
+            m_leaves.push_back(gradientId);
+            PushStage(stage, context);
+        }
+
+        context.m_gradientStack.pop_back();
+        return compiled;
+    }
+
+    void GradientEvaluationPlan::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        if (m_stages.empty())
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // The intermediate values for every stage live in these tiles, so no memory is allocated while evaluating the plan.
+        alignas(16) float registers[MaxStackDepth][TileSize] = {};
+
+        for (size_t tileStart = 0; tileStart < positions.size(); tileStart += TileSize)
+        {
+            const size_t tileCount = AZStd::min(TileSize, positions.size() - tileStart);
+            EvaluateTile(positions.subspan(tileStart, tileCount), registers);
+            AZStd::copy(registers[0], registers[0] + tileCount, outValues.begin() + tileStart);
+        }
+    }
+
+    void GradientEvaluationPlan::EvaluateTile(AZStd::span<const AZ::Vector3> positions, float (*registers)[TileSize]) const
+    {
+        const size_t tileCount = positions.size();
+        const size_t vectorCount = (tileCount + Vec4::ElementCount - 1) & ~(Vec4::ElementCount - 1);
+
+        size_t depth = 0;
+        for (const Stage& stage : m_stages)
+        {
+            switch (stage.m_type)
+            {
+            case StageType::Constant:
+                AZStd::fill(registers[depth], registers[depth] + vectorCount, stage.m_params[0]);
+                ++depth;
+                break;
+            case StageType::Leaf:
+                {
+                    AZStd::span<float> values(registers[depth], tileCount);
+                    AZStd::fill(values.begin(), values.end(), 0.0f);
+                    GradientRequestBus::Event(m_leaves[stage.m_index], &GradientRequestBus::Events::GetValues, positions, values);
+                    ++depth;
+                }
+                break;
+            case StageType::Sampler:
+                m_samplers[stage.m_index].GetValues(positions, AZStd::span<float>(registers[depth], tileCount));
+                ++depth;
+                break;
+            case StageType::InvertInput:
+                InvertInputKernel(registers[depth - 1], vectorCount);
+                break;
+            case StageType::Invert:
+                InvertKernel(registers[depth - 1], vectorCount);
+                break;
+            case StageType::Levels:
+                LevelsKernel(registers[depth - 1], vectorCount, stage.m_params);
+                break;
+            case StageType::Scale:
+                ScaleKernel(registers[depth - 1], vectorCount, stage.m_params[0]);
+                break;
+            case StageType::Threshold:
+                ThresholdKernel(registers[depth - 1], vectorCount, stage.m_params[0]);
+                break;
+            case StageType::Posterize:
+                PosterizeKernel(registers[depth - 1], vectorCount, stage.m_params);
+                break;
+            case StageType::SmoothStep:
+                SmoothStepKernel(registers[depth - 1], vectorCount, stage.m_params);
+                break;
+            case StageType::Mix:
+                MixKernel(registers[depth - 2], registers[depth - 1], vectorCount, stage.m_operation, stage.m_params);
+                --depth;
+                break;
+            case StageType::Clamp:
+                ClampKernel(registers[depth - 1], vectorCount);
+                break;
+            }
+        }
+
+        AZ_Assert(depth == 1, "Gradient evaluation plan left %zu values on the stack instead of 1.", depth);
+    }
+
+    size_t GradientEvaluationPlan::GetFusedStageCount() const
+    {
+        return AZStd::count_if(
+            m_stages.begin(), m_stages.end(),
+            [](const Stage& stage)
+            {
+                return stage.m_type != StageType::Leaf && stage.m_type != StageType::Sampler;
+            });
+    }
+
+    size_t GradientEvaluationPlan::GetLeafCount() const
+    {
+        return m_leaves.size() + m_samplers.size();
+    }
+} // namespace GradientSignal
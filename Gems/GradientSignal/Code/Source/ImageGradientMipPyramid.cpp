@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/ImageGradientMipPyramid.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+namespace GradientSignal
+{
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        // Every kernel processes the positions 4 at a time. The pixel lookups are gathered into lane arrays one lane at a time,
+        // and the filtering math for all 4 lanes is done with Vec4 operations.
+        constexpr size_t LaneCount = Vec4::ElementCount;
+
+        // Returns the index of the first pixel of the filter footprint for the given pixel position.
+        // This matches the Image Gradient, which wraps the integer pixel position into the image before applying the filter.
+        void GetBasePixels(
+            const float* pixelX, const float* pixelY, size_t count, AZ::u32 width, AZ::u32 height,
+            int32_t (&outX)[LaneCount], int32_t (&outY)[LaneCount], Vec4::FloatType& outDeltaX, Vec4::FloatType& outDeltaY)
+        {
+            alignas(16) float lanesX[LaneCount] = { 0.0f };
+            alignas(16) float lanesY[LaneCount] = { 0.0f };
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                lanesX[lane] = pixelX[lane];
+                lanesY[lane] = pixelY[lane];
+            }
+
+            const Vec4::FloatType x = Vec4::LoadAligned(lanesX);
+            const Vec4::FloatType y = Vec4::LoadAligned(lanesY);
+            const Vec4::FloatType floorX = Vec4::Floor(x);
+            const Vec4::FloatType floorY = Vec4::Floor(y);
+            outDeltaX = Vec4::Sub(x, floorX);
+            outDeltaY = Vec4::Sub(y, floorY);
+
+            alignas(16) int32_t floorLanesX[LaneCount];
+            alignas(16) int32_t floorLanesY[LaneCount];
+            Vec4::StoreAligned(floorLanesX, Vec4::ConvertToInt(floorX));
+            Vec4::StoreAligned(floorLanesY, Vec4::ConvertToInt(floorY));
+
+            const int32_t signedWidth = aznumeric_cast<int32_t>(width);
+            const int32_t signedHeight = aznumeric_cast<int32_t>(height);
+            for (size_t lane = 0; lane < LaneCount; ++lane)
+            {
+                outX[lane] = ((floorLanesX[lane] % signedWidth) + signedWidth) % signedWidth;
+                outY[lane] = ((floorLanesY[lane] % signedHeight) + signedHeight) % signedHeight;
+            }
+        }
+
+        // Applies the wrapping rules from ImageGradientComponent::GetClampedValue() to a single coordinate.
+        // Returns -1 if the coordinate is outside the image and should produce a 0 value.
+        int32_t WrapCoordinate(int32_t coordinate, int32_t size, WrappingType wrappingType)
+        {
+            const int32_t maxCoordinate = size - 1;
+            switch (wrappingType)
+            {
+            case WrappingType::ClampToZero:
+                return ((coordinate < 0) || (coordinate > maxCoordinate)) ? -1 : coordinate;
+            case WrappingType::ClampToEdge:
+                return AZ::GetClamp(coordinate, 0, maxCoordinate);
+            case WrappingType::Mirror:
+                coordinate = (coordinate < 0) ? -coordinate : coordinate;
+                return (coordinate > maxCoordinate) ? (maxCoordinate - (coordinate % size)) : coordinate;
+            case WrappingType::None:
+            case WrappingType::Repeat:
+            default:
+                return ((coordinate % size) + size) % size;
+            }
+        }
+
+        float GetWrappedValue(const ImageGradientMipPyramid::Level& level, int32_t x, int32_t y, WrappingType wrappingType)
+        {
+            const int32_t wrappedX = WrapCoordinate(x, aznumeric_cast<int32_t>(level.m_width), wrappingType);
+            const int32_t wrappedY = WrapCoordinate(y, aznumeric_cast<int32_t>(level.m_height), wrappingType);
+            if ((wrappedX < 0) || (wrappedY < 0))
+            {
+                return 0.0f;
+            }
+            return level.m_values[(aznumeric_cast<size_t>(wrappedY) * level.m_width) + wrappedX];
+        }
+
+        Vec4::FloatType LerpKernel(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType t)
+        {
+            return Vec4::Madd(Vec4::Sub(b, a), t, a);
+        }
+
+        // Catmull-Rom interpolation, identical to the per-pixel bicubic filter in ImageGradientComponent:
+        // p1 + 0.5 * t * (p2 - p0 + t * (2p0 - 5p1 + 4p2 - p3 + t * (3(p1 - p2) + p3 - p0)))
+        Vec4::FloatType CubicKernel(
+            Vec4::FloatArgType p0, Vec4::FloatArgType p1, Vec4::FloatArgType p2, Vec4::FloatArgType p3, Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType cubic = Vec4::Sub(Vec4::Add(Vec4::Mul(Vec4::Splat(3.0f), Vec4::Sub(p1, p2)), p3), p0);
+            const Vec4::FloatType quadratic = Vec4::Sub(
+                Vec4::Madd(Vec4::Splat(4.0f), p2, Vec4::Madd(Vec4::Splat(2.0f), p0, Vec4::Mul(Vec4::Splat(-5.0f), p1))), p3);
+            const Vec4::FloatType linear = Vec4::Sub(p2, p0);
+
+            const Vec4::FloatType polynomial = Vec4::Madd(t, Vec4::Madd(t, cubic, quadratic), linear);
+            return Vec4::Madd(Vec4::Mul(Vec4::Splat(0.5f), t), polynomial, p1);
+        }
+
+        void StoreLanes(const Vec4::FloatType& values, float* outValues, size_t count)
+        {
+            alignas(16) float lanes[LaneCount];
+            Vec4::StoreAligned(lanes, values);
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                outValues[lane] = lanes[lane];
+            }
+        }
+    } // namespace
+
+    void ImageGradientMipPyramid::Build(AZ::u32 width, AZ::u32 height, const PixelReader& getPixelValue)
+    {
+        m_levels.clear();
+
+        if ((width == 0) || (height == 0))
+        {
+            return;
+        }
+
+        // Every level halves the previous one, rounding up. Odd rows and columns are folded into the last pixel by
+        // clamping the second sample of the 2x2 box filter.
+        AZ::u32 sourceWidth = width;
+        AZ::u32 sourceHeight = height;
+        while ((sourceWidth > 1) || (sourceHeight > 1))
+        {
+            Level level;
+            level.m_width = (sourceWidth + 1) / 2;
+            level.m_height = (sourceHeight + 1) / 2;
+            level.m_values.resize(aznumeric_cast<size_t>(level.m_width) * level.m_height);
+
+            const Level* sourceLevel = m_levels.empty() ? nullptr : &m_levels.back();
+            auto getSourceValue = [&](AZ::u32 x, AZ::u32 y)
+            {
+                return sourceLevel ? sourceLevel->m_values[(aznumeric_cast<size_t>(y) * sourceWidth) + x] : getPixelValue(x, y);
+            };
+
+            for (AZ::u32 y = 0; y < level.m_height; ++y)
+            {
+                const AZ::u32 y0 = y * 2;
+                const AZ::u32 y1 = AZStd::min(y0 + 1, sourceHeight - 1);
+                for (AZ::u32 x = 0; x < level.m_width; ++x)
+                {
+                    const AZ::u32 x0 = x * 2;
+                    const AZ::u32 x1 = AZStd::min(x0 + 1, sourceWidth - 1);
+                    level.m_values[(aznumeric_cast<size_t>(y) * level.m_width) + x] = 0.25f *
+                        (getSourceValue(x0, y0) + getSourceValue(x1, y0) + getSourceValue(x0, y1) + getSourceValue(x1, y1));
+                }
+            }
+
+            sourceWidth = level.m_width;
+            sourceHeight = level.m_height;
+            m_levels.emplace_back(AZStd::move(level));
+        }
+    }
+
+    void ImageGradientMipPyramid::Clear()
+    {
+        m_levels.clear();
+    }
+
+    bool ImageGradientMipPyramid::IsEmpty() const
+    {
+        return m_levels.empty();
+    }
+
+    size_t ImageGradientMipPyramid::GetLevelCount() const
+    {
+        return m_levels.size();
+    }
+
+    const ImageGradientMipPyramid::Level& ImageGradientMipPyramid::GetLevel(size_t levelIndex) const
+    {
+        AZ_Assert((levelIndex > 0) && (levelIndex <= m_levels.size()), "Invalid mip pyramid level %zu", levelIndex);
+        return m_levels[levelIndex - 1];
+    }
+
+    size_t ImageGradientMipPyramid::GetMemoryUsage() const
+    {
+        size_t bytes = 0;
+        for (const Level& level : m_levels)
+        {
+            bytes += level.m_values.size() * sizeof(float);
+        }
+        return bytes;
+    }
+
+    size_t ImageGradientMipPyramid::SelectLevel(float footprintPixels) const
+    {
+        // Each level doubles the pixel size, so level N is the right choice for footprints of 2^N to 2^(N+1) pixels.
+        size_t level = 0;
+        while ((footprintPixels >= 2.0f) && (level < m_levels.size()))
+        {
+            footprintPixels *= 0.5f;
+            ++level;
+        }
+        return level;
+    }
+
+    void ImageGradientMipPyramid::SamplePoint(
+        size_t levelIndex, AZStd::span<const float> pixelX, AZStd::span<const float> pixelY, AZStd::span<float> outValues) const
+    {
+        const Level& level = GetLevel(levelIndex);
+
+        for (size_t index = 0; index < outValues.size(); index += LaneCount)
+        {
+            const size_t count = AZStd::min(LaneCount, outValues.size() - index);
+
+            int32_t x[LaneCount];
+            int32_t y[LaneCount];
+            Vec4::FloatType deltaX;
+            Vec4::FloatType deltaY;
+            GetBasePixels(&pixelX[index], &pixelY[index], count, level.m_width, level.m_height, x, y, deltaX, deltaY);
+
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                outValues[index + lane] = level.m_values[(aznumeric_cast<size_t>(y[lane]) * level.m_width) + x[lane]];
+            }
+        }
+    }
+
+    void ImageGradientMipPyramid::SampleBilinear(
+        size_t levelIndex, WrappingType wrappingType, AZStd::span<const float> pixelX, AZStd::span<const float> pixelY,
+        AZStd::span<float> outValues) const
+    {
+        const Level& level = GetLevel(levelIndex);
+
+        for (size_t index = 0; index < outValues.size(); index += LaneCount)
+        {
+            const size_t count = AZStd::min(LaneCount, outValues.size() - index);
+
+            int32_t x[LaneCount];
+            int32_t y[LaneCount];
+            Vec4::FloatType deltaX;
+            Vec4::FloatType deltaY;
+            GetBasePixels(&pixelX[index], &pixelY[index], count, level.m_width, level.m_height, x, y, deltaX, deltaY);
+
+            alignas(16) float corners[4][LaneCount] = {};
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                corners[0][lane] = GetWrappedValue(level, x[lane], y[lane], wrappingType);
+                corners[1][lane] = GetWrappedValue(level, x[lane] + 1, y[lane], wrappingType);
+                corners[2][lane] = GetWrappedValue(level, x[lane], y[lane] + 1, wrappingType);
+                corners[3][lane] = GetWrappedValue(level, x[lane] + 1, y[lane] + 1, wrappingType);
+            }
+
+            const Vec4::FloatType valueY0 = LerpKernel(Vec4::LoadAligned(corners[0]), Vec4::LoadAligned(corners[1]), deltaX);
+            const Vec4::FloatType valueY1 = LerpKernel(Vec4::LoadAligned(corners[2]), Vec4::LoadAligned(corners[3]), deltaX);
+            StoreLanes(LerpKernel(valueY0, valueY1, deltaY), &outValues[index], count);
+        }
+    }
+
+    void ImageGradientMipPyramid::SampleBicubic(
+        size_t levelIndex, WrappingType wrappingType, AZStd::span<const float> pixelX, AZStd::span<const float> pixelY,
+        AZStd::span<float> outValues) const
+    {
+        const Level& level = GetLevel(levelIndex);
+
+        for (size_t index = 0; index < outValues.size(); index += LaneCount)
+        {
+            const size_t count = AZStd::min(LaneCount, outValues.size() - index);
+
+            int32_t x[LaneCount];
+            int32_t y[LaneCount];
+            Vec4::FloatType deltaX;
+            Vec4::FloatType deltaY;
+            GetBasePixels(&pixelX[index], &pixelY[index], count, level.m_width, level.m_height, x, y, deltaX, deltaY);
+
+            // Gather the 4x4 neighborhood around each position, starting one pixel below and to the left of the base pixel.
+            alignas(16) float neighborhood[4][4][LaneCount] = {};
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                for (int32_t row = 0; row < 4; ++row)
+                {
+                    for (int32_t column = 0; column < 4; ++column)
+                    {
+                        neighborhood[row][column][lane] =
+                            GetWrappedValue(level, x[lane] + column - 1, y[lane] + row - 1, wrappingType);
+                    }
+                }
+            }
+
+            Vec4::FloatType rowValues[4];
+            for (size_t row = 0; row < 4; ++row)
+            {
+                rowValues[row] = CubicKernel(
+                    Vec4::LoadAligned(neighborhood[row][0]), Vec4::LoadAligned(neighborhood[row][1]),
+                    Vec4::LoadAligned(neighborhood[row][2]), Vec4::LoadAligned(neighborhood[row][3]), deltaX);
+            }
+
+            StoreLanes(CubicKernel(rowValues[0], rowValues[1], rowValues[2], rowValues[3], deltaY), &outValues[index], count);
+        }
+    }
+} // namespace GradientSignal
@@ -18,8 +18,11 @@
 #include <AzFramework/Asset/AssetCatalogBus.h>
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <GradientSignal/CompiledGradientSampler.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/Components/GradientTransformComponent.h>
+#include <GradientSignal/Components/ImageGradientComponent.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -168,6 +171,173 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceMaskGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceSlopeGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Gradient Chains
+
+    class GradientChainGetValues : public GradientSignalBenchmarkFixture
+    {
+    public:
+        const float TestShapeHalfBounds = 128.0f;
+
+        // Build a typical Perlin -> Levels -> Mixed (with Surface Slope) -> Threshold stack. The returned list keeps the entities alive,
+        // and the last entity is the root of the chain.
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> BuildTestGradientChain()
+        {
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+            entities.push_back(BuildTestPerlinGradient(TestShapeHalfBounds));
+            entities.push_back(BuildTestLevelsGradient(TestShapeHalfBounds, entities.back()->GetId()));
+            const AZ::EntityId levelsId = entities.back()->GetId();
+            entities.push_back(BuildTestSurfaceSlopeGradient(TestShapeHalfBounds));
+            entities.push_back(BuildTestMixedGradient(TestShapeHalfBounds, levelsId, entities.back()->GetId()));
+            entities.push_back(BuildTestThresholdGradient(TestShapeHalfBounds, entities.back()->GetId()));
+            return entities;
+        }
+
+        template<typename Sampler>
+        void RunRegionQueryBenchmark(benchmark::State& state, const Sampler& sampler)
+        {
+            const float height = aznumeric_cast<float>(state.range(0));
+            const float width = aznumeric_cast<float>(state.range(0));
+            const int64_t totalQueryPoints = state.range(0) * state.range(0);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<AZ::Vector3> positions(totalQueryPoints);
+                GradientSignalTestHelpers::FillQueryPositions(positions, height, width);
+
+                AZStd::vector<float> results(totalQueryPoints);
+                sampler.GetValues(positions, results);
+                benchmark::DoNotOptimize(results);
+            }
+
+            state.SetItemsProcessed(state.iterations() * totalQueryPoints);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(GradientChainGetValues, BM_GradientChain_SamplerGetValues)(benchmark::State& state)
+    {
+        auto entities = BuildTestGradientChain();
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entities.back()->GetId();
+        RunRegionQueryBenchmark(state, gradientSampler);
+    }
+
+    BENCHMARK_DEFINE_F(GradientChainGetValues, BM_GradientChain_CompiledSamplerGetValues)(benchmark::State& state)
+    {
+        auto entities = BuildTestGradientChain();
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entities.back()->GetId();
+        GradientSignal::CompiledGradientSampler compiledSampler(gradientSampler);
+        RunRegionQueryBenchmark(state, compiledSampler);
+    }
+
+    BENCHMARK_REGISTER_F(GradientChainGetValues, BM_GradientChain_SamplerGetValues)
+        ->Arg(1024)
+        ->Arg(2048)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(GradientChainGetValues, BM_GradientChain_CompiledSamplerGetValues)
+        ->Arg(1024)
+        ->Arg(2048)
+        ->Unit(::benchmark::kMillisecond);
+
+    // --------------------------------------------------------------------------------------
+    // Image Gradient Footprint Mips
+
+    class ImageGradientFootprintMips : public GradientSignalBenchmarkFixture
+    {
+    public:
+        const float TestShapeHalfBounds = 512.0f;
+        const AZ::u32 QueriesPerSide = 256;
+
+        AZStd::unique_ptr<AZ::Entity> BuildImageGradient(AZ::u32 imageSize, bool useFootprintMips)
+        {
+            auto entity = CreateTestEntity(TestShapeHalfBounds);
+            GradientSignal::ImageGradientConfig config;
+            config.m_imageAsset = UnitTest::CreateImageAsset(imageSize, imageSize, 12345);
+            config.m_samplingType = GradientSignal::SamplingType::Bilinear;
+            config.m_useFootprintMips = useFootprintMips;
+            entity->CreateComponent<GradientSignal::ImageGradientComponent>(config);
+
+            GradientSignal::GradientTransformConfig gradientTransformConfig;
+            gradientTransformConfig.m_wrappingType = GradientSignal::WrappingType::None;
+            entity->CreateComponent<GradientSignal::GradientTransformComponent>(gradientTransformConfig);
+
+            ActivateEntity(entity.get());
+            return entity;
+        }
+
+        // Query a grid that covers the whole gradient, so that the footprint of each query is (image size / QueriesPerSide) pixels.
+        AZStd::vector<AZ::Vector3> BuildQueryPositions()
+        {
+            const float spacing = (TestShapeHalfBounds * 2.0f) / QueriesPerSide;
+            AZStd::vector<AZ::Vector3> positions;
+            positions.reserve(QueriesPerSide * QueriesPerSide);
+            for (AZ::u32 y = 0; y < QueriesPerSide; ++y)
+            {
+                for (AZ::u32 x = 0; x < QueriesPerSide; ++x)
+                {
+                    positions.emplace_back(x * spacing, y * spacing, 0.0f);
+                }
+            }
+            return positions;
+        }
+    };
+
+    BENCHMARK_DEFINE_F(ImageGradientFootprintMips, BM_ImageGradientCoarseRegion)(benchmark::State& state)
+    {
+        // Arguments: the image size, and whether or not footprint mips are enabled.
+        const AZ::u32 imageSize = aznumeric_cast<AZ::u32>(state.range(0));
+        const bool useFootprintMips = (state.range(1) != 0);
+
+        auto referenceEntity = BuildImageGradient(imageSize, false);
+        auto entity = BuildImageGradient(imageSize, useFootprintMips);
+
+        const AZStd::vector<AZ::Vector3> positions = BuildQueryPositions();
+        AZStd::vector<float> referenceResults(positions.size());
+        AZStd::vector<float> results(positions.size());
+
+        GradientSignal::GradientSampler referenceSampler;
+        referenceSampler.m_gradientId = referenceEntity->GetId();
+        referenceSampler.GetValues(positions, referenceResults);
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            gradientSampler.GetValues(positions, results);
+            benchmark::DoNotOptimize(results);
+        }
+
+        // Report how far the results drift from the full resolution values, along with the extra memory that the mips use.
+        double totalError = 0.0;
+        float maxError = 0.0f;
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            const float error = AZStd::abs(results[index] - referenceResults[index]);
+            totalError += error;
+            maxError = AZStd::max(maxError, error);
+        }
+
+        auto imageGradient = entity->FindComponent<GradientSignal::ImageGradientComponent>();
+        state.counters["MipBytes"] = aznumeric_cast<double>(imageGradient->GetFootprintMipsMemoryUsage());
+        state.counters["MeanError"] = totalError / results.size();
+        state.counters["MaxError"] = maxError;
+        state.SetItemsProcessed(state.iterations() * positions.size());
+    }
+
+    BENCHMARK_REGISTER_F(ImageGradientFootprintMips, BM_ImageGradientCoarseRegion)
+        ->Args({ 256, 0 })
+        ->Args({ 256, 1 })
+        ->Args({ 1024, 0 })
+        ->Args({ 1024, 1 })
+        ->Args({ 4096, 0 })
+        ->Args({ 4096, 1 })
+        ->Unit(::benchmark::kMillisecond);
+
     // --------------------------------------------------------------------------------------
     // Gradient Surface Data
 
@@ -10,6 +10,8 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/CompiledGradientSampler.h>
+#include <GradientSignal/Ebuses/ConstantGradientRequestBus.h>
 
 namespace UnitTest
 {
@@ -19,6 +21,32 @@ namespace UnitTest
         // Create an arbitrary size shape for comparing values within. It should be large enough that we detect any value anomalies
         // but small enough that the tests run quickly.
         const float TestShapeHalfBounds = 128.0f;
+
+        // Verify that a CompiledGradientSampler produces the same values as the GradientSampler it was built from.
+        void CompareCompiledAndGradientSampler(const GradientSignal::GradientSampler& gradientSampler)
+        {
+            GradientSignal::CompiledGradientSampler compiledSampler(gradientSampler);
+
+            // Use a query count that isn't a multiple of the plan's tile size, so that the partial tile gets verified too.
+            AZStd::vector<AZ::Vector3> positions;
+            for (float y = 0.0f; y < TestShapeHalfBounds * 2.0f; y += 1.0f)
+            {
+                for (float x = 0.0f; x < TestShapeHalfBounds * 2.0f - 1.0f; x += 1.0f)
+                {
+                    positions.emplace_back(x, y, 0.0f);
+                }
+            }
+
+            AZStd::vector<float> expectedResults(positions.size());
+            AZStd::vector<float> compiledResults(positions.size());
+            gradientSampler.GetValues(positions, expectedResults);
+            compiledSampler.GetValues(positions, compiledResults);
+
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                ASSERT_NEAR(expectedResults[index], compiledResults[index], 0.00001f);
+            }
+        }
     };
 
     TEST_F(GradientSignalGetValuesTestsFixture, ImageGradientComponent_VerifyGetValueAndGetValuesMatch)
@@ -128,6 +156,65 @@ namespace UnitTest
         auto entity = BuildTestSurfaceSlopeGradient(TestShapeHalfBounds);
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
-}
 
+    TEST_F(GradientSignalGetValuesTestsFixture, CompiledGradientSampler_VerifyFusedChainMatchesGradientSampler)
+    {
+        // Build a chain that uses every gradient type that gets fused into the evaluation plan, with Perlin and Random leaves.
+        auto perlinEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, perlinEntity->GetId());
+        auto randomEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestMixedGradient(TestShapeHalfBounds, levelsEntity->GetId(), randomEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, mixedEntity->GetId());
+        auto referenceEntity = BuildTestReferenceGradient(TestShapeHalfBounds, posterizeEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, referenceEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, invertEntity->GetId());
+        auto thresholdEntity = BuildTestThresholdGradient(TestShapeHalfBounds, levelsEntity->GetId());
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = smoothStepEntity->GetId();
+        CompareCompiledAndGradientSampler(gradientSampler);
+
+        // The sampler settings are fused into the plan too.
+        gradientSampler.m_invertInput = true;
+        gradientSampler.m_enableLevels = true;
+        gradientSampler.m_inputMid = 0.5f;
+        gradientSampler.m_outputMax = 0.8f;
+        gradientSampler.m_opacity = 0.5f;
+        CompareCompiledAndGradientSampler(gradientSampler);
+
+        gradientSampler.m_gradientId = thresholdEntity->GetId();
+        CompareCompiledAndGradientSampler(gradientSampler);
+
+        // Transformed samplers are evaluated by the sampler itself.
+        gradientSampler.m_enableTransform = true;
+        gradientSampler.m_translate = AZ::Vector3(16.0f, 8.0f, 0.0f);
+        CompareCompiledAndGradientSampler(gradientSampler);
+    }
 
+    TEST_F(GradientSignalGetValuesTestsFixture, CompiledGradientSampler_RecompilesWhenGradientChanges)
+    {
+        auto constantEntity = BuildTestConstantGradient(TestShapeHalfBounds, 0.25f);
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, constantEntity->GetId());
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = invertEntity->GetId();
+        GradientSignal::CompiledGradientSampler compiledSampler(gradientSampler);
+        EXPECT_GT(compiledSampler.GetFusedStageCount(), 0);
+
+        AZStd::vector<AZ::Vector3> positions(4, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        AZStd::vector<float> results(positions.size());
+        compiledSampler.GetValues(positions, results);
+        EXPECT_NEAR(results[0], 0.75f, 0.00001f);
+
+        // Changing an input of the sampled gradient should be picked up through the dependency notifications.
+        GradientSignal::ConstantGradientRequestBus::Event(
+            constantEntity->GetId(), &GradientSignal::ConstantGradientRequestBus::Events::SetConstantValue, 0.5f);
+        compiledSampler.GetValues(positions, results);
+        EXPECT_NEAR(results[0], 0.5f, 0.00001f);
+
+        // Deactivating the sampled gradient makes it produce 0, the same as a GradientSampler would.
+        invertEntity->Deactivate();
+        compiledSampler.GetValues(positions, results);
+        EXPECT_NEAR(results[0], 0.0f, 0.00001f);
+    }
+}
@@ -739,6 +739,123 @@ namespace UnitTest
         }
     }
 
+    TEST_F(GradientSignalImageTestsFixture, ImageGradientComponentFootprintMipsAverageCoarseQueries)
+    {
+        // Map a 64 x 64 image 1:1 onto a 64 x 64 meter box, with footprint mips enabled.
+        constexpr AZ::u32 ImageSize = 64;
+        constexpr float HalfBounds = ImageSize / 2.0f;
+        auto entity = CreateTestEntity(HalfBounds);
+
+        GradientSignal::ImageGradientConfig config;
+        config.m_imageAsset = UnitTest::CreateImageAsset(ImageSize, ImageSize, 12345);
+        config.m_useFootprintMips = true;
+        entity->CreateComponent<GradientSignal::ImageGradientComponent>(config);
+        entity->CreateComponent<GradientSignal::GradientTransformComponent>(GradientSignal::GradientTransformConfig());
+        ActivateEntity(entity.get());
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+
+        // Query a grid with a 4 meter spacing, which covers 4 x 4 pixels per position. The positions are offset from the
+        // block corners so that the pixel lookups don't land on pixel boundaries.
+        constexpr AZ::u32 Spacing = 4;
+        constexpr AZ::u32 QueriesPerSide = ImageSize / Spacing;
+        AZStd::vector<AZ::Vector3> positions;
+        for (AZ::u32 y = 0; y < QueriesPerSide; ++y)
+        {
+            for (AZ::u32 x = 0; x < QueriesPerSide; ++x)
+            {
+                positions.emplace_back(aznumeric_cast<float>(x * Spacing) + 1.5f, aznumeric_cast<float>(y * Spacing) + 1.5f, 0.0f);
+            }
+        }
+
+        AZStd::vector<float> results(positions.size());
+        gradientSampler.GetValues(positions, results);
+
+        // Each coarse query should return the average of the 4 x 4 block of pixels it covers.
+        // Single queries always use the full resolution image, so use them to read the individual pixels.
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const float blockX = AZStd::floor(positions[index].GetX() / Spacing) * Spacing;
+            const float blockY = AZStd::floor(positions[index].GetY() / Spacing) * Spacing;
+
+            float expectedValue = 0.0f;
+            for (AZ::u32 pixelY = 0; pixelY < Spacing; ++pixelY)
+            {
+                for (AZ::u32 pixelX = 0; pixelX < Spacing; ++pixelX)
+                {
+                    GradientSignal::GradientSampleParams params;
+                    params.m_position = AZ::Vector3(blockX + pixelX + 0.5f, blockY + pixelY + 0.5f, 0.0f);
+                    expectedValue += gradientSampler.GetValue(params);
+                }
+            }
+            expectedValue /= (Spacing * Spacing);
+
+            EXPECT_NEAR(results[index], expectedValue, 0.0001f);
+        }
+
+        // The image is 64 x 64, so the downsampled levels are 32 x 32 down to 1 x 1.
+        auto imageGradient = entity->FindComponent<GradientSignal::ImageGradientComponent>();
+        EXPECT_EQ(imageGradient->GetFootprintMipsMemoryUsage(), (32 * 32 + 16 * 16 + 8 * 8 + 4 * 4 + 2 * 2 + 1) * sizeof(float));
+    }
+
+    TEST_F(GradientSignalImageTestsFixture, ImageGradientComponentFootprintMipsRebuiltAfterImageModification)
+    {
+        // Map a 64 x 64 image 1:1 onto a 64 x 64 meter box, with footprint mips enabled.
+        constexpr AZ::u32 ImageSize = 64;
+        constexpr float HalfBounds = ImageSize / 2.0f;
+        auto entity = CreateTestEntity(HalfBounds);
+
+        GradientSignal::ImageGradientConfig config;
+        config.m_imageAsset = UnitTest::CreateImageAsset(ImageSize, ImageSize, 12345);
+        config.m_useFootprintMips = true;
+        entity->CreateComponent<GradientSignal::ImageGradientComponent>(config);
+        entity->CreateComponent<GradientSignal::GradientTransformComponent>(GradientSignal::GradientTransformConfig());
+        ActivateEntity(entity.get());
+
+        auto imageGradient = entity->FindComponent<GradientSignal::ImageGradientComponent>();
+        constexpr size_t FootprintMipsSize = (32 * 32 + 16 * 16 + 8 * 8 + 4 * 4 + 2 * 2 + 1) * sizeof(float);
+        EXPECT_EQ(imageGradient->GetFootprintMipsMemoryUsage(), FootprintMipsSize);
+
+        // The downsampled levels aren't used while the image is being painted.
+        imageGradient->StartImageModification();
+        EXPECT_EQ(imageGradient->GetFootprintMipsMemoryUsage(), 0u);
+
+        // Paint the 4 x 4 block of pixels in the corner of the image.
+        constexpr AZ::u32 Spacing = 4;
+        AZStd::vector<AZ::Vector3> paintPositions;
+        for (AZ::u32 y = 0; y < Spacing; ++y)
+        {
+            for (AZ::u32 x = 0; x < Spacing; ++x)
+            {
+                paintPositions.emplace_back(x + 0.5f, y + 0.5f, 0.0f);
+            }
+        }
+        AZStd::vector<float> paintValues(paintPositions.size(), 1.0f);
+        imageGradient->SetPixelValuesByPosition(paintPositions, paintValues);
+
+        // Ending the modification rebuilds the downsampled levels from the painted image.
+        imageGradient->EndImageModification();
+        EXPECT_EQ(imageGradient->GetFootprintMipsMemoryUsage(), FootprintMipsSize);
+
+        // A coarse query over the painted block returns the average of the painted pixels.
+        constexpr AZ::u32 QueriesPerSide = ImageSize / Spacing;
+        AZStd::vector<AZ::Vector3> positions;
+        for (AZ::u32 y = 0; y < QueriesPerSide; ++y)
+        {
+            for (AZ::u32 x = 0; x < QueriesPerSide; ++x)
+            {
+                positions.emplace_back(aznumeric_cast<float>(x * Spacing) + 1.5f, aznumeric_cast<float>(y * Spacing) + 1.5f, 0.0f);
+            }
+        }
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+        AZStd::vector<float> results(positions.size());
+        gradientSampler.GetValues(positions, results);
+        EXPECT_NEAR(results[0], 1.0f, 0.0001f);
+    }
+
     TEST_F(GradientSignalImageTestsFixture, GradientTransformComponent_TransformTypes)
     {
         // Verify that each transform type for the transform component works correctly.
@@ -7,8 +7,11 @@
 #
 
 set(FILES
+    Include/GradientSignal/CompiledGradientSampler.h
+    Include/GradientSignal/GradientEvaluationPlan.h
     Include/GradientSignal/GradientSampler.h
     Include/GradientSignal/GradientTransform.h
+    Include/GradientSignal/ImageGradientMipPyramid.h
     Include/GradientSignal/SmoothStep.h
     Include/GradientSignal/PerlinImprovedNoise.h
     Include/GradientSignal/Util.h
@@ -75,10 +78,13 @@ set(FILES
     Source/Components/SurfaceMaskGradientComponent.cpp
     Source/Components/SurfaceSlopeGradientComponent.cpp
     Source/Components/ThresholdGradientComponent.cpp
+    Source/CompiledGradientSampler.cpp
+    Source/GradientEvaluationPlan.cpp
     Source/GradientSampler.cpp
     Source/GradientSignalSystemComponent.cpp
     Source/GradientSignalSystemComponent.h
     Source/GradientTransform.cpp
+    Source/ImageGradientMipPyramid.cpp
     Source/SmoothStep.cpp
     Source/PerlinImprovedNoise.cpp
 )
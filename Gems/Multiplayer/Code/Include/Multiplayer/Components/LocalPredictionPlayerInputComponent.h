@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/LocalPredictionPlayerInputComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/IMultiplayerDebug.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
 
 namespace Multiplayer
@@ -87,6 +88,20 @@ namespace Multiplayer
 
 #if AZ_TRAIT_SERVER
         void UpdateBankedTime(AZ::TimeMs deltaTimeMs);
+
+        //! Processes all new inputs within the input array, returns false if the array was discarded as old or out of order.
+        bool ProcessClientInput(AzNetworking::ConnectionId invokingConnectionId, const NetworkInputArray& inputArray);
+
+        //! Compares the client's state hash against local state, and sends the client a correction if they differ.
+        void CorrectClientIfDesynced(const AZ::HashValue32& stateHash);
+
+        //! Queues received inputs on the NetworkInputScheduler to be processed alongside inputs from other connections.
+        void QueueClientInput(AzNetworking::ConnectionId invokingConnectionId, const NetworkInputArray& inputArray, const AZ::HashValue32& stateHash);
+        void ProcessQueuedClientInputs();
+        void MergeQueuedClientInputs();
+
+        //! Adds any audit entries recorded while processing inputs to the audit trail, must be invoked from the main thread.
+        void FlushInputAuditEntries();
 #endif
 
         bool SerializeEntityCorrection(AzNetworking::ISerializer& serializer);
@@ -116,6 +131,24 @@ namespace Multiplayer
         double m_clientBankedTime = 0.0;
         AZ::TimeMs m_lastInputReceivedTimeMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_lastCorrectionSentTimeMs = AZ::Time::ZeroTimeMs;
+
+        struct QueuedClientInput
+        {
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            NetworkInputArray m_inputArray;
+            AZ::HashValue32 m_stateHash = AZ::HashValue32{ 0 };
+        };
+        AZStd::vector<QueuedClientInput> m_queuedClientInputs; // Inputs awaiting the scheduler's parallel input phase, in receive order
+        AZ::HashValue32 m_queuedCorrectionHash = AZ::HashValue32{ 0 }; // State hash of the last queued input array that was processed
+        bool m_hasQueuedCorrectionHash = false;
+
+        struct InputAuditEntry
+        {
+            ClientInputId m_inputId = ClientInputId{ 0 };
+            HostFrameId m_hostFrameId = InvalidHostFrameId;
+            AZStd::vector<MultiplayerAuditingElement> m_inputLogs;
+        };
+        AZStd::vector<InputAuditEntry> m_pendingInputAudits; // Audit entries are deferred since inputs may be processed off the main thread
 #endif
 
 #if AZ_TRAIT_CLIENT
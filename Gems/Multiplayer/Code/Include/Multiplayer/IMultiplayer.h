@@ -298,6 +298,21 @@ namespace Multiplayer
         float m_previousBlendFactor = DefaultBlendFactor;
     };
 
+    //! @class ScopedThreadTime
+    //! @brief This is a wrapper that binds any time alterations on the calling thread to that thread for the lifetime of the scope.
+    class ScopedThreadTime final
+    {
+    public:
+        inline ScopedThreadTime()
+        {
+            GetNetworkTime()->BeginThreadTimeScope();
+        }
+        inline ~ScopedThreadTime()
+        {
+            GetNetworkTime()->EndThreadTimeScope();
+        }
+    };
+
     inline const char* GetEnumString(MultiplayerAgentType value)
     {
         switch (value)
@@ -10,6 +10,7 @@
 
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationBandwidthScheduler.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -121,6 +122,7 @@ namespace Multiplayer
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
+        float GetReplicationPriority(const EntityReplicator& replicator) const;
 
         void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
@@ -210,6 +212,13 @@ namespace Multiplayer
         AZStd::unique_ptr<IReplicationWindow> m_replicationWindow;
         AZStd::unique_ptr<IEntityDomain> m_remoteEntityDomain;
 
+        // Bandwidth scheduling state, candidate storage is reused between ticks to avoid reallocating
+        ReplicationBandwidthScheduler m_bandwidthScheduler;
+        ReplicationBandwidthScheduler::CandidateList m_bandwidthCandidates;
+        ReplicationBandwidthScheduler::SelectedIndices m_bandwidthSelected;
+        AZStd::vector<EntityReplicator*> m_bandwidthCandidateReplicators;
+        AZ::TimeMs m_lastBandwidthTickMs = AZ::Time::ZeroTimeMs;
+
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_entityPendingRemovalMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_frameTimeMs = AZ::Time::ZeroTimeMs;
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! @class ReplicationBandwidthScheduler
+    //! @brief Decides which entity updates a single connection can afford to send each tick.
+    //!
+    //! The scheduler maintains a byte budget that refills at the send rate estimated by the connection's congestion
+    //! control, capped to sv_ReplicationBandwidthBurstMs worth of data. Each tick, every entity with pending changes
+    //! adds its replication priority to an accumulator, so entities that are repeatedly deferred grow more urgent over
+    //! time. Mandatory updates (autonomous entities) are always selected, and the remaining candidates are admitted in
+    //! order of accumulated priority for as long as their estimated update size fits the budget. When the connection
+    //! is congested, low priority entities therefore update less often rather than all entities stalling together.
+    class ReplicationBandwidthScheduler
+    {
+    public:
+
+        struct Candidate
+        {
+            NetEntityId m_entityId = InvalidNetEntityId;
+            float m_priority = 0.0f;
+            bool m_mandatory = false;
+        };
+        using CandidateList = AZStd::vector<Candidate>;
+        using SelectedIndices = AZStd::vector<uint32_t>;
+
+        //! Refills the byte budget for a new tick.
+        //! @param sendRateBytesPerSecond the currently sustainable send rate for the connection
+        //! @param deltaTimeMs            the time elapsed since the previous tick
+        void BeginTick(float sendRateBytesPerSecond, AZ::TimeMs deltaTimeMs);
+
+        //! Selects the candidates to send updates for this tick.
+        //! @param candidates       all entities with pending changes for this tick
+        //! @param maxOptionalCount the maximum number of non-mandatory candidates to select
+        //! @param outSelected      receives the indices of selected candidates, mandatory candidates first
+        void SelectUpdates(const CandidateList& candidates, uint32_t maxOptionalCount, SelectedIndices& outSelected);
+
+        //! Deducts the actual size of a sent update from the budget and refines the size estimate for the entity.
+        //! @param entityId  the entity the update was sent for
+        //! @param sizeBytes the serialized size of the update
+        void RecordSentUpdate(NetEntityId entityId, uint32_t sizeBytes);
+
+        //! Discards all state tracked for an entity that is no longer replicated.
+        //! @param entityId the entity to discard state for
+        void RemoveEntity(NetEntityId entityId);
+
+        //! Returns the number of bytes that may still be sent this tick, negative if the budget has been overdrawn.
+        //! @return the number of bytes that may still be sent this tick
+        float GetBudgetBytes() const;
+
+        //! Returns the number of candidates deferred by the last call to SelectUpdates.
+        //! @return the number of candidates deferred by the last call to SelectUpdates
+        uint32_t GetLastDeferredCount() const;
+
+        //! Returns the accumulated priority of an entity, zero if it has none.
+        //! @return the accumulated priority of an entity
+        float GetAccumulatedPriority(NetEntityId entityId) const;
+
+    private:
+
+        struct EntityEntry
+        {
+            float m_accumulatedPriority = 0.0f;
+            float m_estimatedSizeBytes = 0.0f;
+        };
+
+        float GetEstimatedSize(const EntityEntry& entry) const;
+
+        AZStd::unordered_map<NetEntityId, EntityEntry> m_entries;
+        AZStd::vector<uint32_t> m_optionalIndices; // Reused between ticks to avoid reallocating
+        float m_budgetBytes = 0.0f;
+        uint32_t m_lastDeferredCount = 0;
+        bool m_hasTicked = false;
+    };
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+
+namespace AZ
+{
+    class JobContext;
+}
+
+namespace Multiplayer
+{
+    //! @class NetworkInputScheduler
+    //! @brief Processes queued client inputs for several connections concurrently on the server.
+    //!
+    //! Each queued work item describes the inputs received from a single connection along with the entities of the
+    //! hierarchy it controls and the world bounds of that hierarchy. On execute, items are sorted by connection id and
+    //! greedily placed into waves such that no two items within a wave share an entity or have overlapping bounds. Both
+    //! bounds are expanded by sv_RewindVolumeExtrudeDistance plus sv_ParallelInputConflictDistance, so the entities that
+    //! one item syncs to its rewound frame and moves through are never rewound by another item of the same wave. Waves run
+    //! one after another, and the process functions of all
+    //! items within a wave run concurrently, each inside its own thread time scope. Once all waves complete, the merge
+    //! functions run serially on the calling thread in connection id order, so any results that touch shared state
+    //! (sending corrections, audit trails, stats) are applied deterministically regardless of thread timing.
+    //!
+    //! Parallel processing is opt-in through sv_ParallelInputProcessing, and is only safe if all multiplayer
+    //! component controllers that process input restrict their writes to their own hierarchy.
+    class NetworkInputScheduler
+    {
+    public:
+        AZ_RTTI(NetworkInputScheduler, "{5C1E2F7B-3A8D-4E6B-9F0C-7D2A4B8E1C36}");
+
+        //! Invoked on a worker thread, this is where inputs should be processed.
+        using ProcessFunction = AZStd::function<void()>;
+
+        //! Invoked on the thread that executed the scheduler once all inputs have been processed.
+        using MergeFunction = AZStd::function<void()>;
+
+        NetworkInputScheduler();
+        virtual ~NetworkInputScheduler();
+
+        //! Returns true if client inputs should be queued on the scheduler rather than processed on receipt.
+        //! @return boolean true if parallel input processing is enabled
+        static bool IsParallelProcessingEnabled();
+
+        //! Queues input processing work for a single connection.
+        //! @param owner              opaque key identifying the queuing object, used to cancel the work
+        //! @param connectionId       the connection the inputs were received from, determines merge order
+        //! @param hierarchyEntities  the entities that may be written to while processing the inputs
+        //! @param hierarchyBounds    the world bounds of the hierarchy, work with a null aabb conflicts with all other work
+        //! @param processFunction    the function that processes the inputs
+        //! @param mergeFunction      the function that applies results to shared state
+        void QueueWork
+        (
+            const void* owner,
+            AzNetworking::ConnectionId connectionId,
+            AZStd::vector<AZ::EntityId>&& hierarchyEntities,
+            const AZ::Aabb& hierarchyBounds,
+            ProcessFunction&& processFunction,
+            MergeFunction&& mergeFunction
+        );
+
+        //! Discards any queued work belonging to the provided owner without executing it.
+        //! @param owner the key the work was queued with
+        void CancelWork(const void* owner);
+
+        //! Processes and merges all queued work, then clears the queue.
+        //! @param jobContext the job context to run process functions on, nullptr uses the global job context
+        void Execute(AZ::JobContext* jobContext = nullptr);
+
+        //! Returns the number of work items currently queued.
+        //! @return the number of work items currently queued
+        uint32_t GetWorkCount() const;
+
+        //! Returns the number of waves executed by the last call to Execute.
+        //! @return the number of waves executed by the last call to Execute
+        uint32_t GetLastWaveCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(NetworkInputScheduler);
+
+        struct InputWork
+        {
+            const void* m_owner = nullptr;
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            AZStd::vector<AZ::EntityId> m_hierarchyEntities;
+            AZ::Aabb m_hierarchyBounds = AZ::Aabb::CreateNull();
+            ProcessFunction m_processFunction;
+            MergeFunction m_mergeFunction;
+        };
+
+        struct InputWave
+        {
+            AZStd::vector<uint32_t> m_workIndices;
+            AZStd::unordered_set<AZ::EntityId> m_entities;
+            AZStd::vector<AZ::Aabb> m_bounds;
+            //! True if the wave holds work without valid bounds, which may not run alongside any other work.
+            bool m_isUnbounded = false;
+        };
+
+        //! Returns true if the provided work may run concurrently with all work already placed in the wave.
+        bool CanJoinWave(const InputWave& wave, const InputWork& work) const;
+
+        void ProcessWave(const InputWave& wave, AZ::JobContext* jobContext);
+
+        AZStd::vector<InputWork> m_work;
+        AZStd::vector<InputWave> m_waves; // Reused between executes to avoid reallocating wave storage
+        uint32_t m_lastWaveCount = 0;
+        float m_conflictExpansion = 0.0f; // Distance both sides are expanded by for the overlap tests of the current execute
+    };
+}
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/span.h>
 #include <AzCore/Time/ITime.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
@@ -68,9 +69,24 @@ namespace Multiplayer
         //! @param rewindVolume the volume to rewind entities within (needed for physics entities)
         virtual void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) = 0;
 
+        //! Syncs all entities overlapping any of the provided volumes to the current rewind state.
+        //! The visibility system is queried once using the union of all volumes, and each entity is synced at most once.
+        //! @param rewindVolumes the set of volumes to rewind entities within (needed for physics entities)
+        virtual void SyncEntitiesToRewindState(AZStd::span<const AZ::Aabb> rewindVolumes) = 0;
+
         //! Restores all rewound entities to the current application time.
+        //! This does nothing inside a thread time scope, since other scopes may still use the shared rewound state. Whoever runs the
+        //! thread scopes has to call it from the main thread once they have all ended, as NetworkInputScheduler does after each wave.
         virtual void ClearRewoundEntities() = 0;
 
+        //! Begins a thread local time scope on the calling thread, seeded with the current unaltered network time.
+        //! Until the scope ends, time altered on the calling thread is only visible to that thread, allowing inputs for
+        //! several connections to be processed concurrently. Rewound entities are shared and are only restored by the main thread.
+        virtual void BeginThreadTimeScope() = 0;
+
+        //! Ends the calling thread's thread local time scope.
+        virtual void EndThreadTimeScope() = 0;
+
         AZ_DISABLE_COPY_MOVE(INetworkTime);
     };
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! Connection id bound to network time while a batch syncs rewound entities.
+    //! No entity is owned by this connection, so 'don't rewind the shooter' semantics never apply to the shared sync.
+    static constexpr AzNetworking::ConnectionId RewindBatchConnectionId = AzNetworking::ConnectionId{ 0xFFFFFFFE };
+
+    //! @class RewindBatch
+    //! @brief Groups lag compensated queries by target frame so the world is rewound and restored once per frame.
+    //!
+    //! Issuing a separate rewind for every shot in a tick re-enumerates the visibility system and re-syncs every hit
+    //! volume in range for each query. A RewindBatch instead collects all of the queries for a tick, and for each
+    //! distinct frame and blend factor syncs only the entities overlapping the queried volumes, runs that frame's
+    //! queries back to back, and then restores the rewound entities once.
+    //!
+    //! Entities are synced under RewindBatchConnectionId, so a shooter's own hit volumes are rewound along with
+    //! everyone else's. Queries should exclude the shooter's own entity, as regular lag compensated queries already do.
+    class RewindBatch
+    {
+    public:
+        //! Callback issued while the world is rewound to the query's frame, this is where scene queries should be performed.
+        using QueryCallback = AZStd::function<void()>;
+
+        RewindBatch() = default;
+        ~RewindBatch() = default;
+
+        //! Adds a lag compensated query to the batch.
+        //! @param frameId            the HostFrameId to rewind to
+        //! @param timeMs             the HostTimeMs to rewind to
+        //! @param blendFactor        the factor used to blend between values at the current and previous HostFrameId
+        //! @param rewindConnectionId the ConnectionId of the connection issuing the query
+        //! @param queryVolume        the volume the query may touch, entities outside all query volumes are not rewound
+        //! @param queryCallback      the callback to invoke while rewound
+        void AddQuery
+        (
+            HostFrameId frameId,
+            AZ::TimeMs timeMs,
+            float blendFactor,
+            AzNetworking::ConnectionId rewindConnectionId,
+            const AZ::Aabb& queryVolume,
+            QueryCallback&& queryCallback
+        );
+
+        //! Rewinds, executes and restores all queued queries, then clears the batch.
+        //! Must be invoked outside of any rewound time scope.
+        void Execute();
+
+        //! Discards all queued queries without executing them.
+        void Clear();
+
+        //! Returns the number of queries currently queued.
+        //! @return the number of queries currently queued
+        uint32_t GetQueryCount() const;
+
+        //! Returns the number of distinct rewinds performed by the last call to Execute.
+        //! @return the number of distinct rewinds performed by the last call to Execute
+        uint32_t GetLastRewindCount() const;
+
+    private:
+
+        struct RewindQuery
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AZ::TimeMs m_timeMs = AZ::Time::ZeroTimeMs;
+            float m_blendFactor = DefaultBlendFactor;
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            AZ::Aabb m_queryVolume = AZ::Aabb::CreateNull();
+            QueryCallback m_queryCallback;
+        };
+
+        AZStd::vector<RewindQuery> m_queries;
+        AZStd::vector<AZ::Aabb> m_rewindVolumes; // Scratch storage for the volumes of a single rewind, reused between executes
+        uint32_t m_lastRewindCount = 0;
+    };
+}
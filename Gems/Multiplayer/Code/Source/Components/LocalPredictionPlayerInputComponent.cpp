@@ -13,8 +13,10 @@
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
 #include <AzNetworking/Serialization/HashSerializer.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <Multiplayer/MultiplayerDebug.h>
+#include <Multiplayer/NetworkInput/NetworkInputScheduler.h>
 
 namespace Multiplayer
 {
@@ -165,6 +167,18 @@ namespace Multiplayer
 
     void LocalPredictionPlayerInputComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+#if AZ_TRAIT_SERVER
+        if (!m_queuedClientInputs.empty())
+        {
+            // Inputs that were never processed are dropped, the client resends them after migration
+            if (NetworkInputScheduler* networkInputScheduler = AZ::Interface<NetworkInputScheduler>::Get())
+            {
+                networkInputScheduler->CancelWork(this);
+            }
+            m_queuedClientInputs.clear();
+        }
+#endif
+
 #if AZ_TRAIT_CLIENT
         if (IsNetEntityRoleAutonomous())
         {
@@ -200,17 +214,31 @@ namespace Multiplayer
             m_updateBankedTimeEvent.Enqueue(sv_InputUpdateTimeMs, true);
         }
 
+        if (NetworkInputScheduler::IsParallelProcessingEnabled() && AZ::Interface<NetworkInputScheduler>::Get() != nullptr)
+        {
+            QueueClientInput(invokingConnection->GetConnectionId(), inputArray, stateHash);
+            return;
+        }
+
+        if (ProcessClientInput(invokingConnection->GetConnectionId(), inputArray))
+        {
+            FlushInputAuditEntries();
+            CorrectClientIfDesynced(stateHash);
+        }
+    }
+
+    bool LocalPredictionPlayerInputComponentController::ProcessClientInput(AzNetworking::ConnectionId invokingConnectionId, const NetworkInputArray& inputArray)
+    {
         const ClientInputId clientInputId = inputArray[0].GetClientInputId();
         if (!AzNetworking::SequenceMoreRecent(clientInputId, m_lastClientInputId))
         {
             AZLOG(NET_Prediction, "Discarding old or out of order move input (current: %u, received %u)",
                 aznumeric_cast<uint32_t>(m_lastClientInputId), aznumeric_cast<uint32_t>(clientInputId));
-            return;
+            return false;
         }
 
-        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
         const double clientInputRateSec = AZ::TimeMsToSecondsDouble(cl_InputRateMs);
-        m_lastInputReceivedTimeMs = currentTimeMs;
+        m_lastInputReceivedTimeMs = AZ::GetElapsedTimeMs();
 
         // Keep track of last inputs received, also allows us to update frame ids
         m_lastInputReceived = inputArray;
@@ -236,7 +264,7 @@ namespace Multiplayer
             {
                 m_clientBankedTime = AZStd::min(m_clientBankedTime + clientInputRateSec, (double)sv_MaxBankTimeWindowSec); // clamp to boundary
                 {
-                    ScopedAlterTime scopedTime(input.GetHostFrameId(), input.GetHostTimeMs(), input.GetHostBlendFactor(), invokingConnection->GetConnectionId());
+                    ScopedAlterTime scopedTime(input.GetHostFrameId(), input.GetHostTimeMs(), input.GetHostBlendFactor(), invokingConnectionId);
                     GetNetBindComponent()->ProcessInput(input, static_cast<float>(clientInputRateSec));
                 }
 
@@ -249,19 +277,11 @@ namespace Multiplayer
 #ifndef AZ_RELEASE_BUILD
                     if (cl_EnableDesyncDebugging && cl_DesyncDebugging_AuditInputs)
                     {
-                        // Add to Audit Trail here (server)
-                        if (IMultiplayerDebug* mpDebug = AZ::Interface<IMultiplayerDebug>::Get())
+                        // Record for the audit trail (server), entries are added once processing completes on the main thread
+                        AZStd::vector<MultiplayerAuditingElement> inputLogs = input.GetComponentInputDeltaLogs();
+                        if (!inputLogs.empty())
                         {
-                            AZStd::vector<MultiplayerAuditingElement> inputLogs = input.GetComponentInputDeltaLogs();
-                            if (!inputLogs.empty())
-                            {
-                                mpDebug->AddAuditEntry(
-                                    AuditCategory::Input,
-                                    input.GetClientInputId(),
-                                    input.GetHostFrameId(),
-                                    GetEntity()->GetName(),
-                                    AZStd::move(inputLogs));
-                            }
+                            m_pendingInputAudits.push_back(InputAuditEntry{ input.GetClientInputId(), input.GetHostFrameId(), AZStd::move(inputLogs) });
                         }
                     }
 #endif
@@ -274,6 +294,12 @@ namespace Multiplayer
             }
         }
 
+        return true;
+    }
+
+    void LocalPredictionPlayerInputComponentController::CorrectClientIfDesynced(const AZ::HashValue32& stateHash)
+    {
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
         if (sv_ForceCorrections || (sv_EnableCorrections && (currentTimeMs - m_lastCorrectionSentTimeMs > sv_MinCorrectionTimeMs)))
         {
             m_lastCorrectionSentTimeMs = currentTimeMs;
@@ -344,6 +370,98 @@ namespace Multiplayer
         }
     }
 
+    void LocalPredictionPlayerInputComponentController::QueueClientInput
+    (
+        AzNetworking::ConnectionId invokingConnectionId,
+        const NetworkInputArray& inputArray,
+        const AZ::HashValue32& stateHash
+    )
+    {
+        if (m_queuedClientInputs.empty())
+        {
+            // Gather everything this connection may write to while processing, so the scheduler can keep overlapping hierarchies apart
+            AZStd::vector<AZ::Entity*> hierarchicalEntities;
+            if (NetworkHierarchyRootComponent* hierarchyRoot = GetEntity()->FindComponent<NetworkHierarchyRootComponent>())
+            {
+                hierarchicalEntities = hierarchyRoot->GetHierarchicalEntities();
+            }
+            if (hierarchicalEntities.empty())
+            {
+                hierarchicalEntities.push_back(GetEntity());
+            }
+
+            AZStd::vector<AZ::EntityId> hierarchyEntities;
+            hierarchyEntities.reserve(hierarchicalEntities.size());
+            AZ::Aabb hierarchyBounds = AZ::Aabb::CreateNull();
+            AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+            for (AZ::Entity* entity : hierarchicalEntities)
+            {
+                hierarchyEntities.push_back(entity->GetId());
+                if (entityBoundsUnion != nullptr)
+                {
+                    hierarchyBounds.AddAabb(entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId()));
+                }
+            }
+
+            AZ::Interface<NetworkInputScheduler>::Get()->QueueWork(this, invokingConnectionId, AZStd::move(hierarchyEntities), hierarchyBounds,
+                [this]() { ProcessQueuedClientInputs(); },
+                [this]() { MergeQueuedClientInputs(); });
+        }
+
+        m_queuedClientInputs.push_back(QueuedClientInput{ invokingConnectionId, inputArray, stateHash });
+    }
+
+    void LocalPredictionPlayerInputComponentController::ProcessQueuedClientInputs()
+    {
+        m_hasQueuedCorrectionHash = false;
+        for (const QueuedClientInput& queuedInput : m_queuedClientInputs)
+        {
+            if (ProcessClientInput(queuedInput.m_connectionId, queuedInput.m_inputArray))
+            {
+                m_queuedCorrectionHash = queuedInput.m_stateHash;
+                m_hasQueuedCorrectionHash = true;
+            }
+        }
+    }
+
+    void LocalPredictionPlayerInputComponentController::MergeQueuedClientInputs()
+    {
+        FlushInputAuditEntries();
+
+        // The client's hash covers its state after the most recent input, so only the last processed array needs checking
+        if (m_hasQueuedCorrectionHash)
+        {
+            CorrectClientIfDesynced(m_queuedCorrectionHash);
+        }
+
+        m_queuedClientInputs.clear();
+        m_hasQueuedCorrectionHash = false;
+    }
+
+    void LocalPredictionPlayerInputComponentController::FlushInputAuditEntries()
+    {
+#ifndef AZ_RELEASE_BUILD
+        if (m_pendingInputAudits.empty())
+        {
+            return;
+        }
+
+        if (IMultiplayerDebug* mpDebug = AZ::Interface<IMultiplayerDebug>::Get())
+        {
+            for (InputAuditEntry& auditEntry : m_pendingInputAudits)
+            {
+                mpDebug->AddAuditEntry(
+                    AuditCategory::Input,
+                    auditEntry.m_inputId,
+                    auditEntry.m_hostFrameId,
+                    GetEntity()->GetName(),
+                    AZStd::move(auditEntry.m_inputLogs));
+            }
+        }
+        m_pendingInputAudits.clear();
+#endif
+    }
+
     void LocalPredictionPlayerInputComponentController::HandleSendMigrateClientInput
     (
         AzNetworking::IConnection* invokingConnection, 
@@ -30,6 +30,11 @@ namespace Multiplayer
         ImGui::Text("Total time spent updating TcpListenThread: %lld", aznumeric_cast<AZ::s64>(networking->GetTcpListenThreadUpdateTime()));
         ImGui::Text("Total sockets monitored by UdpReaderThread: %u", networking->GetUdpReaderThreadSocketCount());
         ImGui::Text("Total time spent updating UdpReaderThread: %lld", aznumeric_cast<AZ::s64>(networking->GetUdpReaderThreadUpdateTime()));
+        for (uint32_t readerIndex = 0; readerIndex < networking->GetUdpReaderThreadCount(); ++readerIndex)
+        {
+            ImGui::Text("UdpReaderThread %u queue depth: %u (max %u)", readerIndex,
+                networking->GetUdpReaderThreadQueueDepth(readerIndex), networking->GetUdpReaderThreadMaxQueueDepth(readerIndex));
+        }
         ImGui::NewLine();
 
         for (auto& networkInterface : networking->GetNetworkInterfaces())
@@ -128,6 +133,15 @@ namespace Multiplayer
                     ImGui::Text("Total packets discarded due to load");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total packet buffer allocations");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_packetBufferAllocations));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Packet buffer allocations per packet");
+                    ImGui::TableNextColumn();
+                    const uint64_t totalPackets = metrics.m_sendPackets + metrics.m_recvPackets;
+                    ImGui::Text("%.4f", (totalPackets > 0) ? aznumeric_cast<double>(metrics.m_packetBufferAllocations) / aznumeric_cast<double>(totalPackets) : 0.0);
                     ImGui::EndTable();
                 }
 
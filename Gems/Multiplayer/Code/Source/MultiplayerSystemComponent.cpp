@@ -579,6 +579,9 @@ namespace Multiplayer
         const AZ::TimeMs serverRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
         const float serverRateSeconds = static_cast<float>(serverRateMs) / 1000.0f;
 
+        // INetworking ticks immediately before IMultiplayer, process any client inputs that were queued for parallel processing
+        m_networkInputScheduler.Execute();
+
         TickVisibleNetworkEntities(deltaTime, serverRateSeconds);
 
         if (GetAgentType() == MultiplayerAgentType::ClientServer
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkInput/NetworkInputScheduler.h>
 #include <Multiplayer/Session/ISessionHandlingRequests.h>
 #include <Multiplayer/Session/SessionNotifications.h>
 #include <Editor/MultiplayerEditorConnection.h>
@@ -200,6 +201,7 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        NetworkInputScheduler m_networkInputScheduler;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
@@ -35,6 +35,8 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(bool, sv_ReplicationBandwidthScheduling, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, entity updates sent each tick are limited to the connection's estimated send rate and chosen by accumulated priority");
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -184,6 +186,10 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
+        const bool bandwidthScheduling = sv_ReplicationBandwidthScheduling;
+        m_bandwidthCandidates.clear();
+        m_bandwidthCandidateReplicators.clear();
+
         uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
@@ -217,8 +223,15 @@ namespace Multiplayer
                             m_remoteEntitiesPendingCreation.insert(entityId);
                         }
 
-                        if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
-                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous)
+                        const bool isAutonomous = (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
+                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous);
+                        if (bandwidthScheduling)
+                        {
+                            // Defer the decision until all candidates are known, entities not selected stay pending
+                            m_bandwidthCandidates.push_back({ entityId, GetReplicationPriority(*replicator), isAutonomous });
+                            m_bandwidthCandidateReplicators.push_back(replicator);
+                        }
+                        else if (isAutonomous)
                         {
                             toSendList.push_back(replicator);
                         }
@@ -242,9 +255,38 @@ namespace Multiplayer
             }
         }
 
+        if (bandwidthScheduling)
+        {
+            const AZ::TimeMs deltaTimeMs = (m_lastBandwidthTickMs > AZ::Time::ZeroTimeMs) ? (m_frameTimeMs - m_lastBandwidthTickMs) : AZ::Time::ZeroTimeMs;
+            m_lastBandwidthTickMs = m_frameTimeMs;
+            m_bandwidthScheduler.BeginTick(m_connection.GetMetrics().m_congestionControl.GetSendRateBytesPerSecond(), deltaTimeMs);
+            m_bandwidthScheduler.SelectUpdates(m_bandwidthCandidates, m_replicationWindow->GetMaxProxyEntityReplicatorSendCount(), m_bandwidthSelected);
+            for (uint32_t index : m_bandwidthSelected)
+            {
+                toSendList.push_back(m_bandwidthCandidateReplicators[index]);
+            }
+
+            AZLOG
+            (
+                NET_ReplicationInfo,
+                "Bandwidth scheduling to %s deferred %u of %zd updates, remaining budget %f bytes",
+                GetRemoteHostId().GetString().c_str(),
+                m_bandwidthScheduler.GetLastDeferredCount(),
+                m_bandwidthCandidates.size(),
+                m_bandwidthScheduler.GetBudgetBytes()
+            );
+        }
+
         return toSendList;
     }
 
+    float EntityReplicationManager::GetReplicationPriority(const EntityReplicator& replicator) const
+    {
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        auto iter = replicationSet.find(replicator.GetEntityHandle());
+        return (iter != replicationSet.end()) ? iter->second.m_priority : 1.0f;
+    }
+
     void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
     {
         uint32_t pendingPacketSize = 0;
@@ -269,6 +311,10 @@ namespace Multiplayer
 
             pendingPacketSize += nextMessageSize;
             entityUpdates.push_back(updateMessage);
+            if (sv_ReplicationBandwidthScheduling)
+            {
+                m_bandwidthScheduler.RecordSentUpdate(replicator->GetEntityHandle().GetNetEntityId(), nextMessageSize);
+            }
             replicatorUpdatedList.push_back(replicator);
             replicatorList.pop_front();
 
@@ -1448,6 +1494,7 @@ namespace Multiplayer
                         static_cast<AZ::u64>(replicator->GetEntityHandle().GetNetEntityId()),
                         GetRemoteHostId().GetString().c_str());
                     m_remoteEntitiesPendingCreation.erase(replicator->GetEntityHandle().GetNetEntityId());
+                    m_bandwidthScheduler.RemoveEntity(replicator->GetEntityHandle().GetNetEntityId());
                     m_entityReplicatorMap.erase(*iter);
                     iter = m_replicatorsPendingRemoval.erase(iter);
                 }
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationBandwidthScheduler.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationBandwidthBurstMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Maximum amount of unused replication budget a connection may accumulate, expressed as time at its current send rate");
+    AZ_CVAR(uint32_t, sv_ReplicationDefaultUpdateSize, 64, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Estimated size in bytes of an entity update before any update for that entity has been sent");
+    AZ_CVAR(float, sv_ReplicationUpdateSizeSmoothing, 0.25f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Weight given to the most recent update size when refining an entity's estimated update size");
+
+    void ReplicationBandwidthScheduler::BeginTick(float sendRateBytesPerSecond, AZ::TimeMs deltaTimeMs)
+    {
+        const float burstBytes = sendRateBytesPerSecond * AZ::TimeMsToSeconds(sv_ReplicationBandwidthBurstMs);
+        const float refillBytes = sendRateBytesPerSecond * AZ::TimeMsToSeconds(deltaTimeMs);
+
+        if (!m_hasTicked)
+        {
+            // Start with a full burst so the first tick isn't starved
+            m_budgetBytes = burstBytes;
+            m_hasTicked = true;
+            return;
+        }
+
+        // Debt carried over from mandatory or oversized updates is bounded so a single burst can't stall the connection indefinitely
+        m_budgetBytes = AZStd::clamp(m_budgetBytes + refillBytes, -burstBytes, burstBytes);
+    }
+
+    void ReplicationBandwidthScheduler::SelectUpdates(const CandidateList& candidates, uint32_t maxOptionalCount, SelectedIndices& outSelected)
+    {
+        outSelected.clear();
+        m_optionalIndices.clear();
+
+        float remainingBytes = m_budgetBytes;
+        for (uint32_t index = 0; index < aznumeric_cast<uint32_t>(candidates.size()); ++index)
+        {
+            const Candidate& candidate = candidates[index];
+            EntityEntry& entry = m_entries[candidate.m_entityId];
+            entry.m_accumulatedPriority += candidate.m_priority;
+
+            if (candidate.m_mandatory)
+            {
+                outSelected.push_back(index);
+                remainingBytes -= GetEstimatedSize(entry);
+            }
+            else
+            {
+                m_optionalIndices.push_back(index);
+            }
+        }
+
+        // Most urgent first, ties are broken by entity id so selection is deterministic
+        AZStd::sort(m_optionalIndices.begin(), m_optionalIndices.end(), [this, &candidates](uint32_t lhs, uint32_t rhs)
+        {
+            const NetEntityId lhsId = candidates[lhs].m_entityId;
+            const NetEntityId rhsId = candidates[rhs].m_entityId;
+            const float lhsPriority = m_entries[lhsId].m_accumulatedPriority;
+            const float rhsPriority = m_entries[rhsId].m_accumulatedPriority;
+            return (lhsPriority != rhsPriority) ? (lhsPriority > rhsPriority) : (lhsId < rhsId);
+        });
+
+        uint32_t optionalCount = 0;
+        for (uint32_t index : m_optionalIndices)
+        {
+            if (optionalCount >= maxOptionalCount)
+            {
+                break;
+            }
+
+            const float estimatedSize = GetEstimatedSize(m_entries[candidates[index].m_entityId]);
+            // Always admit at least one update while any budget remains, otherwise an entity larger than the budget would never be sent
+            if ((estimatedSize > remainingBytes) && ((optionalCount > 0) || (remainingBytes <= 0.0f)))
+            {
+                break;
+            }
+
+            outSelected.push_back(index);
+            remainingBytes -= estimatedSize;
+            ++optionalCount;
+        }
+
+        for (uint32_t index : outSelected)
+        {
+            m_entries[candidates[index].m_entityId].m_accumulatedPriority = 0.0f;
+        }
+
+        m_lastDeferredCount = aznumeric_cast<uint32_t>(candidates.size() - outSelected.size());
+    }
+
+    void ReplicationBandwidthScheduler::RecordSentUpdate(NetEntityId entityId, uint32_t sizeBytes)
+    {
+        const float updateSize = aznumeric_cast<float>(sizeBytes);
+        m_budgetBytes -= updateSize;
+
+        EntityEntry& entry = m_entries[entityId];
+        if (entry.m_estimatedSizeBytes <= 0.0f)
+        {
+            entry.m_estimatedSizeBytes = updateSize;
+        }
+        else
+        {
+            entry.m_estimatedSizeBytes += (updateSize - entry.m_estimatedSizeBytes) * sv_ReplicationUpdateSizeSmoothing;
+        }
+    }
+
+    void ReplicationBandwidthScheduler::RemoveEntity(NetEntityId entityId)
+    {
+        m_entries.erase(entityId);
+    }
+
+    float ReplicationBandwidthScheduler::GetBudgetBytes() const
+    {
+        return m_budgetBytes;
+    }
+
+    uint32_t ReplicationBandwidthScheduler::GetLastDeferredCount() const
+    {
+        return m_lastDeferredCount;
+    }
+
+    float ReplicationBandwidthScheduler::GetAccumulatedPriority(NetEntityId entityId) const
+    {
+        auto iter = m_entries.find(entityId);
+        return (iter != m_entries.end()) ? iter->second.m_accumulatedPriority : 0.0f;
+    }
+
+    float ReplicationBandwidthScheduler::GetEstimatedSize(const EntityEntry& entry) const
+    {
+        return (entry.m_estimatedSizeBytes > 0.0f) ? entry.m_estimatedSizeBytes : aznumeric_cast<float>(static_cast<uint32_t>(sv_ReplicationDefaultUpdateSize));
+    }
+}
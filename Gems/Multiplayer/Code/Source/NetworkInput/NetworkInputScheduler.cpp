@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkInput/NetworkInputScheduler.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, sv_ParallelInputProcessing, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, client inputs received by the server are queued and processed in parallel across connections whose controlled hierarchies do not overlap");
+    AZ_CVAR(float, sv_ParallelInputConflictDistance, 10.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Distance a hierarchy may move while processing its queued inputs, added on top of the rewind volume extrusion when testing hierarchies for overlap");
+
+    AZ_CVAR_EXTERNED(float, sv_RewindVolumeExtrudeDistance);
+
+    NetworkInputScheduler::NetworkInputScheduler()
+    {
+        AZ::Interface<NetworkInputScheduler>::Register(this);
+    }
+
+    NetworkInputScheduler::~NetworkInputScheduler()
+    {
+        AZ::Interface<NetworkInputScheduler>::Unregister(this);
+    }
+
+    bool NetworkInputScheduler::IsParallelProcessingEnabled()
+    {
+        return sv_ParallelInputProcessing;
+    }
+
+    void NetworkInputScheduler::QueueWork
+    (
+        const void* owner,
+        AzNetworking::ConnectionId connectionId,
+        AZStd::vector<AZ::EntityId>&& hierarchyEntities,
+        const AZ::Aabb& hierarchyBounds,
+        ProcessFunction&& processFunction,
+        MergeFunction&& mergeFunction
+    )
+    {
+        m_work.push_back(InputWork{ owner, connectionId, AZStd::move(hierarchyEntities), hierarchyBounds, AZStd::move(processFunction), AZStd::move(mergeFunction) });
+    }
+
+    void NetworkInputScheduler::CancelWork(const void* owner)
+    {
+        m_work.erase(AZStd::remove_if(m_work.begin(), m_work.end(), [owner](const InputWork& work) { return work.m_owner == owner; }), m_work.end());
+    }
+
+    void NetworkInputScheduler::Execute(AZ::JobContext* jobContext)
+    {
+        m_lastWaveCount = 0;
+        if (m_work.empty())
+        {
+            return;
+        }
+
+        AZ_Assert(!GetNetworkTime()->IsTimeRewound(), "NetworkInputScheduler must be executed outside of a rewound time scope");
+
+        // Order by connection so wave assignment and merge order do not depend on the order in which packets arrived
+        AZStd::stable_sort(m_work.begin(), m_work.end(), [](const InputWork& lhs, const InputWork& rhs)
+        {
+            return lhs.m_connectionId < rhs.m_connectionId;
+        });
+
+        // Every input syncs the entities around its hierarchy to its own rewound frame, out to the rewind volume extrusion, and then
+        // moves through them. Two items may only run together if those regions, including the distance moved, can't overlap.
+        m_conflictExpansion = sv_ParallelInputConflictDistance + sv_RewindVolumeExtrudeDistance;
+        for (uint32_t workIndex = 0; workIndex < aznumeric_cast<uint32_t>(m_work.size()); ++workIndex)
+        {
+            const InputWork& work = m_work[workIndex];
+
+            uint32_t waveIndex = 0;
+            while ((waveIndex < m_lastWaveCount) && !CanJoinWave(m_waves[waveIndex], work))
+            {
+                ++waveIndex;
+            }
+
+            if (waveIndex == m_lastWaveCount)
+            {
+                if (m_waves.size() <= waveIndex)
+                {
+                    m_waves.emplace_back();
+                }
+                ++m_lastWaveCount;
+            }
+
+            InputWave& wave = m_waves[waveIndex];
+            wave.m_workIndices.push_back(workIndex);
+            wave.m_entities.insert(work.m_hierarchyEntities.begin(), work.m_hierarchyEntities.end());
+            if (work.m_hierarchyBounds.IsValid())
+            {
+                wave.m_bounds.push_back(work.m_hierarchyBounds.GetExpanded(AZ::Vector3(m_conflictExpansion)));
+            }
+            else
+            {
+                wave.m_isUnbounded = true;
+            }
+        }
+
+        for (uint32_t waveIndex = 0; waveIndex < m_lastWaveCount; ++waveIndex)
+        {
+            ProcessWave(m_waves[waveIndex], jobContext);
+        }
+
+        for (InputWork& work : m_work)
+        {
+            work.m_mergeFunction();
+        }
+
+        m_work.clear();
+        for (uint32_t waveIndex = 0; waveIndex < m_lastWaveCount; ++waveIndex)
+        {
+            m_waves[waveIndex].m_workIndices.clear();
+            m_waves[waveIndex].m_entities.clear();
+            m_waves[waveIndex].m_bounds.clear();
+            m_waves[waveIndex].m_isUnbounded = false;
+        }
+    }
+
+    uint32_t NetworkInputScheduler::GetWorkCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_work.size());
+    }
+
+    uint32_t NetworkInputScheduler::GetLastWaveCount() const
+    {
+        return m_lastWaveCount;
+    }
+
+    bool NetworkInputScheduler::CanJoinWave(const InputWave& wave, const InputWork& work) const
+    {
+        // Work without bounds may rewind and move anything, so it conflicts with all other work and runs in a wave of its own
+        if (wave.m_isUnbounded || (!work.m_hierarchyBounds.IsValid() && !wave.m_workIndices.empty()))
+        {
+            return false;
+        }
+
+        for (const AZ::EntityId& entityId : work.m_hierarchyEntities)
+        {
+            if (wave.m_entities.find(entityId) != wave.m_entities.end())
+            {
+                return false;
+            }
+        }
+
+        if (work.m_hierarchyBounds.IsValid())
+        {
+            // Wave bounds are stored pre-expanded, both sides are expanded so the rewind regions of the items are disjoint
+            const AZ::Aabb workBounds = work.m_hierarchyBounds.GetExpanded(AZ::Vector3(m_conflictExpansion));
+            for (const AZ::Aabb& waveBounds : wave.m_bounds)
+            {
+                if (AZ::ShapeIntersection::Overlaps(workBounds, waveBounds))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void NetworkInputScheduler::ProcessWave(const InputWave& wave, AZ::JobContext* jobContext)
+    {
+        if (wave.m_workIndices.size() == 1)
+        {
+            // Nothing to run alongside, skip the job overhead
+            m_work[wave.m_workIndices.front()].m_processFunction();
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion(jobContext);
+        for (uint32_t workIndex : wave.m_workIndices)
+        {
+            InputWork& work = m_work[workIndex];
+            AZ::Job* job = AZ::CreateJobFunction([&work]()
+            {
+                ScopedThreadTime threadTime;
+                work.m_processFunction();
+            }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        // Thread time scopes leave the entities they rewound to the main thread, restore them before the next wave syncs its own
+        GetNetworkTime()->ClearRewoundEntities();
+    }
+}
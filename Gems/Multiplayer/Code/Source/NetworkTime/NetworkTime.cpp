@@ -20,6 +20,18 @@ namespace Multiplayer
     AZ_CVAR(float, sv_RewindVolumeExtrudeDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount to increase rewind volume checks to account for fast moving entities");
     AZ_CVAR(bool, bg_RewindDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true enables debug draw of rewind operations");
 
+    namespace
+    {
+        //! Time state bound to the calling thread by NetworkTime::BeginThreadTimeScope.
+        struct ThreadTimeScope
+        {
+            const NetworkTime* m_owner = nullptr;
+            NetworkTime::TimeState m_timeState;
+        };
+
+        thread_local ThreadTimeScope s_threadTimeScope;
+    }
+
     void NetworkTime::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
@@ -49,12 +61,12 @@ namespace Multiplayer
 
     bool NetworkTime::IsTimeRewound() const
     {
-        return m_rewindingConnectionId != AzNetworking::InvalidConnectionId;
+        return GetTimeState().m_rewindingConnectionId != AzNetworking::InvalidConnectionId;
     }
 
     HostFrameId NetworkTime::GetHostFrameId() const
     {
-        return m_hostFrameId;
+        return GetTimeState().m_hostFrameId;
     }
 
     HostFrameId NetworkTime::GetUnalteredHostFrameId() const
@@ -64,45 +76,52 @@ namespace Multiplayer
 
     void NetworkTime::IncrementHostFrameId()
     {
+        AZ_Assert(!IsThreadTimeScope(), "Incrementing the global application frameId is unsupported within a thread time scope");
         AZ_Assert(!IsTimeRewound(), "Incrementing the global application frameId is unsupported under a rewound time scope");
         ++m_unalteredFrameId;
-        m_hostFrameId = m_unalteredFrameId;
-        m_hostTimeMs = AZ::GetElapsedTimeMs();
+        GetTimeState().m_hostFrameId = m_unalteredFrameId;
+        GetTimeState().m_hostTimeMs = AZ::GetElapsedTimeMs();
     }
 
     AZ::TimeMs NetworkTime::GetHostTimeMs() const
     {
-        return m_hostTimeMs;
+        return GetTimeState().m_hostTimeMs;
     }
 
     float NetworkTime::GetHostBlendFactor() const
     {
-        return m_hostBlendFactor;
+        return GetTimeState().m_hostBlendFactor;
     }
 
     AzNetworking::ConnectionId NetworkTime::GetRewindingConnectionId() const
     {
-        return m_rewindingConnectionId;
+        return GetTimeState().m_rewindingConnectionId;
     }
 
     void NetworkTime::ForceSetTime(HostFrameId frameId, AZ::TimeMs timeMs)
     {
+        AZ_Assert(!IsThreadTimeScope(), "Forcibly setting network time is unsupported within a thread time scope");
         AZ_Assert(!IsTimeRewound(), "Forcibly setting network time is unsupported under a rewound time scope");
         m_unalteredFrameId = frameId;
-        m_hostFrameId = frameId;
-        m_hostTimeMs = timeMs;
-        m_rewindingConnectionId = AzNetworking::InvalidConnectionId;
+        GetTimeState().m_hostFrameId = frameId;
+        GetTimeState().m_hostTimeMs = timeMs;
+        GetTimeState().m_rewindingConnectionId = AzNetworking::InvalidConnectionId;
     }
 
     void NetworkTime::AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId)
     {
-        m_hostFrameId = frameId;
-        m_hostTimeMs = timeMs;
-        m_hostBlendFactor = blendFactor;
-        m_rewindingConnectionId = rewindConnectionId;
+        GetTimeState().m_hostFrameId = frameId;
+        GetTimeState().m_hostTimeMs = timeMs;
+        GetTimeState().m_hostBlendFactor = blendFactor;
+        GetTimeState().m_rewindingConnectionId = rewindConnectionId;
     }
 
     void NetworkTime::SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume)
+    {
+        SyncEntitiesToRewindState(AZStd::span<const AZ::Aabb>(&rewindVolume, 1));
+    }
+
+    void NetworkTime::SyncEntitiesToRewindState(AZStd::span<const AZ::Aabb> rewindVolumes)
     {
         if (!IsTimeRewound())
         {
@@ -111,8 +130,23 @@ namespace Multiplayer
             return;
         }
 
+        if (rewindVolumes.empty())
+        {
+            return;
+        }
+
+        // Entities may be synced from several thread time scopes at once, serialize access to the shared rewound entity state
+        AZStd::scoped_lock lock(m_rewoundEntitiesMutex);
+
+        // Query the vis system once with the union of all rewind volumes, individual volumes are tested per entity below
+        AZ::Aabb unionVolume = AZ::Aabb::CreateNull();
+        for (const AZ::Aabb& rewindVolume : rewindVolumes)
+        {
+            unionVolume.AddAabb(rewindVolume);
+        }
+
         // Since the vis system doesn't support rewound queries, first query with an expanded volume to catch any fast moving entities
-        const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
+        const AZ::Aabb expandedVolume = unionVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
 
         AzFramework::DebugDisplayRequests* debugDisplay = nullptr;
         if (bg_RewindDebugDraw)
@@ -128,10 +162,11 @@ namespace Multiplayer
             debugDisplay->DrawWireBox(expandedVolume.GetMin(), expandedVolume.GetMax());
         }
 
+        const float blendFactor = GetHostBlendFactor();
         NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
         AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
         AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(expandedVolume,
-            [this, debugDisplay, networkEntityTracker, entityBoundsUnion, rewindVolume](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            [this, debugDisplay, networkEntityTracker, entityBoundsUnion, blendFactor, rewindVolumes](const AzFramework::IVisibilityScene::NodeData& nodeData)
         {
             m_rewoundEntities.reserve(m_rewoundEntities.size() + nodeData.m_entries.size());
             for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
@@ -156,7 +191,6 @@ namespace Multiplayer
                             // Get the rewound position for target host frame ID plus the one preceding it for potential lerp
                             AZ::Vector3 rewindCenter = networkTransform->GetTranslation();
                             const AZ::Vector3 rewindCenterPrevious = networkTransform->GetTranslationPrevious();
-                            const float blendFactor = GetNetworkTime()->GetHostBlendFactor();
                             if (!AZ::IsClose(blendFactor, 1.0f) && !rewindCenter.IsClose(rewindCenterPrevious))
                             {
                                 // If we have a blend factor, lerp the translation for accuracy
@@ -170,10 +204,15 @@ namespace Multiplayer
                                 debugDisplay->DrawWireBox(rewoundAabb.GetMin(), rewoundAabb.GetMax());
                             }
 
-                            if (AZ::ShapeIntersection::Overlaps(rewoundAabb, rewindVolume)) // Validate the rewound aabb intersects our rewind volume
+                            // Validate the rewound aabb intersects at least one of our rewind volumes, syncing the entity only once
+                            for (const AZ::Aabb& rewindVolume : rewindVolumes)
                             {
-                                m_rewoundEntities.push_back(entityHandle);
-                                entityHandle.GetNetBindComponent()->NotifySyncRewindState();
+                                if (AZ::ShapeIntersection::Overlaps(rewoundAabb, rewindVolume))
+                                {
+                                    m_rewoundEntities.push_back(entityHandle);
+                                    entityHandle.GetNetBindComponent()->NotifySyncRewindState();
+                                    break;
+                                }
                             }
                         }
                     }
@@ -186,6 +225,13 @@ namespace Multiplayer
     {
         AZ_Assert(!IsTimeRewound(), "Cannot clear rewound entity state while still within scoped rewind");
 
+        if (IsThreadTimeScope())
+        {
+            // Other threads may still rely on the shared rewound state. NetworkInputScheduler restores it from the main thread once
+            // every thread scope of a wave has ended.
+            return;
+        }
+
         for (NetworkEntityHandle entityHandle : m_rewoundEntities)
         {
             if (NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent())
@@ -195,4 +241,37 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    void NetworkTime::BeginThreadTimeScope()
+    {
+        AZ_Assert(!IsThreadTimeScope(), "Thread time scopes cannot be nested");
+        s_threadTimeScope.m_owner = this;
+        // Start from the whole host state, only dropping any rewind of the main thread
+        s_threadTimeScope.m_timeState = m_timeState;
+        s_threadTimeScope.m_timeState.m_hostFrameId = m_unalteredFrameId;
+        s_threadTimeScope.m_timeState.m_rewindingConnectionId = AzNetworking::InvalidConnectionId;
+    }
+
+    void NetworkTime::EndThreadTimeScope()
+    {
+        AZ_Assert(IsThreadTimeScope(), "Ending a thread time scope that was never begun");
+        AZ_Assert(s_threadTimeScope.m_timeState.m_rewindingConnectionId == AzNetworking::InvalidConnectionId,
+            "Ending a thread time scope while still within scoped rewind");
+        s_threadTimeScope.m_owner = nullptr;
+    }
+
+    NetworkTime::TimeState& NetworkTime::GetTimeState()
+    {
+        return IsThreadTimeScope() ? s_threadTimeScope.m_timeState : m_timeState;
+    }
+
+    const NetworkTime::TimeState& NetworkTime::GetTimeState() const
+    {
+        return IsThreadTimeScope() ? s_threadTimeScope.m_timeState : m_timeState;
+    }
+
+    bool NetworkTime::IsThreadTimeScope() const
+    {
+        return s_threadTimeScope.m_owner == this;
+    }
 }
@@ -12,6 +12,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace Multiplayer
 {
@@ -37,17 +38,34 @@ namespace Multiplayer
         void ForceSetTime(HostFrameId frameId, AZ::TimeMs timeMs) override;
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
+        void SyncEntitiesToRewindState(AZStd::span<const AZ::Aabb> rewindVolumes) override;
         void ClearRewoundEntities() override;
+        void BeginThreadTimeScope() override;
+        void EndThreadTimeScope() override;
         //! @}
 
+        //! The alterable portion of network time, either global or bound to a single thread.
+        struct TimeState
+        {
+            HostFrameId m_hostFrameId = HostFrameId{ 0 };
+            AZ::TimeMs m_hostTimeMs = AZ::Time::ZeroTimeMs;
+            float m_hostBlendFactor = DefaultBlendFactor;
+            AzNetworking::ConnectionId m_rewindingConnectionId = AzNetworking::InvalidConnectionId;
+        };
+
     private:
 
+        //! Returns the time state visible to the calling thread.
+        TimeState& GetTimeState();
+        const TimeState& GetTimeState() const;
+
+        //! Returns true if the calling thread is inside one of this instance's thread time scopes.
+        bool IsThreadTimeScope() const;
+
+        AZStd::mutex m_rewoundEntitiesMutex; // Serializes entity syncs issued from concurrent thread time scopes
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
 
-        HostFrameId m_hostFrameId = HostFrameId{ 0 };
+        TimeState m_timeState;
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
-        AZ::TimeMs m_hostTimeMs = AZ::Time::ZeroTimeMs;
-        float m_hostBlendFactor = DefaultBlendFactor;
-        AzNetworking::ConnectionId m_rewindingConnectionId = AzNetworking::InvalidConnectionId;
     };
 }
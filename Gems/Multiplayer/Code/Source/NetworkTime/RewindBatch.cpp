@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/RewindBatch.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    void RewindBatch::AddQuery
+    (
+        HostFrameId frameId,
+        AZ::TimeMs timeMs,
+        float blendFactor,
+        AzNetworking::ConnectionId rewindConnectionId,
+        const AZ::Aabb& queryVolume,
+        QueryCallback&& queryCallback
+    )
+    {
+        m_queries.push_back(RewindQuery{ frameId, timeMs, blendFactor, rewindConnectionId, queryVolume, AZStd::move(queryCallback) });
+    }
+
+    void RewindBatch::Execute()
+    {
+        m_lastRewindCount = 0;
+        if (m_queries.empty())
+        {
+            return;
+        }
+
+        INetworkTime* networkTime = GetNetworkTime();
+        AZ_Assert(!networkTime->IsTimeRewound(), "RewindBatch must be executed outside of a rewound time scope");
+
+        // Group queries targeting the same rewind state, a stable sort preserves submission order within each group
+        AZStd::stable_sort(m_queries.begin(), m_queries.end(), [](const RewindQuery& lhs, const RewindQuery& rhs)
+        {
+            if (lhs.m_frameId != rhs.m_frameId)
+            {
+                return lhs.m_frameId < rhs.m_frameId;
+            }
+            return lhs.m_blendFactor < rhs.m_blendFactor;
+        });
+
+        auto groupBegin = m_queries.begin();
+        while (groupBegin != m_queries.end())
+        {
+            auto groupEnd = groupBegin;
+            m_rewindVolumes.clear();
+            while ((groupEnd != m_queries.end())
+                && (groupEnd->m_frameId == groupBegin->m_frameId)
+                && (groupEnd->m_blendFactor == groupBegin->m_blendFactor))
+            {
+                m_rewindVolumes.push_back(groupEnd->m_queryVolume);
+                ++groupEnd;
+            }
+
+            {
+                ScopedAlterTime rewindTime(groupBegin->m_frameId, groupBegin->m_timeMs, groupBegin->m_blendFactor, RewindBatchConnectionId);
+                networkTime->SyncEntitiesToRewindState(m_rewindVolumes);
+
+                for (auto query = groupBegin; query != groupEnd; ++query)
+                {
+                    // Rebind time to the querying connection so that rewindable reads from its own entities are unaltered
+                    ScopedAlterTime queryTime(query->m_frameId, query->m_timeMs, query->m_blendFactor, query->m_connectionId);
+                    query->m_queryCallback();
+                }
+            }
+
+            // Restore once per rewind, entities left behind at this frame would otherwise pollute the next group's queries
+            networkTime->ClearRewoundEntities();
+            ++m_lastRewindCount;
+            groupBegin = groupEnd;
+        }
+
+        m_queries.clear();
+    }
+
+    void RewindBatch::Clear()
+    {
+        m_queries.clear();
+    }
+
+    uint32_t RewindBatch::GetQueryCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_queries.size());
+    }
+
+    uint32_t RewindBatch::GetLastRewindCount() const
+    {
+        return m_lastRewindCount;
+    }
+}
@@ -138,10 +138,22 @@ namespace Multiplayer
         {
         }
 
+        void SyncEntitiesToRewindState([[maybe_unused]] AZStd::span<const AZ::Aabb> rewindVolumes) override
+        {
+        }
+
         void ClearRewoundEntities() override
         {
         }
 
+        void BeginThreadTimeScope() override
+        {
+        }
+
+        void EndThreadTimeScope() override
+        {
+        }
+
         void AlterTime([[maybe_unused]] HostFrameId frameId, [[maybe_unused]] AZ::TimeMs timeMs, [[maybe_unused]] float blendFactor, [[maybe_unused]] AzNetworking::ConnectionId rewindConnectionId) override
         {
         }
@@ -126,7 +126,10 @@ namespace UnitTest
         MOCK_CONST_METHOD1(GetHostFrameIdForRewindingConnection, Multiplayer::HostFrameId(AzNetworking::ConnectionId));
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
+        MOCK_METHOD1(SyncEntitiesToRewindState, void(AZStd::span<const AZ::Aabb>));
         MOCK_METHOD0(ClearRewoundEntities, void());
+        MOCK_METHOD0(BeginThreadTimeScope, void());
+        MOCK_METHOD0(EndThreadTimeScope, void());
     };
 
     class MockComponentApplicationRequests : public AZ::ComponentApplicationRequests
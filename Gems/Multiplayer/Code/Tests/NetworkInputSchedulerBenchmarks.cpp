@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+#include <AzFramework/Physics/Material/PhysicsMaterialSystemComponent.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
+#include <Multiplayer/Components/NetworkCharacterComponent.h>
+#include <Multiplayer/NetworkInput/NetworkInputScheduler.h>
+#include <Source/SystemComponent.h>
+#include <Source/System/PhysXCookingParams.h>
+#include <Source/System/PhysXSystem.h>
+#include <PhysXCharacters/Components/CharacterControllerComponent.h>
+
+namespace Multiplayer
+{
+    /*
+     * 64 player controlled characters laid out on an 8x8 grid, far enough apart that no two hierarchies conflict.
+     * Every tick each player's connection delivers a few inputs, each of which moves its character through
+     * NetworkCharacterComponentController::TryMoveWithVelocity under a rewound time scope, as ProcessInput does on the server.
+     */
+    class NetworkInputSchedulerBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        static constexpr uint32_t PlayerCount = 64;
+        static constexpr uint32_t GridWidth = 8;
+        static constexpr uint32_t InputsPerTick = 4;
+        static constexpr uint32_t WorkerThreadCount = 8;
+        // Far enough apart for the rewind volumes of neighbouring players not to overlap, so they can process input together
+        static constexpr float PlayerSpacing = 150.0f;
+        static constexpr float InputDeltaTime = 0.033f;
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            AZ::Data::AssetManager::Descriptor assetManagerDesc;
+            AZ::Data::AssetManager::Create(assetManagerDesc);
+
+            m_physXSystem = AZStd::make_unique<PhysX::PhysXSystem>(AZStd::make_unique<PhysX::PhysXSettingsRegistryManager>(), PhysX::PxCooking::GetRealTimeCookingParams());
+
+            m_physMaterialSystemDescriptor.reset(Physics::MaterialSystemComponent::CreateDescriptor());
+            m_physMaterialSystemDescriptor->Reflect(m_serializeContext.get());
+            m_physXSystemDescriptor.reset(PhysX::SystemComponent::CreateDescriptor());
+            m_physXSystemDescriptor->Reflect(m_serializeContext.get());
+            m_charControllerDescriptor.reset(PhysX::CharacterControllerComponent::CreateDescriptor());
+            m_charControllerDescriptor->Reflect(m_serializeContext.get());
+            m_netCharDescriptor.reset(NetworkCharacterComponent::CreateDescriptor());
+            m_netCharDescriptor->Reflect(m_serializeContext.get());
+
+            m_systemEntity = AZStd::make_unique<AZ::Entity>();
+            m_systemEntity->CreateComponent<Physics::MaterialSystemComponent>();
+            m_systemEntity->CreateComponent<PhysX::SystemComponent>();
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            // Characters are created in the default scene
+            AzPhysics::SystemInterface* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            AzPhysics::SceneConfiguration sceneConfiguration = physicsSystem->GetDefaultSceneConfiguration();
+            sceneConfiguration.m_sceneName = AzPhysics::DefaultPhysicsSceneName;
+            m_sceneHandle = physicsSystem->AddScene(sceneConfiguration);
+
+            m_visibilitySystem = AZStd::make_unique<AzFramework::EntityVisibilityBoundsUnionSystem>();
+            m_visibilitySystem->Connect();
+
+            AZ::JobManagerDesc jobDesc;
+            for (uint32_t threadIndex = 0; threadIndex < WorkerThreadCount; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            m_scheduler = AZStd::make_unique<NetworkInputScheduler>();
+
+            m_players.reserve(PlayerCount);
+            for (uint32_t index = 0; index < PlayerCount; ++index)
+            {
+                const AZ::Vector3 position(
+                    aznumeric_cast<float>(index % GridWidth) * PlayerSpacing, aznumeric_cast<float>(index / GridWidth) * PlayerSpacing, 0.0f);
+
+                m_players.push_back(AZStd::make_shared<EntityInfo>(index + 1, "player", NetEntityId{ index + 1 }, EntityInfo::Role::None));
+                EntityInfo& player = *m_players.back();
+                player.m_entity->CreateComponent<AzFramework::TransformComponent>();
+                player.m_entity->CreateComponent<NetBindComponent>();
+                player.m_entity->CreateComponent<NetworkTransformComponent>();
+                player.m_entity->CreateComponent<PhysX::CharacterControllerComponent>(
+                    AZStd::make_unique<Physics::CharacterConfiguration>(),
+                    AZStd::make_shared<Physics::BoxShapeConfiguration>());
+                player.m_entity->CreateComponent<NetworkCharacterComponent>();
+                SetupEntity(player.m_entity, player.m_netId, NetEntityRole::Authority);
+                player.m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(AZ::Transform::CreateTranslation(position));
+                player.m_entity->Activate();
+
+                m_controllers.push_back(static_cast<NetworkCharacterComponentController*>(
+                    player.m_entity->FindComponent<NetworkCharacterComponent>()->GetController()));
+            }
+        }
+
+        void internalTearDown() override
+        {
+            m_controllers.clear();
+            m_players.clear();
+
+            m_scheduler.reset();
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            m_visibilitySystem->Disconnect();
+            m_visibilitySystem.reset();
+
+            AZ::Interface<AzPhysics::SystemInterface>::Get()->RemoveScene(m_sceneHandle);
+            m_systemEntity->Deactivate();
+            m_systemEntity.reset();
+            m_physXSystem.reset();
+
+            m_netCharDescriptor.reset();
+            m_charControllerDescriptor.reset();
+            m_physXSystemDescriptor.reset();
+            m_physMaterialSystemDescriptor.reset();
+
+            AZ::Data::AssetManager::Destroy();
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        //! Processes one tick worth of inputs for a single player, alternating direction so players stay on their grid cell.
+        void ProcessPlayerInputs(uint32_t playerIndex)
+        {
+            for (uint32_t inputIndex = 0; inputIndex < InputsPerTick; ++inputIndex)
+            {
+                const float direction = (inputIndex % 2 == 0) ? 1.0f : -1.0f;
+                ScopedAlterTime scopedTime(HostFrameId{ 1 }, AZ::Time::ZeroTimeMs, DefaultBlendFactor, AzNetworking::ConnectionId{ playerIndex });
+                m_controllers[playerIndex]->TryMoveWithVelocity(AZ::Vector3(direction * 5.0f, 0.0f, 0.0f), InputDeltaTime);
+            }
+        }
+
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_physMaterialSystemDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_physXSystemDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_charControllerDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netCharDescriptor;
+
+        AZStd::unique_ptr<PhysX::PhysXSystem> m_physXSystem;
+        AZStd::unique_ptr<AZ::Entity> m_systemEntity;
+        AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+        AZStd::unique_ptr<AzFramework::EntityVisibilityBoundsUnionSystem> m_visibilitySystem;
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<NetworkInputScheduler> m_scheduler;
+
+        AZStd::vector<AZStd::shared_ptr<EntityInfo>> m_players;
+        AZStd::vector<NetworkCharacterComponentController*> m_controllers;
+    };
+
+    // Processes each connection's inputs in turn on the calling thread, as the server does on receipt today
+    BENCHMARK_DEFINE_F(NetworkInputSchedulerBenchmark, SerialInput64Players)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (uint32_t playerIndex = 0; playerIndex < PlayerCount; ++playerIndex)
+            {
+                ProcessPlayerInputs(playerIndex);
+            }
+        }
+
+        state.counters["InputsPerTick"] = aznumeric_cast<double>(PlayerCount * InputsPerTick);
+    }
+
+    BENCHMARK_REGISTER_F(NetworkInputSchedulerBenchmark, SerialInput64Players)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    // Queues each connection's inputs on the scheduler, which processes non-conflicting hierarchies concurrently
+    BENCHMARK_DEFINE_F(NetworkInputSchedulerBenchmark, ParallelInput64Players)(benchmark::State& state)
+    {
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        uint64_t waveCount = 0;
+        uint64_t mergeCount = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (uint32_t playerIndex = 0; playerIndex < PlayerCount; ++playerIndex)
+            {
+                const AZ::EntityId entityId = m_players[playerIndex]->m_entity->GetId();
+                m_scheduler->QueueWork(m_controllers[playerIndex], AzNetworking::ConnectionId{ playerIndex }, { entityId },
+                    entityBoundsUnion->GetEntityWorldBoundsUnion(entityId),
+                    [this, playerIndex]() { ProcessPlayerInputs(playerIndex); },
+                    [&mergeCount]() { ++mergeCount; });
+            }
+            m_scheduler->Execute(m_jobContext.get());
+            waveCount += m_scheduler->GetLastWaveCount();
+        }
+
+        state.counters["InputsPerTick"] = aznumeric_cast<double>(PlayerCount * InputsPerTick);
+        state.counters["WavesPerTick"] = benchmark::Counter(aznumeric_cast<double>(waveCount), benchmark::Counter::kAvgIterations);
+        state.counters["MergesPerTick"] = benchmark::Counter(aznumeric_cast<double>(mergeCount), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(NetworkInputSchedulerBenchmark, ParallelInput64Players)
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime()
+        ;
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <IMultiplayerConnectionMock.h>
+#include <MockInterfaces.h>
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <Multiplayer/NetworkInput/NetworkInputScheduler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace testing;
+
+    class NetworkInputSchedulerTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_mockNetworkTime = AZStd::make_unique<NiceMock<MockNetworkTime>>();
+            AZ::Interface<Multiplayer::INetworkTime>::Register(m_mockNetworkTime.get());
+
+            AZ::JobManagerDesc jobDesc;
+            for (uint32_t threadIndex = 0; threadIndex < 4; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+            m_scheduler = AZStd::make_unique<Multiplayer::NetworkInputScheduler>();
+        }
+
+        void TearDown() override
+        {
+            m_scheduler.reset();
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::Interface<Multiplayer::INetworkTime>::Unregister(m_mockNetworkTime.get());
+            m_mockNetworkTime.reset();
+        }
+
+        void QueueWork(uint32_t connectionId, AZStd::vector<AZ::EntityId>&& entities, const AZ::Aabb& bounds)
+        {
+            m_scheduler->QueueWork(&m_owners[connectionId], AzNetworking::ConnectionId{ connectionId }, AZStd::move(entities), bounds,
+                [this]() { ++m_processCount; },
+                [this, connectionId]() { m_mergeOrder.push_back(connectionId); });
+        }
+
+        static AZ::Aabb CreateBounds(float offset)
+        {
+            return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(offset, 0.0f, 0.0f), AZ::Vector3(1.0f));
+        }
+
+        AZStd::unique_ptr<NiceMock<MockNetworkTime>> m_mockNetworkTime;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<Multiplayer::NetworkInputScheduler> m_scheduler;
+
+        uint32_t m_owners[8] = {};
+        AZStd::atomic<uint32_t> m_processCount{ 0 };
+        AZStd::vector<uint32_t> m_mergeOrder;
+    };
+
+    TEST_F(NetworkInputSchedulerTests, RegistersInterface)
+    {
+        EXPECT_EQ(AZ::Interface<Multiplayer::NetworkInputScheduler>::Get(), m_scheduler.get());
+    }
+
+    TEST_F(NetworkInputSchedulerTests, DisjointHierarchiesShareAWave)
+    {
+        // Each disjoint item runs inside its own thread time scope
+        EXPECT_CALL(*m_mockNetworkTime, BeginThreadTimeScope()).Times(4);
+        EXPECT_CALL(*m_mockNetworkTime, EndThreadTimeScope()).Times(4);
+
+        // Entities rewound inside the thread scopes are restored from the main thread once the wave is done
+        const AZStd::thread_id mainThreadId = AZStd::this_thread::get_id();
+        EXPECT_CALL(*m_mockNetworkTime, ClearRewoundEntities()).Times(1).WillOnce(Invoke([this, mainThreadId]()
+        {
+            EXPECT_EQ(AZStd::this_thread::get_id(), mainThreadId);
+            EXPECT_EQ(m_processCount, 4);
+        }));
+
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            QueueWork(index, { AZ::EntityId(index + 1) }, CreateBounds(aznumeric_cast<float>(index) * 1000.0f));
+        }
+        EXPECT_EQ(m_scheduler->GetWorkCount(), 4);
+
+        m_scheduler->Execute(m_jobContext.get());
+        EXPECT_EQ(m_scheduler->GetWorkCount(), 0);
+        EXPECT_EQ(m_scheduler->GetLastWaveCount(), 1);
+        EXPECT_EQ(m_processCount, 4);
+    }
+
+    TEST_F(NetworkInputSchedulerTests, SharedEntitiesSplitWaves)
+    {
+        const AZ::EntityId sharedEntity(100);
+        QueueWork(0, { AZ::EntityId(1), sharedEntity }, CreateBounds(0.0f));
+        QueueWork(1, { AZ::EntityId(2), sharedEntity }, CreateBounds(1000.0f));
+        QueueWork(2, { AZ::EntityId(3) }, CreateBounds(2000.0f));
+
+        m_scheduler->Execute(m_jobContext.get());
+        EXPECT_EQ(m_scheduler->GetLastWaveCount(), 2);
+        EXPECT_EQ(m_processCount, 3);
+    }
+
+    TEST_F(NetworkInputSchedulerTests, UnboundedWorkRunsAlone)
+    {
+        // Without bounds the rewind volume of the work is unknown, so it can't share a wave with anything
+        QueueWork(0, { AZ::EntityId(1) }, CreateBounds(0.0f));
+        QueueWork(1, { AZ::EntityId(2) }, AZ::Aabb::CreateNull());
+        QueueWork(2, { AZ::EntityId(3) }, CreateBounds(1000.0f));
+        QueueWork(3, { AZ::EntityId(4) }, AZ::Aabb::CreateNull());
+
+        m_scheduler->Execute(m_jobContext.get());
+        EXPECT_EQ(m_scheduler->GetLastWaveCount(), 3);
+        EXPECT_EQ(m_processCount, 4);
+    }
+
+    TEST_F(NetworkInputSchedulerTests, NearbyHierarchiesSplitWaves)
+    {
+        // Hierarchies within the conflict distance of each other can interact through physics, so never run together
+        QueueWork(0, { AZ::EntityId(1) }, CreateBounds(0.0f));
+        QueueWork(1, { AZ::EntityId(2) }, CreateBounds(3.0f));
+        QueueWork(2, { AZ::EntityId(3) }, CreateBounds(1000.0f));
+
+        m_scheduler->Execute(m_jobContext.get());
+        EXPECT_EQ(m_scheduler->GetLastWaveCount(), 2);
+        EXPECT_EQ(m_processCount, 3);
+    }
+
+    TEST_F(NetworkInputSchedulerTests, OverlappingRewindVolumesSplitWaves)
+    {
+        // These hierarchies are further apart than the conflict distance, but each input rewinds the entities within the rewind
+        // volume extrusion around it, so processing them together could rewind the same entities to different frames
+        QueueWork(0, { AZ::EntityId(1) }, CreateBounds(0.0f));
+        QueueWork(1, { AZ::EntityId(2) }, CreateBounds(80.0f));
+
+        m_scheduler->Execute(m_jobContext.get());
+        EXPECT_EQ(m_scheduler->GetLastWaveCount(), 2);
+        EXPECT_EQ(m_processCount, 2);
+    }
+
+    TEST_F(NetworkInputSchedulerTests, MergesInConnectionOrder)
+    {
+        const uint32_t queueOrder[] = { 3, 0, 2, 1 };
+        for (uint32_t connectionId : queueOrder)
+        {
+            QueueWork(connectionId, { AZ::EntityId(connectionId + 1) }, AZ::Aabb::CreateNull());
+        }
+
+        m_scheduler->Execute(m_jobContext.get());
+        ASSERT_EQ(m_mergeOrder.size(), 4);
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            EXPECT_EQ(m_mergeOrder[index], index);
+        }
+    }
+
+    TEST_F(NetworkInputSchedulerTests, CancelDiscardsWork)
+    {
+        QueueWork(0, { AZ::EntityId(1) }, AZ::Aabb::CreateNull());
+        QueueWork(1, { AZ::EntityId(2) }, AZ::Aabb::CreateNull());
+        m_scheduler->CancelWork(&m_owners[0]);
+        EXPECT_EQ(m_scheduler->GetWorkCount(), 1);
+
+        m_scheduler->Execute(m_jobContext.get());
+        EXPECT_EQ(m_processCount, 1);
+        ASSERT_EQ(m_mergeOrder.size(), 1);
+        EXPECT_EQ(m_mergeOrder[0], 1);
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class NetworkTimeTests
+        : public LeakDetectionFixture
+    {
+    public:
+        Multiplayer::NetworkTime m_networkTime;
+        AZ::LoggerSystemComponent m_loggerComponent;
+        AZ::TimeSystem m_timeSystem;
+    };
+
+    TEST_F(NetworkTimeTests, ThreadTimeScopeStartsFromHostState)
+    {
+        const Multiplayer::HostFrameId hostFrameId(5);
+        const AZ::TimeMs hostTimeMs(100);
+        const float hostBlendFactor = 0.25f;
+        m_networkTime.ForceSetTime(hostFrameId, hostTimeMs);
+        m_networkTime.AlterTime(hostFrameId, hostTimeMs, hostBlendFactor, AzNetworking::InvalidConnectionId);
+
+        Multiplayer::HostFrameId scopeFrameId = Multiplayer::InvalidHostFrameId;
+        AZ::TimeMs scopeTimeMs = AZ::Time::ZeroTimeMs;
+        float scopeBlendFactor = Multiplayer::DefaultBlendFactor;
+        bool scopeRewound = true;
+        AZStd::thread thread([&]()
+        {
+            Multiplayer::ScopedThreadTime threadTime;
+            scopeFrameId = m_networkTime.GetHostFrameId();
+            scopeTimeMs = m_networkTime.GetHostTimeMs();
+            scopeBlendFactor = m_networkTime.GetHostBlendFactor();
+            scopeRewound = m_networkTime.IsTimeRewound();
+        });
+        thread.join();
+
+        EXPECT_EQ(scopeFrameId, hostFrameId);
+        EXPECT_EQ(scopeTimeMs, hostTimeMs);
+        EXPECT_EQ(scopeBlendFactor, hostBlendFactor);
+        EXPECT_FALSE(scopeRewound);
+    }
+
+    TEST_F(NetworkTimeTests, ThreadTimeScopeAlterationsStayOnThread)
+    {
+        m_networkTime.ForceSetTime(Multiplayer::HostFrameId(5), AZ::TimeMs(100));
+
+        AZStd::thread thread([&]()
+        {
+            Multiplayer::ScopedThreadTime threadTime;
+            Multiplayer::ScopedAlterTime alterTime(Multiplayer::HostFrameId(2), AZ::TimeMs(40), 0.5f, AzNetworking::ConnectionId(1));
+            EXPECT_EQ(m_networkTime.GetHostFrameId(), Multiplayer::HostFrameId(2));
+            EXPECT_TRUE(m_networkTime.IsTimeRewound());
+        });
+        thread.join();
+
+        EXPECT_EQ(m_networkTime.GetHostFrameId(), Multiplayer::HostFrameId(5));
+        EXPECT_EQ(m_networkTime.GetHostTimeMs(), AZ::TimeMs(100));
+        EXPECT_FALSE(m_networkTime.IsTimeRewound());
+    }
+}
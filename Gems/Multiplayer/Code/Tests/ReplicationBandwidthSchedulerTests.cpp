@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationBandwidthScheduler.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class ReplicationBandwidthSchedulerTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint32_t UpdateSize = 100;
+        static constexpr uint32_t MaxOptionalCount = 64;
+
+        // Sends whatever the scheduler selects, recording actual sizes as the replication manager does
+        void Tick(float sendRateBytesPerSecond, AZ::TimeMs deltaTimeMs)
+        {
+            m_scheduler.BeginTick(sendRateBytesPerSecond, deltaTimeMs);
+            m_scheduler.SelectUpdates(m_candidates, MaxOptionalCount, m_selected);
+            for (uint32_t index : m_selected)
+            {
+                m_scheduler.RecordSentUpdate(m_candidates[index].m_entityId, UpdateSize);
+            }
+        }
+
+        bool WasSelected(NetEntityId entityId) const
+        {
+            for (uint32_t index : m_selected)
+            {
+                if (m_candidates[index].m_entityId == entityId)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        ReplicationBandwidthScheduler m_scheduler;
+        ReplicationBandwidthScheduler::CandidateList m_candidates;
+        ReplicationBandwidthScheduler::SelectedIndices m_selected;
+    };
+
+    TEST_F(ReplicationBandwidthSchedulerTests, SendsEverythingWithinBudget)
+    {
+        for (uint64_t index = 0; index < 8; ++index)
+        {
+            m_candidates.push_back({ NetEntityId{ index }, 1.0f, false });
+        }
+
+        // 1MB/s comfortably fits 8 small updates
+        Tick(1024.0f * 1024.0f, AZ::TimeMs{ 33 });
+        EXPECT_EQ(m_selected.size(), 8);
+        EXPECT_EQ(m_scheduler.GetLastDeferredCount(), 0);
+    }
+
+    TEST_F(ReplicationBandwidthSchedulerTests, LimitsUpdatesToBudget)
+    {
+        for (uint64_t index = 0; index < 32; ++index)
+        {
+            m_candidates.push_back({ NetEntityId{ index }, 1.0f, false });
+        }
+
+        // 10KB/s with the default 100ms burst allows roughly 1KB per tick, or 10 updates
+        Tick(10.0f * 1024.0f, AZ::TimeMs{ 100 });
+        EXPECT_GT(m_selected.size(), 0);
+        EXPECT_LT(m_selected.size(), 32);
+        EXPECT_EQ(m_scheduler.GetLastDeferredCount(), 32 - m_selected.size());
+    }
+
+    TEST_F(ReplicationBandwidthSchedulerTests, PrefersHigherPriority)
+    {
+        m_candidates.push_back({ NetEntityId{ 1 }, 0.1f, false });
+        m_candidates.push_back({ NetEntityId{ 2 }, 10.0f, false });
+
+        // A budget of a single update only admits the most important entity
+        Tick(1000.0f, AZ::TimeMs{ 100 });
+        ASSERT_EQ(m_selected.size(), 1);
+        EXPECT_TRUE(WasSelected(NetEntityId{ 2 }));
+        EXPECT_GT(m_scheduler.GetAccumulatedPriority(NetEntityId{ 1 }), 0.0f);
+        EXPECT_EQ(m_scheduler.GetAccumulatedPriority(NetEntityId{ 2 }), 0.0f);
+    }
+
+    TEST_F(ReplicationBandwidthSchedulerTests, LowPriorityEventuallySends)
+    {
+        m_candidates.push_back({ NetEntityId{ 1 }, 0.5f, false });
+        m_candidates.push_back({ NetEntityId{ 2 }, 1.0f, false });
+
+        // Deferred entities accumulate priority every tick until they outrank entities that were just sent
+        bool lowPrioritySent = false;
+        for (uint32_t tick = 0; (tick < 10) && !lowPrioritySent; ++tick)
+        {
+            Tick(1000.0f, AZ::TimeMs{ 100 });
+            lowPrioritySent = WasSelected(NetEntityId{ 1 });
+        }
+        EXPECT_TRUE(lowPrioritySent);
+    }
+
+    TEST_F(ReplicationBandwidthSchedulerTests, MandatoryAlwaysSends)
+    {
+        m_candidates.push_back({ NetEntityId{ 1 }, 100.0f, false });
+        m_candidates.push_back({ NetEntityId{ 2 }, 0.0f, true });
+
+        // Even with no budget at all, mandatory updates go out while optional ones wait
+        for (uint32_t tick = 0; tick < 4; ++tick)
+        {
+            Tick(0.0f, AZ::TimeMs{ 100 });
+            EXPECT_TRUE(WasSelected(NetEntityId{ 2 }));
+            EXPECT_FALSE(WasSelected(NetEntityId{ 1 }));
+        }
+    }
+
+    TEST_F(ReplicationBandwidthSchedulerTests, RemoveEntityClearsState)
+    {
+        m_candidates.push_back({ NetEntityId{ 1 }, 1.0f, false });
+        Tick(0.0f, AZ::TimeMs{ 100 });
+        EXPECT_GT(m_scheduler.GetAccumulatedPriority(NetEntityId{ 1 }), 0.0f);
+
+        m_scheduler.RemoveEntity(NetEntityId{ 1 });
+        EXPECT_EQ(m_scheduler.GetAccumulatedPriority(NetEntityId{ 1 }), 0.0f);
+    }
+}
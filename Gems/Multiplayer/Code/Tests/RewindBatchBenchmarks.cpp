@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <Multiplayer/NetworkTime/RewindBatch.h>
+#include <Source/NetworkTime/NetworkTime.h>
+
+namespace Multiplayer
+{
+    //! Minimal entity bounds provider, each player occupies a fixed sized box around its world translation.
+    class BenchmarkEntityBoundsUnion : public AzFramework::IEntityBoundsUnion
+    {
+    public:
+        void RefreshEntityLocalBoundsUnion([[maybe_unused]] AZ::EntityId entityId) override {}
+        AZ::Aabb GetEntityLocalBoundsUnion([[maybe_unused]] AZ::EntityId entityId) const override { return AZ::Aabb::CreateNull(); }
+        void ProcessEntityBoundsUnionRequests() override {}
+        void OnTransformUpdated([[maybe_unused]] AZ::Entity* entity) override {}
+
+        AZ::Aabb GetEntityWorldBoundsUnion(AZ::EntityId entityId) const override
+        {
+            const auto iterator = m_worldBounds.find(entityId);
+            return (iterator != m_worldBounds.end()) ? iterator->second : AZ::Aabb::CreateNull();
+        }
+
+        AZStd::unordered_map<AZ::EntityId, AZ::Aabb> m_worldBounds;
+    };
+
+    /*
+     * 64 players laid out on an 8x8 grid, each of which fires a single shot at a neighbour every tick.
+     * Player latencies are spread across four distinct rewind frames, so a batched rewind performs four rewinds per tick
+     * where rewinding per shot performs sixty four.
+     */
+    class RewindBatchBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        static constexpr uint32_t PlayerCount = 64;
+        static constexpr uint32_t GridWidth = 8;
+        static constexpr uint32_t RewindFrameCount = 4;
+        static constexpr float PlayerSpacing = 20.0f;
+        static constexpr float PlayerHalfExtent = 1.0f;
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            // Swap the stub network time for the real implementation so that rewinds go through the visibility system
+            AZ::Interface<INetworkTime>::Unregister(m_NetworkTime.get());
+            m_rewindNetworkTime = AZStd::make_unique<NetworkTime>();
+            for (uint32_t frame = 0; frame < RewindFrameCount * 2; ++frame)
+            {
+                m_rewindNetworkTime->IncrementHostFrameId();
+            }
+
+            m_octreeSystem = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+            m_entityBoundsUnion = AZStd::make_unique<BenchmarkEntityBoundsUnion>();
+            AZ::Interface<AzFramework::IEntityBoundsUnion>::Register(m_entityBoundsUnion.get());
+
+            m_players.reserve(PlayerCount);
+            m_visibilityEntries.resize(PlayerCount);
+            m_syncRewindHandlers.reserve(PlayerCount);
+            for (uint32_t index = 0; index < PlayerCount; ++index)
+            {
+                const AZ::Vector3 position(
+                    aznumeric_cast<float>(index % GridWidth) * PlayerSpacing, aznumeric_cast<float>(index / GridWidth) * PlayerSpacing, 0.0f);
+
+                m_players.push_back(AZStd::make_shared<EntityInfo>(index + 1, "player", NetEntityId{ index + 1 }, EntityInfo::Role::None));
+                EntityInfo& player = *m_players.back();
+                PopulateHierarchicalEntity(player);
+                SetupEntity(player.m_entity, player.m_netId, NetEntityRole::Authority);
+                player.m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(AZ::Transform::CreateTranslation(position));
+                player.m_entity->Activate();
+
+                m_syncRewindHandlers.emplace_back([this]() { ++m_entitySyncCount; });
+                player.m_entity->FindComponent<NetBindComponent>()->AddEntitySyncRewindEventHandler(m_syncRewindHandlers.back());
+
+                const AZ::Aabb bounds = AZ::Aabb::CreateCenterHalfExtents(position, AZ::Vector3(PlayerHalfExtent));
+                m_entityBoundsUnion->m_worldBounds[player.m_entity->GetId()] = bounds;
+
+                AzFramework::VisibilityEntry& visibilityEntry = m_visibilityEntries[index];
+                visibilityEntry.m_boundingVolume = bounds;
+                visibilityEntry.m_userData = player.m_entity.get();
+                visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_Entity;
+                m_octreeSystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(visibilityEntry);
+            }
+
+            // Each player shoots the next player along its row, the query volume bounds the shot
+            m_shots.reserve(PlayerCount);
+            for (uint32_t index = 0; index < PlayerCount; ++index)
+            {
+                const uint32_t target = (index % GridWidth == GridWidth - 1) ? index - 1 : index + 1;
+                Shot shot;
+                shot.m_frameId = HostFrameId{ index % RewindFrameCount + 1 };
+                shot.m_connectionId = AzNetworking::ConnectionId{ index };
+                shot.m_volume = m_visibilityEntries[index].m_boundingVolume;
+                shot.m_volume.AddAabb(m_visibilityEntries[target].m_boundingVolume);
+                m_shots.push_back(shot);
+            }
+        }
+
+        void internalTearDown() override
+        {
+            m_shots.clear();
+            m_syncRewindHandlers.clear();
+
+            for (AzFramework::VisibilityEntry& visibilityEntry : m_visibilityEntries)
+            {
+                m_octreeSystem->GetDefaultVisibilityScene()->RemoveEntry(visibilityEntry);
+            }
+            m_visibilityEntries.clear();
+            m_players.clear();
+
+            AZ::Interface<AzFramework::IEntityBoundsUnion>::Unregister(m_entityBoundsUnion.get());
+            m_entityBoundsUnion.reset();
+            m_octreeSystem.reset();
+
+            m_rewindNetworkTime.reset();
+            AZ::Interface<INetworkTime>::Register(m_NetworkTime.get());
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        struct Shot
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            AZ::Aabb m_volume = AZ::Aabb::CreateNull();
+        };
+
+        AZStd::unique_ptr<NetworkTime> m_rewindNetworkTime;
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystem;
+        AZStd::unique_ptr<BenchmarkEntityBoundsUnion> m_entityBoundsUnion;
+        AZStd::vector<AZStd::shared_ptr<EntityInfo>> m_players;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visibilityEntries;
+        AZStd::vector<Shot> m_shots;
+
+        AZStd::vector<EntitySyncRewindEvent::Handler> m_syncRewindHandlers;
+        uint64_t m_entitySyncCount = 0;
+        uint64_t m_queryCount = 0;
+    };
+
+    // Rewinds, queries and leaves entities rewound for every shot, restoring once at the end of the tick as the server does today
+    BENCHMARK_DEFINE_F(RewindBatchBenchmark, PerShotRewind64Players)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (const Shot& shot : m_shots)
+            {
+                ScopedAlterTime scopedTime(shot.m_frameId, AZ::Time::ZeroTimeMs, DefaultBlendFactor, shot.m_connectionId);
+                GetNetworkTime()->SyncEntitiesToRewindState(shot.m_volume);
+                ++m_queryCount;
+            }
+            GetNetworkTime()->ClearRewoundEntities();
+        }
+
+        state.counters["EntitySyncsPerTick"] = benchmark::Counter(aznumeric_cast<double>(m_entitySyncCount), benchmark::Counter::kAvgIterations);
+        state.counters["QueriesPerTick"] = benchmark::Counter(aznumeric_cast<double>(m_queryCount), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(RewindBatchBenchmark, PerShotRewind64Players)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    // Groups all shots for the tick by rewind frame, rewinding and restoring once per frame
+    BENCHMARK_DEFINE_F(RewindBatchBenchmark, BatchedRewind64Players)(benchmark::State& state)
+    {
+        RewindBatch batch;
+        uint64_t rewindCount = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (const Shot& shot : m_shots)
+            {
+                batch.AddQuery(shot.m_frameId, AZ::Time::ZeroTimeMs, DefaultBlendFactor, shot.m_connectionId, shot.m_volume,
+                    [this]() { ++m_queryCount; });
+            }
+            batch.Execute();
+            rewindCount += batch.GetLastRewindCount();
+        }
+
+        state.counters["EntitySyncsPerTick"] = benchmark::Counter(aznumeric_cast<double>(m_entitySyncCount), benchmark::Counter::kAvgIterations);
+        state.counters["QueriesPerTick"] = benchmark::Counter(aznumeric_cast<double>(m_queryCount), benchmark::Counter::kAvgIterations);
+        state.counters["RewindsPerTick"] = benchmark::Counter(aznumeric_cast<double>(rewindCount), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(RewindBatchBenchmark, BatchedRewind64Players)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
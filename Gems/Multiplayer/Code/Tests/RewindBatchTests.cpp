@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <IMultiplayerConnectionMock.h>
+#include <MockInterfaces.h>
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <Multiplayer/NetworkTime/RewindBatch.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace testing;
+
+    class RewindBatchTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_mockNetworkTime = AZStd::make_unique<NiceMock<MockNetworkTime>>();
+            AZ::Interface<Multiplayer::INetworkTime>::Register(m_mockNetworkTime.get());
+
+            ON_CALL(*m_mockNetworkTime, AlterTime(_, _, _, _)).WillByDefault(Invoke(
+                [this](Multiplayer::HostFrameId frameId, AZ::TimeMs, float blendFactor, AzNetworking::ConnectionId connectionId)
+                {
+                    m_frameId = frameId;
+                    m_blendFactor = blendFactor;
+                    m_connectionId = connectionId;
+                }));
+            ON_CALL(*m_mockNetworkTime, SyncEntitiesToRewindState(An<AZStd::span<const AZ::Aabb>>())).WillByDefault(Invoke(
+                [this](AZStd::span<const AZ::Aabb> rewindVolumes)
+                {
+                    m_syncedVolumeCounts.push_back(aznumeric_cast<uint32_t>(rewindVolumes.size()));
+                    m_syncConnectionIds.push_back(m_connectionId);
+                }));
+        }
+
+        void TearDown() override
+        {
+            AZ::Interface<Multiplayer::INetworkTime>::Unregister(m_mockNetworkTime.get());
+            m_mockNetworkTime.reset();
+            m_syncedVolumeCounts = {};
+            m_syncConnectionIds = {};
+        }
+
+        static AZ::Aabb CreateVolume(float offset)
+        {
+            return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(offset, 0.0f, 0.0f), AZ::Vector3(1.0f));
+        }
+
+        AZStd::unique_ptr<NiceMock<MockNetworkTime>> m_mockNetworkTime;
+        Multiplayer::HostFrameId m_frameId = Multiplayer::InvalidHostFrameId;
+        float m_blendFactor = Multiplayer::DefaultBlendFactor;
+        AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+        AZStd::vector<uint32_t> m_syncedVolumeCounts;
+        AZStd::vector<AzNetworking::ConnectionId> m_syncConnectionIds;
+    };
+
+    TEST_F(RewindBatchTests, EmptyBatchDoesNotRewind)
+    {
+        EXPECT_CALL(*m_mockNetworkTime, SyncEntitiesToRewindState(An<AZStd::span<const AZ::Aabb>>())).Times(0);
+        EXPECT_CALL(*m_mockNetworkTime, ClearRewoundEntities()).Times(0);
+
+        Multiplayer::RewindBatch batch;
+        batch.Execute();
+        EXPECT_EQ(batch.GetLastRewindCount(), 0);
+    }
+
+    TEST_F(RewindBatchTests, GroupsQueriesByFrame)
+    {
+        EXPECT_CALL(*m_mockNetworkTime, SyncEntitiesToRewindState(An<AZStd::span<const AZ::Aabb>>())).Times(2);
+        EXPECT_CALL(*m_mockNetworkTime, ClearRewoundEntities()).Times(2);
+
+        AZStd::vector<uint32_t> executionOrder;
+        AZStd::vector<Multiplayer::HostFrameId> executionFrames;
+        const Multiplayer::HostFrameId frameIds[] = { Multiplayer::HostFrameId{ 12 }, Multiplayer::HostFrameId{ 10 } };
+
+        Multiplayer::RewindBatch batch;
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            batch.AddQuery(frameIds[index % 2], AZ::TimeMs{ 0 }, 1.0f, AzNetworking::ConnectionId{ index }, CreateVolume(aznumeric_cast<float>(index)),
+                [this, index, &executionOrder, &executionFrames]()
+                {
+                    executionOrder.push_back(index);
+                    executionFrames.push_back(m_frameId);
+                });
+        }
+        EXPECT_EQ(batch.GetQueryCount(), 4);
+
+        batch.Execute();
+        EXPECT_EQ(batch.GetQueryCount(), 0);
+        EXPECT_EQ(batch.GetLastRewindCount(), 2);
+
+        // Each rewind syncs the volumes of both queries targeting its frame
+        ASSERT_EQ(m_syncedVolumeCounts.size(), 2);
+        EXPECT_EQ(m_syncedVolumeCounts[0], 2);
+        EXPECT_EQ(m_syncedVolumeCounts[1], 2);
+
+        // Earlier frames execute first, and submission order is preserved within a frame
+        const uint32_t expectedOrder[] = { 1, 3, 0, 2 };
+        ASSERT_EQ(executionOrder.size(), 4);
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            EXPECT_EQ(executionOrder[index], expectedOrder[index]);
+            EXPECT_EQ(executionFrames[index], frameIds[expectedOrder[index] % 2]);
+        }
+    }
+
+    TEST_F(RewindBatchTests, SeparatesBlendFactors)
+    {
+        EXPECT_CALL(*m_mockNetworkTime, ClearRewoundEntities()).Times(2);
+
+        Multiplayer::RewindBatch batch;
+        batch.AddQuery(Multiplayer::HostFrameId{ 5 }, AZ::TimeMs{ 0 }, 0.5f, AzNetworking::ConnectionId{ 0 }, CreateVolume(0.0f), []() {});
+        batch.AddQuery(Multiplayer::HostFrameId{ 5 }, AZ::TimeMs{ 0 }, 1.0f, AzNetworking::ConnectionId{ 1 }, CreateVolume(1.0f), []() {});
+        batch.Execute();
+
+        EXPECT_EQ(batch.GetLastRewindCount(), 2);
+        ASSERT_EQ(m_syncedVolumeCounts.size(), 2);
+        EXPECT_EQ(m_syncedVolumeCounts[0], 1);
+        EXPECT_EQ(m_syncedVolumeCounts[1], 1);
+    }
+
+    TEST_F(RewindBatchTests, QueriesRunUnderTheirOwnConnection)
+    {
+        AZStd::vector<AzNetworking::ConnectionId> queryConnectionIds;
+
+        Multiplayer::RewindBatch batch;
+        for (uint32_t index = 0; index < 3; ++index)
+        {
+            batch.AddQuery(Multiplayer::HostFrameId{ 7 }, AZ::TimeMs{ 0 }, 1.0f, AzNetworking::ConnectionId{ index }, CreateVolume(0.0f),
+                [this, &queryConnectionIds]()
+                {
+                    queryConnectionIds.push_back(m_connectionId);
+                });
+        }
+        batch.Execute();
+
+        // The shared sync must not exempt any single shooter from being rewound
+        ASSERT_EQ(m_syncConnectionIds.size(), 1);
+        EXPECT_EQ(m_syncConnectionIds[0], Multiplayer::RewindBatchConnectionId);
+
+        ASSERT_EQ(queryConnectionIds.size(), 3);
+        for (uint32_t index = 0; index < 3; ++index)
+        {
+            EXPECT_EQ(queryConnectionIds[index], AzNetworking::ConnectionId{ index });
+        }
+    }
+
+    TEST_F(RewindBatchTests, ClearDiscardsQueries)
+    {
+        EXPECT_CALL(*m_mockNetworkTime, SyncEntitiesToRewindState(An<AZStd::span<const AZ::Aabb>>())).Times(0);
+
+        bool executed = false;
+        Multiplayer::RewindBatch batch;
+        batch.AddQuery(Multiplayer::HostFrameId{ 1 }, AZ::TimeMs{ 0 }, 1.0f, AzNetworking::ConnectionId{ 0 }, CreateVolume(0.0f),
+            [&executed]() { executed = true; });
+        batch.Clear();
+        batch.Execute();
+
+        EXPECT_EQ(batch.GetQueryCount(), 0);
+        EXPECT_FALSE(executed);
+    }
+}
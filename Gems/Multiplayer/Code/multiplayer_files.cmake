@@ -29,6 +29,7 @@ set(FILES
     Include/Multiplayer/NetworkInput/NetworkInputChild.h
     Include/Multiplayer/NetworkInput/NetworkInputHistory.h
     Include/Multiplayer/NetworkInput/NetworkInputMigrationVector.h
+    Include/Multiplayer/NetworkInput/NetworkInputScheduler.h
     Include/Multiplayer/NetworkEntity/NetworkEntityHandle.h
     Include/Multiplayer/NetworkEntity/NetworkEntityHandle.inl
     Include/Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h
@@ -46,9 +47,11 @@ set(FILES
     Include/Multiplayer/MultiplayerTypes.h
     Include/Multiplayer/NetworkEntity/IFilterEntityManager.h
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationBandwidthScheduler.h
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
+    Include/Multiplayer/NetworkTime/RewindBatch.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
     Include/Multiplayer/NetworkTime/RewindableFixedVector.h
@@ -82,12 +85,15 @@ set(FILES
     Source/NetworkEntity/NetworkEntityTracker.h
     Source/NetworkEntity/NetworkEntityTracker.inl
     Source/NetworkEntity/NetworkEntityUpdateMessage.cpp
+    Source/NetworkEntity/EntityReplication/ReplicationBandwidthScheduler.cpp
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
     Source/NetworkInput/NetworkInput.cpp
     Source/NetworkInput/NetworkInputArray.cpp
     Source/NetworkInput/NetworkInputChild.cpp
     Source/NetworkInput/NetworkInputHistory.cpp
     Source/NetworkInput/NetworkInputMigrationVector.cpp
+    Source/NetworkInput/NetworkInputScheduler.cpp
+    Source/NetworkTime/RewindBatch.cpp
     Source/Session/MatchmakingRequests.cpp
     Source/Session/SessionRequests.cpp
     Source/Session/SessionConfig.cpp
@@ -27,11 +27,17 @@ set(FILES
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkCharacterTests.cpp
     Tests/NetworkEntityTests.cpp
+    Tests/NetworkInputSchedulerBenchmarks.cpp
+    Tests/NetworkInputSchedulerTests.cpp
     Tests/NetworkInputTests.cpp
     Tests/NetworkRigidBodyTests.cpp
+    Tests/NetworkTimeTests.cpp
     Tests/NetworkTransformTests.cpp
+    Tests/ReplicationBandwidthSchedulerTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/RewindBatchBenchmarks.cpp
+    Tests/RewindBatchTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
     Tests/TestMultiplayerComponent.h
@@ -32,6 +32,11 @@ namespace PhysX
         "Max size of a heightfield collider update region in heightfield points, used for partitioning updates for faster cancellation. "
         "Each update will be the largest number of heightfield rows that stays below this total point count threshold.");
 
+    AZ_CVAR(size_t, physx_heightfieldColliderMaxDirtyRegions, 16, nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Max number of separate dirty regions tracked for a heightfield collider update. "
+        "Once this is exceeded, all the dirty regions get merged into a single region that contains all of them.");
+
     // The HeightfieldUpdateJobContext is an extremely simplified way to manage the background update jobs.
     // On any heightfield change, the collider code will cancel any update job that's currently running, wait for it
     // to complete, and then start a new update job.
@@ -115,6 +120,32 @@ namespace PhysX
         m_maxColumnVertex = AZStd::max(m_maxColumnVertex, startColumnVertex + numColumnVertices);
     }
 
+    void HeightfieldCollider::DirtyHeightfieldRegion::AddRegion(const DirtyHeightfieldRegion& dirtyRegion)
+    {
+        m_minRowVertex = AZStd::min(m_minRowVertex, dirtyRegion.m_minRowVertex);
+        m_minColumnVertex = AZStd::min(m_minColumnVertex, dirtyRegion.m_minColumnVertex);
+        m_maxRowVertex = AZStd::max(m_maxRowVertex, dirtyRegion.m_maxRowVertex);
+        m_maxColumnVertex = AZStd::max(m_maxColumnVertex, dirtyRegion.m_maxColumnVertex);
+    }
+
+    void HeightfieldCollider::DirtyHeightfieldRegion::ClampToSize(size_t numColumnVertices, size_t numRowVertices)
+    {
+        m_maxRowVertex = AZStd::min(m_maxRowVertex, numRowVertices);
+        m_maxColumnVertex = AZStd::min(m_maxColumnVertex, numColumnVertices);
+    }
+
+    bool HeightfieldCollider::DirtyHeightfieldRegion::Touches(const DirtyHeightfieldRegion& dirtyRegion) const
+    {
+        // The max values are one past the last dirty vertex, so regions that share an edge are also treated as touching.
+        return (m_minRowVertex <= dirtyRegion.m_maxRowVertex) && (dirtyRegion.m_minRowVertex <= m_maxRowVertex) &&
+            (m_minColumnVertex <= dirtyRegion.m_maxColumnVertex) && (dirtyRegion.m_minColumnVertex <= m_maxColumnVertex);
+    }
+
+    bool HeightfieldCollider::DirtyHeightfieldRegion::IsEmpty() const
+    {
+        return (m_minRowVertex >= m_maxRowVertex) || (m_minColumnVertex >= m_maxColumnVertex);
+    }
+
 
 
     HeightfieldCollider::HeightfieldCollider(
@@ -281,18 +312,22 @@ namespace PhysX
     }
 
     void HeightfieldCollider::UpdatePhysXHeightfieldRows(
-        AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
-        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+        size_t dirtyRegionIndex, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
     {
         // This method is called by an update job to update a portion of the PhysX heightfield to contain the latest heightfield data.
 
         if (!m_jobContext->IsCanceled() && (numRows > 0) && (numColumns > 0))
         {
-            // Refresh a subset of the PhysX heightfield.
+            // Modify a subset of the PhysX heightfield samples.
             // This assumes that the shape configuration for this region has already been updated.
             // NOTE: For a given heightfield, only one of these calls should be executed at a time, since the underlying PhysX
             // heightfield has no thread safety protections and modifies min/max height data global to the heightfield on every refresh.
-            Utils::RefreshHeightfieldShape(scene, &(*shape), *m_shapeConfig, startColumn, startRow, numColumns, numRows);
+            Utils::ModifyHeightfieldSamples(*m_shapeConfig, startColumn, startRow, numColumns, numRows);
+
+            // The shape in the scene only needs to pick up the new samples once, after all of the modifications are done.
+            // Refreshing it causes the scene to update the shape bounds and contacts for the entire heightfield, so deferring it
+            // keeps the cost of each of these jobs proportional to the number of samples that they modify.
+            m_shapeRefreshPending = true;
 
             // Reduce our dirty region by the number of rows that we're processing in this piece of the update job chain.
             // We've updated both the shape configuration and the PhysX heightfield at this point, so those rows have completed
@@ -300,18 +335,24 @@ namespace PhysX
             // have changed.
             // This dirty region logic assumes that we're updating all dirty columns for a row on every call. If this assumption
             // ever changes, we'll need more complicated dirty region logic to track which columns in each row are dirty.
-            m_dirtyRegion.m_minRowVertex = startRow + numRows;
+            m_dirtyRegions[dirtyRegionIndex].m_minRowVertex = startRow + numRows;
         }
     }
 
-    void HeightfieldCollider::RefreshComplete()
+    void HeightfieldCollider::RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape)
     {
         // This method is called by an update job to signal that the chain of update jobs have completed.
 
+        // Refresh the shape even if the job was canceled, so that the scene picks up any samples that were already modified.
+        if (m_shapeRefreshPending.exchange(false) && scene && shape)
+        {
+            Utils::RefreshHeightfieldShapeGeometry(scene, shape.get(), *m_shapeConfig);
+        }
+
         // If the job hasn't been canceled, notify any listeners that the collider has changed.
         if (!m_jobContext->IsCanceled())
         {
-            m_dirtyRegion.SetNull();
+            m_dirtyRegions.clear();
             Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
         }
 
@@ -319,6 +360,59 @@ namespace PhysX
         m_jobContext->OnRefreshComplete();
     }
 
+    void HeightfieldCollider::AddDirtyRegion(const AZ::Aabb& dirtyRegion)
+    {
+        DirtyHeightfieldRegion newRegion;
+        newRegion.AddAabb(dirtyRegion, m_entityId);
+
+        AZ_Assert(newRegion.m_maxRowVertex >= newRegion.m_minRowVertex,
+            "Invalid dirty region (min=%zu max=%zu)", newRegion.m_minRowVertex, newRegion.m_maxRowVertex);
+
+        AZ_Assert(newRegion.m_maxColumnVertex >= newRegion.m_minColumnVertex,
+            "Invalid dirty region (min=%zu max=%zu)", newRegion.m_minColumnVertex, newRegion.m_maxColumnVertex);
+
+        if (newRegion.IsEmpty())
+        {
+            return;
+        }
+
+        // Merge the new region with every existing region that it touches. Merging can grow the new region so that it touches
+        // regions that it didn't touch before, so keep going until none of the remaining regions touch it.
+        bool mergedRegion = true;
+        while (mergedRegion)
+        {
+            mergedRegion = false;
+            for (size_t index = 0; index < m_dirtyRegions.size();)
+            {
+                if (m_dirtyRegions[index].IsEmpty() || newRegion.Touches(m_dirtyRegions[index]))
+                {
+                    if (!m_dirtyRegions[index].IsEmpty())
+                    {
+                        newRegion.AddRegion(m_dirtyRegions[index]);
+                        mergedRegion = true;
+                    }
+                    m_dirtyRegions.erase(m_dirtyRegions.begin() + index);
+                }
+                else
+                {
+                    index++;
+                }
+            }
+        }
+
+        // If there are too many separate regions, fall back to a single region that contains all of them, so that the number of
+        // update jobs doesn't keep growing.
+        if (m_dirtyRegions.size() >= physx_heightfieldColliderMaxDirtyRegions)
+        {
+            for (const DirtyHeightfieldRegion& region : m_dirtyRegions)
+            {
+                newRegion.AddRegion(region);
+            }
+            m_dirtyRegions.clear();
+        }
+
+        m_dirtyRegions.emplace_back(newRegion);
+    }
 
     void HeightfieldCollider::RefreshHeightfield(
         const Physics::HeightfieldProviderNotifications::HeightfieldChangeMask changeMask,
@@ -403,6 +497,7 @@ namespace PhysX
         {
             // Destroy the existing heightfield. This will completely remove it from the world.
             ClearHeightfield();
+            m_shapeRefreshPending = false;
 
             *m_shapeConfig = Utils::CreateBaseHeightfieldShapeConfiguration(m_entityId);
             size_t numSamples = m_shapeConfig->GetNumRowVertices() * m_shapeConfig->GetNumColumnVertices();
@@ -428,26 +523,26 @@ namespace PhysX
             InitStaticRigidBody();
         }
 
-        // Add the new request region to our dirty heightfield region
-        m_dirtyRegion.AddAabb(requestRegion, m_entityId);
-
-        AZ_Assert(m_dirtyRegion.m_maxRowVertex >= m_dirtyRegion.m_minRowVertex,
-            "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_minRowVertex, m_dirtyRegion.m_maxRowVertex);
+        // Add the new request region to our dirty heightfield regions.
+        AddDirtyRegion(requestRegion);
 
-        AZ_Assert(m_dirtyRegion.m_maxColumnVertex >= m_dirtyRegion.m_minColumnVertex,
-            "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_maxColumnVertex, m_dirtyRegion.m_minColumnVertex);
-
-        // If our heightfield size has just shrunk and we had a pre-existing dirty region, the max vertex values could be higher than
-        // our current size, so clamp them to the current size.
-        m_dirtyRegion.m_maxRowVertex = AZStd::min(m_dirtyRegion.m_maxRowVertex, m_shapeConfig->GetNumRowVertices());
-        m_dirtyRegion.m_maxColumnVertex = AZStd::min(m_dirtyRegion.m_maxColumnVertex, m_shapeConfig->GetNumColumnVertices());
-
-        size_t startColumn = m_dirtyRegion.m_minColumnVertex;
-        size_t numColumns = m_dirtyRegion.m_maxColumnVertex - m_dirtyRegion.m_minColumnVertex;
-        size_t numRows = m_dirtyRegion.m_maxRowVertex - m_dirtyRegion.m_minRowVertex;
+        // If our heightfield size has just shrunk and we had pre-existing dirty regions, the max vertex values could be higher than
+        // our current size, so clamp them to the current size. Then remove any regions that are too small to affect any vertices.
+        for (size_t index = 0; index < m_dirtyRegions.size();)
+        {
+            m_dirtyRegions[index].ClampToSize(m_shapeConfig->GetNumColumnVertices(), m_shapeConfig->GetNumRowVertices());
+            if (m_dirtyRegions[index].IsEmpty())
+            {
+                m_dirtyRegions.erase(m_dirtyRegions.begin() + index);
+            }
+            else
+            {
+                index++;
+            }
+        }
 
-        // If our dirty region is too small to affect any vertices, early-out.
-        if ((numRows == 0) || (numColumns == 0))
+        // If our dirty regions are too small to affect any vertices, early-out.
+        if (m_dirtyRegions.empty())
         {
             return;
         }
@@ -457,11 +552,6 @@ namespace PhysX
 
         auto shape = GetHeightfieldShape();
 
-        // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
-        // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
-        // regardless of size, there would be a lot more work that needs to complete before we could cancel a job.
-        const size_t rowsPerUpdate = AZStd::max(physx_heightfieldColliderUpdateRegionSize / numColumns, static_cast<size_t>(1));
-
         AZStd::vector<AZ::Job*> updateShapeConfigJobs;
         AZStd::vector<AZ::MultipleDependentJob*> updateShapeConfigCompleteJobs;
         AZStd::vector<AZ::Job*> updatePhysXHeightfieldJobs;
@@ -471,7 +561,7 @@ namespace PhysX
         // The work for refreshing a heightfield is broken up into a series of jobs designed to maximize parallelization, avoid jobs
         // blocking on other jobs, and to respond to cancellation requests reasonably quickly.
         // 
-        // For each block of rows being processed we do the following:
+        // For each block of rows in each dirty region being processed we do the following:
         // UpdateShapeConfigJob -> (UpdateHeightsAndMaterialsAsync) -> UpdateShapeConfigCompleteJob -> UpdatePhysXHeightfieldJob
         // i.e. we update the shape configuration, then we update the PhysX Heightfield
         // The final UpdatePhysXHeightfieldJob triggers the RefreshCompleteJob to signify that all the work is completed.
@@ -491,43 +581,56 @@ namespace PhysX
         // to avoid threading update problems, and the UpdatePhysXHeightfield step can't run until the UpdateShapeConfig step it depends
         // on is complete.
 
-        for (size_t row = 0; row < numRows; row += rowsPerUpdate)
+        for (size_t regionIndex = 0; regionIndex < m_dirtyRegions.size(); regionIndex++)
         {
-            size_t startRow = m_dirtyRegion.m_minRowVertex + row;
-            size_t subregionRows = AZStd::min(m_dirtyRegion.m_maxRowVertex - startRow, rowsPerUpdate);
+            const DirtyHeightfieldRegion& dirtyRegion = m_dirtyRegions[regionIndex];
+            const size_t startColumn = dirtyRegion.m_minColumnVertex;
+            const size_t numColumns = dirtyRegion.m_maxColumnVertex - dirtyRegion.m_minColumnVertex;
+            const size_t numRows = dirtyRegion.m_maxRowVertex - dirtyRegion.m_minRowVertex;
+
+            // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
+            // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
+            // regardless of size, there would be a lot more work that needs to complete before we could cancel a job.
+            const size_t rowsPerUpdate = AZStd::max(physx_heightfieldColliderUpdateRegionSize / numColumns, static_cast<size_t>(1));
 
-            // Create the jobs for this set of rows
+            for (size_t row = 0; row < numRows; row += rowsPerUpdate)
+            {
+                size_t startRow = dirtyRegion.m_minRowVertex + row;
+                size_t subregionRows = AZStd::min(dirtyRegion.m_maxRowVertex - startRow, rowsPerUpdate);
 
-            auto* updateShapeConfigCompleteJob = aznew AZ::MultipleDependentJob(autoDelete, m_jobContext.get());
+                // Create the jobs for this set of rows
 
-            auto* updateShapeConfigJob = AZ::CreateJobFunction(
-                AZStd::bind(&HeightfieldCollider::UpdateShapeConfigRows,
-                    this, updateShapeConfigCompleteJob, startColumn, startRow, numColumns, subregionRows),
-                    autoDelete, m_jobContext.get());
+                auto* updateShapeConfigCompleteJob = aznew AZ::MultipleDependentJob(autoDelete, m_jobContext.get());
 
-            auto* updatePhysXHeightfieldJob = AZ::CreateJobFunction(
-                AZStd::bind(&HeightfieldCollider::UpdatePhysXHeightfieldRows,
-                    this, scene, shape, startColumn, startRow, numColumns, subregionRows),
-                    autoDelete, m_jobContext.get());
+                auto* updateShapeConfigJob = AZ::CreateJobFunction(
+                    AZStd::bind(&HeightfieldCollider::UpdateShapeConfigRows,
+                        this, updateShapeConfigCompleteJob, startColumn, startRow, numColumns, subregionRows),
+                        autoDelete, m_jobContext.get());
 
-            // Set up the dependencies:
-            // UpdateShapeConfigJob 1 -> UpdateShapeConfigCompleteJob 1 -> UpdatePhysXHeightfieldJob 1
-            updateShapeConfigJob->SetDependent(updateShapeConfigCompleteJob);
-            updateShapeConfigCompleteJob->AddDependent(updatePhysXHeightfieldJob);
+                auto* updatePhysXHeightfieldJob = AZ::CreateJobFunction(
+                    AZStd::bind(&HeightfieldCollider::UpdatePhysXHeightfieldRows,
+                        this, regionIndex, startColumn, startRow, numColumns, subregionRows),
+                        autoDelete, m_jobContext.get());
 
-            // Set up additional dependencies for all jobs past the first one:
-            // UpdateShapeConfigCompleteJob 1 -> UpdateShapeConfigJob 2
-            // UpdatePhysXHeightfieldJob 1 -> UpdatePhysXHeightfieldJob 2
-            if (!updateShapeConfigCompleteJobs.empty())
-            {
-                updateShapeConfigCompleteJobs.back()->AddDependent(updateShapeConfigJob);
-                updatePhysXHeightfieldJobs.back()->SetDependent(updatePhysXHeightfieldJob);
-            }
+                // Set up the dependencies:
+                // UpdateShapeConfigJob 1 -> UpdateShapeConfigCompleteJob 1 -> UpdatePhysXHeightfieldJob 1
+                updateShapeConfigJob->SetDependent(updateShapeConfigCompleteJob);
+                updateShapeConfigCompleteJob->AddDependent(updatePhysXHeightfieldJob);
 
-            // Temporarily store all the jobs we're creating so that we can continue to set up dependencies and start the jobs at the end.
-            updateShapeConfigJobs.emplace_back(updateShapeConfigJob);
-            updateShapeConfigCompleteJobs.emplace_back(updateShapeConfigCompleteJob);
-            updatePhysXHeightfieldJobs.emplace_back(updatePhysXHeightfieldJob);
+                // Set up additional dependencies for all jobs past the first one:
+                // UpdateShapeConfigCompleteJob 1 -> UpdateShapeConfigJob 2
+                // UpdatePhysXHeightfieldJob 1 -> UpdatePhysXHeightfieldJob 2
+                if (!updateShapeConfigCompleteJobs.empty())
+                {
+                    updateShapeConfigCompleteJobs.back()->AddDependent(updateShapeConfigJob);
+                    updatePhysXHeightfieldJobs.back()->SetDependent(updatePhysXHeightfieldJob);
+                }
+
+                // Temporarily store all the jobs we're creating so that we can continue to set up dependencies and start the jobs at the end.
+                updateShapeConfigJobs.emplace_back(updateShapeConfigJob);
+                updateShapeConfigCompleteJobs.emplace_back(updateShapeConfigCompleteJob);
+                updatePhysXHeightfieldJobs.emplace_back(updatePhysXHeightfieldJob);
+            }
         }
 
         if (!updateShapeConfigJobs.empty())
@@ -535,7 +638,7 @@ namespace PhysX
             // Set up the final completion job and dependency:
             // UpdatePhysXHeightfieldJob -> RefreshCompleteJob
             auto* refreshCompleteJob =
-                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this), autoDelete, m_jobContext.get());
+                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this, scene, shape), autoDelete, m_jobContext.get());
             updatePhysXHeightfieldJobs.back()->SetDependent(refreshCompleteJob);
 
             // Track that we're starting our refresh job chain.
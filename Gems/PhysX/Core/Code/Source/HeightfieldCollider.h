@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/condition_variable.h>
 
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
@@ -111,12 +113,16 @@ namespace PhysX
         //! Updates a subset of rows in the PhysX heightfield based on the data in the heightfield shape configuration.
         //! Note that while this takes in column ranges, the expectation is that it is processing all the dirty columns for each
         //! row being updated. If this assumption changes, the dirty region tracking logic will also need to change.
+        //! The shape geometry isn't refreshed here, that happens once for the entire update in RefreshComplete().
         void UpdatePhysXHeightfieldRows(
-            AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
-            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
+            size_t dirtyRegionIndex, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
         //! Called once all of the asynchronous update jobs have completed.
-        void RefreshComplete();
+        //! Refreshes the heightfield shape in the scene if any of its samples were modified.
+        void RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape);
+
+        //! Adds a dirty area to the list of dirty regions, merging it with any regions that it overlaps.
+        void AddDirtyRegion(const AZ::Aabb& dirtyRegion);
 
         //! Helper class to manage the spawned physics update jobs.
         class HeightfieldUpdateJobContext : public AZ::JobContext
@@ -178,12 +184,18 @@ namespace PhysX
         //! Cached entity name for the entity this collider is attached to.
         AZStd::string m_entityName;
 
-        //! Track the current dirty region for async heightfield refreshes.
+        //! Track a dirty region for async heightfield refreshes.
         struct DirtyHeightfieldRegion
         {
             DirtyHeightfieldRegion();
             void SetNull();
             void AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId);
+            void AddRegion(const DirtyHeightfieldRegion& dirtyRegion);
+            void ClampToSize(size_t numColumnVertices, size_t numRowVertices);
+
+            //! Returns true if the regions overlap or share an edge.
+            bool Touches(const DirtyHeightfieldRegion& dirtyRegion) const;
+            bool IsEmpty() const;
 
             size_t m_minRowVertex;      //! the first dirty row vertex
             size_t m_minColumnVertex;   //! the first dirty column vertex
@@ -191,7 +203,12 @@ namespace PhysX
             size_t m_maxColumnVertex;   //! one past the last dirty column vertex
         };
 
-        DirtyHeightfieldRegion m_dirtyRegion;
+        //! The disjoint set of regions that still need to be updated. Keeping separate regions instead of a single bounding region
+        //! means that edits in different parts of a large heightfield only update the samples that were edited.
+        AZStd::vector<DirtyHeightfieldRegion> m_dirtyRegions;
+
+        //! Track whether the PhysX heightfield samples were modified without refreshing the shape geometry in the scene yet.
+        AZStd::atomic_bool m_shapeRefreshPending = false;
         
         //! Specifies the way of creating Heightfield Collider.
         DataSource m_dataSourceType = DataSource::GenerateNewHeightfield;
@@ -902,4 +902,31 @@ namespace PhysX
     {
         return m_name;
     }
+
+    bool RigidBody::GetSyncedPose(AZ::Vector3& position, AZ::Quaternion& orientation) const
+    {
+        if (m_syncedPosition && m_syncedOrientation)
+        {
+            position = *m_syncedPosition;
+            orientation = *m_syncedOrientation;
+            return true;
+        }
+        return false;
+    }
+
+    void RigidBody::SetSyncedPose(const AZ::Vector3* position, const AZ::Quaternion* orientation)
+    {
+        m_syncedPosition = position;
+        m_syncedOrientation = orientation;
+    }
+
+    void RigidBody::SetBulkTransformTarget(AZ::TransformInterface* transform)
+    {
+        m_bulkTransformTarget = transform;
+    }
+
+    AZ::TransformInterface* RigidBody::GetBulkTransformTarget() const
+    {
+        return m_bulkTransformTarget;
+    }
 }
@@ -14,6 +14,11 @@
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
 #include <PhysX/UserDataTypes.h>
 
+namespace AZ
+{
+    class TransformInterface;
+}
+
 namespace AzPhysics
 {
     struct RigidBodyConfiguration;
@@ -124,6 +129,18 @@ namespace PhysX
         void SetName(const AZStd::string& entityName);
         const AZStd::string& GetName() const;
 
+        //! Returns the pose read by the scene's bulk transform sync, while this body's sync transform event is being signaled.
+        //! Returns false at any other time, in which case the pose needs to be read with GetPosition and GetOrientation.
+        bool GetSyncedPose(AZ::Vector3& position, AZ::Quaternion& orientation) const;
+        //! Used by the scene's bulk transform sync. Pass nullptr for both once the sync transform event has been signaled.
+        void SetSyncedPose(const AZ::Vector3* position, const AZ::Quaternion* orientation);
+
+        //! Opts this body into the scene's bulk transform update. While set and the body isn't kinematic, bulk transform syncs
+        //! write the synced pose straight to the given transform instead of signaling the sync transform event.
+        //! Pass nullptr to go back to the sync transform event.
+        void SetBulkTransformTarget(AZ::TransformInterface* transform);
+        AZ::TransformInterface* GetBulkTransformTarget() const;
+
         void AddShape(AZStd::shared_ptr<Physics::Shape> shape) override;
         void RemoveShape(AZStd::shared_ptr<Physics::Shape> shape) override;
 
@@ -142,6 +159,9 @@ namespace PhysX
         AZStd::vector<AZStd::shared_ptr<PhysX::Shape>> m_shapes;
         AZStd::string m_name;
         PhysX::ActorData m_actorUserData;
+        const AZ::Vector3* m_syncedPosition = nullptr;
+        const AZ::Quaternion* m_syncedOrientation = nullptr;
+        AZ::TransformInterface* m_bulkTransformTarget = nullptr;
         bool m_startAsleep = false;
     };
 
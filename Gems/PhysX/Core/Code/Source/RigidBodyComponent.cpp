@@ -284,16 +284,24 @@ namespace PhysX
             return;
         }
         
-        AZ::Transform transform = rigidBody->GetTransform();
+        // Use the pose already read by the scene's bulk transform sync if there is one, to avoid locking the scene again.
+        AZ::Vector3 position = AZ::Vector3::CreateZero();
+        AZ::Quaternion orientation = AZ::Quaternion::CreateIdentity();
+        if (!static_cast<RigidBody*>(rigidBody)->GetSyncedPose(position, orientation))
+        {
+            position = rigidBody->GetPosition();
+            orientation = rigidBody->GetOrientation();
+        }
+
         if (m_configuration.m_interpolateMotion)
         {
-            m_interpolator->SetTarget(transform.GetTranslation(), rigidBody->GetOrientation(), fixedDeltaTime);
+            m_interpolator->SetTarget(position, orientation, fixedDeltaTime);
         }
         else if (AZ::TransformInterface* entityTransform = GetEntity()->GetTransform())
         {
             AZ::Transform newWorldTransform = entityTransform->GetWorldTM();
-            newWorldTransform.SetRotation(rigidBody->GetOrientation());
-            newWorldTransform.SetTranslation(rigidBody->GetPosition());
+            newWorldTransform.SetRotation(orientation);
+            newWorldTransform.SetTranslation(position);
             entityTransform->SetWorldTM(newWorldTransform);
         }
         m_isLastMovementFromKinematicSource = false;
@@ -348,6 +356,13 @@ namespace PhysX
                 AzPhysics::SimulatedBody* body =
                     m_cachedSceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle);
                 body->RegisterOnSyncTransformHandler(m_activeBodySyncTransformHandler);
+
+                // Without interpolation PostPhysicsTick only copies the body pose to the entity, which the scene can do for
+                // all the moved bodies in one pass.
+                if (!m_configuration.m_interpolateMotion)
+                {
+                    static_cast<RigidBody*>(body)->SetBulkTransformTarget(GetEntity()->GetTransform());
+                }
             }
             else
             {
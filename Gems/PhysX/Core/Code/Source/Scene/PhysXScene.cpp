@@ -21,15 +21,19 @@
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 #include <PhysX/MathConversion.h>
+#include <PhysX/NativeTypeIdentifiers.h>
 #include <Joint/PhysXJoint.h>
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
@@ -45,9 +49,21 @@ namespace PhysX
 
     AZ_CVAR(bool, physx_parallelTransformSync, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Multithreaded transform update for rigid bodies. "
         "Only relevant if batched transform update is enabled.");
+    AZ_CVAR(bool, physx_bulkTransformSync, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Read the poses of all rigid bodies being synced from PhysX in one pass before sending the transform sync events, "
+        "instead of each handler reading its own body's pose.");
+    AZ_CVAR(bool, physx_bulkTransformUpdate, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Write the synced poses straight to the entity transforms of rigid bodies that opted into the bulk transform update, "
+        "instead of signaling their transform sync events. Only relevant if bulk transform sync is enabled.");
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(bool, physx_parallelSceneQueryBatch, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Split batched scene queries into tasks that run in parallel. "
+        "Batches that fit in a single task always run on the calling thread.");
+    AZ_CVAR(size_t, physx_sceneQueryBatchTaskSize, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many scene queries from a batch should be processed per task");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -306,11 +322,7 @@ namespace PhysX
             const physx::PxVec3 dir = PxMathConvert(raycastRequest->m_direction.GetNormalized());
             const physx::PxHitFlags hitFlags = SceneQueryHelpers::GetPxHitFlags(raycastRequest->m_hitFlags);
             //Raycast
-            bool status = false;
-            {
-                PHYSX_SCENE_READ_LOCK(physxScene);
-                status = physxScene->raycast(orig, dir, raycastRequest->m_distance, castResult, hitFlags, queryData, &queryFilterCallback);
-            }
+            const bool status = physxScene->raycast(orig, dir, raycastRequest->m_distance, castResult, hitFlags, queryData, &queryFilterCallback);
 
             if (status)
             {
@@ -379,12 +391,8 @@ namespace PhysX
                     "Not having MTD set for shape scene queries may result in incorrect reporting of colliders that are in contact or intersect the initial pose of the sweep.");
                 const physx::PxHitFlags hitFlags = SceneQueryHelpers::GetPxHitFlags(shapecastRequest->m_hitFlags);
 
-                bool status = false;
-                {
-                    PHYSX_SCENE_READ_LOCK(*physxScene);
-                    status = physxScene->sweep(pxGeometry.any(), pose, dir, shapecastRequest->m_distance,
-                        castResult, hitFlags, queryData, &queryFilterCallback);
-                }
+                const bool status = physxScene->sweep(pxGeometry.any(), pose, dir, shapecastRequest->m_distance,
+                    castResult, hitFlags, queryData, &queryFilterCallback);
 
                 if (status)
                 {
@@ -426,12 +434,7 @@ namespace PhysX
                 SceneQueryHelpers::GetFilterCallbackFromOverlap(overlapRequest->m_filterCallback),
                 physx::PxQueryHitType::eTOUCH);
 
-            bool status = false;
-            {
-                PHYSX_SCENE_READ_LOCK(*physxScene);
-                status = physxScene->overlap(pxGeometry.any(), pose, overlapCallback, filterData, &filterCallback);
-            }
-            return status;
+            return physxScene->overlap(pxGeometry.any(), pose, overlapCallback, filterData, &filterCallback);
         }
 
         bool OverlapQuery(const AzPhysics::OverlapRequest* overlapRequest,
@@ -474,6 +477,31 @@ namespace PhysX
 
             return status;
         }
+
+        //! Copies a scene query request so that it can outlive the caller's request, as needed by the async queries.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CopySceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            switch (request->m_requestType)
+            {
+            case AzPhysics::SceneQueryRequest::RequestType::Raycast:
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*static_cast<const AzPhysics::RayCastRequest*>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*static_cast<const AzPhysics::ShapeCastRequest*>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Overlap:
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*static_cast<const AzPhysics::OverlapRequest*>(request));
+            default:
+                return nullptr;
+            }
+        }
+
+        //! The data shared by the tasks of an async query batch. It is kept alive until the callback has been invoked.
+        struct AsyncSceneQueryBatch
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId = 0;
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQueryHitsList m_results;
+            AzPhysics::SceneQuery::AsyncBatchCallback m_callback;
+        };
     }
 
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
@@ -514,6 +542,9 @@ namespace PhysX
 
     PhysXScene::~PhysXScene()
     {
+        // Async queries reference the scene, so they need to finish first.
+        WaitForAsyncQueries();
+
         m_physicsSystemConfigChanged.Disconnect();
 
         s_overlapBuffer = {};
@@ -982,6 +1013,17 @@ namespace PhysX
             return false; // return 0 hits
         }
 
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+        return QuerySceneLocked(request, result);
+    }
+
+    bool PhysXScene::QuerySceneLocked(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result)
+    {
+        if (request == nullptr)
+        {
+            return false; // return 0 hits
+        }
+
         // Query flags.
         const physx::PxQueryFlags queryFlags = SceneQueryHelpers::GetPxQueryFlags(request->m_queryType);
         const physx::PxQueryFilterData queryData(queryFlags);
@@ -1014,27 +1056,127 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        // Waiting on a task graph from inside a task isn't supported, so batches issued from a task worker run on the calling thread.
+        if (!physx_parallelSceneQueryBatch || requests.size() <= physx_sceneQueryBatchTaskSize ||
+            AZ::TaskExecutor::Instance().GetCurrentWorkerIndex() >= 0)
         {
-            results.emplace_back(QueryScene(request.get()));
+            QuerySceneRange(requests, results, 0, requests.size());
+            return results;
         }
+
+        AZ::TaskGraph taskGraph("SceneQueryBatch");
+        AZ::TaskGraphEvent finishEvent("SceneQueryBatch event");
+        AddSceneQueryTasks(taskGraph, requests, results, nullptr);
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        // The request is only guaranteed to be valid during this call, so the query runs on a copy.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CopySceneQueryRequest(request);
+        if (!requestCopy)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        AzPhysics::SceneQueryRequests requests;
+        requests.emplace_back(AZStd::move(requestCopy));
+        return QuerySceneAsyncBatch(requestId, requests,
+            [callback = AZStd::move(callback)](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHitsList hits)
+            {
+                callback(id, AZStd::move(hits.front()));
+            });
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        auto batch = AZStd::make_shared<Internal::AsyncSceneQueryBatch>();
+        batch->m_requestId = requestId;
+        batch->m_requests = requests;
+        batch->m_results.resize(requests.size());
+        batch->m_callback = AZStd::move(callback);
+
+        m_pendingAsyncQueries++;
+
+        AZ::TaskGraph taskGraph("SceneQueryAsyncBatch");
+        AZ::TaskToken completionTask = taskGraph.AddTask(
+            AZ::TaskDescriptor{ "SceneQueryAsyncBatchComplete", "Physics" },
+            [batch, this]()
+            {
+                batch->m_callback(batch->m_requestId, AZStd::move(batch->m_results));
+                m_pendingAsyncQueries--;
+            });
+        AddSceneQueryTasks(taskGraph, batch->m_requests, batch->m_results, &completionTask);
+
+        // Nothing waits on the graph, so let it free itself when the tasks are done.
+        taskGraph.Detach();
+        taskGraph.Submit();
+
+        return true;
+    }
+
+    void PhysXScene::QuerySceneRange(
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, size_t begin, size_t end)
+    {
+        // Lock the scene for read once for the whole range instead of once per query.
+        // The hit buffers are thread local, so every task thread uses its own buffers.
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+        for (size_t index = begin; index < end; ++index)
+        {
+            QuerySceneLocked(requests[index].get(), results[index]);
+        }
+    }
+
+    void PhysXScene::AddSceneQueryTasks(
+        AZ::TaskGraph& taskGraph,
+        const AzPhysics::SceneQueryRequests& requests,
+        AzPhysics::SceneQueryHitsList& results,
+        AZ::TaskToken* completionTask)
+    {
+        const size_t taskSize = AZStd::max<size_t>(physx_sceneQueryBatchTaskSize, 1);
+        for (size_t begin = 0; begin < requests.size(); begin += taskSize)
+        {
+            AZ::TaskToken queryTask = taskGraph.AddTask(
+                AZ::TaskDescriptor{ "SceneQueryBatchTask", "Physics" },
+                [begin, end = AZStd::min(begin + taskSize, requests.size()), &requests, &results, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "SceneQueryBatch Task");
+                    QuerySceneRange(requests, results, begin, end);
+                });
+
+            if (completionTask)
+            {
+                queryTask.Precedes(*completionTask);
+            }
+        }
+    }
+
+    void PhysXScene::WaitForAsyncQueries()
+    {
+        while (m_pendingAsyncQueries > 0)
+        {
+            AZStd::this_thread::yield();
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1156,6 +1298,12 @@ namespace PhysX
 
     void PhysXScene::ClearDeferedDeletions()
     {
+        // Hits from async queries that are still running could point at the bodies being deleted.
+        if (!m_deferredDeletions.empty())
+        {
+            WaitForAsyncQueries();
+        }
+
         // swap the deletions in case the simulated body
         // manages more bodies and removes them on destruction (ie. Ragdoll).
         AZStd::vector<AzPhysics::SimulatedBody*> deletions;
@@ -1324,9 +1472,21 @@ namespace PhysX
             {
                 if (AzPhysics::SimulatedBody* simBody = sceneInterface->GetSimulatedBodyFromHandle(m_sceneHandle, bodyHandle))
                 {
-                    simBody->SyncTransform(m_currentDeltaTime);
+                    if (physx_bulkTransformSync)
+                    {
+                        AddToBulkTransformSync(simBody);
+                    }
+                    else
+                    {
+                        simBody->SyncTransform(m_currentDeltaTime);
+                    }
                 }
             }
+
+            if (physx_bulkTransformSync)
+            {
+                BulkSyncTransforms(m_currentDeltaTime, false);
+            }
         }
     }
 
@@ -1342,7 +1502,18 @@ namespace PhysX
             }
         };
 
-        if (physx_parallelTransformSync)
+        if (physx_bulkTransformSync)
+        {
+            for (AzPhysics::SimulatedBodyIndex bodyIndex : m_queuedActiveBodyIndices.GetPackedIndices())
+            {
+                if (bodyIndex < m_simulatedBodies.size() && m_simulatedBodies[bodyIndex].second)
+                {
+                    AddToBulkTransformSync(m_simulatedBodies[bodyIndex].second);
+                }
+            }
+            BulkSyncTransforms(m_accumulatedDeltaTime, physx_parallelTransformSync);
+        }
+        else if (physx_parallelTransformSync)
         {
             m_queuedActiveBodyIndices.ApplyParallel(transformSync, m_pxScene);
         }
@@ -1355,6 +1526,150 @@ namespace PhysX
         m_accumulatedDeltaTime = 0.0f;
     }
 
+    void PhysXScene::RegisterBulkTransformUpdateHandler(OnBulkTransformUpdateEvent::Handler& handler)
+    {
+        handler.Connect(m_bulkTransformUpdateEvent);
+    }
+
+    void PhysXScene::AddToBulkTransformSync(AzPhysics::SimulatedBody* body)
+    {
+        if (body->GetNativeType() == NativeTypeIdentifiers::RigidBody && body->GetNativePointer())
+        {
+            m_bulkTransformSyncBuffer.m_rigidBodies.emplace_back(static_cast<RigidBody*>(body));
+        }
+        else
+        {
+            m_bulkTransformSyncBuffer.m_otherBodies.emplace_back(body);
+        }
+    }
+
+    void PhysXScene::BulkSyncTransforms(float deltaTime, bool parallelApply)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::BulkSyncTransforms");
+
+        BulkTransformSyncBuffer& buffer = m_bulkTransformSyncBuffer;
+        for (AzPhysics::SimulatedBody* body : buffer.m_otherBodies)
+        {
+            body->SyncTransform(deltaTime);
+        }
+
+        const size_t rigidBodyCount = buffer.m_rigidBodies.size();
+
+        // Move the bodies that have their entity transform written directly to the front, so their poses are contiguous for the
+        // bulk transform update event. Kinematic bodies keep going through the sync transform event, since whether their transform
+        // needs updating depends on how they were last moved.
+        size_t bulkUpdateCount = 0;
+        if (physx_bulkTransformUpdate)
+        {
+            for (size_t i = 0; i < rigidBodyCount; ++i)
+            {
+                RigidBody* rigidBody = buffer.m_rigidBodies[i];
+                if (rigidBody->GetBulkTransformTarget() != nullptr && !rigidBody->IsKinematic())
+                {
+                    AZStd::swap(buffer.m_rigidBodies[i], buffer.m_rigidBodies[bulkUpdateCount]);
+                    buffer.m_bulkUpdatedEntityIds.push_back(rigidBody->GetEntityId());
+                    ++bulkUpdateCount;
+                }
+            }
+        }
+
+        buffer.m_positions.resize(rigidBodyCount);
+        buffer.m_orientations.resize(rigidBodyCount);
+
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXScene::BulkSyncTransforms::ReadPoses");
+
+            // Reading the poses doesn't call out to any handlers, so it's always safe to spread across tasks.
+            RunTransformSyncRanges(rigidBodyCount, physx_parallelTransformSync,
+                [&buffer, pxScene = m_pxScene](size_t begin, size_t end)
+                {
+                    PHYSX_SCENE_READ_LOCK(pxScene);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        const physx::PxTransform pose =
+                            static_cast<physx::PxRigidActor*>(buffer.m_rigidBodies[i]->GetNativePointer())->getGlobalPose();
+                        // PxVec3 and PxQuat (x, y, z, w) are tightly packed floats, so they load straight into SIMD registers.
+                        buffer.m_positions[i] = AZ::Vector3::CreateFromFloat3(&pose.p.x);
+                        buffer.m_orientations[i] = AZ::Quaternion::CreateFromFloat4(&pose.q.x);
+                    }
+                });
+        }
+
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXScene::BulkSyncTransforms::SignalSyncTransform");
+
+            RunTransformSyncRanges(rigidBodyCount, parallelApply,
+                [&buffer, bulkUpdateCount, deltaTime](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        RigidBody* rigidBody = buffer.m_rigidBodies[i];
+                        if (i < bulkUpdateCount)
+                        {
+                            AZ::TransformInterface* entityTransform = rigidBody->GetBulkTransformTarget();
+                            AZ::Transform newWorldTransform = entityTransform->GetWorldTM();
+                            newWorldTransform.SetRotation(buffer.m_orientations[i]);
+                            newWorldTransform.SetTranslation(buffer.m_positions[i]);
+                            entityTransform->SetWorldTM(newWorldTransform);
+                        }
+                        else
+                        {
+                            rigidBody->SetSyncedPose(&buffer.m_positions[i], &buffer.m_orientations[i]);
+                            rigidBody->SyncTransform(deltaTime);
+                            rigidBody->SetSyncedPose(nullptr, nullptr);
+                        }
+                    }
+                });
+        }
+
+        if (bulkUpdateCount > 0)
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXScene::BulkSyncTransforms::SignalBulkTransformUpdate");
+
+            BulkTransformUpdate bulkTransformUpdate;
+            bulkTransformUpdate.m_entityIds = buffer.m_bulkUpdatedEntityIds;
+            bulkTransformUpdate.m_positions = AZStd::span<const AZ::Vector3>(buffer.m_positions.data(), bulkUpdateCount);
+            bulkTransformUpdate.m_orientations = AZStd::span<const AZ::Quaternion>(buffer.m_orientations.data(), bulkUpdateCount);
+            m_bulkTransformUpdateEvent.Signal(m_sceneHandle, bulkTransformUpdate);
+        }
+
+        buffer.m_rigidBodies.clear();
+        buffer.m_bulkUpdatedEntityIds.clear();
+        buffer.m_positions.clear();
+        buffer.m_orientations.clear();
+        buffer.m_otherBodies.clear();
+    }
+
+    void PhysXScene::RunTransformSyncRanges(size_t count, bool parallel, const AZStd::function<void(size_t, size_t)>& syncRange)
+    {
+        const size_t batchSize = AZStd::max<size_t>(physx_parallelTransformSyncBatchSize, 1);
+        if (!parallel || count <= batchSize)
+        {
+            syncRange(0, count);
+            return;
+        }
+
+        AZ::TaskGraph taskGraph("Bulk Transform Sync");
+        AZ::TaskGraphEvent finishEvent("Bulk transform sync event");
+        static const AZ::TaskDescriptor taskDescriptor{ "BulkSyncTask", "Physics" };
+        for (size_t i = 0; i < count; i += batchSize)
+        {
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, count), &syncRange, pxScene = m_pxScene]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Bulk Sync Task");
+
+                    // Keep the scene locked for read for the entire task, see QueuedActiveBodyIndices::ApplyParallel.
+                    PHYSX_SCENE_READ_LOCK(pxScene);
+                    syncRange(start, end);
+                });
+        }
+
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+    }
+
     void PhysXScene::QueuedActiveBodyIndices::Insert(AzPhysics::SimulatedBodyIndex bodyIndex)
     {
         if (m_uniqueIndices.insert(bodyIndex).second)
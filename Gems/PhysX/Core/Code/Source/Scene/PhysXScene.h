@@ -12,10 +12,18 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
+namespace AZ
+{
+    class TaskGraph;
+    class TaskToken;
+}
+
 namespace physx
 {
     class PxControllerManager;
@@ -27,6 +35,8 @@ namespace physx
 
 namespace PhysX
 {
+    class RigidBody;
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene final
         : public AzPhysics::Scene
@@ -60,7 +70,9 @@ namespace PhysX
         AzPhysics::SceneQueryHits QueryScene(const AzPhysics::SceneQueryRequest* request) override;
         bool QueryScene(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result) override;
 
+        //! Large batches are split into tasks that run in parallel. See physx_parallelSceneQueryBatch.
         AzPhysics::SceneQueryHitsList QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests) override;
+        //! The async queries run on the task system, and the callback is invoked from the task thread that finishes the last query.
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -84,6 +96,21 @@ namespace PhysX
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
+
+        //! Entity transforms written by one bulk transform update, see RigidBody::SetBulkTransformTarget.
+        //! The spans are only valid while the event is being signaled.
+        struct BulkTransformUpdate
+        {
+            AZStd::span<const AZ::EntityId> m_entityIds;
+            AZStd::span<const AZ::Vector3> m_positions;
+            AZStd::span<const AZ::Quaternion> m_orientations;
+        };
+        using OnBulkTransformUpdateEvent = AZ::Event<AzPhysics::SceneHandle, const BulkTransformUpdate&>;
+
+        //! Registers a handler that is signaled once per bulk transform sync with every entity transform it updated directly,
+        //! for listeners that would rather process the moved entities as one batch than handle them one OnTransformChanged at a time.
+        //! The event is signaled on the simulating thread after all the entity transforms have been written.
+        void RegisterBulkTransformUpdateHandler(OnBulkTransformUpdateEvent::Handler& handler);
         
     private:
 
@@ -97,12 +124,29 @@ namespace PhysX
             void Clear();
             void Apply(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction);
             void ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene);
+            const AZStd::vector<AzPhysics::SimulatedBodyIndex>& GetPackedIndices() const { return m_packedIndices; }
 
         private:
             AZStd::unordered_set<AzPhysics::SimulatedBodyIndex> m_uniqueIndices;
             AZStd::vector<AzPhysics::SimulatedBodyIndex> m_packedIndices;
         };
 
+        //! Runs a single request, the caller must already hold the scene read lock.
+        bool QuerySceneLocked(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result);
+        //! Runs the requests in the range [begin, end) on the calling thread, storing the hits in the matching entries of results.
+        //! The scene is locked for read once for the whole range.
+        void QuerySceneRange(
+            const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, size_t begin, size_t end);
+        //! Adds tasks to the graph that run the requests in groups of physx_sceneQueryBatchTaskSize.
+        //! If a completion task is given, it will run after all of the query tasks.
+        void AddSceneQueryTasks(
+            AZ::TaskGraph& taskGraph,
+            const AzPhysics::SceneQueryRequests& requests,
+            AzPhysics::SceneQueryHitsList& results,
+            AZ::TaskToken* completionTask);
+        //! Blocks until every async scene query on this scene has invoked its callback.
+        void WaitForAsyncQueries();
+
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
 
@@ -115,6 +159,29 @@ namespace PhysX
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
+        //! Bodies waiting for the bulk transform sync. The poses of the PhysX rigid bodies are stored in separate contiguous
+        //! arrays, so they can all be read from PhysX in one tight pass before any sync handler runs.
+        struct BulkTransformSyncBuffer
+        {
+            AZStd::vector<RigidBody*> m_rigidBodies;
+            //! Entities of the first m_rigidBodies that have their transform written directly, see RigidBody::SetBulkTransformTarget.
+            AZStd::vector<AZ::EntityId> m_bulkUpdatedEntityIds;
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Quaternion> m_orientations;
+            //! Bodies which aren't PhysX rigid bodies, such as articulation links. These are signaled without a synced pose.
+            AZStd::vector<AzPhysics::SimulatedBody*> m_otherBodies;
+        };
+
+        void AddToBulkTransformSync(AzPhysics::SimulatedBody* body);
+        //! Reads the poses of all the rigid bodies added with AddToBulkTransformSync. Bodies with a bulk transform target get
+        //! the pose written to it directly and are reported in a single OnBulkTransformUpdateEvent, the others have their sync
+        //! transform events signaled with the poses available through RigidBody::GetSyncedPose. Clears the buffer afterwards.
+        //! If parallelApply is true the events are signaled from task threads, like QueuedActiveBodyIndices::ApplyParallel does.
+        void BulkSyncTransforms(float deltaTime, bool parallelApply);
+        //! Calls syncRange for [0, count) in tasks of physx_parallelTransformSyncBatchSize, each holding the scene read lock,
+        //! or for the whole range on the calling thread without locking if parallel is false.
+        void RunTransformSyncRanges(size_t count, bool parallel, const AZStd::function<void(size_t, size_t)>& syncRange);
+
         bool m_isEnabled = true;
 
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
@@ -122,6 +189,10 @@ namespace PhysX
         // we send the transform sync event once.
         QueuedActiveBodyIndices m_queuedActiveBodyIndices;
 
+        // Reused between syncs to avoid reallocating.
+        BulkTransformSyncBuffer m_bulkTransformSyncBuffer;
+        OnBulkTransformUpdateEvent m_bulkTransformUpdateEvent;
+
         // Accumulated delta time over multiple simulation sub-steps.
         // When we run the batched transform sync, the accumulated simulation time is provided
         // to tell how much time was simulated in this full pass.
@@ -149,6 +220,7 @@ namespace PhysX
         AZ::u32 m_raycastBufferSize = 32; //!< Maximum number of hits that will be returned from a raycast.
         AZ::u32 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u32 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
+        AZStd::atomic<AZ::u32> m_pendingAsyncQueries{ 0 }; //!< Number of async scene query batches that haven't invoked their callback yet.
 
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
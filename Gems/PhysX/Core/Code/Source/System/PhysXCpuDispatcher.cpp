@@ -9,22 +9,87 @@
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
 namespace PhysX
 {
+    AZ_CVAR(bool, physx_cpuDispatcherUseTaskExecutor, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run tasks submitted by the PhysX simulation on an AZ::TaskExecutor at elevated priority instead of as AZ::JobManager jobs.");
+
+    AZ_CVAR(AZ::u32, physx_cpuDispatcherWorkerCount, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of worker threads in an AZ::TaskExecutor dedicated to PhysX tasks. "
+        "0 shares the global AZ::TaskExecutor. Only read when the PhysX system is initialized.");
+
+    namespace Internal
+    {
+        // PhysX tasks are on the critical path of the simulation step, which the game thread blocks on.
+        // Run them ahead of the default (medium) priority work other systems put on the same executor.
+        static const AZ::TaskDescriptor PhysXTaskDescriptor{ "PhysX Task", "Physics", AZ::TaskPriority::HIGH };
+    } // namespace Internal
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
         return aznew PhysXCpuDispatcher();
     }
 
+    PhysXCpuDispatcher::PhysXCpuDispatcher()
+    {
+        if (const AZ::u32 workerCount = physx_cpuDispatcherWorkerCount; workerCount > 0)
+        {
+            m_dedicatedTaskExecutor = AZStd::make_unique<AZ::TaskExecutor>(workerCount);
+        }
+    }
+
+    PhysXCpuDispatcher::~PhysXCpuDispatcher() = default;
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        if (physx_cpuDispatcherUseTaskExecutor)
+        {
+            SubmitToTaskExecutor(task);
+        }
+        else
+        {
+            SubmitToJobManager(task);
+        }
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
+        if (physx_cpuDispatcherUseTaskExecutor)
+        {
+            return GetTaskExecutor().GetThreadCount();
+        }
         return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
     }
-} // namespace PhysX
 
+    void PhysXCpuDispatcher::SubmitToJobManager(physx::PxBaseTask& task)
+    {
+        auto azJob = aznew PhysXJob(task);
+        azJob->Start();
+    }
+
+    void PhysXCpuDispatcher::SubmitToTaskExecutor(physx::PxBaseTask& task)
+    {
+        AZ::TaskGraph taskGraph{ "PhysX Task" };
+        taskGraph.AddTask(
+            Internal::PhysXTaskDescriptor,
+            [&task]()
+            {
+                AZ_PROFILE_SCOPE(Physics, task.getName());
+                task.run();
+                task.release();
+            });
+        // The graph cleans itself up once the task has run, PhysX tracks completion through the task's continuation.
+        taskGraph.Detach();
+        taskGraph.SubmitOnExecutor(GetTaskExecutor());
+    }
+
+    AZ::TaskExecutor& PhysXCpuDispatcher::GetTaskExecutor() const
+    {
+        return m_dedicatedTaskExecutor ? *m_dedicatedTaskExecutor : AZ::TaskExecutor::Instance();
+    }
+} // namespace PhysX
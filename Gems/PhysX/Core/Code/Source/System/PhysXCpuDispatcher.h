@@ -7,25 +7,42 @@
  */
 
 #pragma once
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <PxPhysicsAPI.h>
 #include <System/PhysXAllocator.h>
 
+namespace AZ
+{
+    class TaskExecutor;
+}
+
 namespace PhysX
 {
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! Tasks are either started as jobs on the global AZ::JobManager, or run at elevated priority on an AZ::TaskExecutor,
+    //! depending on physx_cpuDispatcherUseTaskExecutor. The executor is either the shared AZ::TaskExecutor instance or
+    //! one dedicated to PhysX, depending on physx_cpuDispatcherWorkerCount when the dispatcher is created.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator);
 
-        PhysXCpuDispatcher() = default;
-        ~PhysXCpuDispatcher() = default;
+        PhysXCpuDispatcher();
+        ~PhysXCpuDispatcher();
         
     private:
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        void SubmitToJobManager(physx::PxBaseTask& task);
+        void SubmitToTaskExecutor(physx::PxBaseTask& task);
+
+        //! Returns the dedicated executor if one was created, otherwise the shared executor.
+        AZ::TaskExecutor& GetTaskExecutor() const;
+
+        AZStd::unique_ptr<AZ::TaskExecutor> m_dedicatedTaskExecutor; // Only created when physx_cpuDispatcherWorkerCount > 0.
     };
 
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
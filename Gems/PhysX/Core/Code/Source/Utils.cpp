@@ -278,20 +278,30 @@ namespace PhysX
         {
             AZ_PROFILE_FUNCTION(Physics);
 
-            auto* pxScene = static_cast<physx::PxScene*>(physicsScene->GetNativePointer());
-            AZ_Assert(pxScene, "Attempting to reference a null physics scene");
+            ModifyHeightfieldSamples(heightfield, startCol, startRow, numColsToUpdate, numRowsToUpdate);
+            RefreshHeightfieldShapeGeometry(physicsScene, heightfieldShape, heightfield);
+        }
 
-            auto* pxShape = static_cast<physx::PxShape*>(heightfieldShape->GetNativePointer());
-            AZ_Assert(pxShape, "Attempting to refresh a null heightfield shape");
+        void ModifyHeightfieldSamples(
+            Physics::HeightfieldShapeConfiguration& heightfield,
+            const size_t startCol, const size_t startRow,
+            const size_t numColsToUpdate, const size_t numRowsToUpdate)
+        {
+            AZ_PROFILE_FUNCTION(Physics);
 
             physx::PxHeightField* pxHeightfield = static_cast<physx::PxHeightField*>(heightfield.GetCachedNativeHeightfield());
-            AZ_Assert(pxHeightfield, "Attempting to refresh a null heightfield");
+            AZ_Assert(pxHeightfield, "Attempting to modify a null heightfield");
 
             // Convert the generic heightfield samples in the heigthfield shape to PhysX heightfield samples.
             // This can be done outside the scene lock because we aren't modifying anything yet.
             AZStd::vector<physx::PxHeightFieldSample> physxSamples =
                 ConvertHeightfieldSamples(heightfield, startCol, startRow, numColsToUpdate, numRowsToUpdate);
 
+            if (physxSamples.empty())
+            {
+                return;
+            }
+
             // Create a descriptor for the subregion that we're updating.
             physx::PxHeightFieldDesc desc;
             desc.format = physx::PxHeightFieldFormat::eS16_TM;
@@ -303,17 +313,32 @@ namespace PhysX
             // Modify the heightfield samples
             constexpr bool shrinkBounds = false;
             pxHeightfield->modifySamples(static_cast<physx::PxI32>(startCol), static_cast<physx::PxI32>(startRow), desc, shrinkBounds);
+        }
+
+        void RefreshHeightfieldShapeGeometry(
+            AzPhysics::Scene* physicsScene,
+            Physics::Shape* heightfieldShape,
+            Physics::HeightfieldShapeConfiguration& heightfield)
+        {
+            AZ_PROFILE_FUNCTION(Physics);
+
+            auto* pxScene = static_cast<physx::PxScene*>(physicsScene->GetNativePointer());
+            AZ_Assert(pxScene, "Attempting to reference a null physics scene");
+
+            auto* pxShape = static_cast<physx::PxShape*>(heightfieldShape->GetNativePointer());
+            AZ_Assert(pxShape, "Attempting to refresh a null heightfield shape");
+
+            physx::PxHeightField* pxHeightfield = static_cast<physx::PxHeightField*>(heightfield.GetCachedNativeHeightfield());
+            AZ_Assert(pxHeightfield, "Attempting to refresh a null heightfield");
 
             // Lock the scene and modify the heightfield shape in the scene.
             // (If only the heightfield is modified, the shape won't get refreshed with the new data)
-            {
-                PHYSX_SCENE_WRITE_LOCK(pxScene);
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
 
-                physx::PxHeightFieldGeometry hfGeom;
-                pxShape->getHeightFieldGeometry(hfGeom);
-                hfGeom.heightField = pxHeightfield;
-                pxShape->setGeometry(hfGeom);
-            }
+            physx::PxHeightFieldGeometry hfGeom;
+            pxShape->getHeightFieldGeometry(hfGeom);
+            hfGeom.heightField = pxHeightfield;
+            pxShape->setGeometry(hfGeom);
         }
 
         bool CreatePxGeometryFromConfig(const Physics::ShapeConfiguration& shapeConfiguration, physx::PxGeometryHolder& pxGeometry)
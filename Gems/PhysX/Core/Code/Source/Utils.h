@@ -219,6 +219,30 @@ namespace PhysX
             const size_t numColsToUpdate,
             const size_t numRowsToUpdate);
 
+        //! Modify a portion of the PhysX heightfield samples based on the data in the HeightfieldShapeConfiguration.
+        //! This doesn't refresh the shapes that use the heightfield, so RefreshHeightfieldShapeGeometry() needs to be called
+        //! once all the modifications are done. Only one modification should run at a time for a given heightfield.
+        //! @param heightfield The updated shape configuration that contains the new data and the PhysX heightfield to modify.
+        //! @param startCol The starting column of the heightfield to modify
+        //! @param startRow The starting row of the heightfield to modify
+        //! @param numColsToUpdate The number of columns to modify
+        //! @param numRowsToUpdate The number of rows to modify
+        void ModifyHeightfieldSamples(
+            Physics::HeightfieldShapeConfiguration& heightfield,
+            const size_t startCol,
+            const size_t startRow,
+            const size_t numColsToUpdate,
+            const size_t numRowsToUpdate);
+
+        //! Refresh the heightfield shape in the given scene after the samples of its PhysX heightfield have been modified.
+        //! @param physicsScene The scene that the shape is located in. (Needed for write-locking the scene in the thread)
+        //! @param heightfieldShape The shape containing the heightfield in the scene.
+        //! @param heightfield The shape configuration that contains the modified PhysX heightfield.
+        void RefreshHeightfieldShapeGeometry(
+            AzPhysics::Scene* physicsScene,
+            Physics::Shape* heightfieldShape,
+            Physics::HeightfieldShapeConfiguration& heightfield);
+
         //! Sets an array of material slots from Physics Asset.
         //! If the configuration indicates that it should use the physics materials
         //! assignment from the physics asset it will also use those materials for the slots.
@@ -9,6 +9,12 @@
 #ifdef HAVE_BENCHMARK
 #include <benchmark/benchmark.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
@@ -19,6 +25,14 @@
 
 #include <PhysXTestCommon.h>
 #include <PhysXTestUtil.h>
+#include <Scene/PhysXScene.h>
+
+namespace PhysX
+{
+    AZ_CVAR_EXTERNED(bool, physx_cpuDispatcherUseTaskExecutor);
+    AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_bulkTransformSync);
+}
 
 namespace PhysX::Benchmarks
 {
@@ -88,6 +102,46 @@ namespace PhysX::Benchmarks
             //! Number of iterations for each test
             static const int NumIterations = 10;
         } // namespace ActivationBenchmarkSettings
+
+        //! Settings used to setup the concurrent load benchmark
+        namespace ConcurrentLoadBenchmarkSettings
+        {
+            //! Values passed to benchmark to select the number of rigid bodies to spawn during each test
+            //! Current values will run tests between StartRange to EndRange (inclusive), multiplying by RangeMultiplier each step.
+            static const int StartRange = 512;
+            static const int EndRange = 4096;
+            static const int RangeMultipler = 2;
+
+            //! Values passed to benchmark to select which backend the PhysX CPU dispatcher uses
+            static const int JobManagerDispatcher = 0;
+            static const int TaskExecutorDispatcher = 1;
+
+            //! Number of background work items queued before each physics tick, split between the job manager and the task executor
+            static const int LoadItemsPerTick = 64;
+
+            //! How long each background work item keeps its worker thread busy
+            static const double LoadItemMilliseconds = 0.25;
+
+            //! Number of iterations for each test
+            static const int NumIterations = 3;
+        } // namespace ConcurrentLoadBenchmarkSettings
+
+        //! Settings used to setup the transform sync benchmark
+        namespace TransformSyncBenchmarkSettings
+        {
+            //! Number of rigid body entities to spawn
+            static const int NumRigidBodies = 10000;
+
+            //! Number of game frames to simulate. The rigid bodies are still falling and active for all of them.
+            static const int GameFramesToSimulate = 300;
+
+            //! Values passed to benchmark to select how the transforms are synced
+            static const int PerBodyTransformSync = 0;
+            static const int BulkTransformSync = 1;
+
+            //! Number of iterations for each test
+            static const int NumIterations = 3;
+        } // namespace TransformSyncBenchmarkSettings
     } // namespace RigidBodyConstants
 
     namespace Utils
@@ -197,6 +251,53 @@ namespace PhysX::Benchmarks
 
             Physics::RigidBodyRequests* m_physicsRigidBodyComponent = nullptr;
         };
+
+        //! Queues busy work on both the job manager and the task executor, to simulate other systems
+        //! competing with the physics simulation for worker threads.
+        class ConcurrentLoad
+        {
+        public:
+            void Queue(int itemCount, double itemMilliseconds)
+            {
+                m_pendingItems += itemCount;
+
+                const int taskCount = itemCount / 2;
+                AZ::TaskGraph taskGraph{ "Benchmark Concurrent Load" };
+                static const AZ::TaskDescriptor loadTaskDescriptor{ "Benchmark Concurrent Load", "Benchmark" };
+                for (int i = 0; i < taskCount; i++)
+                {
+                    taskGraph.AddTask(loadTaskDescriptor, [this, itemMilliseconds]() { RunItem(itemMilliseconds); });
+                }
+                taskGraph.Detach();
+                taskGraph.Submit();
+
+                for (int i = taskCount; i < itemCount; i++)
+                {
+                    AZ::CreateJobFunction([this, itemMilliseconds]() { RunItem(itemMilliseconds); }, true)->Start();
+                }
+            }
+
+            //! Blocks until all of the queued work has finished.
+            void Wait()
+            {
+                while (m_pendingItems > 0)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+
+        private:
+            void RunItem(double itemMilliseconds)
+            {
+                const auto start = AZStd::chrono::steady_clock::now();
+                while (Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start).count() < itemMilliseconds)
+                {
+                }
+                --m_pendingItems;
+            }
+
+            AZStd::atomic<int> m_pendingItems = 0;
+        };
     } // namespace Utils
 
     //! Rigid body performance fixture.
@@ -457,6 +558,179 @@ namespace PhysX::Benchmarks
         SetLabel(state, bodyType);
     }
 
+    //! BM_RigidBody_MovingAndColliding_ConcurrentLoad - Same setup as BM_RigidBody_MovingAndColliding, but before every tick
+    //! background work is queued on the job manager and the task executor, so the simulation has to compete for worker threads.
+    //! The second argument selects whether the PhysX CPU dispatcher runs its tasks on the job manager or the task executor.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MovingAndColliding_ConcurrentLoad)(benchmark::State& state)
+    {
+        AZ::SimpleLcgRandom rand;
+        rand.SetSeed(RigidBodyConstants::RandGenSeed);
+
+        const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
+        WashingMachine washingMachine;
+        washingMachine.SetupWashingMachine(
+            m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
+            washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
+
+        const int numRigidBodies = aznumeric_cast<int>(state.range(0));
+        const bool useTaskExecutor = state.range(1) == RigidBodyConstants::ConcurrentLoadBenchmarkSettings::TaskExecutorDispatcher;
+
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+            const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
+            const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
+            return AZ::Vector3(x, y, z);
+        };
+        Utils::GenerateSpawnOrientationFuncPtr oriGenerator = [&rand]([[maybe_unused]] int idx) -> AZ::Quaternion {
+            return AZ::CreateRandomQuaternion(rand);
+        };
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+        {
+            return boxShapeConfiguration;
+        };
+        Utils::BenchmarkRigidBodies rigidBodies = Utils::CreateRigidBodies(
+            numRigidBodies,
+            GetDefaultSceneHandle(),
+            RigidBodyConstants::CCDEnabled, RigidBodyApiObject, &colliderGenerator, &posGenerator, &oriGenerator);
+
+        // the dispatcher checks the cvar for every task, so it can be switched without recreating the scene
+        const bool previousUseTaskExecutor = physx_cpuDispatcherUseTaskExecutor;
+        physx_cpuDispatcherUseTaskExecutor = useTaskExecutor;
+
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        Utils::ConcurrentLoad concurrentLoad;
+        AZStd::vector<double> tickTimes;
+        tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
+            {
+                concurrentLoad.Queue(
+                    RigidBodyConstants::ConcurrentLoadBenchmarkSettings::LoadItemsPerTick,
+                    RigidBodyConstants::ConcurrentLoadBenchmarkSettings::LoadItemMilliseconds);
+
+                auto start = AZStd::chrono::steady_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+
+                // don't let the load build up across ticks
+                concurrentLoad.Wait();
+            }
+        }
+        subTickTracker.Stop();
+
+        physx_cpuDispatcherUseTaskExecutor = previousUseTaskExecutor;
+
+        //object clean up
+        washingMachine.TearDownWashingMachine();
+
+        if (auto handlesList = AZStd::get_if<AzPhysics::SimulatedBodyHandleList>(&rigidBodies))
+        {
+            m_defaultScene->RemoveSimulatedBodies(*handlesList);
+        }
+
+        AZStd::visit(
+            [](auto& rigidBodies)
+            {
+                rigidBodies.clear();
+            },
+            rigidBodies);
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+
+        state.SetLabel(useTaskExecutor ? "TaskExecutorDispatcher" : "JobManagerDispatcher");
+    }
+
+    //! BM_RigidBody_TransformSync - This test will spawn 10k rigid body entities above the washing machine and measure how long
+    //! it takes to sync their transforms back to the entities after each tick, with and without the bulk transform sync.
+    //! The Frame counters report the simulation step, the P50 / P90 / P99 / Mean / StDev counters report the transform sync.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformSync)(benchmark::State& state)
+    {
+        AZ::SimpleLcgRandom rand;
+        rand.SetSeed(RigidBodyConstants::RandGenSeed);
+
+        const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
+        WashingMachine washingMachine;
+        washingMachine.SetupWashingMachine(
+            m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
+            washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
+
+        const int numRigidBodies = aznumeric_cast<int>(state.range(0));
+        const bool useBulkSync = state.range(1) == RigidBodyConstants::TransformSyncBenchmarkSettings::BulkTransformSync;
+
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+            const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
+            const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
+            return AZ::Vector3(x, y, z);
+        };
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+        {
+            return boxShapeConfiguration;
+        };
+        Utils::BenchmarkRigidBodies rigidBodies = Utils::CreateRigidBodies(
+            numRigidBodies, GetDefaultSceneHandle(), RigidBodyConstants::CCDEnabled, RigidBodyEntity, &colliderGenerator, &posGenerator);
+
+        // batch the transform sync so it runs separately from the simulation step and can be timed on its own
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        const bool previousBulkTransformSync = physx_bulkTransformSync;
+        physx_batchTransformSync = true;
+        physx_bulkTransformSync = useBulkSync;
+
+        auto* physXScene = static_cast<PhysX::PhysXScene*>(m_defaultScene);
+
+        Types::TimeList tickTimes;
+        Types::TimeList syncTimes;
+        tickTimes.reserve(RigidBodyConstants::TransformSyncBenchmarkSettings::GameFramesToSimulate);
+        syncTimes.reserve(RigidBodyConstants::TransformSyncBenchmarkSettings::GameFramesToSimulate);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::TransformSyncBenchmarkSettings::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                m_defaultScene->StartSimulation(DefaultTimeStep);
+                m_defaultScene->FinishSimulation();
+                auto syncStart = AZStd::chrono::steady_clock::now();
+                physXScene->FlushTransformSync();
+                auto end = AZStd::chrono::steady_clock::now();
+
+                tickTimes.emplace_back(Types::double_milliseconds(syncStart - start).count());
+                syncTimes.emplace_back(Types::double_milliseconds(end - syncStart).count());
+            }
+        }
+
+        physx_batchTransformSync = previousBatchTransformSync;
+        physx_bulkTransformSync = previousBulkTransformSync;
+
+        //object clean up
+        washingMachine.TearDownWashingMachine();
+
+        AZStd::visit(
+            [](auto& rigidBodies)
+            {
+                rigidBodies.clear();
+            },
+            rigidBodies);
+
+        Types::TimeList subTickTimes;
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTimes);
+        Utils::ReportPercentiles(state, syncTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, syncTimes);
+
+        state.SetLabel(useBulkSync ? "BulkTransformSync" : "PerBodyTransformSync");
+    }
+
     //! BM_RigidBody_Activation - This test will create the requested number of rigid bodies, including
     //! mock components that depend on the rigid bodies, and measure the time it takes to activate them.
     BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_Activation)(benchmark::State& state)
@@ -768,6 +1042,24 @@ namespace PhysX::Benchmarks
         ->MeasureProcessCPUTime();
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MovingAndColliding_ConcurrentLoad)
+        ->RangeMultiplier(RigidBodyConstants::ConcurrentLoadBenchmarkSettings::RangeMultipler)
+        ->Ranges({ { RigidBodyConstants::ConcurrentLoadBenchmarkSettings::StartRange, RigidBodyConstants::ConcurrentLoadBenchmarkSettings::EndRange },
+                   { RigidBodyConstants::ConcurrentLoadBenchmarkSettings::JobManagerDispatcher,
+                     RigidBodyConstants::ConcurrentLoadBenchmarkSettings::TaskExecutorDispatcher } })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::ConcurrentLoadBenchmarkSettings::NumIterations)
+        ->MeasureProcessCPUTime();
+
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformSync)
+        ->Args({ RigidBodyConstants::TransformSyncBenchmarkSettings::NumRigidBodies,
+                 RigidBodyConstants::TransformSyncBenchmarkSettings::PerBodyTransformSync })
+        ->Args({ RigidBodyConstants::TransformSyncBenchmarkSettings::NumRigidBodies,
+                 RigidBodyConstants::TransformSyncBenchmarkSettings::BulkTransformSync })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::TransformSyncBenchmarkSettings::NumIterations)
+        ->MeasureProcessCPUTime();
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_Activation)
         ->RangeMultiplier(RigidBodyConstants::ActivationBenchmarkSettings::RangeMultipler)
         ->Ranges({ { RigidBodyConstants::ActivationBenchmarkSettings::StartRange, RigidBodyConstants::ActivationBenchmarkSettings::EndRange } })
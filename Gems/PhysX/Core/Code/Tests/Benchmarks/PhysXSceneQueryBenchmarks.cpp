@@ -9,7 +9,10 @@
 #ifdef HAVE_BENCHMARK
 #include <vector>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
@@ -21,6 +24,11 @@
 #include <PhysX/PhysXLocks.h>
 #include <Scene/PhysXScene.h>
 
+namespace PhysX
+{
+    AZ_CVAR_EXTERNED(bool, physx_parallelSceneQueryBatch);
+}
+
 namespace PhysX::Benchmarks
 {
     namespace SceneQueryConstants
@@ -41,6 +49,12 @@ namespace PhysX::Benchmarks
             {{512, 1024}, {32, 512}},
             {{2048, 4096}, {64, 512}}
         };
+
+        // Batched query benchmarks use a fixed scene of 1024 boxes within a radius of 64
+        // and vary the number of requests in the batch.
+        static const int64_t BatchNumBoxes = 1024;
+        static const int64_t BatchMaxRadius = 64;
+        static const std::vector<int64_t> BatchSizes = { 1, 10, 100, 1000, 10000 };
     }
 
     class PhysXSceneQueryBenchmarkFixture
@@ -126,6 +140,22 @@ namespace PhysX::Benchmarks
         }
 
     protected:
+        //! Builds a raycast request towards each box, repeating the boxes if there are more requests than boxes.
+        AzPhysics::SceneQueryRequests BuildRaycastBatch(size_t batchSize) const
+        {
+            AzPhysics::SceneQueryRequests requests;
+            requests.reserve(batchSize);
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+                request->m_start = AZ::Vector3::CreateZero();
+                request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+                request->m_distance = 2000.0f;
+                requests.emplace_back(AZStd::move(request));
+            }
+            return requests;
+        }
+
         std::vector<EntityPtr> m_entities;
         std::vector<AZ::Vector3> m_boxes;
         AZ::u32 m_numBoxes = 0;
@@ -289,6 +319,80 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Runs a batch of raycasts through QuerySceneBatch.
+    //! \state.range(2) - number of requests in the batch
+    //! \state.range(3) - 1 to split the batch into parallel tasks, 0 to run it on the calling thread
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)(benchmark::State& state)
+    {
+        const size_t batchSize = aznumeric_cast<size_t>(state.range(2));
+        const AzPhysics::SceneQueryRequests requests = BuildRaycastBatch(batchSize);
+
+        const bool previousParallelBatch = physx_parallelSceneQueryBatch;
+        physx_parallelSceneQueryBatch = (state.range(3) != 0);
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        physx_parallelSceneQueryBatch = previousParallelBatch;
+
+        state.SetItemsProcessed(state.iterations() * batchSize);
+
+        // get the P50, P90, P99 percentiles of each call and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! Runs a batch of raycasts through QuerySceneAsyncBatch, measuring the time until the callback is invoked.
+    //! \state.range(2) - number of requests in the batch
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatch)(benchmark::State& state)
+    {
+        const size_t batchSize = aznumeric_cast<size_t>(state.range(2));
+        const AzPhysics::SceneQueryRequests requests = BuildRaycastBatch(batchSize);
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AZStd::atomic_bool completed = false;
+            [[maybe_unused]] const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+                [&completed](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+                {
+                    benchmark::DoNotOptimize(results);
+                    completed = true;
+                });
+            AZ_Assert(queued, "Failed to queue the async scene query batch.");
+
+            while (!completed)
+            {
+                AZStd::this_thread::yield();
+            }
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+        }
+
+        state.SetItemsProcessed(state.iterations() * batchSize);
+
+        // get the P50, P90, P99 percentiles of each call and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -322,5 +426,32 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+
+    static void SerialAndParallelBatchArgs(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t batchSize : SceneQueryConstants::BatchSizes)
+        {
+            benchmark->Args({ SceneQueryConstants::BatchNumBoxes, SceneQueryConstants::BatchMaxRadius, batchSize, 0 });
+            benchmark->Args({ SceneQueryConstants::BatchNumBoxes, SceneQueryConstants::BatchMaxRadius, batchSize, 1 });
+        }
+    }
+
+    static void AsyncBatchArgs(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t batchSize : SceneQueryConstants::BatchSizes)
+        {
+            benchmark->Args({ SceneQueryConstants::BatchNumBoxes, SceneQueryConstants::BatchMaxRadius, batchSize });
+        }
+    }
+
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)
+        ->Apply(SerialAndParallelBatchArgs)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatch)
+        ->Apply(AsyncBatchArgs)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
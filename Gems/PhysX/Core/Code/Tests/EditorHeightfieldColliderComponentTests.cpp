@@ -489,5 +489,87 @@ namespace PhysXEditorTests
         }
     }
 
+    TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentHeightfieldColliderPartialUpdateOnlyModifiesDirtyRows)
+    {
+        AZ::EntityId gameEntityId = m_gameEntity->GetId();
+
+        // Only the middle row of the heightfield is dirty, and its new heights are all the same.
+        constexpr size_t dirtyRow = 1;
+        constexpr float dirtyHeight = 2.5f;
+
+        ON_CALL(*m_gameMockShapeRequests, GetHeightfieldIndicesFromRegion)
+            .WillByDefault(
+                []([[maybe_unused]] const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows)
+                {
+                    startColumn = 0;
+                    startRow = dirtyRow;
+                    numColumns = 3;
+                    numRows = 1;
+                });
+
+        ON_CALL(*m_gameMockShapeRequests, UpdateHeightsAndMaterialsAsync)
+            .WillByDefault(
+                [](const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback,
+                   const Physics::UpdateHeightfieldCompleteFunction& updateHeightsMaterialsCompleteCallback,
+                   size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+                {
+                    auto samples = GetSamples();
+                    for (size_t row = startRow; row < startRow + numRows; row++)
+                    {
+                        for (size_t col = startColumn; col < startColumn + numColumns; col++)
+                        {
+                            Physics::HeightMaterialPoint sample = samples[(row * 3) + col];
+                            sample.m_height = dirtyHeight;
+                            updateHeightsMaterialsCallback(col, row, sample);
+                        }
+                    }
+
+                    updateHeightsMaterialsCompleteCallback();
+                });
+
+        Physics::HeightfieldProviderNotificationBus::Event(
+            gameEntityId, &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged,
+            AZ::Aabb::CreateFromMinMaxValues(0.0f, 1.0f, -3.0f, 3.0f, 2.0f, 3.0f),
+            Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData);
+
+        auto runtimeHeightfieldComponent = m_gameEntity->FindComponent<PhysX::HeightfieldColliderComponent>();
+        runtimeHeightfieldComponent->BlockOnPendingJobs();
+
+        AzPhysics::SimulatedBody* staticBody = nullptr;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+            staticBody, gameEntityId, &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+        const auto* pxRigidStatic = static_cast<const physx::PxRigidStatic*>(staticBody->GetNativePointer());
+
+        PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+
+        physx::PxShape* shape = nullptr;
+        pxRigidStatic->getShapes(&shape, 1, 0);
+
+        physx::PxHeightFieldGeometry heightfieldGeometry;
+        shape->getHeightFieldGeometry(heightfieldGeometry);
+
+        physx::PxHeightField* heightfield = heightfieldGeometry.heightField;
+
+        float minHeightBounds{ 0.0f };
+        float maxHeightBounds{ 0.0f };
+        Physics::HeightfieldProviderRequestsBus::Event(
+            gameEntityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldHeightBounds, minHeightBounds, maxHeightBounds);
+
+        const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
+        const float scaleFactor = (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
+
+        // The dirty row should have the new heights, and every other row should still have the original heights.
+        const AZStd::vector<Physics::HeightMaterialPoint> samples = GetSamples();
+        for (physx::PxU32 sampleRow = 0; sampleRow < 3; ++sampleRow)
+        {
+            for (physx::PxU32 sampleColumn = 0; sampleColumn < 3; ++sampleColumn)
+            {
+                const float expectedHeight = (sampleRow == dirtyRow) ? dirtyHeight : samples[sampleRow * 3 + sampleColumn].m_height;
+                physx::PxHeightFieldSample samplePhysX = heightfield->getSample(sampleRow, sampleColumn);
+                EXPECT_EQ(samplePhysX.height, azlossy_cast<physx::PxI16>(expectedHeight * scaleFactor));
+            }
+        }
+    }
+
 } // namespace PhysXEditorTests
 
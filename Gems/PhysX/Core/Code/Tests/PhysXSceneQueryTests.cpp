@@ -7,6 +7,8 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1007,4 +1009,160 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        // Use enough requests for the batch to be split into several tasks.
+        constexpr size_t NumBodies = 256;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < NumBodies; ++i)
+        {
+            const AZ::Vector3 position(aznumeric_cast<float>(i) * 4.0f, 10.0f, 0.0f);
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, position, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3(position.GetX(), 0.0f, 0.0f);
+            request->m_direction = AZ::Vector3::CreateAxisY();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        // Results should be in the same order as the requests, no matter which task processed them.
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackReceivesExpectedHit)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle sphereHandle =
+            TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX();
+        request.m_distance = 200.0f;
+
+        constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 42;
+        AZStd::atomic_bool callbackInvoked = false;
+        AzPhysics::SceneQuery::AsyncRequestId receivedId = 0;
+        AzPhysics::SceneQueryHits receivedHits;
+
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, RequestId, &request,
+            [&](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                receivedId = requestId;
+                receivedHits = AZStd::move(hits);
+                callbackInvoked = true;
+            });
+        ASSERT_TRUE(queued);
+
+        while (!callbackInvoked)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        EXPECT_EQ(receivedId, RequestId);
+        ASSERT_EQ(receivedHits.m_hits.size(), 1);
+        EXPECT_TRUE(receivedHits.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackReceivesExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        constexpr size_t NumBodies = 100;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < NumBodies; ++i)
+        {
+            const AZ::Vector3 position(aznumeric_cast<float>(i) * 4.0f, 0.0f, 0.0f);
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, position, 1.0f));
+
+            requests.emplace_back(AZStd::make_shared<AzPhysics::OverlapRequest>(
+                AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(0.5f, AZ::Transform::CreateTranslation(position))));
+        }
+
+        AZStd::atomic_bool callbackInvoked = false;
+        AzPhysics::SceneQueryHitsList receivedResults;
+
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+            [&](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+            {
+                receivedResults = AZStd::move(results);
+                callbackInvoked = true;
+            });
+        ASSERT_TRUE(queued);
+
+        while (!callbackInvoked)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        ASSERT_EQ(receivedResults.size(), requests.size());
+        for (size_t i = 0; i < receivedResults.size(); i++)
+        {
+            ASSERT_EQ(receivedResults[i].m_hits.size(), 1);
+            EXPECT_TRUE(receivedResults[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_FromTaskWorker_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        // Use enough requests for the batch to be split into several tasks when issued from the main thread.
+        constexpr size_t NumBodies = 256;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < NumBodies; ++i)
+        {
+            const AZ::Vector3 position(aznumeric_cast<float>(i) * 4.0f, 10.0f, 0.0f);
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, position, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3(position.GetX(), 0.0f, 0.0f);
+            request->m_direction = AZ::Vector3::CreateAxisY();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::RayCastRequest asyncRequest;
+        asyncRequest.m_start = AZ::Vector3::CreateZero();
+        asyncRequest.m_direction = AZ::Vector3::CreateAxisX();
+        asyncRequest.m_distance = 1.0f;
+
+        // Async callbacks run on a task worker, where the batch has to run without waiting on another task graph.
+        AZStd::atomic_bool callbackInvoked = false;
+        AzPhysics::SceneQueryHitsList results;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 0, &asyncRequest,
+            [&](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHits)
+            {
+                results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+                callbackInvoked = true;
+            });
+        ASSERT_TRUE(queued);
+
+        while (!callbackInvoked)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
 }
@@ -37,8 +37,16 @@
 #include <Scene/PhysXScene.h>
 #include <Tests/PhysXTestCommon.h>
 
+#include <AzCore/Console/IConsole.h>
+
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_bulkTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_bulkTransformUpdate);
+    AZ_CVAR_EXTERNED(bool, physx_parallelTransformSync);
+    AZ_CVAR_EXTERNED(size_t, physx_parallelTransformSyncBatchSize);
+
     class PhysXSpecificTest
         : public PhysXDefaultWorldTest
         , public UnitTest::TraceBusRedirector
@@ -1716,5 +1724,114 @@ namespace PhysX
         EXPECT_EQ(setKinematicFalseWarningHandler.GetWarningCount(), 1);
         EXPECT_TRUE(rigidBody->IsKinematic());
     }
+
+    TEST_F(PhysXSpecificTest, RigidBody_BulkTransformSync_EntityTransformsMatchBodies)
+    {
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        const bool previousBulkTransformSync = physx_bulkTransformSync;
+        const bool previousParallelTransformSync = physx_parallelTransformSync;
+        const size_t previousParallelTransformSyncBatchSize = physx_parallelTransformSyncBatchSize;
+        physx_batchTransformSync = true;
+        physx_bulkTransformSync = true;
+        physx_parallelTransformSync = true;
+        // Use small batches so the bulk sync is spread across several tasks
+        physx_parallelTransformSyncBatchSize = 2;
+
+        const float startHeight = 10.0f;
+        AZStd::vector<EntityPtr> boxes;
+        for (int i = 0; i < 8; ++i)
+        {
+            boxes.emplace_back(TestUtils::AddUnitTestObject(m_testSceneHandle, AZ::Vector3(2.0f * i, 0.0f, startHeight), "TestBox"));
+        }
+
+        for (int timeStep = 0; timeStep < 10; timeStep++)
+        {
+            m_defaultScene->StartSimulation(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            m_defaultScene->FinishSimulation();
+        }
+        static_cast<PhysX::PhysXScene*>(m_defaultScene)->FlushTransformSync();
+
+        for (const EntityPtr& box : boxes)
+        {
+            const AzPhysics::RigidBody* rigidBody = box->FindComponent<RigidBodyComponent>()->GetRigidBody();
+            const AZ::Vector3 entityPosition = box->GetTransform()->GetWorldTranslation();
+            EXPECT_LT(entityPosition.GetZ(), startHeight);
+            EXPECT_TRUE(entityPosition.IsClose(rigidBody->GetPosition(), tolerance));
+            EXPECT_TRUE(box->GetTransform()->GetWorldRotationQuaternion().IsClose(rigidBody->GetOrientation(), tolerance));
+        }
+
+        physx_batchTransformSync = previousBatchTransformSync;
+        physx_bulkTransformSync = previousBulkTransformSync;
+        physx_parallelTransformSync = previousParallelTransformSync;
+        physx_parallelTransformSyncBatchSize = previousParallelTransformSyncBatchSize;
+    }
+
+    TEST_F(PhysXSpecificTest, RigidBody_BulkTransformUpdate_SignalsOneBatchForAllBodies)
+    {
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        const bool previousBulkTransformSync = physx_bulkTransformSync;
+        const bool previousBulkTransformUpdate = physx_bulkTransformUpdate;
+        const bool previousParallelTransformSync = physx_parallelTransformSync;
+        const size_t previousParallelTransformSyncBatchSize = physx_parallelTransformSyncBatchSize;
+        physx_batchTransformSync = true;
+        physx_bulkTransformSync = true;
+        physx_bulkTransformUpdate = true;
+        physx_parallelTransformSync = true;
+        // Use small batches so the entity transforms are written from several tasks
+        physx_parallelTransformSyncBatchSize = 2;
+
+        const float startHeight = 10.0f;
+        AZStd::vector<EntityPtr> boxes;
+        for (int i = 0; i < 8; ++i)
+        {
+            boxes.emplace_back(TestUtils::AddUnitTestObject(m_testSceneHandle, AZ::Vector3(2.0f * i, 0.0f, startHeight), "TestBox"));
+        }
+
+        int signalCount = 0;
+        AZStd::vector<AZ::EntityId> updatedEntityIds;
+        PhysXScene::OnBulkTransformUpdateEvent::Handler bulkTransformUpdateHandler(
+            [&signalCount, &updatedEntityIds](AzPhysics::SceneHandle, const PhysXScene::BulkTransformUpdate& bulkTransformUpdate)
+            {
+                ++signalCount;
+                ASSERT_EQ(bulkTransformUpdate.m_entityIds.size(), bulkTransformUpdate.m_positions.size());
+                ASSERT_EQ(bulkTransformUpdate.m_entityIds.size(), bulkTransformUpdate.m_orientations.size());
+                for (size_t i = 0; i < bulkTransformUpdate.m_entityIds.size(); ++i)
+                {
+                    // The entity transforms have already been written when the batch is signaled
+                    AZ::Transform worldTransform = AZ::Transform::CreateIdentity();
+                    AZ::TransformBus::EventResult(worldTransform, bulkTransformUpdate.m_entityIds[i], &AZ::TransformBus::Events::GetWorldTM);
+                    EXPECT_TRUE(worldTransform.GetTranslation().IsClose(bulkTransformUpdate.m_positions[i]));
+                    EXPECT_TRUE(worldTransform.GetRotation().IsClose(bulkTransformUpdate.m_orientations[i]));
+                    updatedEntityIds.push_back(bulkTransformUpdate.m_entityIds[i]);
+                }
+            });
+        auto* physXScene = static_cast<PhysX::PhysXScene*>(m_defaultScene);
+        physXScene->RegisterBulkTransformUpdateHandler(bulkTransformUpdateHandler);
+
+        for (int timeStep = 0; timeStep < 10; timeStep++)
+        {
+            m_defaultScene->StartSimulation(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            m_defaultScene->FinishSimulation();
+        }
+        physXScene->FlushTransformSync();
+
+        // All the boxes are moving, so they are all updated by the one batch of the flush
+        EXPECT_EQ(signalCount, 1);
+        EXPECT_EQ(updatedEntityIds.size(), boxes.size());
+        for (const EntityPtr& box : boxes)
+        {
+            EXPECT_NE(AZStd::find(updatedEntityIds.begin(), updatedEntityIds.end(), box->GetId()), updatedEntityIds.end());
+            const AzPhysics::RigidBody* rigidBody = box->FindComponent<RigidBodyComponent>()->GetRigidBody();
+            EXPECT_LT(box->GetTransform()->GetWorldTranslation().GetZ(), startHeight);
+            EXPECT_TRUE(box->GetTransform()->GetWorldTranslation().IsClose(rigidBody->GetPosition(), tolerance));
+        }
+
+        bulkTransformUpdateHandler.Disconnect();
+        physx_batchTransformSync = previousBatchTransformSync;
+        physx_bulkTransformSync = previousBulkTransformSync;
+        physx_bulkTransformUpdate = previousBulkTransformUpdate;
+        physx_parallelTransformSync = previousParallelTransformSync;
+        physx_parallelTransformSyncBatchSize = previousParallelTransformSyncBatchSize;
+    }
 } // namespace PhysX
 
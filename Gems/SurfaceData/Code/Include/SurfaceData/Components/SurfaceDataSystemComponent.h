@@ -10,7 +10,10 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
@@ -69,6 +72,39 @@ namespace SurfaceData
         SurfaceDataRegistryHandle GetSurfaceDataModifierHandle(const AZ::EntityId& modifierEntityId) override;
 
     private:
+        // A region query result that can be reused by later queries with the exact same region, step size, and tags.
+        struct RegionCacheTile
+        {
+            AZ::Aabb m_region = AZ::Aabb::CreateNull();
+            AZ::Vector2 m_stepSize = AZ::Vector2::CreateZero();
+            SurfaceTagVector m_desiredTags;
+            size_t m_hash = 0;
+            AZStd::atomic_uint64_t m_lastUsed{ 0 };
+            // Shared, so that the points can be copied in and out of the cache without holding the cache lock.
+            AZStd::shared_ptr<const SurfacePointList> m_surfacePoints;
+        };
+
+        static size_t GetRegionCacheHash(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags);
+        static bool RegionCacheTileMatches(
+            const RegionCacheTile& tile, size_t hash, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            const SurfaceTagVector& desiredTags);
+
+        // Copy a cached region query result into the output list. Returns false if there's no cached result for the query.
+        bool GetSurfacePointsFromRegionCache(
+            size_t hash, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags,
+            SurfacePointList& surfacePointLists) const;
+        // Add a region query result to the cache, evicting the least recently used tile if the cache is full.
+        // The result is dropped if the surface data changed since cacheGeneration was read.
+        void AddSurfacePointsToRegionCache(
+            size_t hash, AZ::u64 cacheGeneration, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            const SurfaceTagVector& desiredTags, const SurfacePointList& surfacePointLists) const;
+        // Remove every cached tile that overlaps the given bounds, or all of them if the bounds are invalid.
+        void InvalidateRegionCache(const AZ::Aabb& bounds);
+        // Remove every cached tile that a surface change from oldBounds to newBounds can affect.
+        // Called before OnSurfaceChanged is broadcast, so that listeners that query the surface in response never get stale results.
+        void InvalidateRegionCache(const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds);
+        void ReportRegionCacheHitRate(bool cacheHit) const;
+
 
         using SurfaceDataRegistryMap = AZStd::unordered_map<SurfaceDataRegistryHandle, SurfaceDataRegistryEntry>;
 
@@ -102,5 +138,14 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        // Cache of region query results, invalidated whenever a provider or modifier changes.
+        mutable AZStd::shared_mutex m_regionCacheMutex;
+        mutable AZStd::vector<AZStd::unique_ptr<RegionCacheTile>> m_regionCache;
+        // Incremented on every surface change, so that queries that overlap a change don't add stale results to the cache.
+        AZStd::atomic_uint64_t m_regionCacheGeneration{ 0 };
+        mutable AZStd::atomic_uint64_t m_regionCacheUseCounter{ 0 };
+        mutable AZStd::atomic_uint64_t m_regionCacheQueries{ 0 };
+        mutable AZStd::atomic_uint64_t m_regionCacheHits{ 0 };
     };
 }
@@ -6,10 +6,13 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 
 #include <SurfaceData/Components/SurfaceDataSystemComponent.h>
@@ -22,6 +25,14 @@
 
 AZ_DEFINE_BUDGET(SurfaceData);
 
+AZ_CVAR(
+    uint32_t,
+    sd_regionQueryCacheSize,
+    64,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of GetSurfacePointsFromRegion results that are cached for reuse. Set to 0 to disable the cache.");
+
 namespace SurfaceData
 {
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -128,6 +139,8 @@ namespace SurfaceData
     {
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
         AZ::Interface<SurfaceDataSystem>::Unregister(this);
+
+        InvalidateRegionCache(AZ::Aabb::CreateNull());
     }
 
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
@@ -140,6 +153,8 @@ namespace SurfaceData
             // because new surface points have the potential of getting the modifier tags applied as well.
             SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(entry.m_bounds, entry.m_tags);
 
+            InvalidateRegionCache(entry.m_bounds, entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
             SurfaceDataSystemNotificationBus::Broadcast(
@@ -159,6 +174,8 @@ namespace SurfaceData
             // because the removed surface points have the potential of getting the modifier tags applied as well.
             SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(entry.m_bounds, entry.m_tags);
 
+            InvalidateRegionCache(entry.m_bounds, entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
             SurfaceDataSystemNotificationBus::Broadcast(
@@ -182,6 +199,8 @@ namespace SurfaceData
             surfaceTagBounds.AddAabb(entry.m_bounds);
             SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(surfaceTagBounds, entry.m_tags);
 
+            InvalidateRegionCache(oldBounds, entry.m_bounds);
+
             SurfaceDataSystemNotificationBus::Broadcast(
                 &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, oldBounds, entry.m_bounds,
                 affectedSurfaceTags);
@@ -197,6 +216,8 @@ namespace SurfaceData
             // any new surface points, we only need to broadcast the modifier tags themselves as the ones that changed.
             const SurfaceTagSet affectedSurfaceTags = ConvertTagVectorToSet(entry.m_tags);
 
+            InvalidateRegionCache(entry.m_bounds, entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
             SurfaceDataSystemNotificationBus::Broadcast(
@@ -215,6 +236,8 @@ namespace SurfaceData
             // any new surface points, we only need to broadcast the modifier tags themselves as the ones that changed.
             const SurfaceTagSet affectedSurfaceTags = ConvertTagVectorToSet(entry.m_tags);
 
+            InvalidateRegionCache(entry.m_bounds, entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause a full refresh for any system listening, instead of just a refresh within the bounds.
             SurfaceDataSystemNotificationBus::Broadcast(
@@ -247,6 +270,8 @@ namespace SurfaceData
 
         if (UpdateSurfaceDataModifierInternal(handle, entry, oldBounds))
         {
+            InvalidateRegionCache(oldBounds, entry.m_bounds);
+
             SurfaceDataSystemNotificationBus::Broadcast(
                 &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, oldBounds, entry.m_bounds,
                 affectedSurfaceTags);
@@ -263,6 +288,8 @@ namespace SurfaceData
             // because the affected surface points have the potential of getting the modifier tags applied as well.
             SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(dirtyBounds, entryItr->second.m_tags);
 
+            InvalidateRegionCache(dirtyBounds, dirtyBounds);
+
             SurfaceDataSystemNotificationBus::Broadcast(
                 &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, AZ::EntityId(), dirtyBounds, dirtyBounds, affectedSurfaceTags);
         }
@@ -306,6 +333,24 @@ namespace SurfaceData
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize,
         const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointLists) const
     {
+        SURFACE_DATA_PROFILE_FUNCTION_VERBOSE
+
+        // Vegetation sectors, terrain and gradients tend to query the same regions repeatedly, so try to reuse a previous result.
+        // The generation needs to be read before querying, so that a result that overlaps a surface change never gets cached.
+        const bool useCache = sd_regionQueryCacheSize > 0;
+        const size_t cacheHash = useCache ? GetRegionCacheHash(inRegion, stepSize, desiredTags) : 0;
+        const AZ::u64 cacheGeneration = m_regionCacheGeneration.load(AZStd::memory_order_acquire);
+        if (useCache)
+        {
+            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromRegion: CacheLookup");
+            const bool cacheHit = GetSurfacePointsFromRegionCache(cacheHash, inRegion, stepSize, desiredTags, surfacePointLists);
+            ReportRegionCacheHitRate(cacheHit);
+            if (cacheHit)
+            {
+                return;
+            }
+        }
+
         const size_t totalQueryPositions = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) *
             aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
 
@@ -323,6 +368,12 @@ namespace SurfaceData
         }
 
         GetSurfacePointsFromListInternal(inPositions, inRegion, desiredTags, surfacePointLists);
+
+        if (useCache)
+        {
+            SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromRegion: CacheInsert");
+            AddSurfacePointsToRegionCache(cacheHash, cacheGeneration, inRegion, stepSize, desiredTags, surfacePointLists);
+        }
     }
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromList(
@@ -441,6 +492,156 @@ namespace SurfaceData
         surfacePointLists.EndListConstruction();
     }
 
+    void SurfaceDataSystemComponent::InvalidateRegionCache(const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds)
+    {
+        // The changed tags aren't used to narrow the invalidation, because a cached region with tag filters can still change
+        // when a provider with other tags moves points around (i.e. points merging together).
+        InvalidateRegionCache(oldBounds);
+        if (oldBounds.IsValid() && newBounds != oldBounds)
+        {
+            InvalidateRegionCache(newBounds);
+        }
+    }
+
+    size_t SurfaceDataSystemComponent::GetRegionCacheHash(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags)
+    {
+        // The Z range of the region is ignored by the query, so it isn't part of the key either.
+        size_t hash = 0;
+        AZStd::hash_combine(
+            hash, inRegion.GetMin().GetX(), inRegion.GetMin().GetY(), inRegion.GetMax().GetX(), inRegion.GetMax().GetY(),
+            stepSize.GetX(), stepSize.GetY());
+        for (const auto& tag : desiredTags)
+        {
+            AZStd::hash_combine(hash, static_cast<AZ::u32>(tag));
+        }
+        return hash;
+    }
+
+    bool SurfaceDataSystemComponent::RegionCacheTileMatches(
+        const RegionCacheTile& tile, size_t hash, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+        const SurfaceTagVector& desiredTags)
+    {
+        return (tile.m_hash == hash) && (tile.m_stepSize == stepSize) &&
+            (tile.m_region.GetMin().GetX() == inRegion.GetMin().GetX()) &&
+            (tile.m_region.GetMin().GetY() == inRegion.GetMin().GetY()) &&
+            (tile.m_region.GetMax().GetX() == inRegion.GetMax().GetX()) &&
+            (tile.m_region.GetMax().GetY() == inRegion.GetMax().GetY()) && (tile.m_desiredTags == desiredTags);
+    }
+
+    bool SurfaceDataSystemComponent::GetSurfacePointsFromRegionCache(
+        size_t hash, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags,
+        SurfacePointList& surfacePointLists) const
+    {
+        AZStd::shared_ptr<const SurfacePointList> cachedSurfacePoints;
+        {
+            AZStd::shared_lock<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+
+            for (const auto& tile : m_regionCache)
+            {
+                if (RegionCacheTileMatches(*tile, hash, inRegion, stepSize, desiredTags))
+                {
+                    tile->m_lastUsed.store(++m_regionCacheUseCounter, AZStd::memory_order_relaxed);
+                    cachedSurfacePoints = tile->m_surfacePoints;
+                    break;
+                }
+            }
+        }
+
+        if (!cachedSurfacePoints)
+        {
+            return false;
+        }
+
+        surfacePointLists = *cachedSurfacePoints;
+        return true;
+    }
+
+    void SurfaceDataSystemComponent::AddSurfacePointsToRegionCache(
+        size_t hash, AZ::u64 cacheGeneration, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+        const SurfaceTagVector& desiredTags, const SurfacePointList& surfacePointLists) const
+    {
+        // Copy the points before taking the lock, so that concurrent queries aren't blocked while a large result is copied.
+        auto cachedSurfacePoints = AZStd::make_shared<const SurfacePointList>(surfacePointLists);
+
+        AZStd::unique_lock<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+
+        // The surface data changed while this query was running, so the result might already be stale.
+        if (m_regionCacheGeneration.load(AZStd::memory_order_acquire) != cacheGeneration)
+        {
+            return;
+        }
+
+        for (const auto& cachedTile : m_regionCache)
+        {
+            // Another thread already cached the same query.
+            if (RegionCacheTileMatches(*cachedTile, hash, inRegion, stepSize, desiredTags))
+            {
+                return;
+            }
+        }
+
+        const size_t maxTiles = sd_regionQueryCacheSize;
+        RegionCacheTile* tile = nullptr;
+        if (m_regionCache.size() < maxTiles)
+        {
+            tile = m_regionCache.emplace_back(AZStd::make_unique<RegionCacheTile>()).get();
+        }
+        else
+        {
+            // The cache size can be lowered at runtime, so drop any tiles past the new size before reusing the oldest one.
+            m_regionCache.resize(AZStd::max(maxTiles, size_t(1)));
+            tile = m_regionCache.front().get();
+            for (const auto& cachedTile : m_regionCache)
+            {
+                if (cachedTile->m_lastUsed.load(AZStd::memory_order_relaxed) < tile->m_lastUsed.load(AZStd::memory_order_relaxed))
+                {
+                    tile = cachedTile.get();
+                }
+            }
+        }
+
+        tile->m_region = inRegion;
+        tile->m_stepSize = stepSize;
+        tile->m_desiredTags = desiredTags;
+        tile->m_hash = hash;
+        tile->m_lastUsed.store(++m_regionCacheUseCounter, AZStd::memory_order_relaxed);
+        tile->m_surfacePoints = AZStd::move(cachedSurfacePoints);
+    }
+
+    void SurfaceDataSystemComponent::InvalidateRegionCache(const AZ::Aabb& bounds)
+    {
+        AZStd::unique_lock<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+
+        ++m_regionCacheGeneration;
+
+        // An invalid Aabb means that the entire surface could have changed.
+        if (!bounds.IsValid())
+        {
+            m_regionCache.clear();
+            return;
+        }
+
+        for (auto tileItr = m_regionCache.begin(); tileItr != m_regionCache.end();)
+        {
+            if (AabbOverlaps2D((*tileItr)->m_region, bounds))
+            {
+                tileItr = m_regionCache.erase(tileItr);
+            }
+            else
+            {
+                ++tileItr;
+            }
+        }
+    }
+
+    void SurfaceDataSystemComponent::ReportRegionCacheHitRate(bool cacheHit) const
+    {
+        [[maybe_unused]] const AZ::u64 queries = ++m_regionCacheQueries;
+        [[maybe_unused]] const AZ::u64 hits = cacheHit ? ++m_regionCacheHits : m_regionCacheHits.load();
+        AZ_PROFILE_DATAPOINT(SurfaceData, (100.0 * hits) / queries, L"SurfaceData/RegionQueryCache/HitRatePercent");
+    }
+
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry)
     {
         AZ_Assert(entry.m_maxPointsCreatedPerInput > 0, "Surface data providers should always create at least 1 point.");
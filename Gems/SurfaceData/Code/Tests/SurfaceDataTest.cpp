@@ -23,10 +23,12 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <SurfaceData/Components/SurfaceDataSystemComponent.h>
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
+#include <SurfaceData/SurfaceDataSystemNotificationBus.h>
 #include <SurfaceData/SurfaceTag.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <Tests/SurfaceDataTestFixtures.h>
@@ -61,6 +63,12 @@ class MockSurfaceProvider
             Unregister();
         }
 
+        // The number of positions that this provider was queried for.
+        size_t GetQueriedPositionCount() const
+        {
+            return m_queriedPositionCount;
+        }
+
     private:
         AZStd::unordered_map<AZStd::pair<float, float>, AZStd::vector<AzFramework::SurfaceData::SurfacePoint>> m_surfacePoints;
         SurfaceData::SurfaceTagVector m_tags;
@@ -161,6 +169,7 @@ class MockSurfaceProvider
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override
         {
+            ++m_queriedPositionCount;
             auto surfacePoints = m_surfacePoints.find(AZStd::make_pair(inPosition.GetX(), inPosition.GetY()));
 
             if (surfacePoints != m_surfacePoints.end())
@@ -192,6 +201,7 @@ class MockSurfaceProvider
         }
 
         SurfaceData::SurfaceDataRegistryHandle m_providerHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+        mutable AZStd::atomic<size_t> m_queriedPositionCount{ 0 };
 
 };
 
@@ -754,6 +764,134 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_NoMatchingReg
     EXPECT_TRUE(availablePointsPerPosition.IsEmpty());
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_CachedResultsInvalidatedBySurfaceChanges)
+{
+    // This test verifies that repeated region queries return the same results, and that surface changes in the region
+    // are reflected in the results of the next query instead of returning a stale cached result.
+
+    // Create a mock Surface Provider that covers from (0, 0) - (8, 8) in space.
+    // It defines points spaced 0.25 apart, with heights of 0 and 4, and with the tag "test_surface1".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    // Query for all the surface points from (0, 0) - (4, 4) with a step size of 1, including both provider tags.
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    auto countPointsWithTag = [](const SurfaceData::SurfacePointList& pointList, AZ::Crc32 tag)
+    {
+        size_t count = 0;
+        pointList.EnumeratePoints(
+            [&count, tag](
+                [[maybe_unused]] size_t inPositionIndex, [[maybe_unused]] const AZ::Vector3& position,
+                [[maybe_unused]] const AZ::Vector3& normal, const SurfaceData::SurfaceTagWeights& masks) -> bool
+            {
+                count += masks.HasMatchingTag(tag) ? 1 : 0;
+                return true;
+            });
+        return count;
+    };
+
+    // Query the same region twice. Both queries should return the same 32 points (16 positions, 2 heights each),
+    // and the second one should come from the cache without querying the provider again.
+    SurfaceData::SurfacePointList firstQueryPoints;
+    SurfaceData::SurfacePointList secondQueryPoints;
+    AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(regionBounds, stepSize, testTags, firstQueryPoints);
+    const size_t firstQueriedPositionCount = mockProvider.GetQueriedPositionCount();
+    EXPECT_GT(firstQueriedPositionCount, 0);
+    AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(regionBounds, stepSize, testTags, secondQueryPoints);
+    EXPECT_EQ(mockProvider.GetQueriedPositionCount(), firstQueriedPositionCount);
+    EXPECT_EQ(firstQueryPoints.GetSize(), 32);
+    EXPECT_EQ(secondQueryPoints.GetSize(), firstQueryPoints.GetSize());
+    EXPECT_EQ(countPointsWithTag(secondQueryPoints, m_testSurface1Crc), 32);
+    EXPECT_EQ(countPointsWithTag(secondQueryPoints, m_testSurface2Crc), 0);
+
+    {
+        // Add a surface modifier over the region, which should cause the next query to pick up the modifier tag.
+        SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+        MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+            AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f),
+            AZ::EntityId(0x22222222));
+
+        SurfaceData::SurfacePointList modifiedQueryPoints;
+        AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(
+            regionBounds, stepSize, testTags, modifiedQueryPoints);
+        EXPECT_GT(mockProvider.GetQueriedPositionCount(), firstQueriedPositionCount);
+        EXPECT_EQ(modifiedQueryPoints.GetSize(), 32);
+        EXPECT_EQ(countPointsWithTag(modifiedQueryPoints, m_testSurface2Crc), 32);
+    }
+
+    // Once the modifier is removed, the modifier tag should disappear from the results again.
+    SurfaceData::SurfacePointList finalQueryPoints;
+    AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(regionBounds, stepSize, testTags, finalQueryPoints);
+    EXPECT_EQ(finalQueryPoints.GetSize(), 32);
+    EXPECT_EQ(countPointsWithTag(finalQueryPoints, m_testSurface2Crc), 0);
+}
+
+// Queries a region from inside OnSurfaceChanged, the way systems that refresh in response to surface changes do.
+class SurfaceChangedRegionQueryListener : private SurfaceData::SurfaceDataSystemNotificationBus::Handler
+{
+public:
+    SurfaceChangedRegionQueryListener(const AZ::Aabb& region, const AZ::Vector2& stepSize, const SurfaceData::SurfaceTagVector& tags)
+        : m_region(region)
+        , m_stepSize(stepSize)
+        , m_tags(tags)
+    {
+        SurfaceData::SurfaceDataSystemNotificationBus::Handler::BusConnect();
+    }
+
+    ~SurfaceChangedRegionQueryListener()
+    {
+        SurfaceData::SurfaceDataSystemNotificationBus::Handler::BusDisconnect();
+    }
+
+    void OnSurfaceChanged(
+        [[maybe_unused]] const AZ::EntityId& entityId,
+        [[maybe_unused]] const AZ::Aabb& oldBounds,
+        [[maybe_unused]] const AZ::Aabb& newBounds,
+        [[maybe_unused]] const SurfaceData::SurfaceTagSet& changedSurfaceTags) override
+    {
+        m_queriedPoints.Clear();
+        AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(m_region, m_stepSize, m_tags, m_queriedPoints);
+        ++m_notificationCount;
+    }
+
+    SurfaceData::SurfacePointList m_queriedPoints;
+    int m_notificationCount = 0;
+
+private:
+    AZ::Aabb m_region;
+    AZ::Vector2 m_stepSize;
+    SurfaceData::SurfaceTagVector m_tags;
+};
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_CacheInvalidatedBeforeSurfaceChangedNotification)
+{
+    // This test verifies that the cached region query results are invalidated before OnSurfaceChanged is broadcast,
+    // so that a listener that queries the region in response to the notification never gets the stale cached result.
+
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+
+    // Create a mock Surface Provider that covers from (0, 0) - (8, 8) in space, with heights of 0 and 4.
+    auto mockProvider = AZStd::make_unique<MockSurfaceProvider>(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, testTags,
+        AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    // Cache the region query result: 32 points (16 positions, 2 heights each).
+    SurfaceData::SurfacePointList cachedQueryPoints;
+    AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(regionBounds, stepSize, testTags, cachedQueryPoints);
+    EXPECT_EQ(cachedQueryPoints.GetSize(), 32);
+
+    // Removing the provider notifies the listener, which should no longer find any points in the region.
+    SurfaceChangedRegionQueryListener listener(regionBounds, stepSize, testTags);
+    mockProvider.reset();
+    EXPECT_EQ(listener.m_notificationCount, 1);
+    EXPECT_TRUE(listener.m_queriedPoints.IsEmpty());
+}
+
 TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_ProviderModifierMasksCombine)
 {
     // This test verifies that SurfaceDataModifiers can successfully modify the tags on each point.
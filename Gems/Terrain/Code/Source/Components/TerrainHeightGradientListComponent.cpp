@@ -11,6 +11,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -21,6 +22,15 @@
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
 #include <TerrainProfiler.h>
 
+AZ_CVAR(bool,
+    terrain_compiledGradientQueries,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "When enabled, region height queries on Terrain Height Gradient List components evaluate their gradients through compiled "
+    "gradient evaluation plans instead of querying every gradient in the chain through the GradientRequestBus."
+);
+
 namespace Terrain
 {
     void TerrainHeightGradientListConfig::Reflect(AZ::ReflectContext* context)
@@ -116,6 +126,24 @@ namespace Terrain
             }
         }
 
+        // The compiled samplers listen for changes to their gradients and recompile on the next query, so they can be built
+        // up front regardless of the cvar setting.
+        m_compiledGradients.clear();
+        for (auto& entityId : m_configuration.m_gradientEntities)
+        {
+            if (entityId.IsValid())
+            {
+                GradientSignal::GradientSampler sampler;
+                sampler.m_gradientId = entityId;
+                sampler.m_ownerEntityId = GetEntityId();
+                m_compiledGradients.emplace_back(AZStd::make_unique<GradientSignal::CompiledGradientSampler>(sampler));
+            }
+            else
+            {
+                m_compiledGradients.emplace_back(nullptr);
+            }
+        }
+
         Terrain::TerrainAreaHeightRequestBus::Handler::BusConnect(GetEntityId());
 
         // Cache any height data needed and notify that the area has changed.
@@ -127,6 +155,7 @@ namespace Terrain
         // Disconnect before doing any other teardown. This will guarantee that any active queries have finished before we proceed.
         Terrain::TerrainAreaHeightRequestBus::Handler::BusDisconnect();
 
+        m_compiledGradients.clear();
         m_dependencyMonitor.Reset();
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
@@ -234,12 +263,21 @@ namespace Terrain
             // value of 0 outside their data bounds if they're using bounded data.  We should examine the possibility of extending the
             // gradient API to provide actual bounds so that it's possible to detect if the gradient even 'exists' in an area, at which
             // point we could just make this list a prioritized list from top to bottom for any points that overlap.
-            for (auto& gradientId : m_configuration.m_gradientEntities)
+            const bool useCompiledGradients = terrain_compiledGradientQueries;
+            for (size_t gradientIndex = 0; gradientIndex < m_configuration.m_gradientEntities.size(); gradientIndex++)
             {
+                const AZ::EntityId& gradientId = m_configuration.m_gradientEntities[gradientIndex];
                 if (gradientId.IsValid())
                 {
-                    GradientSignal::GradientRequestBus::Event(
-                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                    if (useCompiledGradients)
+                    {
+                        m_compiledGradients[gradientIndex]->GetValues(inOutPositionList, curGradientSamples);
+                    }
+                    else
+                    {
+                        GradientSignal::GradientRequestBus::Event(
+                            gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                    }
 
                     for (size_t index = 0; index < maxValueSamples.size(); index++)
                     {
@@ -17,6 +17,9 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <GradientSignal/CompiledGradientSampler.h>
 
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
@@ -95,6 +98,10 @@ namespace Terrain
 
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
 
+        // Compiled evaluation plans for each entry in m_configuration.m_gradientEntities (null for invalid entries), used by
+        // GetHeights() while terrain_compiledGradientQueries is enabled.
+        AZStd::vector<AZStd::unique_ptr<GradientSignal::CompiledGradientSampler>> m_compiledGradients;
+
         // The TerrainAreaHeightRequestBus allows parallel dispatches, so make sure that queries don't happen at the same
         // time as cached data updates.
         AZStd::shared_mutex m_queryMutex;
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainQueryCache.h>
+
+#include <AzCore/std/hash.h>
+
+namespace Terrain
+{
+    bool TerrainQueryCache::TileKey::operator==(const TileKey& other) const
+    {
+        return (m_tileX == other.m_tileX) && (m_tileY == other.m_tileY) && (m_stepSize == other.m_stepSize) &&
+            (m_sampler == other.m_sampler) && (m_requestedData == other.m_requestedData);
+    }
+
+    size_t TerrainQueryCache::TileKeyHasher::operator()(const TileKey& key) const
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(
+            hash, key.m_tileX, key.m_tileY, key.m_stepSize.GetX(), key.m_stepSize.GetY(), static_cast<int32_t>(key.m_sampler),
+            key.m_requestedData);
+        return hash;
+    }
+
+    AZStd::shared_ptr<const TerrainQueryCache::Tile> TerrainQueryCache::FindTile(const TileKey& key) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        auto tileItr = m_tiles.find(key);
+        if (tileItr == m_tiles.end())
+        {
+            return {};
+        }
+
+        tileItr->second->m_lastUsed.store(++m_useCounter, AZStd::memory_order_relaxed);
+        return tileItr->second;
+    }
+
+    AZ::u64 TerrainQueryCache::GetGeneration() const
+    {
+        return m_generation.load(AZStd::memory_order_acquire);
+    }
+
+    void TerrainQueryCache::AddTile(const TileKey& key, AZStd::shared_ptr<const Tile> tile, AZ::u64 generation, size_t maxTiles)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        // The terrain changed while the tile was being computed, so it might contain stale data.
+        if ((maxTiles == 0) || (m_generation.load(AZStd::memory_order_acquire) != generation))
+        {
+            return;
+        }
+
+        // Make room for the new tile by evicting the least recently used ones. The maximum can be lowered at runtime,
+        // so this might need to evict more than one tile.
+        while (!m_tiles.empty() && (m_tiles.size() >= maxTiles))
+        {
+            auto oldestTile = m_tiles.begin();
+            for (auto tileItr = m_tiles.begin(); tileItr != m_tiles.end(); ++tileItr)
+            {
+                if (tileItr->second->m_lastUsed.load(AZStd::memory_order_relaxed) <
+                    oldestTile->second->m_lastUsed.load(AZStd::memory_order_relaxed))
+                {
+                    oldestTile = tileItr;
+                }
+            }
+            m_tiles.erase(oldestTile);
+        }
+
+        tile->m_lastUsed.store(++m_useCounter, AZStd::memory_order_relaxed);
+        m_tiles.insert_or_assign(key, AZStd::move(tile));
+    }
+
+    void TerrainQueryCache::Invalidate(const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        ++m_generation;
+
+        // Terrain queries ignore the Z value of the input positions, so only compare the XY bounds.
+        for (auto tileItr = m_tiles.begin(); tileItr != m_tiles.end();)
+        {
+            const AZ::Aabb& tileBounds = tileItr->second->m_dependencyBounds;
+            const bool overlaps = (tileBounds.GetMin().GetX() <= dirtyRegion.GetMax().GetX()) &&
+                (tileBounds.GetMax().GetX() >= dirtyRegion.GetMin().GetX()) &&
+                (tileBounds.GetMin().GetY() <= dirtyRegion.GetMax().GetY()) &&
+                (tileBounds.GetMax().GetY() >= dirtyRegion.GetMin().GetY());
+
+            tileItr = overlaps ? m_tiles.erase(tileItr) : AZStd::next(tileItr);
+        }
+    }
+
+    void TerrainQueryCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        ++m_generation;
+        m_tiles.clear();
+    }
+
+    size_t TerrainQueryCache::GetTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        return m_tiles.size();
+    }
+} // namespace Terrain
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
+
+namespace Terrain
+{
+    //! Caches terrain region query results so that repeated queries over the same area don't need to evaluate the
+    //! height and surface gradients again.
+    //! Results are stored in tiles of TileSize x TileSize samples. The samples lie on the lattice defined by the query step size,
+    //! anchored at the world origin, so region queries that start on that lattice can be assembled from the same tiles as long
+    //! as their positions round to the same values as the tile positions.
+    //! Each tile only holds the data that was requested, computed with the requested sampler, so the cached values match the
+    //! values a live query would return for the same positions.
+    class TerrainQueryCache
+    {
+    public:
+        using Sampler = AzFramework::Terrain::TerrainDataRequests::Sampler;
+
+        //! Number of samples along each side of a tile.
+        static constexpr int32_t TileSize = 32;
+
+        struct TileKey
+        {
+            bool operator==(const TileKey& other) const;
+
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+            AZ::Vector2 m_stepSize = AZ::Vector2::CreateZero();
+            Sampler m_sampler = Sampler::DEFAULT;
+            //! The requested TerrainDataMask, limited to the data channels that exist.
+            uint8_t m_requestedData = 0;
+        };
+
+        struct TileKeyHasher
+        {
+            size_t operator()(const TileKey& key) const;
+        };
+
+        struct Tile
+        {
+            //! The XY area that can affect the samples in this tile. Dirty regions that overlap it invalidate the tile.
+            AZ::Aabb m_dependencyBounds = AZ::Aabb::CreateNull();
+
+            //! Per-sample data in row-major order. Only the requested data channels are filled in.
+            AZStd::vector<float> m_heights;
+            AZStd::vector<AZ::Vector3> m_normals;
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceWeights;
+            AZStd::vector<bool> m_terrainExists;
+
+            mutable AZStd::atomic_uint64_t m_lastUsed{ 0 };
+        };
+
+        //! Returns the world position of the first sample of a tile along one axis.
+        //! The tile positions are generated from this start the same way a live region query generates them from its start point.
+        static float GetTileStart(int64_t firstSample, float stepSize)
+        {
+            return static_cast<float>(firstSample) * stepSize;
+        }
+
+        //! Returns the cached tile for the key, or null if it isn't cached.
+        AZStd::shared_ptr<const Tile> FindTile(const TileKey& key) const;
+
+        //! Returns a counter that changes every time tiles are invalidated.
+        //! Read it before computing a tile and pass it to AddTile() so that tiles computed from stale data are dropped.
+        AZ::u64 GetGeneration() const;
+
+        //! Adds a tile to the cache, evicting the least recently used tiles to stay within maxTiles.
+        void AddTile(const TileKey& key, AZStd::shared_ptr<const Tile> tile, AZ::u64 generation, size_t maxTiles);
+
+        //! Removes every tile that depends on data inside the dirty region.
+        void Invalidate(const AZ::Aabb& dirtyRegion);
+
+        //! Removes all the tiles.
+        void Clear();
+
+        size_t GetTileCount() const;
+
+    private:
+        mutable AZStd::shared_mutex m_tileMutex;
+        AZStd::unordered_map<TileKey, AZStd::shared_ptr<const Tile>, TileKeyHasher> m_tiles;
+        AZStd::atomic_uint64_t m_generation{ 0 };
+        mutable AZStd::atomic_uint64_t m_useCounter{ 0 };
+    };
+} // namespace Terrain
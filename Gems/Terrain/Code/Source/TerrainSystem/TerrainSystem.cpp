@@ -7,6 +7,7 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +26,18 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+namespace Terrain
+{
+    AZ_CVAR(
+        uint32_t,
+        t_queryCacheMaxTiles,
+        128,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of region query tiles the terrain system keeps cached. Set to 0 to disable the cache.\n"
+        "Each tile holds 32 x 32 samples of the requested data.");
+}
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -88,6 +101,7 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_queryCache.Clear();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +152,7 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    m_queryCache.Clear();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -1417,34 +1432,12 @@ void TerrainSystem::QueryList(
         return;
     }
 
-    AZStd::vector<bool> terrainExists(inPositions.size());
+    AZStd::vector<bool> terrainExists;
     AZStd::vector<float> heights;
     AZStd::vector<AZ::Vector3> normals;
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights;
 
-    // Query normals before heights because the height query produces better results for the terrainExists flag for a given point,
-    // so we want to prefer keeping the results from the height query if we end up querying both.
-    // (Ideally at some point they will produce identical results)
-    if (requestedData & TerrainDataMask::Normals)
-    {
-        normals.resize(inPositions.size());
-        GetNormalsSynchronous(inPositions, sampler, normals, terrainExists);
-    }
-    if (requestedData & TerrainDataMask::Heights)
-    {
-        heights.resize(inPositions.size());
-        GetHeightsSynchronous(inPositions, sampler, heights, terrainExists);
-    }
-    if (requestedData & TerrainDataMask::SurfaceData)
-    {
-        // We can potentially skip an extra call to GetHeights if we already
-        // got the terrain exists flags in the earlier call to GetHeights
-        AZStd::vector<bool> terrainExistsEmpty;
-
-        surfaceWeights.resize(inPositions.size());
-        GetOrderedSurfaceWeightsFromList(inPositions, sampler, surfaceWeights,
-            (requestedData & TerrainDataMask::Heights) ? terrainExistsEmpty : terrainExists);
-    }
+    GetQueryDataSynchronous(inPositions, requestedData, sampler, heights, normals, surfaceWeights, terrainExists);
 
     {
         TERRAIN_PROFILE_SCOPE_VERBOSE("QueryList-PerPositionCallbacks");
@@ -1607,6 +1600,11 @@ void TerrainSystem::QueryRegionInternal(
         return;
     }
 
+    if (QueryRegionFromCache(queryRegion, xIndexOffset, yIndexOffset, requestedData, perPositionCallback, sampler))
+    {
+        return;
+    }
+
     AZStd::vector<AZ::Vector3> inPositions = GenerateInputPositionsFromRegion(queryRegion);
 
     if (inPositions.empty())
@@ -1614,11 +1612,52 @@ void TerrainSystem::QueryRegionInternal(
         return;
     }
 
-    AZStd::vector<bool> terrainExists(inPositions.size());
+    AZStd::vector<bool> terrainExists;
     AZStd::vector<float> heights;
     AZStd::vector<AZ::Vector3> normals;
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights;
 
+    GetQueryDataSynchronous(inPositions, requestedData, sampler, heights, normals, surfaceWeights, terrainExists);
+
+    {
+        AZ_PROFILE_SCOPE(Terrain, "QueryRegionInternal-PerPositionCallbacks");
+
+        AzFramework::SurfaceData::SurfacePoint surfacePoint;
+        for (size_t y = 0, i = 0; y < queryRegion.m_numPointsY; y++)
+        {
+            for (size_t x = 0; x < queryRegion.m_numPointsX; x++)
+            {
+                surfacePoint.m_position = inPositions[i];
+                if (requestedData & TerrainDataMask::Heights)
+                {
+                    surfacePoint.m_position.SetZ(heights[i]);
+                }
+                if (requestedData & TerrainDataMask::Normals)
+                {
+                    surfacePoint.m_normal = AZStd::move(normals[i]);
+                }
+                if (requestedData & TerrainDataMask::SurfaceData)
+                {
+                    surfacePoint.m_surfaceTags = AZStd::move(surfaceWeights[i]);
+                }
+                perPositionCallback(x + xIndexOffset, y + yIndexOffset, surfacePoint, terrainExists[i]);
+                i++;
+            }
+        }
+    }
+}
+
+void TerrainSystem::GetQueryDataSynchronous(
+    const AZStd::span<const AZ::Vector3>& inPositions,
+    TerrainDataMask requestedData,
+    Sampler sampler,
+    AZStd::vector<float>& heights,
+    AZStd::vector<AZ::Vector3>& normals,
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList>& surfaceWeights,
+    AZStd::vector<bool>& terrainExists) const
+{
+    terrainExists.resize(inPositions.size());
+
     // Query normals before heights because the height query produces better results for the terrainExists flag for a given point,
     // so we want to prefer keeping the results from the height query if we end up querying both.
     // (Ideally at some point they will produce identical results)
@@ -1645,33 +1684,194 @@ void TerrainSystem::QueryRegionInternal(
         GetOrderedSurfaceWeightsFromList(
             inPositions, sampler, surfaceWeights, (requestedData & TerrainDataMask::Heights) ? terrainExistsEmpty : terrainExists);
     }
+}
 
+bool TerrainSystem::QueryRegionFromCache(
+    const AzFramework::Terrain::TerrainQueryRegion& queryRegion,
+    size_t xIndexOffset, size_t yIndexOffset,
+    TerrainDataMask requestedData,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+    Sampler sampler) const
+{
+    constexpr int64_t TileSize = TerrainQueryCache::TileSize;
+    const size_t maxTiles = t_queryCacheMaxTiles;
+
+    // Small queries are cheaper to run live than to fill the tiles around them.
+    if ((maxTiles == 0) || ((queryRegion.m_numPointsX * queryRegion.m_numPointsY) < static_cast<size_t>(TileSize * TileSize)))
     {
-        AZ_PROFILE_SCOPE(Terrain, "QueryRegionInternal-PerPositionCallbacks");
+        return false;
+    }
+
+    const AZ::Vector2& stepSize = queryRegion.m_stepSize;
+    if ((stepSize.GetX() <= 0.0f) || (stepSize.GetY() <= 0.0f))
+    {
+        return false;
+    }
+
+    // The region has to start exactly on the lattice of the step size, so that its positions match the cached sample positions.
+    constexpr float MaxSampleIndex = static_cast<float>(1 << 24);
+    const float firstSampleX = roundf(queryRegion.m_startPoint.GetX() / stepSize.GetX());
+    const float firstSampleY = roundf(queryRegion.m_startPoint.GetY() / stepSize.GetY());
+    if ((fabsf(firstSampleX) >= MaxSampleIndex) || (fabsf(firstSampleY) >= MaxSampleIndex) ||
+        ((firstSampleX * stepSize.GetX()) != queryRegion.m_startPoint.GetX()) ||
+        ((firstSampleY * stepSize.GetY()) != queryRegion.m_startPoint.GetY()))
+    {
+        return false;
+    }
+
+    auto getTileIndex = [](int64_t sampleIndex) -> int64_t
+    {
+        return (sampleIndex >= 0) ? (sampleIndex / TileSize) : -((TileSize - 1 - sampleIndex) / TileSize);
+    };
+
+    const int64_t startSampleX = static_cast<int64_t>(firstSampleX);
+    const int64_t startSampleY = static_cast<int64_t>(firstSampleY);
+    const int64_t firstTileX = getTileIndex(startSampleX);
+    const int64_t firstTileY = getTileIndex(startSampleY);
+    const int64_t numTilesX = getTileIndex(startSampleX + aznumeric_cast<int64_t>(queryRegion.m_numPointsX) - 1) - firstTileX + 1;
+    const int64_t numTilesY = getTileIndex(startSampleY + aznumeric_cast<int64_t>(queryRegion.m_numPointsY) - 1) - firstTileY + 1;
+
+    // A region that needs a large part of the cache would mostly evict tiles that other queries are still using.
+    if (static_cast<size_t>(numTilesX * numTilesY) > (maxTiles / 2))
+    {
+        return false;
+    }
+
+    // The tiles generate their positions from the tile start the same way a live query generates them from the region start.
+    // Those only round to the same floats for some region starts, so check every row and column before using the cache.
+    auto matchesTilePositions = [&getTileIndex](float regionStart, int64_t startSample, size_t numPoints, float step)
+    {
+        for (size_t i = 0; i < numPoints; i++)
+        {
+            const int64_t sample = startSample + aznumeric_cast<int64_t>(i);
+            const int64_t tileFirstSample = getTileIndex(sample) * TileSize;
+            const float tileStart = TerrainQueryCache::GetTileStart(tileFirstSample, step);
+            const size_t localSample = aznumeric_cast<size_t>(sample - tileFirstSample);
+            if (aznumeric_cast<float>(tileStart + (localSample * step)) != aznumeric_cast<float>(regionStart + (i * step)))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (!matchesTilePositions(queryRegion.m_startPoint.GetX(), startSampleX, queryRegion.m_numPointsX, stepSize.GetX()) ||
+        !matchesTilePositions(queryRegion.m_startPoint.GetY(), startSampleY, queryRegion.m_numPointsY, stepSize.GetY()))
+    {
+        return false;
+    }
+
+    AZ_PROFILE_SCOPE(Terrain, "QueryRegionFromCache");
+
+    TerrainQueryCache::TileKey tileKey;
+    tileKey.m_stepSize = stepSize;
+    tileKey.m_sampler = sampler;
+    tileKey.m_requestedData =
+        static_cast<uint8_t>(requestedData & (TerrainDataMask::Heights | TerrainDataMask::Normals | TerrainDataMask::SurfaceData));
+
+    // Gather the tiles that the region covers, computing any that aren't cached yet.
+    AZStd::vector<AZStd::shared_ptr<const TerrainQueryCache::Tile>> tiles;
+    tiles.reserve(static_cast<size_t>(numTilesX * numTilesY));
+    for (int64_t tileY = firstTileY; tileY < (firstTileY + numTilesY); tileY++)
+    {
+        for (int64_t tileX = firstTileX; tileX < (firstTileX + numTilesX); tileX++)
+        {
+            tileKey.m_tileX = aznumeric_cast<int32_t>(tileX);
+            tileKey.m_tileY = aznumeric_cast<int32_t>(tileY);
 
+            AZStd::shared_ptr<const TerrainQueryCache::Tile> tile = m_queryCache.FindTile(tileKey);
+            if (!tile)
+            {
+                // Read the generation before computing the tile, so that a tile that overlaps a terrain change doesn't get cached.
+                const AZ::u64 generation = m_queryCache.GetGeneration();
+                tile = BuildQueryCacheTile(tileKey);
+                m_queryCache.AddTile(tileKey, tile, generation, maxTiles);
+            }
+            tiles.emplace_back(AZStd::move(tile));
+        }
+    }
+
+    {
+        AZ_PROFILE_SCOPE(Terrain, "QueryRegionFromCache-PerPositionCallbacks");
+
+        // Call the callbacks in the same order as a live query. The positions are generated the same way as
+        // GenerateInputPositionsFromRegion(), only the data comes from the tiles.
         AzFramework::SurfaceData::SurfacePoint surfacePoint;
-        for (size_t y = 0, i = 0; y < queryRegion.m_numPointsY; y++)
+        for (size_t y = 0; y < queryRegion.m_numPointsY; y++)
         {
+            const int64_t sampleY = startSampleY + aznumeric_cast<int64_t>(y);
+            const int64_t tileRow = getTileIndex(sampleY) - firstTileY;
+            const int64_t localY = sampleY - (getTileIndex(sampleY) * TileSize);
+            const float fy = aznumeric_cast<float>(queryRegion.m_startPoint.GetY() + (y * stepSize.GetY()));
+
             for (size_t x = 0; x < queryRegion.m_numPointsX; x++)
             {
-                surfacePoint.m_position = inPositions[i];
+                const int64_t sampleX = startSampleX + aznumeric_cast<int64_t>(x);
+                const int64_t tileColumn = getTileIndex(sampleX) - firstTileX;
+                const int64_t localX = sampleX - (getTileIndex(sampleX) * TileSize);
+                const float fx = aznumeric_cast<float>(queryRegion.m_startPoint.GetX() + (x * stepSize.GetX()));
+
+                const TerrainQueryCache::Tile& tile = *tiles[static_cast<size_t>((tileRow * numTilesX) + tileColumn)];
+                const size_t sampleIndex = static_cast<size_t>((localY * TileSize) + localX);
+
+                surfacePoint.m_position = AZ::Vector3(fx, fy, 0.0f);
                 if (requestedData & TerrainDataMask::Heights)
                 {
-                    surfacePoint.m_position.SetZ(heights[i]);
+                    surfacePoint.m_position.SetZ(tile.m_heights[sampleIndex]);
                 }
                 if (requestedData & TerrainDataMask::Normals)
                 {
-                    surfacePoint.m_normal = AZStd::move(normals[i]);
+                    surfacePoint.m_normal = tile.m_normals[sampleIndex];
                 }
                 if (requestedData & TerrainDataMask::SurfaceData)
                 {
-                    surfacePoint.m_surfaceTags = AZStd::move(surfaceWeights[i]);
+                    surfacePoint.m_surfaceTags = tile.m_surfaceWeights[sampleIndex];
                 }
-                perPositionCallback(x + xIndexOffset, y + yIndexOffset, surfacePoint, terrainExists[i]);
-                i++;
+                perPositionCallback(x + xIndexOffset, y + yIndexOffset, surfacePoint, tile.m_terrainExists[sampleIndex]);
             }
         }
     }
+
+    return true;
+}
+
+AZStd::shared_ptr<const TerrainQueryCache::Tile> TerrainSystem::BuildQueryCacheTile(const TerrainQueryCache::TileKey& tileKey) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    constexpr int32_t TileSize = TerrainQueryCache::TileSize;
+    const float stepX = tileKey.m_stepSize.GetX();
+    const float stepY = tileKey.m_stepSize.GetY();
+    const float startX = TerrainQueryCache::GetTileStart(static_cast<int64_t>(tileKey.m_tileX) * TileSize, stepX);
+    const float startY = TerrainQueryCache::GetTileStart(static_cast<int64_t>(tileKey.m_tileY) * TileSize, stepY);
+
+    // Generate the positions the same way as GenerateInputPositionsFromRegion() does for a region starting at the tile start.
+    AZStd::vector<AZ::Vector3> inPositions;
+    inPositions.reserve(TileSize * TileSize);
+    for (size_t y = 0; y < static_cast<size_t>(TileSize); y++)
+    {
+        const float fy = aznumeric_cast<float>(startY + (y * stepY));
+        for (size_t x = 0; x < static_cast<size_t>(TileSize); x++)
+        {
+            const float fx = aznumeric_cast<float>(startX + (x * stepX));
+            inPositions.emplace_back(fx, fy, 0.0f);
+        }
+    }
+
+    auto tile = AZStd::make_shared<TerrainQueryCache::Tile>();
+    GetQueryDataSynchronous(
+        inPositions, static_cast<TerrainDataMask>(tileKey.m_requestedData), tileKey.m_sampler, tile->m_heights, tile->m_normals,
+        tile->m_surfaceWeights, tile->m_terrainExists);
+
+    // Interpolated heights and normals use the neighboring points on the query grid, so a change within a couple of grid
+    // points of the tile can still affect its samples.
+    const float margin =
+        2.0f * AZStd::max(m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution);
+    tile->m_dependencyBounds = AZ::Aabb::CreateFromMinMaxValues(
+        inPositions.front().GetX() - margin, inPositions.front().GetY() - margin, 0.0f,
+        inPositions.back().GetX() + margin, inPositions.back().GetY() + margin, 0.0f);
+
+    return tile;
 }
 
 void TerrainSystem::RegisterArea(AZ::EntityId areaId)
@@ -1686,6 +1886,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    m_queryCache.Invalidate(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
     m_cachedAreaBounds.AddAabb(aabb);
@@ -1706,6 +1907,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                m_queryCache.Invalidate(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
 
@@ -1761,6 +1963,10 @@ void TerrainSystem::RefreshRegion(
 {
     m_dirtyRegion.AddAabb(dirtyRegion);
 
+    // Drop any cached query results right away, so that queries made before the change notifications go out already
+    // see the new data.
+    m_queryCache.Invalidate(dirtyRegion);
+
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
 }
@@ -1804,6 +2010,9 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The query resolutions and height bounds affect every cached result.
+        m_queryCache.Clear();
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
@@ -25,6 +25,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainQueryCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 AZ_DECLARE_BUDGET(Terrain);
@@ -211,6 +212,27 @@ namespace Terrain
             AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
             Sampler sampler) const;
 
+        //! Runs a region query using the tiles in the query cache, computing any missing tiles.
+        //! Returns false without calling the callback if the region can't be assembled from cached tiles.
+        bool QueryRegionFromCache(
+            const AzFramework::Terrain::TerrainQueryRegion& queryRegion,
+            size_t xIndexOffset, size_t yIndexOffset,
+            TerrainDataMask requestedData,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampler) const;
+
+        AZStd::shared_ptr<const TerrainQueryCache::Tile> BuildQueryCacheTile(const TerrainQueryCache::TileKey& tileKey) const;
+
+        //! Get the requested data for each input position. Only the vectors for the requested data are resized and filled in.
+        void GetQueryDataSynchronous(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            TerrainDataMask requestedData,
+            Sampler sampler,
+            AZStd::vector<float>& heights,
+            AZStd::vector<AZ::Vector3>& normals,
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList>& surfaceWeights,
+            AZStd::vector<bool>& terrainExists) const;
+
         template<typename VectorType>
         AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> ProcessFromListAsync(
             const AZStd::span<const VectorType>& inPositions,
@@ -314,6 +336,8 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        mutable TerrainQueryCache m_queryCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
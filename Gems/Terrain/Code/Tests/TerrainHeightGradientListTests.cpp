@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzTest/AzTest.h>
 
 #include <Components/TerrainHeightGradientListComponent.h>
@@ -19,6 +20,8 @@
 #include <Tests/Mocks/Terrain/MockTerrainDataRequestBus.h>
 #include <TerrainTestFixtures.h>
 
+AZ_CVAR_EXTERNED(bool, terrain_compiledGradientQueries);
+
 using ::testing::_;
 using ::testing::Mock;
 using ::testing::NiceMock;
@@ -197,3 +200,66 @@ TEST_F(TerrainHeightGradientListComponentTest, TerrainHeightGradientListGetHeigh
         ASSERT_EQ(terrainExists, terrainExistsList[index]);
     }
 }
+
+TEST_F(TerrainHeightGradientListComponentTest, TerrainHeightGradientListCompiledGradientsMatchGradientRequests)
+{
+    // Check that GetHeights returns the same values whether the gradients are queried through the GradientRequestBus
+    // or through compiled gradient evaluation plans.
+
+    auto entity = CreateEntity();
+    AddHeightGradientListToEntity(entity.get());
+    AddRequiredComponentsToEntity(entity.get());
+
+    NiceMock<UnitTest::MockTerrainAreaHeightRequests> heightfieldRequestBus(entity->GetId());
+
+    // Create a deterministic but varying result for our mock gradient.
+    NiceMock<UnitTest::MockGradientRequests> gradientRequests(entity->GetId());
+    ON_CALL(gradientRequests, GetValue)
+        .WillByDefault(
+            [](const GradientSignal::GradientSampleParams& params) -> float
+            {
+                double intpart;
+                return aznumeric_cast<float>(modf(params.m_position.GetX() * params.m_position.GetY(), &intpart));
+            });
+
+    // Setup a mock to provide the encompassing Aabb to the HeightGradientListComponent.
+    const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(1000.0f));
+    NiceMock<UnitTest::MockShapeComponentRequests> mockShapeRequests(entity->GetId());
+    ON_CALL(mockShapeRequests, GetEncompassingAabb).WillByDefault(Return(aabb));
+
+    NiceMock<UnitTest::MockTerrainDataRequests> mockterrainDataRequests;
+    ON_CALL(mockterrainDataRequests, GetTerrainHeightQueryResolution).WillByDefault(Return(1.0f));
+
+    ActivateEntity(entity.get());
+
+    // Ensure the cached values in the HeightGradientListComponent are up to date.
+    LmbrCentral::DependencyNotificationBus::Event(entity->GetId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionChanged);
+
+    // Use a query count that isn't a multiple of the evaluation plan tile size.
+    AZStd::vector<AZ::Vector3> positions;
+    for (float y = 0.0f; y <= 10.0f; y += 0.1f)
+    {
+        for (float x = 0.0f; x <= 10.0f; x += 0.1f)
+        {
+            positions.emplace_back(x, y, 0.0f);
+        }
+    }
+
+    AZStd::vector<AZ::Vector3> expectedPositions(positions);
+    AZStd::vector<bool> expectedTerrainExistsList(positions.size(), false);
+    Terrain::TerrainAreaHeightRequestBus::Event(
+        entity->GetId(), &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, expectedPositions, expectedTerrainExistsList);
+
+    AZStd::vector<AZ::Vector3> compiledPositions(positions);
+    AZStd::vector<bool> compiledTerrainExistsList(positions.size(), false);
+    terrain_compiledGradientQueries = true;
+    Terrain::TerrainAreaHeightRequestBus::Event(
+        entity->GetId(), &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, compiledPositions, compiledTerrainExistsList);
+    terrain_compiledGradientQueries = false;
+
+    for (size_t index = 0; index < positions.size(); index++)
+    {
+        ASSERT_TRUE(expectedPositions[index].IsClose(compiledPositions[index]));
+        ASSERT_EQ(expectedTerrainExistsList[index], compiledTerrainExistsList[index]);
+    }
+}
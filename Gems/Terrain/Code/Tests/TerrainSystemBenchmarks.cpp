@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
@@ -33,6 +34,11 @@
 #include <TerrainTestFixtures.h>
 #include <benchmark/benchmark.h>
 
+namespace Terrain
+{
+    AZ_CVAR_EXTERNED(uint32_t, t_queryCacheMaxTiles);
+}
+
 namespace UnitTest
 {
     using ::testing::NiceMock;
@@ -743,6 +749,58 @@ namespace UnitTest
         ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    // Repeatedly queries the same region with the terrain query cache enabled or disabled.
+    // state.range(0) is the size of the queried region, state.range(1) is 1 to use the cache and 0 to query live,
+    // and state.range(2) is the sampler.
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfacePointsRegionCached)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        const float regionSize = aznumeric_cast<float>(state.range(0));
+        const bool useCache = (state.range(1) != 0);
+        const AzFramework::Terrain::TerrainDataRequests::Sampler sampler =
+            static_cast<AzFramework::Terrain::TerrainDataRequests::Sampler>(state.range(2));
+
+        const float queryResolution = 1.0f;
+        const AZ::Aabb worldBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1024.0f), AZ::Vector3(1024.0f));
+        CreateTestTerrainSystem(worldBounds, queryResolution, 1);
+
+        // Regions that need more than half of the cache are always queried live, so make sure this region fits.
+        const uint32_t tilesPerSide = aznumeric_cast<uint32_t>(regionSize) / Terrain::TerrainQueryCache::TileSize + 1;
+        const uint32_t previousMaxTiles = Terrain::t_queryCacheMaxTiles;
+        Terrain::t_queryCacheMaxTiles = useCache ? (tilesPerSide * tilesPerSide * 2) : 0;
+
+        auto perPositionCallback = []([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+            const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        {
+            benchmark::DoNotOptimize(surfacePoint);
+        };
+
+        const AZ::Aabb queryBounds =
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-regionSize / 2.0f), AZ::Vector3(regionSize / 2.0f));
+        AzFramework::Terrain::TerrainQueryRegion queryRegion =
+            AzFramework::Terrain::TerrainQueryRegion::CreateFromAabbAndStepSize(queryBounds, AZ::Vector2(queryResolution));
+
+        for ([[maybe_unused]] auto stateIterator : state)
+        {
+            AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                &AzFramework::Terrain::TerrainDataRequests::QueryRegion, queryRegion,
+                AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::All, perPositionCallback, sampler);
+        }
+
+        Terrain::t_queryCacheMaxTiles = previousMaxTiles;
+        DestroyTestTerrainSystem();
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfacePointsRegionCached)
+        ->Args({ 256, 0, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) })
+        ->Args({ 256, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) })
+        ->Args({ 512, 0, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) })
+        ->Args({ 512, 0, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfacePointsRegionAsync)(benchmark::State& state)
     {
         // Run the benchmark
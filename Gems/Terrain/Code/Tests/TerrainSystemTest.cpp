@@ -1320,6 +1320,110 @@ namespace UnitTest
             AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
     }
 
+    TEST_F(TerrainSystemTest, TerrainProcessHeightsFromRegionUsesCacheUntilRegionIsRefreshed)
+    {
+        // Region queries that are large enough get served from the terrain query cache. Verify that repeating a query doesn't
+        // regenerate the heights, and that refreshing the region makes the next query pick up the new heights.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -5.0f, 64.0f, 64.0f, 15.0f);
+        float heightOffset = 1.0f;
+        size_t numHeightsGenerated = 0;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset, &numHeightsGenerated](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(heightOffset);
+                terrainExists = true;
+                numHeightsGenerated++;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Query a 64 x 64 region that starts on the query grid, so that it lines up with the cached tiles.
+        const AzFramework::Terrain::TerrainQueryRegion queryRegion(AZ::Vector3(-32.0f, -32.0f, 0.0f), 64, 64, AZ::Vector2(1.0f));
+
+        float expectedHeight = heightOffset;
+        size_t numPointsQueried = 0;
+        auto perPositionCallback = [&expectedHeight, &numPointsQueried](size_t xIndex, size_t yIndex,
+            const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            EXPECT_EQ(surfacePoint.m_position.GetX(), -32.0f + aznumeric_cast<float>(xIndex));
+            EXPECT_EQ(surfacePoint.m_position.GetY(), -32.0f + aznumeric_cast<float>(yIndex));
+            EXPECT_NEAR(surfacePoint.m_position.GetZ(), expectedHeight, 0.0001f);
+            EXPECT_TRUE(terrainExists);
+            numPointsQueried++;
+        };
+
+        terrainSystem->QueryRegion(
+            queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        EXPECT_EQ(numPointsQueried, 64 * 64);
+        EXPECT_GT(numHeightsGenerated, 0);
+
+        // Repeating the query should reuse the cached heights without generating any new ones.
+        const size_t numHeightsAfterFirstQuery = numHeightsGenerated;
+        numPointsQueried = 0;
+        terrainSystem->QueryRegion(
+            queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        EXPECT_EQ(numPointsQueried, 64 * 64);
+        EXPECT_EQ(numHeightsGenerated, numHeightsAfterFirstQuery);
+
+        // Change the heights and refresh the region. The next query should return the new heights.
+        heightOffset = 5.0f;
+        expectedHeight = heightOffset;
+        terrainSystem->RefreshRegion(spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+
+        numPointsQueried = 0;
+        terrainSystem->QueryRegion(
+            queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        EXPECT_EQ(numPointsQueried, 64 * 64);
+        EXPECT_GT(numHeightsGenerated, numHeightsAfterFirstQuery);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainProcessHeightsFromRegionMatchesLiveQueryPositions)
+    {
+        // Cached and live region queries must evaluate the terrain at the positions they report, even for step sizes that
+        // aren't exactly representable. The heights depend on X with no rounding, so any position mismatch changes them.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -5.0f, 64.0f, 64.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() * 0.25f);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Start the region on the query grid so that it's eligible for the cache.
+        const float stepSize = 0.3f;
+        const float start = static_cast<float>(-32) * stepSize;
+        const AzFramework::Terrain::TerrainQueryRegion queryRegion(AZ::Vector3(start, start, 0.0f), 64, 64, AZ::Vector2(stepSize));
+
+        size_t numPointsQueried = 0;
+        auto perPositionCallback = [&numPointsQueried](
+            [[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+            const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            EXPECT_EQ(surfacePoint.m_position.GetZ(), surfacePoint.m_position.GetX() * 0.25f);
+            EXPECT_TRUE(terrainExists);
+            numPointsQueried++;
+        };
+
+        // Query twice so that the second query can be served from any tiles the first one cached.
+        for (int queryCount = 0; queryCount < 2; queryCount++)
+        {
+            numPointsQueried = 0;
+            terrainSystem->QueryRegion(
+                queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback,
+                AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+            EXPECT_EQ(numPointsQueried, 64 * 64);
+        }
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessSurfaceWeightsFromRegion)
     {
         const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
@@ -22,6 +22,8 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -127,6 +129,7 @@ namespace Vegetation
     const int AreaSystemConfig::s_maxViewRectangleSize = 128;
     const int AreaSystemConfig::s_maxSectorDensity = 64;
     const int AreaSystemConfig::s_maxSectorSizeInMeters = 1024;
+    const int AreaSystemConfig::s_maxSectorBatchSize = 64;
     const int64_t AreaSystemConfig::s_maxVegetationInstances = 2 * 1024 * 1024;
     const int AreaSystemConfig::s_maxInstancesPerMeter = 16;
 
@@ -143,6 +146,7 @@ namespace Vegetation
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("SectorBatchSize", &AreaSystemConfig::m_sectorBatchSize)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -173,6 +177,9 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_sectorBatchSize, "Sector Batch Size", "The number of sectors whose surface points are gathered in parallel before they get filled. 1 processes one sector at a time.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, s_maxSectorBatchSize)
                 ;
             }
         }
@@ -186,6 +193,7 @@ namespace Vegetation
                 ->Property("sectorDensity", BehaviorValueProperty(&AreaSystemConfig::m_sectorDensity))
                 ->Property("sectorSizeInMeters", BehaviorValueProperty(&AreaSystemConfig::m_sectorSizeInMeters))
                 ->Property("threadProcessingIntervalMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingIntervalMs))
+                ->Property("sectorBatchSize", BehaviorValueProperty(&AreaSystemConfig::m_sectorBatchSize))
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
@@ -779,6 +787,7 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_sectorBatchSize = m_configuration.m_sectorBatchSize;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -1082,6 +1091,13 @@ namespace Vegetation
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
+        return InsertSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::InsertSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
@@ -1776,6 +1792,14 @@ namespace Vegetation
             }
         }
 
+        // Create / update a whole batch of sectors at once if the batch mode is enabled.
+        const size_t maxBatchSize = aznumeric_cast<size_t>(AZStd::max(m_cachedMainThreadData.m_sectorBatchSize, 1));
+        if ((maxBatchSize > 1) && (m_updateWorkList.size() > 1))
+        {
+            UpdateSectorBatch(threadData, vegTasks, maxBatchSize);
+            return true;
+        }
+
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
@@ -1827,4 +1851,119 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks, size_t maxBatchSize)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        // Pull the closest sectors off the back of the work list.  Creates stop early once they would grow the rolling window
+        // past the view rectangle while there are still deletes pending, since UpdateOneSector() gives those deletes priority.
+        m_sectorBatch.resize(AZStd::min(maxBatchSize, m_updateWorkList.size()));
+        size_t batchSize = 0;
+        {
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+
+            size_t rollingWindowSize = vegTasks->m_sectorRollingWindow.size();
+            while ((batchSize < m_sectorBatch.size()) && !m_updateWorkList.empty())
+            {
+                const auto& updateEntry = m_updateWorkList.back();
+                if (updateEntry.second == UpdateMode::Create)
+                {
+                    if ((batchSize > 0) && !m_deleteWorkList.empty() && (rollingWindowSize >= m_viewRectSectorCount))
+                    {
+                        break;
+                    }
+                    ++rollingWindowSize;
+                }
+
+                SectorBatchEntry& batchEntry = m_sectorBatch[batchSize++];
+                batchEntry.m_mode = updateEntry.second;
+                batchEntry.m_sectorInfo.m_id = updateEntry.first;
+                batchEntry.m_sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(updateEntry.first, sectorSizeInMeters);
+                m_updateWorkList.pop_back();
+            }
+        }
+
+        // Gathering the surface points doesn't touch the rolling window or any vegetation area, so it can run in parallel.
+        // The surface data system only takes shared locks while it queries the surface providers and modifiers.
+        auto gatherSectorPoints = [vegTasks, sectorDensity, sectorSizeInMeters, sectorPointSnapMode](SectorBatchEntry& batchEntry)
+        {
+            vegTasks->UpdateSectorPoints(batchEntry.m_sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        };
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext && (batchSize > 1))
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t batchIndex = 0; batchIndex < batchSize; ++batchIndex)
+            {
+                SectorBatchEntry& batchEntry = m_sectorBatch[batchIndex];
+                if (batchEntry.m_mode != UpdateMode::Fill)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([&gatherSectorPoints, &batchEntry]()
+                        {
+                            gatherSectorPoints(batchEntry);
+                        }, true);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (size_t batchIndex = 0; batchIndex < batchSize; ++batchIndex)
+            {
+                if (m_sectorBatch[batchIndex].m_mode != UpdateMode::Fill)
+                {
+                    gatherSectorPoints(m_sectorBatch[batchIndex]);
+                }
+            }
+        }
+
+        // Claims are always resolved serially, closest sector first, and within each sector in area priority order.
+        // Area claim logic isn't reentrant, so this keeps the placement identical to processing one sector at a time.
+        for (size_t batchIndex = 0; batchIndex < batchSize; ++batchIndex)
+        {
+            SectorBatchEntry& batchEntry = m_sectorBatch[batchIndex];
+
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+
+            switch (batchEntry.m_mode)
+            {
+                case UpdateMode::RebuildSurfaceCacheAndFill:
+                {
+                    auto sectorInfo = vegTasks->GetSector(batchEntry.m_sectorInfo.m_id);
+                    AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+                    sectorInfo->m_baseContext.m_masks = AZStd::move(batchEntry.m_sectorInfo.m_baseContext.m_masks);
+                    sectorInfo->m_baseContext.m_availablePoints.swap(batchEntry.m_sectorInfo.m_baseContext.m_availablePoints);
+                    vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                }
+                break;
+
+                case UpdateMode::Fill:
+                {
+                    auto sectorInfo = vegTasks->GetSector(batchEntry.m_sectorInfo.m_id);
+                    AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+                    vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                }
+                break;
+
+                case UpdateMode::Create:
+                {
+                    AZ_Assert(!vegTasks->GetSector(batchEntry.m_sectorInfo.m_id), "Sector update mode is 'Create' but sector already exists");
+                    auto sectorInfo = vegTasks->InsertSector(AZStd::move(batchEntry.m_sectorInfo));
+                    vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+
+                    // The moved-from entry gets reused by the next batch.
+                    batchEntry.m_sectorInfo = {};
+                }
+                break;
+            }
+        }
+    }
+
 }
@@ -49,7 +49,8 @@ namespace Vegetation
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
-                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                   && m_sectorBatchSize == other.m_sectorBatchSize;
         }
 
         int m_viewRectangleSize = 13;
@@ -58,8 +59,12 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        //! Number of sectors processed together by the vegetation thread. When this is larger than 1, the surface points
+        //! for the whole batch are gathered in parallel on the job system before the sectors are filled in priority order.
+        int m_sectorBatchSize = 1;
     private:
         static const int s_maxViewRectangleSize;
+        static const int s_maxSectorBatchSize;
         static const int s_maxSectorDensity;
         static const int s_maxSectorSizeInMeters;
 
@@ -271,6 +276,7 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_sectorBatchSize = 1;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -292,6 +298,8 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose points were already gathered to the rolling window.
+            SectorInfo* InsertSector(SectorInfo&& sectorInfo);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
@@ -430,6 +438,7 @@ namespace Vegetation
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks, size_t maxBatchSize);
 
             enum class UpdateMode
             {
@@ -438,6 +447,14 @@ namespace Vegetation
                 Fill
             };
 
+            // A sector pulled off the update work list by UpdateSectorBatch().  Sectors that need new surface points have them
+            // gathered into m_sectorInfo in parallel before the batch is applied to the rolling window.
+            struct SectorBatchEntry
+            {
+                UpdateMode m_mode = UpdateMode::Fill;
+                SectorInfo m_sectorInfo;
+            };
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
@@ -455,6 +472,9 @@ namespace Vegetation
             // thread without requiring mutexes.
             CachedMainThreadData m_cachedMainThreadData;
 
+            // The sectors currently being processed by UpdateSectorBatch().  This is kept persistent to avoid reallocating
+            // the sector point lists for every batch.
+            AZStd::vector<SectorBatchEntry> m_sectorBatch;
         };
 
         bool ApplyPendingConfigChanges();
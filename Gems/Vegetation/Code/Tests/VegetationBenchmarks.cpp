@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/Components/CameraBus.h>
+
+#include <SurfaceData/Components/SurfaceDataSystemComponent.h>
+#include <SurfaceData/SurfaceDataProviderRequestBus.h>
+#include <SurfaceData/SurfaceDataSystemRequestBus.h>
+#include <Vegetation/Ebuses/AreaRequestBus.h>
+#include <Vegetation/Ebuses/AreaSystemRequestBus.h>
+#include <Vegetation/Ebuses/SystemConfigurationBus.h>
+#include <Vegetation/InstanceData.h>
+#include <VegetationModule.h>
+#include <AreaSystemComponent.h>
+
+namespace UnitTest
+{
+    // Starts up the job system and the Asset Manager that the vegetation system components depend on.
+    class VegetationBenchmarkDependenciesComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(VegetationBenchmarkDependenciesComponent, "{5B0C4C5C-8E0A-4F0E-9A53-2B6E3C9F7D41}");
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serialize->Class<VegetationBenchmarkDependenciesComponent, AZ::Component>()->Version(0);
+            }
+        }
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("VegetationBenchmarkDependenciesService"));
+        }
+
+    protected:
+        void Activate() override
+        {
+            // Use a worker per core so that the sector batches can actually run in parallel.
+            AZ::JobManagerDesc jobDesc;
+            const unsigned int numWorkerThreads = AZ::GetMax(AZStd::thread::hardware_concurrency(), 2u);
+            for (unsigned int workerIndex = 0; workerIndex < numWorkerThreads; ++workerIndex)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            AZ::Data::AssetManager::Descriptor descriptor;
+            AZ::Data::AssetManager::Create(descriptor);
+        }
+
+        void Deactivate() override
+        {
+            AZ::Data::AssetManager::Destroy();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+        }
+
+        AZ::JobManager* m_jobManager{ nullptr };
+        AZ::JobContext* m_jobContext{ nullptr };
+    };
+
+    class VegetationBenchmarkDependenciesModule
+        : public AZ::Module
+    {
+    public:
+        AZ_RTTI(VegetationBenchmarkDependenciesModule, "{0E5B8F0C-5D67-4C6B-B2F4-87A4A3C1E0D9}", AZ::Module);
+        AZ_CLASS_ALLOCATOR(VegetationBenchmarkDependenciesModule, AZ::SystemAllocator);
+
+        VegetationBenchmarkDependenciesModule()
+        {
+            m_descriptors.insert(m_descriptors.end(), {
+                VegetationBenchmarkDependenciesComponent::CreateDescriptor(),
+                SurfaceData::SurfaceDataSystemComponent::CreateDescriptor()
+                });
+        }
+
+        AZ::ComponentTypeList GetRequiredSystemComponents() const override
+        {
+            return AZ::ComponentTypeList{
+                azrtti_typeid<VegetationBenchmarkDependenciesComponent>(),
+                azrtti_typeid<SurfaceData::SurfaceDataSystemComponent>()
+            };
+        }
+    };
+
+    // An infinite, gently rolling surface so that every sector point query produces exactly one surface point.
+    class BenchmarkSurfaceProvider
+        : public SurfaceData::SurfaceDataProviderRequestBus::Handler
+    {
+    public:
+        BenchmarkSurfaceProvider()
+        {
+            m_weights.AssignSurfaceTagWeights(SurfaceData::SurfaceTagVector{ SurfaceData::SurfaceTag("benchmark") }, 1.0f);
+
+            SurfaceData::SurfaceDataRegistryEntry registryEntry;
+            registryEntry.m_entityId = m_entityId;
+            registryEntry.m_tags.emplace_back("benchmark");
+            registryEntry.m_maxPointsCreatedPerInput = 1;
+            m_providerHandle = AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->RegisterSurfaceDataProvider(registryEntry);
+            SurfaceData::SurfaceDataProviderRequestBus::Handler::BusConnect(m_providerHandle);
+        }
+
+        ~BenchmarkSurfaceProvider() override
+        {
+            SurfaceData::SurfaceDataProviderRequestBus::Handler::BusDisconnect();
+            AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->UnregisterSurfaceDataProvider(m_providerHandle);
+        }
+
+        void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            const float height = 4.0f * sinf(inPosition.GetX() * 0.05f) * cosf(inPosition.GetY() * 0.05f);
+            surfacePointList.AddSurfacePoint(
+                m_entityId, inPosition, AZ::Vector3(inPosition.GetX(), inPosition.GetY(), height), AZ::Vector3::CreateAxisZ(), m_weights);
+        }
+
+    private:
+        AZ::EntityId m_entityId{ 0x5EC70B };
+        SurfaceData::SurfaceDataRegistryHandle m_providerHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+        SurfaceData::SurfaceTagWeights m_weights;
+    };
+
+    // A dense vegetation area that claims every point it's given, so that the benchmark measures the area system itself.
+    class BenchmarkDenseArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+    public:
+        BenchmarkDenseArea()
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_entityId);
+            Vegetation::AreaSystemRequestBus::Broadcast(
+                &Vegetation::AreaSystemRequestBus::Events::RegisterArea, m_entityId, 0, 0,
+                AZ::Aabb::CreateFromMinMax(AZ::Vector3(-AZ::Constants::MaxFloatBeforePrecisionLoss), AZ::Vector3(AZ::Constants::MaxFloatBeforePrecisionLoss)));
+        }
+
+        ~BenchmarkDenseArea() override
+        {
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::UnregisterArea, m_entityId);
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            Vegetation::InstanceData instanceData;
+            instanceData.m_id = m_entityId;
+            for (const auto& point : context.m_availablePoints)
+            {
+                instanceData.m_position = point.m_position;
+                instanceData.m_normal = point.m_normal;
+                if (!context.m_existedCallback(point, instanceData))
+                {
+                    context.m_createdCallback(point, instanceData);
+                }
+            }
+            context.m_availablePoints.clear();
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+
+    private:
+        AZ::EntityId m_entityId{ 0xA4EA };
+    };
+
+    // Provides the active camera position that the area system uses to center its view rectangle.
+    class BenchmarkCamera
+        : public Camera::CameraSystemRequestBus::Handler
+        , public AZ::TransformBus::Handler
+    {
+    public:
+        BenchmarkCamera()
+        {
+            Camera::CameraSystemRequestBus::Handler::BusConnect();
+            AZ::TransformBus::Handler::BusConnect(m_entityId);
+        }
+
+        ~BenchmarkCamera() override
+        {
+            AZ::TransformBus::Handler::BusDisconnect();
+            Camera::CameraSystemRequestBus::Handler::BusDisconnect();
+        }
+
+        void SetPosition(const AZ::Vector3& position)
+        {
+            m_worldTM.SetTranslation(position);
+        }
+
+        // CameraSystemRequestBus
+        AZ::EntityId GetActiveCamera() override
+        {
+            return m_entityId;
+        }
+
+        // TransformBus
+        void BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler&) override {}
+        void BindParentChangedEventHandler(AZ::ParentChangedEvent::Handler&) override {}
+        void BindChildChangedEventHandler(AZ::ChildChangedEvent::Handler&) override {}
+        void NotifyChildChangedEvent(AZ::ChildChangeType, AZ::EntityId) override {}
+        const AZ::Transform& GetLocalTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        AZ::Vector3 GetWorldTranslation() override { return m_worldTM.GetTranslation(); }
+        bool IsStaticTransform() override { return false; }
+
+    private:
+        AZ::EntityId m_entityId{ 0xCA3E7A };
+        AZ::Transform m_worldTM = AZ::Transform::CreateIdentity();
+    };
+
+    class VegetationAreaSystemBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr int ViewRectangleSize = 13;
+        static constexpr int SectorDensity = 20;
+        static constexpr int SectorSizeInMeters = 16;
+
+        void internalSetUp()
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            AZ::ComponentApplication::StartupParameters appStartup;
+            appStartup.m_loadSettingsRegistry = false;
+            appStartup.m_createStaticModulesCallback = [](AZStd::vector<AZ::Module*>& modules)
+            {
+                modules.emplace_back(new VegetationBenchmarkDependenciesModule);
+                modules.emplace_back(new Vegetation::VegetationModule);
+            };
+
+            m_systemEntity = m_application.Create(appDesc, appStartup);
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            m_surfaceProvider = AZStd::make_unique<BenchmarkSurfaceProvider>();
+            m_area = AZStd::make_unique<BenchmarkDenseArea>();
+            m_camera = AZStd::make_unique<BenchmarkCamera>();
+            m_cameraSectorX = 0;
+        }
+
+        void internalTearDown()
+        {
+            m_camera.reset();
+            m_area.reset();
+            m_surfaceProvider.reset();
+
+            m_systemEntity->Deactivate();
+            m_application.Destroy();
+            m_systemEntity = nullptr;
+        }
+
+        void SetSectorBatchSize(int sectorBatchSize)
+        {
+            Vegetation::AreaSystemConfig config;
+            config.m_viewRectangleSize = ViewRectangleSize;
+            config.m_sectorDensity = SectorDensity;
+            config.m_sectorSizeInMeters = SectorSizeInMeters;
+            config.m_threadProcessingIntervalMs = 0;
+            config.m_sectorBatchSize = sectorBatchSize;
+            Vegetation::SystemConfigurationRequestBus::Broadcast(&Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+        }
+
+        // Moves the camera so that the view rectangle starts at the given sector column.
+        void MoveCameraToSector(int sectorX)
+        {
+            m_cameraSectorX = sectorX;
+            const float halfViewSize = aznumeric_cast<float>(ViewRectangleSize >> 1);
+            const float cameraX = (sectorX + 0.5f + halfViewSize) * SectorSizeInMeters;
+            const float cameraY = (0.5f + halfViewSize) * SectorSizeInMeters;
+            m_camera->SetPosition(AZ::Vector3(cameraX, cameraY, 0.0f));
+        }
+
+        // Ticks the vegetation system until every point in the view rectangle has been claimed.
+        void TickUntilPopulated()
+        {
+            const float pointSpacing = aznumeric_cast<float>(SectorSizeInMeters) / SectorDensity;
+            const AZ::Vector3 viewMin(aznumeric_cast<float>(m_cameraSectorX * SectorSizeInMeters), 0.0f, -AZ::Constants::MaxFloatBeforePrecisionLoss);
+            const AZ::Vector3 viewMax(
+                viewMin.GetX() + ViewRectangleSize * SectorSizeInMeters - pointSpacing * 0.5f,
+                ViewRectangleSize * SectorSizeInMeters - pointSpacing * 0.5f,
+                AZ::Constants::MaxFloatBeforePrecisionLoss);
+            const AZ::Aabb viewBounds = AZ::Aabb::CreateFromMinMax(viewMin, viewMax);
+            const size_t expectedInstanceCount = static_cast<size_t>(ViewRectangleSize * SectorDensity) * (ViewRectangleSize * SectorDensity);
+
+            size_t instanceCount = 0;
+            while (instanceCount < expectedInstanceCount)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+                AZStd::this_thread::yield();
+
+                Vegetation::AreaSystemRequestBus::BroadcastResult(
+                    instanceCount, &Vegetation::AreaSystemRequestBus::Events::GetInstanceCountInAabb, viewBounds);
+            }
+        }
+
+    protected:
+        void SetUp([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+        void SetUp([[maybe_unused]] benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        AZ::ComponentApplication m_application;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::unique_ptr<BenchmarkSurfaceProvider> m_surfaceProvider;
+        AZStd::unique_ptr<BenchmarkDenseArea> m_area;
+        AZStd::unique_ptr<BenchmarkCamera> m_camera;
+        int m_cameraSectorX = 0;
+    };
+
+    // Moves the camera through a dense area one sector column at a time and waits for the newly visible sectors to fill.
+    // The argument is the sector batch size, where 1 is the original one-sector-at-a-time processing.
+    BENCHMARK_DEFINE_F(VegetationAreaSystemBenchmark, BM_CameraSweep)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        constexpr int StepsPerIteration = 8;
+
+        SetSectorBatchSize(aznumeric_cast<int>(state.range(0)));
+        MoveCameraToSector(0);
+        TickUntilPopulated();
+
+        int64_t sectorsPopulated = 0;
+        double totalTimeToPopulateMs = 0.0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int step = 0; step < StepsPerIteration; ++step)
+            {
+                const auto startTime = AZStd::chrono::steady_clock::now();
+                MoveCameraToSector(m_cameraSectorX + 1);
+                TickUntilPopulated();
+                const auto endTime = AZStd::chrono::steady_clock::now();
+
+                totalTimeToPopulateMs += AZStd::chrono::duration<double, AZStd::milli>(endTime - startTime).count();
+                sectorsPopulated += ViewRectangleSize;
+            }
+        }
+
+        state.counters["SectorsPerSecond"] = benchmark::Counter(aznumeric_cast<double>(sectorsPopulated), benchmark::Counter::kIsRate);
+        state.counters["TimeToPopulateMs"] = totalTimeToPopulateMs / AZ::GetMax(aznumeric_cast<double>(state.iterations() * StepsPerIteration), 1.0);
+    }
+
+    BENCHMARK_REGISTER_F(VegetationAreaSystemBenchmark, BM_CameraSweep)
+        ->Arg(1)
+        ->Arg(4)
+        ->Arg(16)
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime();
+}
+
+#endif
@@ -8,6 +8,7 @@
 
 set(FILES
     Tests/VegetationMocks.h
+    Tests/VegetationBenchmarks.cpp
     Tests/VegetationComponentOperationTests.cpp
     Tests/VegetationComponentModifierTests.cpp
     Tests/VegetationComponentDescriptorTests.cpp